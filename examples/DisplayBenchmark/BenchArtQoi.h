@@ -0,0 +1,146 @@
+// Generated by tools/imageconvert.py from bench_art.png (QOI). Do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t kBenchArtQoi[] = {
+    0x71, 0x6F, 0x69, 0x66, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0xFE, 0x10,
+    0x20, 0x40, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD, 0xF8,
+    0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xC8, 0xB0,
+    0x94, 0xFE, 0x9E, 0xA2, 0xB7, 0xFE, 0xDD, 0xDF, 0xE6, 0xB9, 0xA2, 0x56, 0x84, 0x7E, 0xFE, 0x95,
+    0x9A, 0xB1, 0xFE, 0x37, 0x3F, 0x6B, 0x37, 0xC2, 0x0E, 0x3A, 0x31, 0x04, 0x3C, 0x3F, 0xFE, 0x96,
+    0x9A, 0xB1, 0x02, 0x37, 0xC1, 0xFE, 0xC4, 0xC7, 0xD4, 0xFE, 0xFF, 0xFF, 0xFF, 0x91, 0x7B, 0x37,
+    0xC5, 0xA7, 0x87, 0xFE, 0x7E, 0x83, 0xA0, 0xFE, 0xD7, 0xD9, 0xE2, 0x26, 0xC0, 0xFE, 0x8C, 0x91,
+    0xAA, 0x37, 0xC2, 0xBF, 0x91, 0xFE, 0xA4, 0xA8, 0xBC, 0xFE, 0xE4, 0xE5, 0xEB, 0xB5, 0x93, 0x8E,
+    0x7C, 0xFE, 0xB5, 0xB8, 0xC8, 0xFE, 0x4B, 0x52, 0x7A, 0x37, 0xC2, 0xFE, 0x6E, 0x74, 0x94, 0xFE,
+    0xD3, 0xD5, 0xDF, 0xFE, 0xF8, 0xF9, 0xFA, 0x9B, 0x89, 0xFE, 0xC0, 0xC3, 0xD1, 0xFE, 0x50, 0x58,
+    0x7E, 0x37, 0xCA, 0xAC, 0x85, 0x0D, 0xFE, 0xE3, 0xE4, 0xEA, 0x04, 0x0C, 0x25, 0xFE, 0x87, 0x8C,
+    0xA6, 0x37, 0xC2, 0xFE, 0x6E, 0x74, 0x94, 0x30, 0xFE, 0xF8, 0xF9, 0xFA, 0x0C, 0x3B, 0xFE, 0x50,
+    0x58, 0x7E, 0x37, 0xD3, 0xA3, 0x9A, 0xC7, 0xBA, 0x92, 0xFE, 0xE9, 0xEA, 0xEF, 0x26, 0xFE, 0xAB,
+    0xAE, 0xC1, 0xFE, 0x3F, 0x46, 0x73, 0xA5, 0x76, 0xFE, 0xBC, 0xBE, 0xCE, 0x26, 0xFE, 0xDE, 0xDF,
+    0xE7, 0x35, 0x92, 0x7B, 0xC0, 0x14, 0x0B, 0x26, 0x23, 0xFE, 0x3F, 0x46, 0x73, 0x2F, 0x01, 0x26,
+    0x82, 0x6F, 0xFE, 0x40, 0x48, 0x74, 0x90, 0x8C, 0xC0, 0xFE, 0xC5, 0xC8, 0xD5, 0x26, 0x91, 0x8C,
+    0x35, 0xC5, 0xFE, 0x80, 0x84, 0xA2, 0xFE, 0xAF, 0xB3, 0xC5, 0xFE, 0x5F, 0x65, 0x8A, 0x26, 0xC0,
+    0xFE, 0x8E, 0x93, 0xAD, 0x35, 0xC2, 0xFE, 0xBD, 0xC0, 0xCF, 0xFE, 0x7B, 0x80, 0x9E, 0xFE, 0x45,
+    0x4C, 0x77, 0x2F, 0xFE, 0xC8, 0xCA, 0xD7, 0x26, 0x21, 0x09, 0x35, 0xC0, 0xFE, 0x77, 0x7D, 0x9C,
+    0xFE, 0xFE, 0xFE, 0xFE, 0x2D, 0xFE, 0x4A, 0x51, 0x7B, 0xBE, 0xA1, 0xFE, 0xFD, 0xFD, 0xFD, 0x97,
+    0x8B, 0xFE, 0x4D, 0x54, 0x7D, 0x35, 0xC9, 0xFE, 0xBB, 0xBD, 0xCD, 0x26, 0x3B, 0xFE, 0x43, 0x4A,
+    0x76, 0x11, 0xFE, 0xFC, 0xFC, 0xFD, 0x26, 0xFE, 0x83, 0x88, 0xA4, 0x35, 0xC0, 0x0F, 0x17, 0x2D,
+    0x05, 0x1C, 0x08, 0x16, 0x2B, 0x35, 0xD2, 0xA3, 0x9A, 0xC7, 0xFE, 0xCA, 0xCC, 0xD9, 0x26, 0x8A,
+    0x8E, 0xFE, 0x36, 0x3D, 0x6F, 0x33, 0xC0, 0xAA, 0x85, 0xFE, 0xF6, 0xF7, 0xF9, 0x26, 0xFE, 0xB3,
+    0xB5, 0xC8, 0x33, 0xC0, 0x3E, 0x26, 0x06, 0x11, 0x33, 0xC0, 0x34, 0x39, 0x26, 0xFE, 0xB7, 0xB9,
+    0xCB, 0x33, 0xC0, 0xFE, 0xC6, 0xC8, 0xD6, 0x26, 0x21, 0x33, 0xC7, 0xA6, 0x87, 0x26, 0xC0, 0xFE,
+    0x90, 0x94, 0xAF, 0x33, 0xC6, 0xFE, 0x67, 0x6C, 0x92, 0x26, 0xC0, 0xFE, 0x80, 0x85, 0xA4, 0x33,
+    0x11, 0xFE, 0xE9, 0xE9, 0xEF, 0x26, 0xFE, 0x98, 0x9C, 0xB5, 0x33, 0xC0, 0xFE, 0xCF, 0xD1, 0xDD,
+    0x26, 0xFE, 0xB8, 0xBB, 0xCC, 0x33, 0xFE, 0x72, 0x77, 0x9A, 0x26, 0xC0, 0xFE, 0x6A, 0x6F, 0x94,
+    0x33, 0xFE, 0x66, 0x6B, 0x91, 0x17, 0x26, 0xFE, 0x77, 0x7C, 0x9D, 0x33, 0xFE, 0xE6, 0xE6, 0xED,
+    0x26, 0xFE, 0xAD, 0xB0, 0xC4, 0x33, 0xC0, 0xFE, 0xE7, 0xE8, 0xEE, 0x26, 0xFE, 0xAF, 0xB2, 0xC6,
+    0x33, 0xA2, 0x88, 0x06, 0xB6, 0x82, 0x3C, 0x33, 0xC0, 0x02, 0x26, 0x18, 0x33, 0xD2, 0xA3, 0x9A,
+    0xC6, 0xB4, 0x82, 0x26, 0xC0, 0xFE, 0xAB, 0xAE, 0xC4, 0x31, 0xC2, 0xFE, 0xC0, 0xC2, 0xD2, 0x26,
+    0x99, 0x8A, 0xFE, 0x3D, 0x43, 0x76, 0xAF, 0x94, 0x26, 0xC0, 0x38, 0x31, 0xC2, 0xFE, 0xC0, 0xC2,
+    0xD2, 0x26, 0x9B, 0x89, 0xFE, 0x3F, 0x45, 0x77, 0x31, 0xFE, 0xC8, 0xC9, 0xD8, 0x26, 0x92, 0x7B,
+    0x31, 0xC7, 0xA6, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xC0, 0xFE, 0x93, 0x96, 0xB2, 0x31, 0xC6, 0xFE,
+    0x7D, 0x81, 0xA3, 0xFE, 0xFF, 0xFF, 0xFF, 0xC0, 0xFE, 0x87, 0x8A, 0xAA, 0x31, 0xFE, 0x5D, 0x62,
+    0x8C, 0x26, 0xC0, 0xFE, 0x7E, 0x82, 0xA4, 0x31, 0xC0, 0xFE, 0xB4, 0xB6, 0xCA, 0x26, 0x92, 0x8C,
+    0x31, 0xC0, 0xFE, 0xAF, 0xB1, 0xC6, 0x26, 0x88, 0x7E, 0xFE, 0x4B, 0x50, 0x7F, 0xFE, 0xE4, 0xE5,
+    0xEC, 0x26, 0xFE, 0xB4, 0xB6, 0xCA, 0x31, 0xC0, 0xFE, 0xA4, 0xA6, 0xBE, 0x26, 0xFE, 0xDF, 0xE0,
+    0xE8, 0xFE, 0x4A, 0x4F, 0x7F, 0xBB, 0x80, 0xFE, 0xFD, 0xFD, 0xFD, 0x00, 0xFE, 0x6F, 0x74, 0x99,
+    0x31, 0xFE, 0x5D, 0x62, 0x8C, 0x26, 0xC0, 0xFE, 0x7E, 0x82, 0xA4, 0x31, 0xC0, 0x25, 0x26, 0x30,
+    0x31, 0xD2, 0xA3, 0x9A, 0xC6, 0xFE, 0x6E, 0x72, 0x9A, 0x26, 0xC0, 0xFE, 0x98, 0x9A, 0xB7, 0xFE,
+    0x3C, 0x41, 0x77, 0xC2, 0xFE, 0xAB, 0xAD, 0xC4, 0x26, 0xC0, 0xFE, 0x5A, 0x5E, 0x8C, 0xB4, 0x82,
+    0x26, 0xC0, 0x00, 0xFE, 0x3C, 0x41, 0x77, 0xC2, 0x33, 0x26, 0xC0, 0xFE, 0x5B, 0x60, 0x8D, 0x2F,
+    0xFE, 0xC9, 0xCA, 0xD9, 0x26, 0x92, 0x7C, 0x2F, 0xC7, 0xA6, 0x86, 0x26, 0xC0, 0xFE, 0x95, 0x97,
+    0xB5, 0x2F, 0xC5, 0xA7, 0x86, 0xFE, 0xDA, 0xDB, 0xE5, 0x26, 0x0B, 0xFE, 0x51, 0x55, 0x85, 0x2F,
+    0xFE, 0x76, 0x7A, 0xA0, 0x26, 0xC0, 0xFE, 0x77, 0x7A, 0xA0, 0x2F, 0xC0, 0xFE, 0xAC, 0xAE, 0xC5,
+    0x26, 0xC0, 0xFE, 0x44, 0x49, 0x7D, 0x2F, 0xA7, 0x96, 0xFE, 0xE1, 0xE2, 0xEA, 0x26, 0x8F, 0x7D,
+    0x26, 0x0E, 0xFE, 0x45, 0x4A, 0x7D, 0x2F, 0xC0, 0xA1, 0x98, 0xFE, 0xB8, 0xBA, 0xCD, 0x26, 0xC1,
+    0x9D, 0x89, 0xFE, 0x89, 0x8C, 0xAD, 0x2F, 0xC0, 0xFE, 0x76, 0x7A, 0xA0, 0x26, 0xC0, 0x1C, 0x2F,
+    0xC0, 0x02, 0x26, 0xC0, 0xFE, 0x44, 0x49, 0x7D, 0x2F, 0xD1, 0xA3, 0x9A, 0xC6, 0xFE, 0x71, 0x74,
+    0x9E, 0x26, 0xC0, 0xFE, 0x99, 0x9B, 0xB9, 0x2D, 0xC2, 0xFE, 0xAD, 0xAE, 0xC6, 0x26, 0xC0, 0xFE,
+    0x5D, 0x61, 0x90, 0xB4, 0x92, 0xFE, 0xFF, 0xFF, 0xFF, 0xC0, 0x16, 0x2D, 0xC2, 0x0C, 0x26, 0xC0,
+    0xFE, 0x5F, 0x62, 0x91, 0x2D, 0xFE, 0xCA, 0xCB, 0xDB, 0x26, 0x30, 0x2D, 0xC7, 0xA6, 0x86, 0x26,
+    0xC0, 0xFE, 0x97, 0x99, 0xB8, 0x2D, 0xC4, 0xA2, 0x88, 0xFE, 0xC5, 0xC7, 0xD7, 0x26, 0x55, 0xFE,
+    0x83, 0x85, 0xAA, 0x2D, 0xC0, 0xFE, 0x7A, 0x7C, 0xA4, 0x26, 0xC0, 0xFE, 0x7A, 0x7D, 0xA4, 0x2D,
+    0xC0, 0xFE, 0xAE, 0xB0, 0xC8, 0x26, 0xC0, 0xFE, 0x48, 0x4C, 0x82, 0x2D, 0xC0, 0xFE, 0x66, 0x69,
+    0x96, 0xFE, 0xFD, 0xFD, 0xFD, 0x26, 0x55, 0xFE, 0x69, 0x6C, 0x98, 0x2D, 0xC1, 0xFE, 0xB7, 0xB9,
+    0xCE, 0x26, 0xFE, 0xD7, 0xD7, 0xE3, 0xFE, 0x51, 0x55, 0x88, 0xB4, 0x82, 0xFE, 0xF5, 0xF5, 0xF8,
+    0x17, 0xFE, 0x85, 0x87, 0xAB, 0x2D, 0xFE, 0x7A, 0x7C, 0xA4, 0x26, 0xC0, 0x10, 0x2D, 0xC0, 0x27,
+    0x26, 0xC0, 0xFE, 0x48, 0x4C, 0x82, 0x2D, 0xD1, 0xA3, 0x9A, 0xC6, 0xB4, 0x92, 0x26, 0xC0, 0xFE,
+    0xAF, 0xB0, 0xC9, 0x2B, 0xC2, 0xFE, 0xC4, 0xC5, 0xD7, 0x26, 0x00, 0xFE, 0x4B, 0x4D, 0x85, 0xAD,
+    0x84, 0x26, 0xC0, 0xFE, 0xB1, 0xB2, 0xCA, 0x2B, 0xC2, 0x3B, 0x26, 0x9B, 0x8A, 0x3A, 0x2B, 0xFE,
+    0xCB, 0xCC, 0xDC, 0x26, 0x92, 0x8D, 0x2B, 0xC7, 0xA6, 0x86, 0x26, 0xC0, 0xFE, 0x99, 0x9B, 0xBA,
+    0x2B, 0xC4, 0xFE, 0xB7, 0xB8, 0xCF, 0x26, 0x55, 0xFE, 0x86, 0x88, 0xAD, 0x2B, 0xC1, 0xFE, 0x66,
+    0x69, 0x98, 0x26, 0xC0, 0xFE, 0x87, 0x89, 0xAE, 0x2B, 0xC0, 0xFE, 0xB9, 0xBA, 0xD0, 0x26, 0x93,
+    0x8C, 0x2B, 0xC1, 0xFE, 0x7E, 0x80, 0xA8, 0x26, 0xC1, 0xFE, 0x85, 0x87, 0xAD, 0x2B, 0xC0, 0xAC,
+    0x84, 0x26, 0xC0, 0xFE, 0x90, 0x91, 0xB4, 0x2B, 0xC0, 0xFE, 0xC1, 0xC2, 0xD5, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xDA, 0xDA, 0xE6, 0x2B, 0x1C, 0x26, 0xC0, 0x39, 0x2B, 0xC0, 0x32, 0x26, 0x3F, 0x2B,
+    0xD2, 0xA3, 0x9A, 0xC7, 0xFE, 0xD1, 0xD2, 0xE1, 0x26, 0x8A, 0x8F, 0xFE, 0x49, 0x4B, 0x86, 0x56,
+    0xC0, 0xA9, 0x85, 0xFE, 0xF7, 0xF7, 0xFA, 0x26, 0xFE, 0xC1, 0xC2, 0xD6, 0x29, 0xC0, 0xFE, 0xD0,
+    0xD0, 0xE0, 0x26, 0x8C, 0x8F, 0xFE, 0x4A, 0x4C, 0x87, 0x29, 0xC0, 0x1B, 0x03, 0x26, 0xFE, 0xBE,
+    0xBE, 0xD4, 0x29, 0xC0, 0xFE, 0xCC, 0xCD, 0xDD, 0x26, 0x93, 0x7C, 0x29, 0xC7, 0xA6, 0x86, 0x26,
+    0xC0, 0xFE, 0x9B, 0x9C, 0xBD, 0x29, 0xC3, 0xFE, 0xA9, 0xAA, 0xC6, 0x26, 0xC0, 0xFE, 0x92, 0x93,
+    0xB7, 0x29, 0xC2, 0x00, 0xFE, 0xEC, 0xEC, 0xF2, 0x26, 0xFE, 0xA3, 0xA4, 0xC2, 0x29, 0xC0, 0xFE,
+    0xD5, 0xD5, 0xE3, 0x26, 0xFE, 0xBF, 0xC0, 0xD5, 0x29, 0xC0, 0xB1, 0x82, 0xFE, 0xF1, 0xF1, 0xF6,
+    0x26, 0xFE, 0xDD, 0xDD, 0xE8, 0x26, 0x95, 0x8B, 0xFE, 0x5D, 0x5F, 0x94, 0x29, 0xAF, 0x83, 0x26,
+    0xC0, 0x0B, 0x29, 0xC0, 0xFE, 0xC3, 0xC4, 0xD8, 0x26, 0xFE, 0xDD, 0xDE, 0xE9, 0x29, 0x00, 0xFE,
+    0xEC, 0xEC, 0xF2, 0x26, 0x20, 0x29, 0xC0, 0x12, 0x26, 0x05, 0x29, 0xD2, 0xA3, 0x9A, 0xC7, 0xB8,
+    0x90, 0xFE, 0xED, 0xEE, 0xF4, 0x26, 0xFE, 0xB2, 0xB2, 0xCD, 0xFE, 0x58, 0x59, 0x93, 0xA4, 0x86,
+    0xFE, 0xC4, 0xC4, 0xD9, 0x26, 0x8E, 0x8E, 0xFE, 0x60, 0x61, 0x98, 0x27, 0xC0, 0xFE, 0x64, 0x65,
+    0x9A, 0xFE, 0xEC, 0xEC, 0xF3, 0x26, 0xFE, 0xB6, 0xB6, 0xD0, 0xFE, 0x59, 0x5A, 0x93, 0x2D, 0x04,
+    0x26, 0xFE, 0xE4, 0xE4, 0xED, 0xFE, 0x5B, 0x5C, 0x95, 0x27, 0xC0, 0xFE, 0xCD, 0xCD, 0xDF, 0x26,
+    0x93, 0x8C, 0x27, 0xC7, 0xA6, 0x86, 0x26, 0xC0, 0xFE, 0x9D, 0x9E, 0xC0, 0x27, 0xC2, 0xFE, 0x9A,
+    0x9A, 0xBD, 0x26, 0xC0, 0xFE, 0xA4, 0xA4, 0xC4, 0x27, 0xC4, 0xFE, 0x8C, 0x8D, 0xB4, 0x26, 0x2B,
+    0xFE, 0x63, 0x64, 0x9A, 0xFE, 0x7F, 0x7F, 0xAC, 0xFE, 0xFD, 0xFD, 0xFE, 0x99, 0x8A, 0xFE, 0x67,
+    0x68, 0x9C, 0x27, 0x7E, 0xFE, 0xCC, 0xCD, 0xDE, 0x26, 0xFE, 0xDA, 0xDA, 0xE7, 0xFE, 0x51, 0x52,
+    0x8E, 0xFE, 0xD9, 0xD9, 0xE6, 0x26, 0xFE, 0xD2, 0xD2, 0xE2, 0xFE, 0x4D, 0x4E, 0x8C, 0x27, 0xFE,
+    0xD1, 0xD1, 0xE1, 0x26, 0x07, 0x2D, 0xB2, 0x82, 0x34, 0x26, 0xFE, 0xA0, 0xA1, 0xC2, 0x27, 0xC0,
+    0x06, 0x26, 0x2B, 0xFE, 0x63, 0x64, 0x9A, 0x21, 0x0F, 0x34, 0xFE, 0x67, 0x68, 0x9C, 0x27, 0xD2,
+    0xA3, 0x9A, 0xC8, 0xAF, 0x83, 0xFE, 0xAF, 0xAF, 0xCC, 0xFE, 0xE4, 0xE4, 0xEE, 0xB6, 0x80, 0x26,
+    0xC0, 0x33, 0xFE, 0x63, 0x63, 0x9C, 0x25, 0xC2, 0xAE, 0x83, 0x01, 0x17, 0x29, 0xC0, 0xFE, 0xE1,
+    0xE1, 0xEC, 0xFE, 0xA9, 0xA9, 0xC8, 0xFE, 0x59, 0x59, 0x96, 0x25, 0xC1, 0xFE, 0xCE, 0xCE, 0xE0,
+    0x26, 0x93, 0x8D, 0x25, 0xC5, 0xFE, 0x8F, 0x8F, 0xB8, 0x26, 0xC4, 0xFE, 0xD9, 0xD9, 0xE7, 0x25,
+    0xC0, 0x3A, 0x26, 0xC4, 0xFE, 0xAD, 0xAD, 0xCB, 0x25, 0xC1, 0xFE, 0x89, 0x89, 0xB4, 0xFE, 0xDB,
+    0xDB, 0xE8, 0xFE, 0xFA, 0xFA, 0xFC, 0x34, 0xFE, 0xCC, 0xCC, 0xDF, 0xFE, 0x70, 0x70, 0xA4, 0xFE,
+    0x50, 0x50, 0x90, 0xC0, 0xFE, 0x9B, 0x9B, 0xC0, 0x26, 0x29, 0xFE, 0x6C, 0x6C, 0xA2, 0x25, 0xFE,
+    0x6B, 0x6B, 0xA1, 0x29, 0x26, 0xFE, 0xA0, 0xA0, 0xC3, 0x25, 0xAA, 0x85, 0xFE, 0xAB, 0xAB, 0xCA,
+    0xFE, 0xE4, 0xE4, 0xEE, 0xB4, 0x81, 0x9C, 0x89, 0xFE, 0xDB, 0xDB, 0xE8, 0xFE, 0x95, 0x95, 0xBC,
+    0xFE, 0x51, 0x51, 0x90, 0x56, 0xC1, 0xFE, 0x89, 0x89, 0xB4, 0xFE, 0xDB, 0xDB, 0xE8, 0xFE, 0xFA,
+    0xFA, 0xFC, 0x9C, 0x89, 0x2E, 0x31, 0xFE, 0x50, 0x50, 0x90, 0xD3, 0xA3, 0x9A, 0xCC, 0xFE, 0x93,
+    0x92, 0xBC, 0xFE, 0xFF, 0xFF, 0xFF, 0x8E, 0x8F, 0xFE, 0x69, 0x68, 0xA2, 0x23, 0xFD, 0xE6, 0xA3,
+    0x9A, 0xCD, 0xFE, 0xB0, 0xAF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xE7, 0xE6, 0xF0, 0xFE, 0x66,
+    0x65, 0xA3, 0x21, 0xFD, 0xE5, 0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD, 0xF8, 0xA3, 0x9A, 0xFD,
+    0xF8, 0xA3, 0x9A, 0xFD, 0xD1, 0x26, 0xC9, 0x19, 0xDA, 0xA3, 0x9A, 0xFD, 0xCE, 0x26, 0xCF, 0x17,
+    0xD7, 0xFE, 0x10, 0x20, 0x40, 0xFD, 0xCB, 0x26, 0xD5, 0x05, 0xFD, 0xDF, 0x26, 0xC7, 0xFE, 0xD2,
+    0x28, 0x28, 0xC7, 0x26, 0xC7, 0x05, 0xFD, 0xDC, 0x26, 0xC4, 0x0B, 0xCF, 0x26, 0xC4, 0x05, 0xFD,
+    0xDA, 0x26, 0xC3, 0x0B, 0xD3, 0x26, 0xC3, 0x05, 0xFD, 0xD7, 0x26, 0xC3, 0x0B, 0xD7, 0x26, 0xC3,
+    0x05, 0xFD, 0xD4, 0x26, 0xC3, 0x0B, 0xD9, 0x26, 0xC3, 0x05, 0xD9, 0xFE, 0xFA, 0xBE, 0x14, 0xF3,
+    0x05, 0xC0, 0x26, 0xC2, 0x0B, 0xDD, 0x26, 0xC2, 0x05, 0xD6, 0x25, 0xF6, 0x26, 0xC2, 0x0B, 0xDF,
+    0x26, 0xC2, 0x05, 0xD4, 0x25, 0xF7, 0x26, 0xC1, 0x0B, 0xE1, 0x26, 0xC1, 0x05, 0xD3, 0x25, 0xF7,
+    0x26, 0xC1, 0x0B, 0xE3, 0x26, 0xC1, 0x05, 0xD1, 0x25, 0xF7, 0x26, 0xC2, 0x0B, 0xE3, 0x26, 0xC2,
+    0x05, 0xD0, 0x25, 0xF6, 0x26, 0xC2, 0x0B, 0xE5, 0x26, 0xC2, 0x05, 0xCE, 0x25, 0xF7, 0x26, 0xC1,
+    0x0B, 0xE7, 0x26, 0xC1, 0x05, 0xCE, 0x25, 0xF6, 0x26, 0xC2, 0x0B, 0xE7, 0x26, 0xC2, 0x05, 0xCD,
+    0x25, 0xF6, 0x26, 0xC1, 0x0B, 0xE9, 0x26, 0xC1, 0x05, 0xCD, 0x25, 0xF6, 0x26, 0xC1, 0x0B, 0xE9,
+    0x26, 0xC1, 0x05, 0xCD, 0x25, 0xF5, 0x26, 0xC1, 0x0B, 0xEB, 0x26, 0xC1, 0x05, 0xCC, 0x25, 0xF5,
+    0x26, 0xC1, 0x0B, 0xEB, 0x26, 0xC1, 0x05, 0xCC, 0x25, 0xF5, 0x26, 0xC1, 0x0B, 0xEB, 0x26, 0xC1,
+    0x05, 0xCC, 0x25, 0xF4, 0x26, 0xC2, 0x0B, 0xEB, 0x26, 0xC2, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1,
+    0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1, 0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB,
+    0x25, 0xF4, 0x26, 0xC1, 0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1, 0x0B, 0xED,
+    0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1, 0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4,
+    0x26, 0xC1, 0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1, 0x0B, 0xED, 0x26, 0xC1,
+    0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1, 0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC1,
+    0x0B, 0xED, 0x26, 0xC1, 0x05, 0xCB, 0x25, 0xF4, 0x26, 0xC2, 0x0B, 0xEB, 0x26, 0xC2, 0x05, 0xCB,
+    0x25, 0xF5, 0x26, 0xC1, 0x0B, 0xEB, 0x26, 0xC1, 0x05, 0xCC, 0x25, 0xF5, 0x26, 0xC1, 0x0B, 0xEB,
+    0x26, 0xC1, 0x05, 0xCC, 0x25, 0xF5, 0x26, 0xC1, 0x0B, 0xEB, 0x26, 0xC1, 0x05, 0xCC, 0x25, 0xF6,
+    0x26, 0xC1, 0x0B, 0xE9, 0x26, 0xC1, 0x05, 0xCD, 0x25, 0xF6, 0x26, 0xC1, 0x0B, 0xE9, 0x26, 0xC1,
+    0x05, 0xCD, 0x25, 0xF6, 0x26, 0xC2, 0x0B, 0xE7, 0x26, 0xC2, 0x05, 0xCD, 0x25, 0xF7, 0x26, 0xC1,
+    0x0B, 0xE7, 0x26, 0xC1, 0x05, 0xCE, 0x25, 0xF7, 0x26, 0xC2, 0x0B, 0xE5, 0x26, 0xC2, 0x05, 0xCE,
+    0x25, 0xF8, 0x26, 0xC2, 0x0B, 0xE3, 0x26, 0xC2, 0x05, 0xCF, 0x25, 0xF9, 0x26, 0xC1, 0x0B, 0xE3,
+    0x26, 0xC1, 0x05, 0xD0, 0x25, 0xFA, 0x26, 0xC1, 0x0B, 0xE1, 0x26, 0xC1, 0x05, 0xD1, 0x25, 0xFA,
+    0x26, 0xC2, 0x0B, 0xDF, 0x26, 0xC2, 0x05, 0xD1, 0x25, 0xFB, 0x26, 0xC2, 0x0B, 0xDD, 0x26, 0xC2,
+    0x05, 0xD3, 0x25, 0xFB, 0x26, 0xC3, 0x0B, 0xD9, 0x26, 0xC3, 0x05, 0xD4, 0x25, 0xFC, 0x26, 0xC3,
+    0x0B, 0xD7, 0x26, 0xC3, 0x05, 0xD6, 0x25, 0xFB, 0x05, 0xC0, 0x26, 0xC3, 0x0B, 0xD3, 0x26, 0xC3,
+    0x05, 0xD9, 0x25, 0xF9, 0x05, 0xC2, 0x26, 0xC4, 0x0B, 0xCF, 0x26, 0xC4, 0x05, 0xDB, 0x25, 0xF7,
+    0x05, 0xC4, 0x26, 0xC7, 0x0B, 0xC7, 0x26, 0xC7, 0x05, 0xDE, 0x25, 0xF3, 0x05, 0xC8, 0x26, 0xD5,
+    0x05, 0xFD, 0xE4, 0x26, 0xCF, 0x05, 0xFD, 0xEA, 0x26, 0xC9, 0x05, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+};
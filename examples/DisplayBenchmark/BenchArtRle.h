@@ -0,0 +1,156 @@
+// Generated by tools/imageconvert.py from bench_art.png (RLE). Do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t kBenchArtRle[] = {
+    0x52, 0x35, 0x36, 0x35, 0x78, 0x00, 0x50, 0x00, 0xFF, 0x08, 0x11, 0xEF, 0x08, 0x11, 0xF7, 0x29,
+    0x19, 0xF7, 0x49, 0x19, 0xF7, 0x6A, 0x21, 0xF7, 0x6B, 0x21, 0xF7, 0x8B, 0x29, 0x89, 0xAC, 0x29,
+    0x07, 0x2D, 0x3A, 0x16, 0x9D, 0xFC, 0xDE, 0xDF, 0xFF, 0xBF, 0xF7, 0xDC, 0xDE, 0xD6, 0x94, 0xED,
+    0x31, 0x83, 0xAC, 0x29, 0x07, 0x2D, 0x3A, 0x16, 0x9D, 0xFC, 0xDE, 0xDF, 0xFF, 0xBF, 0xF7, 0xDC,
+    0xDE, 0xD6, 0x94, 0xED, 0x31, 0x82, 0xAC, 0x29, 0x02, 0x3A, 0xC6, 0xFF, 0xFF, 0x9E, 0xEF, 0x86,
+    0xAC, 0x29, 0x05, 0xED, 0x31, 0x14, 0x7C, 0xDC, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x8C, 0x83,
+    0xAC, 0x29, 0x06, 0xAF, 0x4A, 0x57, 0xA5, 0x3D, 0xE7, 0xDF, 0xFF, 0x5D, 0xE7, 0xD9, 0xB5, 0x8F,
+    0x4A, 0x83, 0xAC, 0x29, 0x05, 0xB2, 0x6B, 0xBB, 0xD6, 0xDF, 0xFF, 0xBE, 0xF7, 0x1A, 0xC6, 0xCF,
+    0x52, 0x8B, 0xAC, 0x29, 0x06, 0x0D, 0x3A, 0x57, 0xA5, 0x3D, 0xE7, 0xDF, 0xFF, 0xBE, 0xF7, 0xDC,
+    0xD6, 0x74, 0x84, 0x83, 0xAC, 0x29, 0x05, 0xB2, 0x6B, 0xBB, 0xD6, 0xDF, 0xFF, 0xBE, 0xF7, 0x1A,
+    0xC6, 0xCF, 0x52, 0x94, 0xAC, 0x29, 0x88, 0xCD, 0x31, 0x1A, 0x8F, 0x4A, 0x5D, 0xEF, 0xFF, 0xFF,
+    0x78, 0xAD, 0x2E, 0x3A, 0x4E, 0x42, 0xF9, 0xBD, 0xFF, 0xFF, 0xFC, 0xDE, 0x2E, 0x3A, 0xCD, 0x31,
+    0xCD, 0x31, 0x8F, 0x4A, 0x5D, 0xEF, 0xFF, 0xFF, 0x78, 0xAD, 0x2E, 0x3A, 0x4E, 0x42, 0xF9, 0xBD,
+    0xFF, 0xFF, 0x1D, 0xDF, 0x4E, 0x42, 0xCD, 0x31, 0xCD, 0x31, 0x5A, 0xC6, 0xFF, 0xFF, 0x9E, 0xF7,
+    0x86, 0xCD, 0x31, 0x05, 0x34, 0x84, 0x98, 0xAD, 0x31, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x8C,
+    0x83, 0xCD, 0x31, 0x11, 0x19, 0xBE, 0x13, 0x7C, 0x6E, 0x42, 0x4E, 0x42, 0x5A, 0xCE, 0xFF, 0xFF,
+    0x9E, 0xF7, 0x4E, 0x42, 0xCD, 0x31, 0xCD, 0x31, 0xF3, 0x73, 0xFF, 0xFF, 0x5D, 0xE7, 0x8F, 0x4A,
+    0x72, 0x6B, 0xFF, 0xFF, 0xBE, 0xF7, 0xAF, 0x4A, 0x8A, 0xCD, 0x31, 0x11, 0xF9, 0xBD, 0xFF, 0xFF,
+    0xFC, 0xDE, 0x4E, 0x42, 0x31, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x84, 0xCD, 0x31, 0xCD, 0x31,
+    0xF3, 0x73, 0xFF, 0xFF, 0x5D, 0xE7, 0x8F, 0x4A, 0x72, 0x6B, 0xFF, 0xFF, 0xBE, 0xF7, 0xAF, 0x4A,
+    0x9C, 0xCD, 0x31, 0x1A, 0x7B, 0xCE, 0xFF, 0xFF, 0x5D, 0xEF, 0xED, 0x31, 0xCD, 0x31, 0xCD, 0x31,
+    0x2E, 0x3A, 0xBF, 0xF7, 0xFF, 0xFF, 0xB9, 0xB5, 0xCD, 0x31, 0xCD, 0x31, 0x7B, 0xCE, 0xFF, 0xFF,
+    0x5D, 0xEF, 0xED, 0x31, 0xCD, 0x31, 0xCD, 0x31, 0x2E, 0x3A, 0xBF, 0xF7, 0xFF, 0xFF, 0xD9, 0xB5,
+    0xCD, 0x31, 0xCD, 0x31, 0x5A, 0xC6, 0xFF, 0xFF, 0x9E, 0xF7, 0x88, 0xCD, 0x31, 0x03, 0x0E, 0x3A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x94, 0x87, 0xCD, 0x31, 0x2A, 0x72, 0x63, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x34, 0x84, 0xCD, 0x31, 0xED, 0x31, 0x5D, 0xEF, 0xFF, 0xFF, 0xF6, 0x9C, 0xCD, 0x31, 0xCD, 0x31,
+    0x9B, 0xCE, 0xFF, 0xFF, 0xD9, 0xBD, 0xCD, 0x31, 0xB3, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0x6B,
+    0xCD, 0x31, 0x52, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x73, 0xCD, 0x31, 0x3D, 0xE7, 0xFF, 0xFF,
+    0x98, 0xAD, 0xCD, 0x31, 0xCD, 0x31, 0x5D, 0xE7, 0xFF, 0xFF, 0x98, 0xAD, 0xCD, 0x31, 0xED, 0x31,
+    0x5D, 0xEF, 0xFF, 0xFF, 0xF6, 0x9C, 0xCD, 0x31, 0xCD, 0x31, 0x9B, 0xCE, 0xFF, 0xFF, 0xD9, 0xBD,
+    0x93, 0xCD, 0x31, 0x87, 0xEE, 0x39, 0x03, 0x90, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xAD, 0x83,
+    0xEE, 0x39, 0x07, 0x1A, 0xC6, 0xFF, 0xFF, 0xDF, 0xFF, 0x0E, 0x3A, 0x90, 0x4A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x78, 0xAD, 0x83, 0xEE, 0x39, 0x07, 0x1A, 0xC6, 0xFF, 0xFF, 0xDF, 0xFF, 0x2E, 0x3A, 0xEE,
+    0x39, 0x5B, 0xCE, 0xFF, 0xFF, 0x9E, 0xF7, 0x88, 0xEE, 0x39, 0x03, 0x2E, 0x3A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xB6, 0x94, 0x87, 0xEE, 0x39, 0x2A, 0x14, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x84, 0xEE,
+    0x39, 0x11, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x7C, 0xEE, 0x39, 0xEE, 0x39, 0xB9, 0xB5, 0xFF,
+    0xFF, 0x9E, 0xF7, 0xEE, 0x39, 0xEE, 0x39, 0x98, 0xAD, 0xFF, 0xFF, 0x3D, 0xE7, 0x8F, 0x4A, 0x3D,
+    0xE7, 0xFF, 0xFF, 0xB9, 0xB5, 0xEE, 0x39, 0xEE, 0x39, 0x37, 0xA5, 0xFF, 0xFF, 0x1D, 0xDF, 0x6F,
+    0x4A, 0x52, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x6B, 0xEE, 0x39, 0x11, 0x5B, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x14, 0x7C, 0xEE, 0x39, 0xEE, 0x39, 0xB9, 0xB5, 0xFF, 0xFF, 0x9E, 0xF7, 0x93, 0xEE, 0x39,
+    0x87, 0x0E, 0x3A, 0x03, 0x93, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x9C, 0x83, 0x0E, 0x3A, 0x07,
+    0x78, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x5A, 0x93, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x9C,
+    0x83, 0x0E, 0x3A, 0x07, 0x78, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x5B, 0x0E, 0x3A, 0x5B, 0xCE,
+    0xFF, 0xFF, 0x9E, 0xF7, 0x88, 0x0E, 0x3A, 0x03, 0x2F, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x94,
+    0x86, 0x0E, 0x3A, 0x1B, 0x4F, 0x42, 0xDC, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xB0, 0x52, 0x0E, 0x3A,
+    0xD4, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x73, 0x0E, 0x3A, 0x0E, 0x3A, 0x78, 0xAD, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x42, 0x0E, 0x3A, 0x4F, 0x42, 0x1D, 0xE7, 0xFF, 0xFF, 0x7E, 0xEF, 0xFF, 0xFF,
+    0x3D, 0xE7, 0x4F, 0x42, 0x0E, 0x3A, 0x0E, 0x3A, 0x0F, 0x3A, 0xD9, 0xBD, 0x83, 0xFF, 0xFF, 0x0C,
+    0x75, 0x8C, 0x0E, 0x3A, 0x0E, 0x3A, 0xD4, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x73, 0x0E, 0x3A,
+    0x0E, 0x3A, 0x78, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x42, 0x92, 0x0E, 0x3A, 0x87, 0x2F, 0x42,
+    0x03, 0xB3, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x9C, 0x83, 0x2F, 0x42, 0x07, 0x78, 0xAD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x12, 0x5B, 0xB3, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x9C, 0x83, 0x2F, 0x42,
+    0x07, 0x78, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0x5B, 0x2F, 0x42, 0x5B, 0xCE, 0xFF, 0xFF, 0x9E,
+    0xF7, 0x88, 0x2F, 0x42, 0x03, 0x50, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x94, 0x86, 0x2F, 0x42,
+    0x12, 0x3A, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0x84, 0x2F, 0x42, 0x2F, 0x42, 0xF4, 0x7B, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x7B, 0x2F, 0x42, 0x2F, 0x42, 0x99, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x70,
+    0x4A, 0x2F, 0x42, 0x2F, 0x42, 0x52, 0x63, 0x82, 0xFF, 0xFF, 0x00, 0x73, 0x6B, 0x82, 0x2F, 0x42,
+    0x12, 0xD9, 0xB5, 0xFF, 0xFF, 0xBC, 0xD6, 0xB1, 0x52, 0x52, 0x63, 0xBF, 0xF7, 0xFF, 0xFF, 0x35,
+    0x84, 0x2F, 0x42, 0xF4, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7B, 0x2F, 0x42, 0x2F, 0x42, 0x99,
+    0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x4A, 0x92, 0x2F, 0x42, 0x87, 0x30, 0x42, 0x03, 0xD1, 0x5A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0xAD, 0x83, 0x30, 0x42, 0x07, 0x3A, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x70, 0x4A, 0xD1, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0xB5, 0x83, 0x30, 0x42, 0x07, 0x3A, 0xC6,
+    0xFF, 0xFF, 0xDF, 0xFF, 0x70, 0x4A, 0x30, 0x42, 0x7B, 0xCE, 0xFF, 0xFF, 0x9E, 0xF7, 0x88, 0x30,
+    0x42, 0x03, 0x70, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x9C, 0x85, 0x30, 0x42, 0x03, 0xD9, 0xB5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x84, 0x82, 0x30, 0x42, 0x08, 0x53, 0x63, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x55, 0x84, 0x30, 0x42, 0x30, 0x42, 0xDA, 0xBD, 0xFF, 0xFF, 0x9E, 0xF7, 0x82, 0x30, 0x42, 0x00,
+    0x15, 0x7C, 0x82, 0xFF, 0xFF, 0x15, 0x35, 0x84, 0x30, 0x42, 0x30, 0x42, 0x91, 0x52, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x96, 0x94, 0x30, 0x42, 0x30, 0x42, 0x1A, 0xC6, 0xFF, 0xFF, 0xDC, 0xDE, 0x30, 0x42,
+    0x53, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x84, 0x30, 0x42, 0x30, 0x42, 0xDA, 0xBD, 0xFF, 0xFF,
+    0x9E, 0xF7, 0x93, 0x30, 0x42, 0x88, 0x50, 0x4A, 0x02, 0x9C, 0xD6, 0xFF, 0xFF, 0x5E, 0xEF, 0x82,
+    0x50, 0x4A, 0x14, 0x91, 0x52, 0xBF, 0xF7, 0xFF, 0xFF, 0x1A, 0xC6, 0x50, 0x4A, 0x50, 0x4A, 0x9C,
+    0xD6, 0xFF, 0xFF, 0x5E, 0xEF, 0x70, 0x4A, 0x50, 0x4A, 0x50, 0x4A, 0x91, 0x52, 0xBF, 0xF7, 0xFF,
+    0xFF, 0xFA, 0xBD, 0x50, 0x4A, 0x50, 0x4A, 0x7B, 0xCE, 0xFF, 0xFF, 0x9E, 0xF7, 0x88, 0x50, 0x4A,
+    0x03, 0x91, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x9C, 0x84, 0x50, 0x4A, 0x03, 0x58, 0xAD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x96, 0x94, 0x83, 0x50, 0x4A, 0x25, 0x70, 0x4A, 0x7E, 0xEF, 0xFF, 0xFF, 0x38,
+    0xA5, 0x50, 0x4A, 0x50, 0x4A, 0xBC, 0xD6, 0xFF, 0xFF, 0x1A, 0xBE, 0x50, 0x4A, 0x50, 0x4A, 0xD2,
+    0x5A, 0x9E, 0xF7, 0xFF, 0xFF, 0xFD, 0xDE, 0xFF, 0xFF, 0xBE, 0xF7, 0xF2, 0x5A, 0x50, 0x4A, 0xD2,
+    0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x94, 0x50, 0x4A, 0x50, 0x4A, 0x3B, 0xC6, 0xFF, 0xFF, 0xFD,
+    0xDE, 0x50, 0x4A, 0x70, 0x4A, 0x7E, 0xEF, 0xFF, 0xFF, 0x38, 0xA5, 0x50, 0x4A, 0x50, 0x4A, 0xBC,
+    0xD6, 0xFF, 0xFF, 0x1A, 0xBE, 0x93, 0x50, 0x4A, 0x88, 0x71, 0x4A, 0x1A, 0x33, 0x63, 0x7E, 0xEF,
+    0xFF, 0xFF, 0x99, 0xB5, 0xD2, 0x5A, 0xF2, 0x5A, 0x3B, 0xC6, 0xFF, 0xFF, 0x7E, 0xEF, 0x13, 0x63,
+    0x71, 0x4A, 0x71, 0x4A, 0x33, 0x63, 0x7E, 0xEF, 0xFF, 0xFF, 0xBA, 0xB5, 0xD2, 0x5A, 0xF2, 0x5A,
+    0x3B, 0xC6, 0xFF, 0xFF, 0x3D, 0xE7, 0xF2, 0x5A, 0x71, 0x4A, 0x71, 0x4A, 0x7B, 0xCE, 0xFF, 0xFF,
+    0x9E, 0xF7, 0x88, 0x71, 0x4A, 0x03, 0x91, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x9C, 0x83, 0x71,
+    0x4A, 0x03, 0xD7, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xA5, 0x85, 0x71, 0x4A, 0x24, 0x76, 0x8C,
+    0xFF, 0xFF, 0x5E, 0xEF, 0x33, 0x63, 0xF5, 0x7B, 0xFF, 0xFF, 0xBF, 0xF7, 0x53, 0x63, 0x71, 0x4A,
+    0x71, 0x4A, 0x7B, 0xCE, 0xFF, 0xFF, 0xDC, 0xDE, 0x91, 0x52, 0xDC, 0xDE, 0xFF, 0xFF, 0x9C, 0xD6,
+    0x71, 0x4A, 0x71, 0x4A, 0x9C, 0xD6, 0xFF, 0xFF, 0xDC, 0xDE, 0xF2, 0x5A, 0x74, 0x6B, 0xBF, 0xF7,
+    0xFF, 0xFF, 0x18, 0xA5, 0x71, 0x4A, 0x71, 0x4A, 0x76, 0x8C, 0xFF, 0xFF, 0x5E, 0xEF, 0x33, 0x63,
+    0xF5, 0x7B, 0xFF, 0xFF, 0xBF, 0xF7, 0x53, 0x63, 0x93, 0x71, 0x4A, 0x89, 0x92, 0x52, 0x07, 0xF3,
+    0x5A, 0x79, 0xAD, 0x3D, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xD6, 0x13, 0x63, 0x83,
+    0x92, 0x52, 0x07, 0xF3, 0x5A, 0x79, 0xAD, 0x3D, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x1D, 0xE7, 0x59,
+    0xAD, 0xD2, 0x5A, 0x82, 0x92, 0x52, 0x02, 0x7C, 0xCE, 0xFF, 0xFF, 0x9E, 0xF7, 0x86, 0x92, 0x52,
+    0x00, 0x77, 0x8C, 0x85, 0xFF, 0xFF, 0x03, 0xDC, 0xDE, 0x92, 0x52, 0x92, 0x52, 0x7E, 0xEF, 0x85,
+    0xFF, 0xFF, 0x00, 0x79, 0xAD, 0x82, 0x92, 0x52, 0x18, 0x56, 0x8C, 0xDD, 0xDE, 0xDF, 0xFF, 0xBF,
+    0xF7, 0x7B, 0xCE, 0x94, 0x73, 0x92, 0x52, 0x92, 0x52, 0xD8, 0x9C, 0xFF, 0xFF, 0xDF, 0xFF, 0x74,
+    0x6B, 0x92, 0x52, 0x54, 0x6B, 0xDF, 0xFF, 0xFF, 0xFF, 0x18, 0xA5, 0x92, 0x52, 0xD2, 0x5A, 0x59,
+    0xAD, 0x3D, 0xE7, 0xDF, 0xFF, 0xBF, 0xF7, 0xDD, 0xDE, 0xB7, 0x94, 0x83, 0x92, 0x52, 0x05, 0x56,
+    0x8C, 0xDD, 0xDE, 0xDF, 0xFF, 0xBF, 0xF7, 0x7B, 0xCE, 0x94, 0x73, 0xA2, 0x92, 0x52, 0x03, 0x97,
+    0x94, 0xFF, 0xFF, 0x7E, 0xEF, 0x54, 0x6B, 0xE5, 0x92, 0x52, 0x8E, 0xB3, 0x5A, 0x03, 0x79, 0xB5,
+    0xFF, 0xFF, 0x3E, 0xE7, 0x34, 0x63, 0xE4, 0xB3, 0x5A, 0xF7, 0xD3, 0x5A, 0xF7, 0xF4, 0x62, 0xF7,
+    0xF5, 0x62, 0xD0, 0x15, 0x6B, 0x8A, 0xFF, 0xFF, 0x9B, 0x15, 0x6B, 0xCD, 0x36, 0x6B, 0x90, 0xFF,
+    0xFF, 0x98, 0x36, 0x6B, 0xCA, 0x08, 0x11, 0x96, 0xFF, 0xFF, 0xDE, 0x08, 0x11, 0x88, 0xFF, 0xFF,
+    0x88, 0x45, 0xD1, 0x88, 0xFF, 0xFF, 0xDB, 0x08, 0x11, 0x85, 0xFF, 0xFF, 0x90, 0x45, 0xD1, 0x85,
+    0xFF, 0xFF, 0xD9, 0x08, 0x11, 0x84, 0xFF, 0xFF, 0x94, 0x45, 0xD1, 0x84, 0xFF, 0xFF, 0xD6, 0x08,
+    0x11, 0x84, 0xFF, 0xFF, 0x98, 0x45, 0xD1, 0x84, 0xFF, 0xFF, 0xD3, 0x08, 0x11, 0x84, 0xFF, 0xFF,
+    0x9A, 0x45, 0xD1, 0x84, 0xFF, 0xFF, 0x9A, 0x08, 0x11, 0xB4, 0xE2, 0xFD, 0x81, 0x08, 0x11, 0x83,
+    0xFF, 0xFF, 0x9E, 0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x97, 0x08, 0x11, 0xB7, 0xE2, 0xFD, 0x83, 0xFF,
+    0xFF, 0xA0, 0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x95, 0x08, 0x11, 0xB8, 0xE2, 0xFD, 0x82, 0xFF, 0xFF,
+    0xA2, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x94, 0x08, 0x11, 0xB8, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xA4,
+    0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x92, 0x08, 0x11, 0xB8, 0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xA4, 0x45,
+    0xD1, 0x83, 0xFF, 0xFF, 0x91, 0x08, 0x11, 0xB7, 0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xA6, 0x45, 0xD1,
+    0x83, 0xFF, 0xFF, 0x8F, 0x08, 0x11, 0xB8, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xA8, 0x45, 0xD1, 0x82,
+    0xFF, 0xFF, 0x8F, 0x08, 0x11, 0xB7, 0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xA8, 0x45, 0xD1, 0x83, 0xFF,
+    0xFF, 0x8E, 0x08, 0x11, 0xB7, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAA, 0x45, 0xD1, 0x82, 0xFF, 0xFF,
+    0x8E, 0x08, 0x11, 0xB7, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAA, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8E,
+    0x08, 0x11, 0xB6, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8D, 0x08,
+    0x11, 0xB6, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8D, 0x08, 0x11,
+    0xB6, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8D, 0x08, 0x11, 0xB5,
+    0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2,
+    0xFD, 0x82, 0xFF, 0xFF, 0xAE, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD,
+    0x82, 0xFF, 0xFF, 0xAE, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82,
+    0xFF, 0xFF, 0xAE, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82, 0xFF,
+    0xFF, 0xAE, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82, 0xFF, 0xFF,
+    0xAE, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAE,
+    0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAE, 0x45,
+    0xD1, 0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAE, 0x45, 0xD1,
+    0x82, 0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAE, 0x45, 0xD1, 0x82,
+    0xFF, 0xFF, 0x8C, 0x08, 0x11, 0xB5, 0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x83, 0xFF,
+    0xFF, 0x8C, 0x08, 0x11, 0xB6, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x82, 0xFF, 0xFF,
+    0x8D, 0x08, 0x11, 0xB6, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8D,
+    0x08, 0x11, 0xB6, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAC, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8D, 0x08,
+    0x11, 0xB7, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAA, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8E, 0x08, 0x11,
+    0xB7, 0xE2, 0xFD, 0x82, 0xFF, 0xFF, 0xAA, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8E, 0x08, 0x11, 0xB7,
+    0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xA8, 0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x8E, 0x08, 0x11, 0xB8, 0xE2,
+    0xFD, 0x82, 0xFF, 0xFF, 0xA8, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x8F, 0x08, 0x11, 0xB8, 0xE2, 0xFD,
+    0x83, 0xFF, 0xFF, 0xA6, 0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x8F, 0x08, 0x11, 0xB9, 0xE2, 0xFD, 0x83,
+    0xFF, 0xFF, 0xA4, 0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x90, 0x08, 0x11, 0xBA, 0xE2, 0xFD, 0x82, 0xFF,
+    0xFF, 0xA4, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x91, 0x08, 0x11, 0xBB, 0xE2, 0xFD, 0x82, 0xFF, 0xFF,
+    0xA2, 0x45, 0xD1, 0x82, 0xFF, 0xFF, 0x92, 0x08, 0x11, 0xBB, 0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0xA0,
+    0x45, 0xD1, 0x83, 0xFF, 0xFF, 0x92, 0x08, 0x11, 0xBC, 0xE2, 0xFD, 0x83, 0xFF, 0xFF, 0x9E, 0x45,
+    0xD1, 0x83, 0xFF, 0xFF, 0x94, 0x08, 0x11, 0xBC, 0xE2, 0xFD, 0x84, 0xFF, 0xFF, 0x9A, 0x45, 0xD1,
+    0x84, 0xFF, 0xFF, 0x95, 0x08, 0x11, 0xBD, 0xE2, 0xFD, 0x84, 0xFF, 0xFF, 0x98, 0x45, 0xD1, 0x84,
+    0xFF, 0xFF, 0x97, 0x08, 0x11, 0xBC, 0xE2, 0xFD, 0x81, 0x08, 0x11, 0x84, 0xFF, 0xFF, 0x94, 0x45,
+    0xD1, 0x84, 0xFF, 0xFF, 0x9A, 0x08, 0x11, 0xBA, 0xE2, 0xFD, 0x83, 0x08, 0x11, 0x85, 0xFF, 0xFF,
+    0x90, 0x45, 0xD1, 0x85, 0xFF, 0xFF, 0x9C, 0x08, 0x11, 0xB8, 0xE2, 0xFD, 0x85, 0x08, 0x11, 0x88,
+    0xFF, 0xFF, 0x88, 0x45, 0xD1, 0x88, 0xFF, 0xFF, 0x9F, 0x08, 0x11, 0xB4, 0xE2, 0xFD, 0x89, 0x08,
+    0x11, 0x96, 0xFF, 0xFF, 0xE3, 0x08, 0x11, 0x90, 0xFF, 0xFF, 0xE9, 0x08, 0x11, 0x8A, 0xFF, 0xFF,
+    0xFF, 0x08, 0x11, 0xFF, 0x08, 0x11, 0xFF, 0x08, 0x11, 0xFF, 0x08, 0x11, 0xF3, 0x08, 0x11,
+};
@@ -0,0 +1,549 @@
+// Generated by tools/imageconvert.py from bench_bounce_src.gif (GIF). Do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t kBenchBounceGif[] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0xA0, 0x00, 0x78, 0x00, 0x85, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF1, 0xF1, 0xF3, 0xEC, 0xED, 0xEF, 0xEB,
+    0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD7, 0xD8,
+    0xDC, 0xD6, 0xD7, 0xDB, 0xCD, 0xCF, 0xD4, 0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE,
+    0xFA, 0xC8, 0x28, 0xC4, 0xC6, 0xCC, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB,
+    0xBD, 0xC4, 0xB5, 0xB7, 0xBF, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E, 0x8E, 0x91,
+    0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x28, 0x78, 0x3C,
+    0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x51, 0x57, 0x68, 0x42, 0x48, 0x5B, 0x35,
+    0x3B, 0x50, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x1E, 0x28, 0x46, 0x1F, 0x26,
+    0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32,
+    0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0x0B,
+    0x4E, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45, 0x32, 0x2E, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00,
+    0x21, 0xF9, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x78,
+    0x00, 0x00, 0x08, 0xFF, 0x00, 0x55, 0x08, 0x1C, 0x48, 0xB0, 0xA0, 0xC1, 0x83, 0x08, 0x13, 0x2A,
+    0x5C, 0xC8, 0xB0, 0xA1, 0xC3, 0x87, 0x10, 0x23, 0x22, 0x9C, 0x41, 0xB1, 0xA2, 0xC5, 0x8B, 0x16,
+    0x55, 0x60, 0xDC, 0x88, 0x51, 0x23, 0xC7, 0x8F, 0x33, 0x3C, 0x82, 0xDC, 0x28, 0x72, 0xE4, 0xC5,
+    0x92, 0x26, 0x2B, 0xA2, 0x4C, 0x19, 0x92, 0xE5, 0x49, 0x97, 0x19, 0x61, 0xAA, 0x94, 0x49, 0x71,
+    0x65, 0x4A, 0x9B, 0x26, 0x71, 0x8E, 0xD4, 0x09, 0x92, 0xE7, 0x47, 0x9F, 0x1C, 0x81, 0x92, 0xA4,
+    0xD9, 0x92, 0xA6, 0xD0, 0x8E, 0x44, 0x8F, 0xBE, 0x34, 0x6A, 0x31, 0x44, 0x03, 0x07, 0x16, 0x4E,
+    0x50, 0x24, 0x40, 0x51, 0x80, 0x84, 0xAB, 0x1F, 0x34, 0xB2, 0xB8, 0xF0, 0xE0, 0x02, 0x8B, 0x19,
+    0x5B, 0xBB, 0x7E, 0x45, 0xCA, 0xB4, 0xAC, 0x4C, 0xA5, 0x31, 0xCD, 0xC2, 0x14, 0x49, 0xA2, 0xC2,
+    0x8B, 0x19, 0x1D, 0x28, 0x4C, 0x9D, 0x3B, 0x13, 0xC3, 0x87, 0x19, 0x1E, 0x34, 0xCC, 0xB0, 0x8B,
+    0x57, 0x2F, 0xD9, 0xB3, 0x49, 0x03, 0xAB, 0x75, 0x89, 0x76, 0x26, 0x45, 0x0A, 0x25, 0x28, 0xB6,
+    0xB8, 0x00, 0x63, 0x06, 0x55, 0xC7, 0x31, 0x17, 0xA4, 0x98, 0x81, 0x82, 0xC1, 0x0C, 0xC9, 0x94,
+    0x2D, 0xFF, 0x5D, 0x2B, 0x18, 0xF0, 0x60, 0x96, 0x85, 0x6B, 0x56, 0x44, 0xE0, 0x02, 0xE3, 0xE3,
+    0xC7, 0xA2, 0x0B, 0xC4, 0x98, 0x11, 0xC3, 0xC0, 0x0C, 0xD5, 0xAC, 0x5D, 0x6F, 0x26, 0xDC, 0x99,
+    0xF3, 0xE7, 0x9B, 0x9D, 0x0F, 0x94, 0xFE, 0x20, 0x21, 0x01, 0x5D, 0xAB, 0x57, 0x4D, 0x68, 0x84,
+    0xDD, 0xFA, 0xF5, 0xEA, 0xE2, 0xB3, 0x41, 0xD7, 0xA6, 0x7D, 0x3B, 0x67, 0x67, 0x08, 0x89, 0x67,
+    0xAC, 0x08, 0x40, 0x17, 0x75, 0x4B, 0xCC, 0x95, 0x2F, 0x4F, 0xCE, 0x9E, 0x1C, 0x77, 0xF3, 0x9D,
+    0xCB, 0x95, 0x9B, 0xFF, 0x1D, 0xE1, 0x76, 0x06, 0x87, 0x01, 0xD5, 0x63, 0xF2, 0xF5, 0x90, 0x61,
+    0xEF, 0x5D, 0xF6, 0x43, 0xBF, 0xF7, 0x0C, 0xEF, 0xDD, 0xB3, 0x7D, 0x19, 0x1B, 0x14, 0x4C, 0x10,
+    0x71, 0x9A, 0xAE, 0xE8, 0xB0, 0x5E, 0x81, 0xC5, 0x55, 0x80, 0xDD, 0x39, 0x27, 0xDF, 0x4F, 0xF4,
+    0x19, 0x68, 0x9F, 0x6D, 0x0B, 0x32, 0xD7, 0xA0, 0x78, 0x0F, 0xD6, 0xC7, 0xE0, 0x84, 0x0E, 0x52,
+    0x08, 0xA1, 0x85, 0x12, 0x56, 0xA8, 0xE1, 0x85, 0x1B, 0x66, 0xC8, 0xE1, 0x87, 0x1E, 0x86, 0xA8,
+    0x20, 0x86, 0x23, 0x76, 0x58, 0x22, 0x88, 0x27, 0x8A, 0x08, 0xDE, 0x81, 0x41, 0x25, 0xB8, 0x62,
+    0x84, 0x29, 0xC6, 0xF8, 0x22, 0x89, 0x33, 0x9A, 0x58, 0x23, 0x8A, 0x37, 0xAA, 0x38, 0x1F, 0x8B,
+    0xF1, 0xC1, 0x98, 0xA3, 0x8C, 0x3B, 0xFA, 0x18, 0x24, 0x8D, 0x43, 0xDA, 0x58, 0x24, 0x8E, 0x47,
+    0xEA, 0xF8, 0x93, 0x44, 0x4C, 0x36, 0xE9, 0xE4, 0x93, 0x50, 0x46, 0xD9, 0x90, 0x8B, 0x49, 0x02,
+    0x89, 0x20, 0x8F, 0x05, 0xFE, 0xA8, 0x65, 0x95, 0x5B, 0x5E, 0x29, 0xA4, 0x97, 0x44, 0x82, 0x69,
+    0xA4, 0x98, 0x48, 0x92, 0xA9, 0x64, 0x8B, 0x58, 0x2E, 0xF5, 0x25, 0x9A, 0x6B, 0xF6, 0x18, 0x26,
+    0x9B, 0x6F, 0xBA, 0x39, 0x26, 0x9C, 0x73, 0xCA, 0x59, 0x26, 0x9D, 0x77, 0xDA, 0x79, 0xA6, 0x45,
+    0x00, 0xF4, 0xE9, 0x27, 0x00, 0x71, 0x66, 0xC9, 0xE5, 0xA0, 0x66, 0x5A, 0x89, 0x27, 0x47, 0x7D,
+    0x46, 0xA0, 0xE8, 0xA2, 0x11, 0xF4, 0x99, 0xA7, 0xA0, 0x85, 0x76, 0x79, 0xA8, 0xA1, 0x7A, 0x62,
+    0x04, 0x00, 0xA3, 0x98, 0x2A, 0x0A, 0x28, 0xA5, 0x90, 0x4E, 0x2A, 0x69, 0xA5, 0x9F, 0x76, 0x7A,
+    0x69, 0xA6, 0x99, 0x6E, 0x4A, 0xA8, 0xA7, 0xA7, 0x82, 0x9A, 0x6A, 0xA7, 0xAA, 0xCE, 0x30, 0x2A,
+    0xA9, 0xA5, 0x86, 0xFF, 0xAA, 0x66, 0xA0, 0xB3, 0xD6, 0xC9, 0xAA, 0xA0, 0xAF, 0xC2, 0x1A, 0x6B,
+    0xA4, 0xAB, 0xD6, 0xFA, 0xA8, 0xAF, 0x7B, 0xE2, 0xAA, 0x2B, 0xAC, 0xA6, 0xB6, 0x8A, 0x2A, 0xAF,
+    0xC8, 0x1E, 0xAB, 0x2C, 0xA8, 0xB9, 0x0E, 0x8B, 0x69, 0xB1, 0xC0, 0x72, 0x1A, 0xAD, 0xAC, 0x69,
+    0xB5, 0x99, 0x65, 0xB3, 0xCE, 0x2E, 0x0A, 0x6D, 0xB5, 0xB4, 0x72, 0x6B, 0xEB, 0xB4, 0xBD, 0x7A,
+    0xCB, 0x67, 0xB6, 0xA4, 0x6E, 0x6B, 0x98, 0xB5, 0xE0, 0x26, 0x6B, 0xEC, 0xBA, 0xD7, 0x92, 0xBB,
+    0x2B, 0xBB, 0xE9, 0x2E, 0x7B, 0x6B, 0xBC, 0xF0, 0x8A, 0x5B, 0x11, 0xB6, 0xE4, 0x9A, 0x2B, 0x5A,
+    0x9A, 0xF6, 0x4A, 0xDB, 0x2F, 0xB5, 0xE7, 0x5A, 0xEA, 0xEE, 0xB3, 0xEA, 0xCE, 0xFB, 0x6F, 0xB8,
+    0x01, 0x7F, 0xFB, 0x2F, 0xBE, 0xD9, 0xEA, 0x5B, 0x14, 0xBA, 0x07, 0x17, 0x4C, 0xAF, 0xC1, 0x2A,
+    0x29, 0xC4, 0xB0, 0xAE, 0x00, 0x48, 0xA9, 0xF1, 0xC6, 0x1C, 0x4B, 0x09, 0xD2, 0xC5, 0xC4, 0x22,
+    0xBC, 0x2F, 0xC4, 0x09, 0xFF, 0x1A, 0xF1, 0xB1, 0x20, 0x13, 0x2C, 0xF2, 0xC3, 0xDD, 0x96, 0x1C,
+    0xEC, 0xC4, 0xF1, 0xA6, 0xAC, 0xA9, 0xBF, 0x2E, 0xD3, 0x3C, 0x72, 0xCB, 0x37, 0xD7, 0x99, 0xB2,
+    0xC3, 0x27, 0xD7, 0x5B, 0x33, 0xC0, 0x39, 0x9B, 0xFC, 0xF3, 0x45, 0x89, 0x96, 0xCA, 0x73, 0xCF,
+    0x14, 0x07, 0xFD, 0x32, 0xD2, 0x30, 0x33, 0xED, 0xEA, 0x9F, 0x8E, 0x2A, 0x3C, 0xB4, 0xC4, 0x4E,
+    0x4F, 0x2D, 0x6F, 0xD3, 0x56, 0xFB, 0xAC, 0xB4, 0xCD, 0x2C, 0x4B, 0xBD, 0x35, 0xD0, 0x5D, 0x0B,
+    0xFD, 0xF5, 0xCA, 0xA1, 0x85, 0xBD, 0x74, 0xD6, 0x49, 0x9B, 0xCD, 0x75, 0xD9, 0x6C, 0x53, 0x49,
+    0x35, 0xDA, 0x58, 0x8F, 0xFD, 0xB6, 0xDC, 0x57, 0x57, 0x4D, 0xB7, 0xD6, 0x6A, 0x83, 0xDD, 0x36,
+    0xBF, 0x70, 0xDB, 0xFF, 0x9D, 0x37, 0xD9, 0x6E, 0xD7, 0xDD, 0xF7, 0xE0, 0x77, 0xA7, 0xBD, 0x37,
+    0xC9, 0x85, 0xC7, 0xFD, 0xF7, 0xDC, 0x8B, 0x0B, 0x9E, 0xB8, 0xDF, 0x87, 0xE3, 0xDC, 0x38, 0xDE,
+    0x91, 0x7B, 0x3D, 0xB9, 0xE1, 0x81, 0x53, 0x9E, 0x39, 0xE6, 0x7C, 0x3F, 0x4E, 0xF8, 0xE5, 0x8A,
+    0x57, 0x2E, 0x36, 0xE8, 0x90, 0x6F, 0x1E, 0xBA, 0xE9, 0xA5, 0x77, 0x4E, 0xFA, 0xE7, 0xA2, 0x9F,
+    0xED, 0xF9, 0xEB, 0xAB, 0xD7, 0xD4, 0xF1, 0xEC, 0xB4, 0xD7, 0x6E, 0x7B, 0x41, 0xA8, 0xB3, 0x9E,
+    0x3B, 0xEC, 0xAD, 0xAF, 0xBD, 0x7B, 0xEC, 0xC0, 0xF7, 0xAE, 0xF7, 0xEF, 0xC2, 0x03, 0xAE, 0x7A,
+    0xF1, 0x8C, 0x23, 0xEF, 0x78, 0xF0, 0xC4, 0x37, 0x7F, 0xBC, 0xF3, 0x88, 0x33, 0xFF, 0xFC, 0xF4,
+    0xD1, 0x2B, 0xAF, 0x39, 0xF5, 0x92, 0x5B, 0xCF, 0x79, 0xF5, 0xD0, 0x67, 0xDF, 0xBD, 0xE5, 0xDA,
+    0x9F, 0x8E, 0x3D, 0xF8, 0xDF, 0x8F, 0x1E, 0x7E, 0xEA, 0xDC, 0x8F, 0x6F, 0x7E, 0xF9, 0xAE, 0x4B,
+    0x9F, 0xFE, 0xFB, 0xDE, 0xAB, 0xDF, 0xFE, 0xF9, 0xBA, 0xCB, 0xEF, 0xBB, 0xFD, 0xC3, 0xE3, 0x6F,
+    0x3C, 0xFC, 0xE4, 0xEB, 0x9F, 0x3C, 0xFB, 0xF7, 0xE3, 0xDF, 0xFA, 0xFC, 0xB7, 0x3C, 0xFA, 0xF1,
+    0x0E, 0x80, 0xF9, 0x13, 0xE0, 0xFC, 0x10, 0x48, 0xB6, 0xDB, 0x39, 0xF0, 0x81, 0x10, 0x94, 0x08,
+    0x03, 0xFF, 0x47, 0xC0, 0xEB, 0x29, 0x30, 0x80, 0xF1, 0xBB, 0x60, 0x02, 0x33, 0xC8, 0xC1, 0xFE,
+    0x69, 0x70, 0x7F, 0x1D, 0x1C, 0xE0, 0x07, 0x29, 0x38, 0xC2, 0x02, 0x4E, 0xD0, 0x84, 0x15, 0xDC,
+    0x5E, 0x08, 0x17, 0x98, 0x42, 0xF1, 0x95, 0xD0, 0x82, 0x2B, 0xC4, 0xA0, 0x07, 0x63, 0xB8, 0xC1,
+    0x19, 0xDA, 0x50, 0x84, 0x34, 0x04, 0xE1, 0x0D, 0x59, 0xF8, 0x42, 0x15, 0xEE, 0x50, 0x86, 0x38,
+    0xFC, 0x61, 0x0D, 0xA6, 0x83, 0x48, 0x44, 0x1E, 0xE6, 0x90, 0x84, 0x47, 0x44, 0x61, 0x0F, 0x5D,
+    0x98, 0x44, 0x18, 0x0A, 0x51, 0x87, 0x45, 0x04, 0xA2, 0x11, 0x9F, 0x88, 0x44, 0x2A, 0x2A, 0xB1,
+    0x89, 0x3E, 0x8C, 0xE2, 0x10, 0xA7, 0xA8, 0xC5, 0x06, 0x46, 0xF0, 0x8B, 0x60, 0x0C, 0xA3, 0x01,
+    0xDD, 0x87, 0x45, 0x26, 0x5A, 0xD1, 0x89, 0x5D, 0xAC, 0x62, 0x1A, 0xAF, 0x78, 0xC6, 0x2C, 0x72,
+    0xF1, 0x8D, 0x52, 0x8C, 0xE3, 0x16, 0xE5, 0x08, 0x45, 0x38, 0x8E, 0x04, 0x04, 0x78, 0xCC, 0xA3,
+    0x1E, 0xF7, 0xC8, 0xC7, 0x3E, 0xFA, 0xF1, 0x8F, 0x80, 0x0C, 0xA4, 0x20, 0x07, 0x49, 0xC8, 0x42,
+    0x1A, 0xF2, 0x90, 0x88, 0x4C, 0xA4, 0x22, 0x17, 0xC9, 0xC8, 0x46, 0x3A, 0xF2, 0x91, 0x90, 0x8C,
+    0xA4, 0x24, 0x27, 0x49, 0xC9, 0x4A, 0x5A, 0xF2, 0x92, 0x98, 0xCC, 0xA4, 0x26, 0x37, 0xC9, 0xC9,
+    0x4E, 0x7A, 0xF2, 0x93, 0xA0, 0x0C, 0xA5, 0x28, 0x47, 0x49, 0xCA, 0x52, 0x9A, 0xF2, 0x94, 0xA8,
+    0x4C, 0xA5, 0x2A, 0x57, 0xC9, 0xCA, 0x56, 0xBA, 0xF2, 0x95, 0xB0, 0x8C, 0xA5, 0x2C, 0x67, 0x49,
+    0xCB, 0x5A, 0xDA, 0xF2, 0x96, 0xB8, 0x9C, 0x64, 0x40, 0x00, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06,
+    0x00, 0x38, 0x00, 0x2C, 0x0A, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x85, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF2, 0xF2, 0xF4, 0xF1, 0xF1, 0xF3, 0xEC,
+    0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB,
+    0xDF, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7, 0xDB, 0xCD, 0xCF, 0xD4, 0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF,
+    0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28, 0xC4, 0xC6, 0xCC, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC,
+    0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB5, 0xB7, 0xBF, 0xA6, 0xA9, 0xB2, 0x91, 0x95, 0xA0, 0x90, 0x94,
+    0x9F, 0x8F, 0x93, 0x9E, 0x8E, 0x91, 0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D,
+    0x7B, 0x7F, 0x8D, 0x76, 0x7B, 0x88, 0x28, 0x78, 0x3C, 0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67,
+    0x6C, 0x7B, 0x51, 0x57, 0x68, 0x42, 0x48, 0x5B, 0x35, 0x3B, 0x50, 0x2A, 0x31, 0x47, 0x29, 0x30,
+    0x46, 0x28, 0x30, 0x45, 0x26, 0x2E, 0x43, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C,
+    0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x12, 0x1A, 0x32, 0x11,
+    0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00,
+    0x71, 0x08, 0x1C, 0x48, 0xB0, 0xE0, 0xC0, 0x1B, 0x2F, 0x32, 0x10, 0xB8, 0x61, 0xB0, 0xA1, 0xC3,
+    0x82, 0x37, 0x22, 0x88, 0x28, 0xC0, 0xF0, 0xA1, 0x45, 0x83, 0x37, 0x5A, 0xE0, 0xA0, 0x78, 0xB1,
+    0xE3, 0x41, 0x86, 0x1C, 0x3D, 0x76, 0xBC, 0x01, 0xB2, 0xA2, 0x48, 0x8B, 0x24, 0x37, 0x9A, 0x3C,
+    0xE9, 0x30, 0x65, 0x48, 0x96, 0x2D, 0x49, 0xBE, 0x84, 0x49, 0xB3, 0xA6, 0xCD, 0x9B, 0x38, 0x73,
+    0xEA, 0xDC, 0xC9, 0xB3, 0xA7, 0xCF, 0x9F, 0x40, 0x83, 0x0A, 0x1D, 0x7A, 0x93, 0xE4, 0x0D, 0x17,
+    0x46, 0x71, 0x1A, 0x25, 0x89, 0x74, 0x69, 0xCD, 0xA5, 0x4C, 0xA1, 0xAE, 0xF4, 0x28, 0xF5, 0x68,
+    0xD5, 0x93, 0x55, 0xAD, 0x5E, 0x1D, 0x99, 0xB5, 0xE9, 0x56, 0x94, 0x5D, 0xB3, 0x4E, 0xC5, 0x28,
+    0xD6, 0xEB, 0xD7, 0x86, 0x62, 0xB5, 0x66, 0x05, 0x1B, 0x56, 0x2C, 0xDB, 0xAA, 0x66, 0xA5, 0xBE,
+    0x95, 0x1A, 0x17, 0xEA, 0x5C, 0xA8, 0x75, 0x9D, 0x3E, 0x4C, 0x9B, 0x37, 0xA9, 0x45, 0x17, 0x80,
+    0x03, 0x0B, 0x1E, 0x2C, 0x98, 0x2B, 0x5C, 0xB7, 0x86, 0xF1, 0xAE, 0x15, 0x79, 0x58, 0x2E, 0x4B,
+    0xBA, 0x8E, 0x61, 0x2A, 0x76, 0x0A, 0xA0, 0xB2, 0x65, 0x00, 0x8C, 0xA3, 0xA6, 0xAC, 0x2C, 0xA1,
+    0xB3, 0x67, 0x09, 0x95, 0x6B, 0x02, 0xF8, 0x4C, 0xBA, 0x33, 0x66, 0x96, 0xA3, 0x4B, 0x97, 0x3E,
+    0xED, 0x31, 0xB5, 0xEA, 0xD5, 0xAD, 0x5F, 0xCB, 0x66, 0xFD, 0xD0, 0xB5, 0x6C, 0xD2, 0xB4, 0x1B,
+    0xDA, 0xBE, 0x8D, 0xDB, 0xE2, 0x6E, 0xDE, 0x9E, 0x73, 0x17, 0xFC, 0x0D, 0x1C, 0xB4, 0xEF, 0xE2,
+    0xB0, 0x6B, 0x23, 0xEF, 0xAD, 0x7C, 0x79, 0xF0, 0xE3, 0xCE, 0x4D, 0x5F, 0x24, 0x7E, 0x5B, 0xB8,
+    0x41, 0xEA, 0xB3, 0x63, 0x23, 0xB7, 0xEE, 0x10, 0xFB, 0x67, 0xEE, 0xCD, 0xB3, 0xD3, 0x0A, 0xE4,
+    0xBC, 0x1A, 0x7C, 0xEB, 0xCB, 0xA1, 0x0D, 0x06, 0x04, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00,
+    0x45, 0x00, 0x2C, 0x14, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x53, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF1, 0xF1, 0xF3, 0xEC, 0xED, 0xEF, 0xEB, 0xEC,
+    0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD7, 0xD8, 0xDC,
+    0xD6, 0xD7, 0xDB, 0xD3, 0xD4, 0xD9, 0xCF, 0xD1, 0xD6, 0xCD, 0xCF, 0xD4, 0xCA, 0xCB, 0xD1, 0xC8,
+    0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28, 0xC5, 0xC7, 0xCD, 0xC4, 0xC6, 0xCC, 0xC1, 0xC3,
+    0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB9, 0xBB, 0xC2, 0xB5, 0xB7, 0xBF,
+    0xB2, 0xB5, 0xBC, 0xA3, 0xA6, 0xAF, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E, 0x8E,
+    0x91, 0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x28, 0x78,
+    0x3C, 0x70, 0x74, 0x83, 0x6C, 0x71, 0x80, 0x6B, 0x70, 0x7F, 0x69, 0x6E, 0x7D, 0x67, 0x6C, 0x7B,
+    0x63, 0x69, 0x78, 0x60, 0x65, 0x75, 0x52, 0x57, 0x69, 0x51, 0x57, 0x68, 0x44, 0x4A, 0x5D, 0x42,
+    0x48, 0x5B, 0x35, 0x3C, 0x50, 0x35, 0x3B, 0x50, 0x31, 0x38, 0x4C, 0x2A, 0x31, 0x47, 0x29, 0x30,
+    0x46, 0x28, 0x30, 0x45, 0x24, 0x2B, 0x41, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C,
+    0x1C, 0x24, 0x3B, 0x1B, 0x23, 0x3A, 0x1A, 0x22, 0x39, 0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13,
+    0x1B, 0x32, 0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x8B,
+    0x08, 0x1C, 0x38, 0x10, 0x85, 0x84, 0x06, 0x2E, 0x08, 0x2A, 0x5C, 0xC8, 0x90, 0x20, 0x0E, 0x0A,
+    0x42, 0x64, 0x28, 0x68, 0x48, 0x91, 0xA2, 0x8C, 0x16, 0x45, 0x7C, 0x18, 0xA8, 0xC8, 0xB1, 0xA1,
+    0x8A, 0x0E, 0x1D, 0x43, 0x0E, 0xA4, 0xB1, 0x00, 0x87, 0xC8, 0x90, 0x3D, 0x1C, 0xC0, 0x38, 0xD9,
+    0x71, 0x08, 0x07, 0x16, 0x44, 0x58, 0x72, 0x4C, 0x31, 0xA0, 0x42, 0x05, 0x0D, 0x32, 0x73, 0xEA,
+    0xDC, 0xC9, 0xB3, 0xA7, 0xCF, 0x9F, 0x40, 0x83, 0x0A, 0x1D, 0x4A, 0xB4, 0xA8, 0xD1, 0xA3, 0x48,
+    0x93, 0x2A, 0x5D, 0xCA, 0xB4, 0xA9, 0xD3, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5,
+    0xAB, 0x0D, 0x89, 0x68, 0xDD, 0x1A, 0x93, 0x27, 0xD7, 0xAF, 0x5A, 0x75, 0x82, 0x1D, 0x2B, 0x73,
+    0xAC, 0xD9, 0x93, 0x66, 0xD3, 0x86, 0x4C, 0xCB, 0xB6, 0x23, 0x5B, 0xB5, 0x15, 0x73, 0xBC, 0x35,
+    0x9B, 0x23, 0xEE, 0xDC, 0xB1, 0x75, 0x29, 0xCA, 0xBD, 0xFB, 0x35, 0x6F, 0xC3, 0xBD, 0x7C, 0xB7,
+    0xFA, 0x65, 0x08, 0x38, 0x30, 0x91, 0xC1, 0x0B, 0x0B, 0x07, 0x46, 0xAC, 0x50, 0x31, 0x5F, 0xC6,
+    0x0A, 0x0D, 0x6F, 0xED, 0x98, 0xA3, 0xB2, 0xE5, 0xCB, 0x98, 0x2F, 0xAF, 0x35, 0x8C, 0x96, 0x6F,
+    0xD9, 0xB9, 0x62, 0xDB, 0x7A, 0x05, 0x9B, 0x14, 0x80, 0xE9, 0xD3, 0x00, 0x7A, 0x9A, 0x9E, 0xC0,
+    0xBA, 0xF5, 0x04, 0xD3, 0x3A, 0x01, 0xB8, 0x9E, 0xCD, 0x3A, 0x35, 0x4B, 0xD9, 0xB4, 0x69, 0xDB,
+    0x0E, 0x89, 0x3B, 0xB7, 0x6E, 0xDE, 0xBE, 0x83, 0xEF, 0xA6, 0xD8, 0x3B, 0xF8, 0xEC, 0xE1, 0x0C,
+    0x8B, 0x1B, 0x3F, 0x5E, 0x51, 0xF9, 0xF2, 0xD6, 0xC8, 0x15, 0x3A, 0x7F, 0xFE, 0xBA, 0x39, 0xF5,
+    0xDF, 0xC4, 0xAF, 0x33, 0xCF, 0xAE, 0x1D, 0xBA, 0xF5, 0xEE, 0xB5, 0x39, 0x4E, 0x1B, 0x37, 0x1E,
+    0x7D, 0xE1, 0x78, 0xE1, 0xC0, 0xAF, 0x97, 0x6F, 0x78, 0xDE, 0xF5, 0x7A, 0xEE, 0xE8, 0x73, 0xAE,
+    0xD6, 0xFD, 0x9E, 0x37, 0x6A, 0xD8, 0x0B, 0x03, 0x02, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00,
+    0x4F, 0x00, 0x2C, 0x1C, 0x00, 0x04, 0x00, 0x21, 0x00, 0x67, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF6, 0xF6, 0xF7, 0xF5, 0xF5, 0xF6, 0xF1, 0xF1, 0xF3, 0xEE, 0xEF,
+    0xF0, 0xEC, 0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xE2, 0xE3, 0xE6,
+    0xDD, 0xDE, 0xE2, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7, 0xDB, 0xD0,
+    0xD2, 0xD6, 0xCD, 0xCF, 0xD4, 0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8,
+    0x28, 0xC5, 0xC7, 0xCD, 0xC4, 0xC6, 0xCC, 0xC3, 0xC5, 0xCB, 0xC1, 0xC3, 0xC9, 0xBF, 0xC1, 0xC8,
+    0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB5, 0xB7, 0xBF, 0xAE, 0xB1, 0xB9, 0xA9,
+    0xAC, 0xB4, 0xA8, 0xAB, 0xB4, 0x9A, 0x9D, 0xA7, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93,
+    0x9E, 0x8E, 0x91, 0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7F, 0x83, 0x90, 0x7D, 0x81, 0x8E,
+    0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x28, 0x78, 0x3C, 0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67,
+    0x6C, 0x7B, 0x5F, 0x64, 0x74, 0x5A, 0x60, 0x70, 0x56, 0x5C, 0x6D, 0x51, 0x57, 0x68, 0x50, 0x56,
+    0x67, 0x4F, 0x55, 0x66, 0x49, 0x4F, 0x62, 0x42, 0x48, 0x5B, 0x35, 0x3C, 0x50, 0x35, 0x3B, 0x50,
+    0x2C, 0x33, 0x48, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x27, 0x2F, 0x44, 0x1E,
+    0x28, 0x46, 0x20, 0x27, 0x3E, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x19, 0x21,
+    0x38, 0x17, 0x1E, 0x36, 0x16, 0x1D, 0x35, 0x15, 0x1D, 0x34, 0x14, 0x1C, 0x33, 0x13, 0x1B, 0x32,
+    0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x8D,
+    0x80, 0xC0, 0x10, 0x81, 0xC6, 0x93, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0x50, 0xC5, 0x0A, 0x27,
+    0x40, 0x16, 0x30, 0x9C, 0x48, 0x31, 0xA1, 0x10, 0x24, 0x4F, 0x6C, 0x30, 0xA8, 0xC8, 0x91, 0x62,
+    0x88, 0x01, 0x37, 0x3A, 0x8A, 0x54, 0xE8, 0x64, 0x86, 0x88, 0x91, 0x23, 0x47, 0x28, 0x71, 0xB2,
+    0xC4, 0x00, 0x4A, 0x91, 0x22, 0x64, 0x38, 0xC1, 0x31, 0xE1, 0x65, 0x47, 0x1E, 0x19, 0x2E, 0x6C,
+    0xD0, 0x61, 0xB3, 0xA7, 0xCF, 0x9F, 0x40, 0x83, 0x0A, 0x1D, 0x4A, 0xB4, 0xA8, 0xD1, 0xA3, 0x48,
+    0x93, 0x2A, 0x5D, 0xCA, 0xB4, 0xA9, 0xD3, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5,
+    0xAB, 0x58, 0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0xD7, 0xAF, 0x60, 0xC3, 0x8A, 0x1D, 0x4B, 0xB6,
+    0xAC, 0xD9, 0xB3, 0x68, 0xD3, 0x1E, 0x74, 0xC2, 0x36, 0x08, 0x5B, 0x27, 0x43, 0xDF, 0xB6, 0x95,
+    0x0B, 0xF7, 0x27, 0x5D, 0x27, 0x6E, 0xE9, 0xFA, 0xBC, 0x8B, 0x97, 0xAF, 0x4D, 0xBE, 0x7D, 0xFD,
+    0x8E, 0x04, 0x1C, 0x58, 0x70, 0x47, 0xC2, 0x79, 0x0D, 0x57, 0x24, 0x5C, 0x58, 0xF1, 0x44, 0xC6,
+    0x89, 0x1D, 0x33, 0x84, 0xCC, 0xF8, 0x30, 0xE2, 0xCA, 0x1C, 0x29, 0x13, 0xB6, 0x0C, 0x38, 0xF2,
+    0x5D, 0xCE, 0x7C, 0x3D, 0xEB, 0xED, 0x18, 0xA4, 0xB4, 0xE9, 0xD3, 0xA8, 0x4F, 0x0F, 0xEE, 0xBC,
+    0x79, 0xF5, 0x5D, 0xD1, 0x6C, 0xFF, 0xBE, 0x96, 0x2C, 0x72, 0xF6, 0xE8, 0xBD, 0x72, 0x3D, 0xC7,
+    0x9D, 0x1B, 0xFB, 0x20, 0x80, 0xDF, 0xC0, 0x01, 0x0C, 0xFD, 0x6D, 0xA1, 0xB8, 0x71, 0x0B, 0xBF,
+    0x81, 0x02, 0x38, 0xCE, 0xBC, 0xB8, 0xF0, 0x9E, 0xCB, 0x9B, 0x37, 0x7F, 0x8E, 0x32, 0xBA, 0xF4,
+    0xE9, 0xD5, 0xAF, 0x6B, 0xA7, 0xCE, 0xD1, 0xBA, 0x76, 0xE6, 0xDC, 0x29, 0x7A, 0x39, 0xFF, 0x0E,
+    0xBE, 0xE3, 0x78, 0xF2, 0xC6, 0xC3, 0x33, 0x3C, 0x8F, 0x1E, 0xB9, 0xF9, 0xF6, 0xD8, 0xBB, 0xC3,
+    0x2F, 0x2F, 0x7F, 0x7E, 0xFA, 0xF7, 0xF6, 0x9D, 0x8B, 0x64, 0xFF, 0x5D, 0xFD, 0x44, 0xFE, 0xDB,
+    0x65, 0x07, 0x9F, 0x7F, 0x15, 0x01, 0x78, 0x1C, 0x81, 0xF5, 0x05, 0xF8, 0x13, 0x71, 0xD3, 0x21,
+    0x58, 0x5D, 0x70, 0xC9, 0x2D, 0x14, 0x10, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00, 0x3F, 0x00,
+    0x2C, 0x1C, 0x00, 0x04, 0x00, 0x2B, 0x00, 0x67, 0x00, 0x85, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFD,
+    0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF3, 0xF3, 0xF4, 0xF1, 0xF1, 0xF3, 0xEC,
+    0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB,
+    0xDF, 0xD8, 0xD9, 0xDD, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7, 0xDB, 0xCD, 0xCF, 0xD4, 0xCB, 0xCD, 0xD2,
+    0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28, 0xC4, 0xC6, 0xCC, 0xC1,
+    0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB5, 0xB7, 0xBF, 0xB4, 0xB7,
+    0xBE, 0xA8, 0xAB, 0xB4, 0x9C, 0x9F, 0xA9, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E,
+    0x8E, 0x91, 0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x28,
+    0x78, 0x3C, 0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x64, 0x6A, 0x79, 0x61, 0x66,
+    0x76, 0x55, 0x5B, 0x6C, 0x51, 0x57, 0x68, 0x48, 0x4E, 0x61, 0x42, 0x48, 0x5B, 0x35, 0x3B, 0x50,
+    0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E,
+    0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x12, 0x1A,
+    0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x7D, 0x08, 0x6C,
+    0x21, 0xE0, 0x87, 0xC1, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0xD0, 0xA0, 0x40, 0x1C, 0x12, 0x0A,
+    0x34, 0x9C, 0x48, 0x91, 0xA1, 0x40, 0x0F, 0x2C, 0x0C, 0x54, 0xDC, 0xC8, 0xF1, 0x05, 0x07, 0x1F,
+    0x1A, 0x39, 0x8A, 0x64, 0x98, 0x23, 0x02, 0x0D, 0x90, 0x23, 0x53, 0x26, 0x5C, 0xD1, 0xC0, 0x82,
+    0x85, 0x00, 0x1D, 0x54, 0xCA, 0x14, 0xF8, 0x03, 0xA5, 0x4C, 0x95, 0x02, 0x05, 0x86, 0xBC, 0xC9,
+    0xB3, 0xA7, 0xCF, 0x9F, 0x40, 0x83, 0x0A, 0x1D, 0x4A, 0xB4, 0xA8, 0xD1, 0xA3, 0x48, 0x93, 0x2A,
+    0x5D, 0xCA, 0xB4, 0xA9, 0xD3, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5, 0xAB, 0x58,
+    0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0xD7, 0xAF, 0x60, 0xC3, 0x8A, 0x1D, 0x4B, 0xB6, 0xAC, 0xD9,
+    0xB3, 0x68, 0xD3, 0xAA, 0x5D, 0xCB, 0xB6, 0xAD, 0x5B, 0x9E, 0x00, 0xE2, 0xCA, 0x05, 0x90, 0x34,
+    0x6E, 0x85, 0xBB, 0x78, 0x2B, 0xC4, 0x35, 0x0A, 0x20, 0xAF, 0xDF, 0xBB, 0x74, 0x87, 0xF6, 0xFD,
+    0xFB, 0x37, 0x30, 0xD0, 0xC1, 0x84, 0x0B, 0x1F, 0x4E, 0xCC, 0xD8, 0x30, 0x5C, 0xC6, 0x89, 0x1D,
+    0xCB, 0x44, 0x0C, 0x59, 0xF1, 0xE3, 0xCA, 0x84, 0x25, 0xA7, 0xA4, 0x8C, 0x19, 0xAF, 0xE6, 0x91,
+    0x9C, 0x3B, 0xEB, 0xED, 0x19, 0xBA, 0xF3, 0x67, 0x91, 0xA5, 0x31, 0x9F, 0xE6, 0x98, 0xBA, 0xF2,
+    0x6A, 0xD6, 0xA2, 0x3D, 0xFF, 0x6C, 0x1D, 0x79, 0xB1, 0xE8, 0xD7, 0x9B, 0x4D, 0x13, 0xA5, 0x3D,
+    0xBA, 0xA8, 0xDD, 0xC2, 0xB8, 0x37, 0xE6, 0x1C, 0x7E, 0x70, 0xAE, 0xDC, 0x9F, 0xC3, 0x93, 0xD3,
+    0x2C, 0xAA, 0xBC, 0x39, 0xD1, 0xE6, 0xD0, 0x85, 0x42, 0x9F, 0x0E, 0x74, 0xBA, 0x75, 0xE4, 0xD6,
+    0xA3, 0xF7, 0xAC, 0x91, 0x1D, 0x7A, 0x8D, 0xED, 0xDD, 0x9B, 0x7F, 0x39, 0xE7, 0xC9, 0x3D, 0x7C,
+    0xF2, 0xF1, 0x37, 0xCB, 0x9B, 0xCF, 0x89, 0x5E, 0xA6, 0xFA, 0xF5, 0x3E, 0xDA, 0xAB, 0x7C, 0xBF,
+    0x5E, 0x7E, 0x4A, 0xFA, 0xE6, 0xED, 0xDF, 0xAF, 0xC1, 0xBF, 0xBF, 0xFF, 0xFF, 0xFD, 0x61, 0x07,
+    0x9F, 0x0F, 0xD5, 0xC1, 0x27, 0x9D, 0x79, 0xCF, 0x75, 0x67, 0x54, 0x76, 0x49, 0x9D, 0xE0, 0xE0,
+    0x83, 0x27, 0xA4, 0x14, 0x10, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00, 0x46, 0x00, 0x2C, 0x1C,
+    0x00, 0x04, 0x00, 0x35, 0x00, 0x53, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF9, 0xF7, 0xF7,
+    0xF8, 0xF5, 0xF5, 0xF6, 0xF1, 0xF1, 0xF3, 0xEC, 0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9, 0xEA, 0xEC,
+    0xE6, 0xE7, 0xE9, 0xE0, 0xE1, 0xE4, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD7, 0xD8, 0xDC, 0xD6,
+    0xD7, 0xDB, 0xCD, 0xCF, 0xD4, 0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8,
+    0x28, 0xC4, 0xC6, 0xCC, 0xC2, 0xC4, 0xCA, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBF, 0xC5,
+    0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB7, 0xB9, 0xC0, 0xB5, 0xB7, 0xBF, 0xAD, 0xB0, 0xB8, 0xA0,
+    0xA4, 0xAD, 0x96, 0x9A, 0xA4, 0x95, 0x99, 0xA3, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93,
+    0x9E, 0x8E, 0x91, 0x9D, 0x8C, 0x90, 0x9B, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7F, 0x83, 0x90,
+    0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x74, 0x79, 0x87, 0x28, 0x78, 0x3C, 0x71, 0x76, 0x84, 0x70,
+    0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x5D, 0x62, 0x73, 0x5A, 0x60, 0x70, 0x51, 0x57,
+    0x68, 0x46, 0x4D, 0x5F, 0x42, 0x48, 0x5B, 0x35, 0x3B, 0x50, 0x33, 0x3A, 0x4E, 0x31, 0x38, 0x4C,
+    0x2E, 0x35, 0x4A, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x1E, 0x28, 0x46, 0x1F,
+    0x26, 0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13, 0x1B,
+    0x32, 0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x65, 0x24, 0x98, 0x30, 0x81,
+    0x84, 0x91, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0xB0, 0xA1, 0x43, 0x84, 0x2F, 0x58, 0x14, 0x99,
+    0xF8, 0xB0, 0xA2, 0xC5, 0x8B, 0x07, 0x4F, 0xC4, 0x98, 0x58, 0x04, 0xA3, 0xC7, 0x8F, 0x08, 0x3D,
+    0x74, 0x80, 0xA0, 0xE1, 0x06, 0xC8, 0x93, 0x17, 0x3F, 0xA8, 0x28, 0x02, 0x83, 0x02, 0xCA, 0x97,
+    0x0E, 0x71, 0x08, 0x29, 0x22, 0xA4, 0x40, 0x47, 0x98, 0x38, 0x11, 0x72, 0x88, 0x61, 0x64, 0x86,
+    0xCB, 0x9C, 0x40, 0x6D, 0x40, 0x98, 0x70, 0xC1, 0x24, 0xD0, 0xA3, 0x48, 0x93, 0x2A, 0x5D, 0xCA,
+    0xB4, 0xA9, 0xD3, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5, 0xAB, 0x58, 0xB3, 0x6A,
+    0xDD, 0xCA, 0xB5, 0xAB, 0xD7, 0xAF, 0x60, 0xC3, 0x8A, 0x1D, 0x4B, 0xB6, 0xAC, 0xD9, 0xB3, 0x68,
+    0xD3, 0xAA, 0x5D, 0xCB, 0xB6, 0xAD, 0xDB, 0xA6, 0x00, 0xE2, 0xCA, 0x05, 0xA0, 0x35, 0xAE, 0x84,
+    0xBB, 0x78, 0x25, 0xC4, 0xBD, 0x0A, 0x20, 0xAF, 0xDF, 0xBB, 0x74, 0xA9, 0xF6, 0xFD, 0xFB, 0x37,
+    0x70, 0xD4, 0xC1, 0x84, 0x0B, 0x1F, 0x4E, 0xCC, 0xD8, 0x30, 0x5C, 0xC6, 0x89, 0x1D, 0x2F, 0x45,
+    0x0C, 0x59, 0xF1, 0xE3, 0xCA, 0x84, 0x25, 0x27, 0xA5, 0x8C, 0x19, 0xAF, 0x66, 0xA4, 0x9C, 0x3B,
+    0xEB, 0x75, 0x1A, 0xBA, 0xF3, 0xE7, 0xA3, 0xA5, 0x31, 0x9F, 0x06, 0x9A, 0xBA, 0xF2, 0x6A, 0xD6,
+    0xA2, 0x3D, 0x43, 0x6D, 0x1D, 0x79, 0xB1, 0xE8, 0xD7, 0x9B, 0x4D, 0x57, 0xA5, 0x3D, 0xDA, 0xAA,
+    0xDD, 0xC2, 0xB8, 0x9F, 0xCE, 0x95, 0x2B, 0x95, 0x23, 0x0F, 0x8E, 0x5A, 0x39, 0x4E, 0x3C, 0xAE,
+    0xFC, 0xAA, 0xF2, 0xE5, 0xCF, 0x6F, 0x4E, 0x8D, 0x5E, 0x84, 0xF9, 0xF3, 0xE9, 0xD4, 0xAD, 0x5F,
+    0x87, 0x4A, 0x1D, 0x7A, 0x77, 0xEE, 0xDD, 0xB5, 0x6F, 0x3D, 0x6F, 0xDA, 0xDD, 0xFB, 0x77, 0xF2,
+    0xE5, 0xC5, 0x8F, 0x5F, 0x5A, 0xBE, 0x7A, 0x7B, 0xA7, 0xED, 0xD5, 0x37, 0x47, 0x1F, 0xFE, 0x3D,
+    0xFD, 0xEC, 0xF6, 0x99, 0xC6, 0xCF, 0xCF, 0x94, 0x87, 0xFF, 0xFF, 0x00, 0x06, 0x08, 0x20, 0x78,
+    0xF8, 0x9D, 0xF7, 0x54, 0x7D, 0xD4, 0x61, 0xF7, 0x9C, 0x7C, 0x55, 0x45, 0xA7, 0x9E, 0x73, 0xCA,
+    0x89, 0x97, 0x9C, 0x79, 0x20, 0x05, 0x04, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00, 0x4D, 0x00,
+    0x2C, 0x1C, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF9,
+    0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF2, 0xF2, 0xF4, 0xF1, 0xF1, 0xF3, 0xEC, 0xED, 0xEF, 0xEB,
+    0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDC, 0xDD, 0xE1, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB,
+    0xDF, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7, 0xDB, 0xCD, 0xCF, 0xD4, 0xCB, 0xCC, 0xD2, 0xCA, 0xCB, 0xD1,
+    0xC9, 0xCA, 0xD0, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xC6, 0xC8, 0xCD, 0xFA, 0xC8, 0x28, 0xC4,
+    0xC6, 0xCC, 0xC3, 0xC5, 0xCB, 0xC1, 0xC3, 0xC9, 0xC0, 0xC2, 0xC9, 0xBF, 0xC1, 0xC8, 0xBD, 0xC0,
+    0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB8, 0xBA, 0xC1, 0xB5, 0xB7, 0xBF, 0xB4, 0xB7, 0xBE,
+    0xB3, 0xB6, 0xBD, 0x9E, 0xA2, 0xAB, 0x99, 0x9C, 0xA7, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F,
+    0x93, 0x9E, 0x8E, 0x91, 0x9D, 0x8D, 0x90, 0x9C, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7F, 0x83,
+    0x90, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x73, 0x78, 0x86, 0x28, 0x78, 0x3C, 0x70, 0x74, 0x83,
+    0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x5E, 0x63, 0x73, 0x5C, 0x61, 0x72, 0x51, 0x57, 0x68, 0x4D,
+    0x53, 0x65, 0x42, 0x48, 0x5B, 0x35, 0x3B, 0x50, 0x32, 0x39, 0x4D, 0x31, 0x38, 0x4C, 0x30, 0x37,
+    0x4C, 0x2E, 0x35, 0x4A, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x25, 0x2C, 0x42,
+    0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x16,
+    0x1D, 0x35, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x95, 0x90, 0x80,
+    0x50, 0x81, 0x47, 0x93, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0xB0, 0xA1, 0xC3, 0x87, 0x08, 0x5F,
+    0xA4, 0x68, 0x52, 0x43, 0x04, 0xC4, 0x8B, 0x18, 0x33, 0x36, 0x94, 0xA0, 0xA3, 0xC9, 0x11, 0x16,
+    0x1A, 0x43, 0x8A, 0x7C, 0x68, 0xC0, 0xC5, 0x85, 0x10, 0x3D, 0x46, 0xAA, 0x5C, 0xD9, 0x84, 0x00,
+    0x8D, 0x26, 0x34, 0x32, 0xB0, 0x9C, 0xA9, 0x51, 0x01, 0xCD, 0x9B, 0x1A, 0x47, 0xDC, 0x68, 0x72,
+    0x43, 0x03, 0xCE, 0x9F, 0x0C, 0x83, 0x7C, 0xC0, 0xB0, 0x01, 0xA8, 0xD1, 0xA3, 0x48, 0x93, 0x2A,
+    0x5D, 0xCA, 0xB4, 0xA9, 0xD3, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5, 0xAB, 0x58,
+    0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0x46, 0x00, 0x60, 0xC3, 0x02, 0xF0, 0x7A, 0x10, 0xAC, 0x85,
+    0xB3, 0x68, 0x2D, 0x80, 0xED, 0x0A, 0x20, 0xAD, 0xDB, 0xB3, 0x63, 0xB5, 0xB6, 0x7D, 0xFB, 0x36,
+    0xEE, 0xD5, 0xB9, 0x74, 0xEB, 0xDE, 0xCD, 0xCB, 0xD7, 0xEE, 0x54, 0xBC, 0x7C, 0xDD, 0xFA, 0x8D,
+    0x0A, 0x38, 0xB0, 0x60, 0xAA, 0x85, 0x0D, 0xA3, 0x1D, 0xFC, 0x34, 0xB1, 0x62, 0xB5, 0x88, 0x1F,
+    0xEB, 0xFD, 0x2B, 0xF9, 0x30, 0xE5, 0xCA, 0x8B, 0x23, 0x63, 0x86, 0x5B, 0xD5, 0x71, 0x60, 0xC6,
+    0x50, 0x3D, 0xF7, 0xDD, 0x2B, 0x19, 0xB4, 0x54, 0xD1, 0x69, 0x4D, 0x5F, 0x1E, 0x4D, 0x95, 0x89,
+    0xEB, 0xD7, 0x4C, 0x9A, 0x98, 0xAD, 0xAB, 0x7A, 0x29, 0xEC, 0xDB, 0xAE, 0x65, 0x8B, 0x5D, 0xDB,
+    0x1A, 0x37, 0xEE, 0xAD, 0xBE, 0x83, 0x67, 0x0D, 0x4E, 0xFC, 0x2A, 0xF1, 0xE3, 0x56, 0x8F, 0x17,
+    0xA7, 0x2A, 0x44, 0x79, 0x70, 0x21, 0xCC, 0x9D, 0xFB, 0x86, 0x3E, 0xB5, 0xB9, 0xF4, 0xDB, 0xD4,
+    0xA5, 0x5A, 0xBF, 0xFE, 0x3A, 0x7B, 0xD4, 0xED, 0xDC, 0x99, 0x78, 0x24, 0x87, 0x0A, 0x9E, 0xFB,
+    0xF8, 0xA7, 0xE5, 0xAF, 0x9F, 0x7F, 0x1A, 0xFE, 0xB5, 0x55, 0x21, 0xF0, 0xE3, 0xCB, 0x9F, 0x2F,
+    0xDF, 0x78, 0xF8, 0xE1, 0xD7, 0x81, 0x3B, 0xEF, 0xAA, 0x9C, 0x6C, 0x13, 0xDF, 0x22, 0x05, 0x04,
+    0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00, 0x43, 0x00, 0x2C, 0x1C, 0x00, 0x04, 0x00, 0x49, 0x00,
+    0x3F, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF1,
+    0xF1, 0xF3, 0xED, 0xEE, 0xF0, 0xEC, 0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7,
+    0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7, 0xDB, 0xD2, 0xD4, 0xD8,
+    0xCD, 0xCF, 0xD4, 0xCB, 0xCC, 0xD2, 0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA,
+    0xC8, 0x28, 0xC5, 0xC7, 0xCD, 0xC4, 0xC6, 0xCC, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE,
+    0xC5, 0xBB, 0xBD, 0xC4, 0xB6, 0xB8, 0xC0, 0xB5, 0xB7, 0xBF, 0xB2, 0xB5, 0xBC, 0xAD, 0xB0, 0xB8,
+    0xA0, 0xA4, 0xAD, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E, 0x8E, 0x91, 0x9D, 0x8A,
+    0x8E, 0x9A, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x28, 0x78,
+    0x3C, 0x70, 0x74, 0x83, 0x6E, 0x73, 0x81, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x59, 0x5F, 0x6F,
+    0x51, 0x57, 0x68, 0x4A, 0x50, 0x62, 0x44, 0x4A, 0x5D, 0x42, 0x48, 0x5B, 0x35, 0x3B, 0x50, 0x32,
+    0x39, 0x4D, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x25, 0x2C, 0x42, 0x1E, 0x28,
+    0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34,
+    0x13, 0x1B, 0x32, 0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x3D, 0x58, 0xB0, 0x10, 0xA1, 0xC0, 0x90, 0x83, 0x08, 0x13,
+    0x2A, 0x5C, 0xC8, 0xB0, 0xA1, 0xC3, 0x87, 0x10, 0x0F, 0x0A, 0x11, 0x32, 0x64, 0x05, 0x89, 0x88,
+    0x18, 0x33, 0x6A, 0xCC, 0x38, 0x31, 0x88, 0x03, 0x1C, 0x1B, 0x43, 0x8A, 0x0C, 0x39, 0xD1, 0xC5,
+    0x07, 0x8A, 0x23, 0x53, 0xAA, 0x64, 0x38, 0xB1, 0xC2, 0x0C, 0x94, 0x2B, 0x63, 0xAA, 0x14, 0x12,
+    0x63, 0xC3, 0x44, 0x99, 0x38, 0x47, 0x0A, 0xE9, 0x00, 0xE3, 0x66, 0xCE, 0x9F, 0x19, 0x69, 0x40,
+    0x98, 0x08, 0x13, 0xA8, 0xD1, 0xA3, 0x48, 0x93, 0x2A, 0x5D, 0xCA, 0xB4, 0xA9, 0xD3, 0xA7, 0x50,
+    0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5, 0xAB, 0x58, 0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0xD7,
+    0xAF, 0x46, 0x89, 0xE6, 0x20, 0x0A, 0xD6, 0x21, 0xD1, 0x89, 0x63, 0xCF, 0x96, 0x55, 0x78, 0x16,
+    0x6D, 0xDB, 0xA2, 0x60, 0xDF, 0x0A, 0x49, 0xDB, 0x76, 0xAD, 0xDC, 0xB9, 0x77, 0xE3, 0xDE, 0xA5,
+    0xFB, 0xF6, 0xEB, 0x5D, 0xBC, 0x79, 0xBB, 0xFE, 0x05, 0x1C, 0x78, 0xEB, 0x60, 0xBE, 0x7D, 0xB9,
+    0x1E, 0x1E, 0x2C, 0xF8, 0x2F, 0xE2, 0xBA, 0x8A, 0x1D, 0x33, 0x8E, 0xBC, 0x77, 0xB2, 0x61, 0xC9,
+    0x7F, 0xBD, 0xE6, 0xD8, 0xCC, 0xB9, 0xB3, 0xE7, 0xCE, 0x7E, 0x2B, 0x17, 0x6E, 0xFC, 0xF6, 0xB1,
+    0x4F, 0xBD, 0x6D, 0x4D, 0xAF, 0x95, 0x98, 0x3A, 0xF1, 0xEA, 0x21, 0xAD, 0xD5, 0xBE, 0x4E, 0x28,
+    0x96, 0xEC, 0x41, 0x00, 0xB8, 0x73, 0x03, 0x98, 0x9D, 0x10, 0x37, 0x85, 0xDF, 0xC0, 0x29, 0xE0,
+    0xE6, 0x0D, 0x20, 0xB8, 0xF1, 0xDF, 0xBB, 0x57, 0x17, 0x3F, 0x7E, 0x3C, 0x39, 0xD8, 0xE5, 0xCC,
+    0x9B, 0x3F, 0x8F, 0x4E, 0xDD, 0x39, 0x57, 0xE8, 0xD4, 0x8D, 0x5B, 0xD7, 0x8A, 0x3D, 0xBB, 0xF6,
+    0xAE, 0xDD, 0xBD, 0x03, 0x32, 0xDF, 0x8E, 0x35, 0xBC, 0x78, 0xE1, 0xE0, 0xCF, 0x4B, 0xBF, 0xAE,
+    0xFE, 0x3B, 0xFB, 0xF6, 0xE3, 0xD3, 0xC3, 0x47, 0xEE, 0xD5, 0x7C, 0x76, 0xF2, 0x59, 0xED, 0x57,
+    0x9F, 0xAE, 0x1E, 0xFF, 0x56, 0xFD, 0xC1, 0xF9, 0xF7, 0xDE, 0x7E, 0xB3, 0xF9, 0xD6, 0x9C, 0x80,
+    0xCF, 0xE9, 0x36, 0xDC, 0x42, 0x01, 0x01, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00, 0x4D, 0x00,
+    0x2C, 0x1C, 0x00, 0x04, 0x00, 0x53, 0x00, 0x53, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF8, 0xF9, 0xF9,
+    0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF1, 0xF1, 0xF3, 0xEF, 0xF0, 0xF1, 0xED,
+    0xEE, 0xF0, 0xEC, 0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xE3, 0xE4,
+    0xE7, 0xE2, 0xE3, 0xE6, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD9, 0xDA, 0xDE, 0xD7, 0xD8, 0xDC,
+    0xD6, 0xD7, 0xDB, 0xD0, 0xD2, 0xD6, 0xCF, 0xD1, 0xD6, 0xCD, 0xCF, 0xD4, 0xCB, 0xCC, 0xD2, 0xCA,
+    0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28, 0xC5, 0xC7, 0xCD, 0xC4, 0xC6,
+    0xCC, 0xC3, 0xC5, 0xCB, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4,
+    0xB5, 0xB7, 0xBF, 0xA4, 0xA7, 0xB0, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E, 0x8E,
+    0x91, 0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x28, 0x78,
+    0x3C, 0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x60, 0x65, 0x75, 0x5E, 0x63, 0x73,
+    0x57, 0x5D, 0x6E, 0x51, 0x57, 0x68, 0x4F, 0x55, 0x66, 0x49, 0x4F, 0x62, 0x48, 0x4E, 0x61, 0x45,
+    0x4C, 0x5E, 0x43, 0x49, 0x5C, 0x42, 0x48, 0x5B, 0x41, 0x47, 0x5A, 0x3D, 0x43, 0x57, 0x3C, 0x43,
+    0x56, 0x35, 0x3B, 0x50, 0x31, 0x38, 0x4C, 0x2F, 0x36, 0x4B, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46,
+    0x28, 0x30, 0x45, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17,
+    0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x69, 0x5C, 0xE8,
+    0x90, 0xE1, 0x46, 0x93, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0xB0, 0xA1, 0xC3, 0x87, 0x10, 0x23,
+    0x36, 0xF8, 0xD1, 0xC4, 0x07, 0x84, 0x88, 0x18, 0x33, 0x6A, 0xDC, 0xD8, 0x70, 0x82, 0x0E, 0x26,
+    0x38, 0x18, 0x70, 0x1C, 0x49, 0xB2, 0x64, 0xC2, 0x1C, 0x01, 0x24, 0x04, 0x90, 0x61, 0xB2, 0xA5,
+    0xCB, 0x88, 0x1B, 0x62, 0x30, 0x81, 0x31, 0xE2, 0xA5, 0xCD, 0x9B, 0x08, 0x0D, 0x28, 0x61, 0x92,
+    0xE4, 0x00, 0xCE, 0x9F, 0x2E, 0x2D, 0xD4, 0x60, 0x62, 0x83, 0x02, 0xD0, 0xA3, 0x24, 0x79, 0x6C,
+    0xD8, 0xC0, 0x61, 0x07, 0xD2, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA, 0xD5, 0xAB, 0x58,
+    0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0xD7, 0xAF, 0x60, 0xC3, 0x8A, 0x1D, 0x4B, 0xB6, 0xAC, 0xD9,
+    0xB3, 0x68, 0xD3, 0xAA, 0x5D, 0xCB, 0xB6, 0xAD, 0xDB, 0xB7, 0x70, 0xE3, 0xCA, 0x9D, 0x4B, 0xB7,
+    0xAE, 0xDD, 0xBB, 0x78, 0xF3, 0xEA, 0xDD, 0xCB, 0xB7, 0xAF, 0xDF, 0xBF, 0x80, 0x03, 0x9B, 0x64,
+    0x42, 0xB8, 0x30, 0x93, 0xBC, 0x86, 0x13, 0x13, 0xB6, 0xAB, 0xB8, 0x31, 0xDD, 0xC6, 0x90, 0xE5,
+    0x42, 0x9E, 0x0C, 0x77, 0xB2, 0xE5, 0xB7, 0x96, 0x29, 0xB7, 0x1D, 0x92, 0x19, 0xF2, 0x90, 0xCD,
+    0x9D, 0x1B, 0x7F, 0x66, 0xCB, 0x39, 0x74, 0xE2, 0xD1, 0x6B, 0x4B, 0x9B, 0x2E, 0x8C, 0x5A, 0xAD,
+    0xEA, 0xD5, 0x4C, 0x5A, 0xA7, 0x7D, 0xBD, 0x5A, 0x36, 0x5A, 0xDA, 0xA6, 0x6D, 0xDF, 0x1E, 0xC2,
+    0xBB, 0xB7, 0xEF, 0xDF, 0xBD, 0x31, 0xC3, 0x5E, 0x2C, 0x7C, 0xB5, 0x64, 0xD3, 0x8F, 0x3B, 0x33,
+    0xBE, 0x8C, 0xD7, 0xF1, 0x41, 0x00, 0xD0, 0xA3, 0x03, 0xC8, 0x0B, 0x5D, 0x83, 0xF5, 0xEB, 0x1A,
+    0xA0, 0xDB, 0x05, 0x80, 0xBD, 0xBB, 0xF5, 0xE9, 0x73, 0xB9, 0x7B, 0x4E, 0xF7, 0x0E, 0x1E, 0xAE,
+    0xF8, 0xF1, 0xE4, 0xCD, 0xA3, 0x5F, 0x5F, 0x9E, 0xED, 0xF9, 0xF5, 0xDD, 0xDB, 0xAB, 0x7D, 0x0F,
+    0x3F, 0x7E, 0x5B, 0xFA, 0xF5, 0xAF, 0xCB, 0x47, 0x8B, 0x3F, 0x7F, 0xF6, 0xFB, 0xFE, 0xA5, 0xE7,
+    0x5E, 0x80, 0xF6, 0x0D, 0x48, 0xA0, 0x7E, 0x00, 0x1E, 0xF8, 0x9D, 0x5B, 0xFD, 0xC1, 0xB7, 0x5F,
+    0x5A, 0x0D, 0xB2, 0xA7, 0x5E, 0x80, 0x0F, 0xAE, 0x15, 0x21, 0x76, 0x15, 0x1A, 0x28, 0x61, 0x5D,
+    0xD5, 0x91, 0x97, 0xA1, 0x79, 0xD2, 0x69, 0xB7, 0x50, 0x40, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06,
+    0x00, 0x49, 0x00, 0x2C, 0x1C, 0x00, 0x04, 0x00, 0x5D, 0x00, 0x67, 0x00, 0x86, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF1, 0xF1, 0xF3, 0xEC, 0xED, 0xEF, 0xEB,
+    0xEC, 0xEE, 0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDB, 0xDD, 0xE0, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB,
+    0xDF, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7, 0xDB, 0xCD, 0xCF, 0xD4, 0xCB, 0xCC, 0xD2, 0xCA, 0xCB, 0xD1,
+    0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28, 0xC4, 0xC6, 0xCC, 0xC3, 0xC5, 0xCB, 0xC1,
+    0xC3, 0xC9, 0xBF, 0xC1, 0xC8, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB9, 0xBB,
+    0xC2, 0xB5, 0xB7, 0xBF, 0xB4, 0xB7, 0xBE, 0xB3, 0xB6, 0xBD, 0x9E, 0xA1, 0xAB, 0x9A, 0x9D, 0xA7,
+    0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E, 0x8E, 0x91, 0x9D, 0x8D, 0x90, 0x9C, 0x83,
+    0x87, 0x94, 0x82, 0x87, 0x93, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x74, 0x79,
+    0x87, 0x28, 0x78, 0x3C, 0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x5F, 0x64, 0x74,
+    0x5C, 0x61, 0x72, 0x5B, 0x60, 0x71, 0x51, 0x57, 0x68, 0x4F, 0x55, 0x66, 0x42, 0x48, 0x5B, 0x35,
+    0x3B, 0x50, 0x33, 0x3A, 0x4E, 0x32, 0x39, 0x4D, 0x2F, 0x36, 0x4B, 0x2A, 0x31, 0x47, 0x29, 0x30,
+    0x46, 0x28, 0x30, 0x45, 0x26, 0x2D, 0x43, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C,
+    0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36, 0x16, 0x1D, 0x35, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x12,
+    0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00,
+    0x73, 0x60, 0xA0, 0xB0, 0xA1, 0x47, 0x92, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0xB0, 0xA1, 0xC3,
+    0x87, 0x10, 0x23, 0x3E, 0xBC, 0x40, 0x23, 0x09, 0x8D, 0x0F, 0x12, 0x33, 0x6A, 0xDC, 0xC8, 0x51,
+    0x62, 0x81, 0x22, 0x49, 0x8A, 0x24, 0xE8, 0x48, 0xB2, 0xA4, 0xC9, 0x87, 0x16, 0x62, 0x20, 0x81,
+    0x41, 0xE0, 0xA4, 0xCB, 0x97, 0x24, 0x73, 0x74, 0xA8, 0x90, 0xC2, 0x00, 0xCC, 0x9B, 0x38, 0x1F,
+    0x9E, 0x18, 0x92, 0xE4, 0x46, 0x84, 0x9C, 0x40, 0x83, 0x26, 0xF1, 0x20, 0x23, 0x49, 0x89, 0x15,
+    0x42, 0x93, 0xC2, 0xC4, 0x11, 0xE1, 0x01, 0x08, 0x23, 0x4A, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5, 0xAA,
+    0xD5, 0xAB, 0x58, 0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0xD7, 0xAF, 0x60, 0xC3, 0x8A, 0x1D, 0x4B,
+    0xB6, 0xAC, 0xD9, 0xB3, 0x68, 0xD3, 0xAA, 0x5D, 0xCB, 0xB6, 0xAD, 0xDB, 0xB7, 0x70, 0xE3, 0xCA,
+    0x9D, 0x4B, 0xB7, 0xAE, 0xDD, 0xBB, 0x78, 0xF3, 0xEA, 0xDD, 0xCB, 0xB7, 0xAF, 0xDF, 0xBF, 0x80,
+    0x03, 0x0B, 0x1E, 0x4C, 0xB8, 0xB0, 0xE1, 0xC3, 0x88, 0x13, 0x2B, 0x5E, 0xCC, 0xB8, 0xB1, 0xE3,
+    0xC7, 0x90, 0x23, 0x4B, 0x9E, 0x4C, 0xB9, 0xB2, 0xE5, 0xCB, 0x98, 0x33, 0x4F, 0x45, 0xC2, 0xD9,
+    0x07, 0x67, 0x24, 0x83, 0x3F, 0x77, 0x16, 0x0D, 0xFA, 0x2F, 0x69, 0x24, 0x9E, 0x49, 0xFB, 0x3D,
+    0x8D, 0x9A, 0x35, 0x5F, 0xD6, 0xAD, 0x5D, 0xE7, 0x85, 0x1D, 0x5B, 0xF6, 0x5D, 0xDA, 0xA9, 0x6D,
+    0xD7, 0xA5, 0x5D, 0x5B, 0xF7, 0x5C, 0xDE, 0xB9, 0x7D, 0xCB, 0x05, 0xCE, 0xFB, 0x36, 0xEE, 0xE2,
+    0x76, 0x89, 0xD3, 0x36, 0x0E, 0x3B, 0xF8, 0x69, 0xE6, 0xAC, 0x9D, 0xAB, 0xBE, 0xEB, 0xA3, 0xBA,
+    0xF5, 0xEB, 0xD8, 0xAF, 0xCF, 0x6E, 0xBE, 0x7C, 0xFB, 0x69, 0xE9, 0x9C, 0x5F, 0x7F, 0x75, 0x17,
+    0x8E, 0x77, 0xFC, 0xF4, 0xD5, 0xA2, 0x9D, 0x87, 0x1E, 0x1D, 0xFE, 0x20, 0x80, 0xF7, 0xF0, 0x01,
+    0x0C, 0x7E, 0x3F, 0xA1, 0xBE, 0xFD, 0x09, 0xEF, 0x01, 0x03, 0xB8, 0xCF, 0xBF, 0xBE, 0xFC, 0xBE,
+    0xFB, 0xF5, 0xD7, 0xDF, 0x7F, 0x7A, 0x05, 0x28, 0xE0, 0x80, 0x05, 0x1E, 0xA8, 0x20, 0x81, 0x76,
+    0x19, 0xA8, 0x20, 0x7F, 0x0C, 0xD2, 0xE5, 0xE0, 0x83, 0x10, 0xDE, 0x35, 0x21, 0x85, 0xF6, 0x45,
+    0x28, 0xD7, 0x85, 0x18, 0xE2, 0x67, 0x61, 0x87, 0x08, 0x36, 0x08, 0x62, 0x85, 0x22, 0x8E, 0x98,
+    0xE1, 0x87, 0x26, 0xFA, 0x87, 0x17, 0x87, 0x0F, 0x6A, 0x38, 0x17, 0x8B, 0x0B, 0x26, 0x08, 0xA2,
+    0x8B, 0x75, 0xC1, 0x78, 0x1F, 0x8D, 0x25, 0xC6, 0xF8, 0x17, 0x7D, 0x03, 0xE2, 0x58, 0x60, 0x7C,
+    0xF9, 0x2D, 0x14, 0x10, 0x00, 0x21, 0xF9, 0x04, 0x01, 0x06, 0x00, 0x38, 0x00, 0x2C, 0x16, 0x00,
+    0x04, 0x00, 0x6D, 0x00, 0x67, 0x00, 0x85, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8,
+    0xF5, 0xF5, 0xF6, 0xF2, 0xF2, 0xF4, 0xF1, 0xF1, 0xF3, 0xEC, 0xED, 0xEF, 0xEB, 0xEC, 0xEE, 0xE9,
+    0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xD7, 0xD8, 0xDC, 0xD6, 0xD7,
+    0xDB, 0xCD, 0xCF, 0xD4, 0xCA, 0xCB, 0xD1, 0xC8, 0xCA, 0xCF, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28,
+    0xC4, 0xC6, 0xCC, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0, 0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB5,
+    0xB7, 0xBF, 0xA6, 0xA9, 0xB2, 0x91, 0x95, 0xA0, 0x90, 0x94, 0x9F, 0x8F, 0x93, 0x9E, 0x8E, 0x91,
+    0x9D, 0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7C, 0x80, 0x8D, 0x7B, 0x7F, 0x8D, 0x76, 0x7B, 0x88,
+    0x28, 0x78, 0x3C, 0x70, 0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x51, 0x57, 0x68, 0x42,
+    0x48, 0x5B, 0x35, 0x3B, 0x50, 0x2A, 0x31, 0x47, 0x29, 0x30, 0x46, 0x28, 0x30, 0x45, 0x26, 0x2E,
+    0x43, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1E, 0x26, 0x3C, 0x1C, 0x24, 0x3B, 0x17, 0x1E, 0x36,
+    0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x12, 0x1A, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x6F, 0xBC, 0xC8, 0x40, 0xE0, 0x06,
+    0x0E, 0x18, 0x18, 0x20, 0x60, 0x80, 0x81, 0xA3, 0xA1, 0xC3, 0x87, 0x10, 0x23, 0x4A, 0x9C, 0x48,
+    0xB1, 0xA2, 0xC5, 0x8B, 0x18, 0x25, 0xDE, 0x88, 0x20, 0xA2, 0x80, 0x41, 0x0D, 0x21, 0x70, 0x80,
+    0xE0, 0x90, 0xB1, 0xA4, 0xC9, 0x93, 0x28, 0x51, 0xDE, 0x68, 0x81, 0xC3, 0x23, 0x0E, 0x06, 0x2C,
+    0x70, 0xAC, 0x68, 0x90, 0xB2, 0xA6, 0xCD, 0x9B, 0x26, 0x6F, 0x18, 0x74, 0x69, 0xA0, 0x06, 0x8E,
+    0x1A, 0x07, 0x70, 0x0A, 0x1D, 0x4A, 0x54, 0x67, 0x4B, 0x83, 0x3D, 0x6F, 0xF8, 0x24, 0xCA, 0xB4,
+    0xE9, 0x49, 0xA3, 0x2E, 0x61, 0xCA, 0xA4, 0xE9, 0xB4, 0xAA, 0x55, 0x8D, 0x3B, 0x3F, 0x86, 0x04,
+    0xB1, 0xE1, 0xAA, 0x57, 0xAF, 0x3A, 0x6F, 0xB8, 0x44, 0xA8, 0x90, 0xE1, 0xD7, 0xB3, 0x68, 0xD3,
+    0xAA, 0x5D, 0xCB, 0xB6, 0xAD, 0xDB, 0xB7, 0x70, 0xE3, 0xCA, 0x9D, 0x4B, 0xB7, 0xAE, 0xDD, 0xBB,
+    0x78, 0xF3, 0xEA, 0xDD, 0xCB, 0xB7, 0xAF, 0xDF, 0xBF, 0x80, 0x03, 0x0B, 0x1E, 0x4C, 0xB8, 0xB0,
+    0xE1, 0xC3, 0x88, 0x13, 0x2B, 0x5E, 0xCC, 0xB8, 0xB1, 0xE3, 0xC7, 0x90, 0x23, 0x4B, 0x9E, 0x4C,
+    0xB9, 0xB2, 0xE5, 0xCB, 0x98, 0x33, 0x6B, 0xDE, 0xCC, 0xB9, 0xB3, 0xE7, 0xCF, 0xA0, 0x43, 0x8B,
+    0x1E, 0x4D, 0xBA, 0xB4, 0xE9, 0xD3, 0xA8, 0x53, 0xAB, 0x5E, 0xCD, 0xBA, 0xB5, 0xEB, 0xD7, 0xB0,
+    0x63, 0xCB, 0x9E, 0x4D, 0xBB, 0xB6, 0x6D, 0xCC, 0x00, 0x72, 0xEB, 0x06, 0x80, 0x3A, 0xB7, 0x84,
+    0xDF, 0xC0, 0x25, 0xE4, 0x2E, 0x0D, 0x20, 0xB8, 0xF1, 0xDF, 0xBC, 0x45, 0x17, 0x3F, 0x7E, 0x3C,
+    0xF9, 0xE7, 0xE5, 0xCC, 0x9B, 0x3F, 0x8F, 0x4E, 0xDD, 0xF9, 0x66, 0xE8, 0xD4, 0x8D, 0x5B, 0xCF,
+    0x8C, 0x3D, 0xBB, 0x76, 0xCE, 0xDD, 0xBD, 0x03, 0x92, 0xDF, 0x7E, 0x39, 0xBC, 0x78, 0xE1, 0xE0,
+    0xCF, 0x4B, 0xBF, 0xAE, 0xFE, 0x3B, 0xFB, 0xF6, 0xE3, 0xD3, 0xC3, 0x47, 0xDE, 0xD9, 0x7C, 0x76,
+    0xF2, 0xB8, 0xE7, 0xE3, 0xCF, 0xAF, 0x7E, 0x3F, 0xF7, 0xF3, 0xFE, 0x69, 0x66, 0x5F, 0x7C, 0xA4,
+    0xF9, 0xD6, 0x5C, 0x80, 0x94, 0x85, 0xA5, 0xA0, 0x43, 0xBB, 0xE9, 0xE6, 0x99, 0x82, 0x10, 0x1A,
+    0x45, 0x5A, 0x84, 0x14, 0x8E, 0x46, 0xE1, 0x85, 0xA1, 0x5D, 0xA8, 0xE1, 0x67, 0x1A, 0x76, 0xF8,
+    0x60, 0x87, 0x18, 0x72, 0xE6, 0x02, 0x88, 0x17, 0xBA, 0x20, 0x22, 0x89, 0x14, 0x9A, 0xB8, 0xD9,
+    0x88, 0x28, 0x42, 0xA8, 0xA2, 0x66, 0x2C, 0xB6, 0x18, 0xD6, 0x8B, 0x99, 0xC5, 0x28, 0xE3, 0x0D,
+    0x34, 0x62, 0x66, 0xA3, 0x8C, 0x39, 0x5E, 0xB6, 0x63, 0x8B, 0x3D, 0xFA, 0xE8, 0xC2, 0x90, 0x44,
+    0x16, 0x69, 0x24, 0x91, 0x1F, 0xDE, 0x68, 0x50, 0x92, 0x2D, 0x66, 0xD8, 0xA4, 0x68, 0x28, 0x96,
+    0x06, 0x22, 0x6A, 0x23, 0x54, 0x69, 0xE5, 0x08, 0x27, 0x05, 0x04, 0x00, 0x21, 0xF9, 0x04, 0x01,
+    0x06, 0x00, 0x2B, 0x00, 0x2C, 0x1C, 0x00, 0x04, 0x00, 0x71, 0x00, 0x53, 0x00, 0x85, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xF8, 0xF9, 0xF7, 0xF7, 0xF8, 0xF5, 0xF5, 0xF6, 0xF2, 0xF2, 0xF4, 0xF1, 0xF1, 0xF3,
+    0xE9, 0xEA, 0xEC, 0xE6, 0xE7, 0xE9, 0xDA, 0xDC, 0xDF, 0xDA, 0xDB, 0xDF, 0xCD, 0xCF, 0xD4, 0xCA,
+    0xCB, 0xD1, 0xC7, 0xC9, 0xCE, 0xFA, 0xC8, 0x28, 0xC4, 0xC6, 0xCC, 0xC1, 0xC3, 0xC9, 0xBD, 0xC0,
+    0xC6, 0xBC, 0xBE, 0xC5, 0xBB, 0xBD, 0xC4, 0xB5, 0xB7, 0xBF, 0xA6, 0xA9, 0xB2, 0x8E, 0x91, 0x9D,
+    0x83, 0x87, 0x94, 0x80, 0x84, 0x91, 0x7B, 0x7F, 0x8D, 0x76, 0x7B, 0x88, 0x28, 0x78, 0x3C, 0x70,
+    0x74, 0x83, 0x6B, 0x70, 0x7F, 0x67, 0x6C, 0x7B, 0x51, 0x57, 0x68, 0x42, 0x48, 0x5B, 0x35, 0x3B,
+    0x50, 0x2A, 0x31, 0x47, 0x26, 0x2E, 0x43, 0x1E, 0x28, 0x46, 0x1F, 0x26, 0x3D, 0x1C, 0x24, 0x3B,
+    0x17, 0x1E, 0x36, 0x15, 0x1D, 0x34, 0x13, 0x1B, 0x32, 0x11, 0x19, 0x31, 0x10, 0x18, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0x00, 0x55, 0x90, 0xA0, 0x40, 0x40, 0xC5, 0x8A, 0x83, 0x08, 0x13, 0x2A, 0x5C, 0xC8, 0xB0, 0xA1,
+    0xC3, 0x87, 0x10, 0x23, 0x4A, 0x9C, 0x88, 0x50, 0x05, 0x83, 0x0C, 0x05, 0x0C, 0x52, 0xDC, 0xC8,
+    0xB1, 0xA3, 0xC7, 0x8F, 0x07, 0x55, 0x88, 0x58, 0x91, 0x11, 0xA4, 0xC9, 0x93, 0x28, 0x3B, 0xAA,
+    0x30, 0x58, 0x32, 0xA5, 0xCB, 0x97, 0x30, 0x57, 0xAC, 0x24, 0xA9, 0x31, 0xA6, 0xCD, 0x9B, 0x1B,
+    0x67, 0xB6, 0xC4, 0xC9, 0xB3, 0x27, 0x43, 0x9D, 0x35, 0x7D, 0x0A, 0xED, 0xB9, 0x52, 0xC5, 0xCE,
+    0xA1, 0x48, 0x93, 0x2A, 0x5D, 0xCA, 0xB4, 0xA9, 0xD3, 0xA7, 0x50, 0xA3, 0x4A, 0x9D, 0x4A, 0xB5,
+    0xAA, 0xD5, 0xAB, 0x58, 0xB3, 0x6A, 0xDD, 0xCA, 0xB5, 0xAB, 0xD7, 0xAF, 0x60, 0xC3, 0x8A, 0x1D,
+    0x4B, 0xB6, 0xAC, 0xD9, 0xB3, 0x68, 0xD3, 0xAA, 0x5D, 0xCB, 0xB6, 0xAD, 0xDB, 0xB7, 0x70, 0xE3,
+    0xCA, 0x9D, 0x4B, 0xB7, 0xAE, 0xDD, 0xBB, 0x78, 0xF3, 0xEA, 0xDD, 0xCB, 0xB7, 0xAF, 0xDF, 0xBF,
+    0x80, 0x03, 0x0B, 0xD6, 0x0A, 0xA0, 0xB0, 0x61, 0x00, 0x83, 0x19, 0x16, 0x6E, 0xC0, 0xB8, 0x71,
+    0x83, 0xC2, 0x89, 0x11, 0x02, 0x70, 0x4C, 0x99, 0x31, 0xE2, 0xC4, 0x93, 0x2B, 0x57, 0xBE, 0x1C,
+    0x38, 0xB3, 0xE6, 0xCD, 0x9D, 0x3F, 0x8B, 0xE6, 0xDC, 0xD7, 0xB3, 0x68, 0xCA, 0xA4, 0xF7, 0x9A,
+    0x3E, 0x8D, 0xDA, 0xEF, 0x6A, 0xD6, 0x8D, 0x53, 0xE7, 0x7D, 0x0D, 0xFB, 0xB1, 0xEB, 0xDA, 0xA0,
+    0x4B, 0xE3, 0x6E, 0xAD, 0x7B, 0x77, 0xEC, 0xDB, 0xBE, 0x2D, 0xFF, 0xA5, 0x7D, 0x5A, 0xB6, 0x5E,
+    0xE2, 0xA3, 0x43, 0xE3, 0x36, 0xCE, 0x17, 0xB9, 0x63, 0xE6, 0xBD, 0x93, 0x47, 0x5E, 0xB1, 0x78,
+    0x33, 0xF4, 0xBB, 0x45, 0x47, 0x14, 0x95, 0x7C, 0x18, 0xF2, 0xDF, 0xA2, 0x2B, 0xB5, 0x83, 0x5D,
+    0x9F, 0x2E, 0x13, 0xBC, 0x0A, 0xF1, 0xE3, 0x13, 0x9B, 0x0F, 0xBF, 0x3E, 0xE8, 0xF7, 0xF6, 0xE8,
+    0xCD, 0x07, 0x6E, 0xCF, 0x9E, 0x3E, 0x60, 0xFA, 0xE7, 0xF1, 0xBF, 0xA7, 0x1F, 0x7F, 0xBD, 0x5F,
+    0xFC, 0xF9, 0xE9, 0xD7, 0x17, 0x80, 0xFD, 0xC9, 0x37, 0x20, 0x7E, 0x05, 0xA6, 0xC7, 0x17, 0x81,
+    0x00, 0xFE, 0x87, 0x60, 0x83, 0x07, 0xF2, 0x07, 0x61, 0x5F, 0x23, 0x54, 0x68, 0xE1, 0x85, 0x18,
+    0x5E, 0x78, 0x9F, 0x84, 0xF6, 0x6D, 0xB8, 0x5E, 0x82, 0xEE, 0x39, 0x68, 0x5E, 0x82, 0x91, 0x7D,
+    0xE8, 0xDF, 0x74, 0x23, 0x1A, 0x48, 0x5E, 0x79, 0x01, 0x86, 0x08, 0x51, 0x40, 0x00, 0x3B,
+};
@@ -0,0 +1,422 @@
+// Generated by tools/imageconvert.py from bench_photo.png (JPG). Do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t kBenchPhotoJpeg[] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0A, 0x10, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x14, 0x0E,
+    0x0F, 0x0C, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1A, 0x1D, 0x25, 0x1F, 0x1A,
+    0x1B, 0x23, 0x1C, 0x16, 0x16, 0x20, 0x2C, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2A, 0x29, 0x19, 0x1F,
+    0x2D, 0x30, 0x2D, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x07, 0x07,
+    0x07, 0x0A, 0x08, 0x0A, 0x13, 0x0A, 0x0A, 0x13, 0x28, 0x1A, 0x16, 0x1A, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0xF0, 0x01, 0x40, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x1B, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x04, 0x07, 0xFF, 0xC4,
+    0x00, 0x31, 0x10, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x03, 0x03, 0x03, 0x04, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x11, 0x05, 0x12, 0x21, 0x06, 0x13, 0x31, 0x22,
+    0x41, 0x51, 0x14, 0x32, 0x61, 0x07, 0x23, 0x71, 0x15, 0x33, 0x52, 0x91, 0x42, 0x81, 0x24, 0x35,
+    0x53, 0xFF, 0xC4, 0x00, 0x1C, 0x01, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x04, 0x05, 0x06, 0x01, 0x07, 0x08, 0xFF,
+    0xC4, 0x00, 0x2A, 0x11, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x11, 0x05, 0x31, 0x12, 0x21, 0x06, 0x41,
+    0x13, 0x51, 0x14, 0x22, 0x32, 0x61, 0x23, 0x71, 0x15, 0xA1, 0xB1, 0xFF, 0xDA, 0x00, 0x0C, 0x03,
+    0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xCA, 0xE8, 0x4E, 0xAD, 0xFC, 0x16, 0x18,
+    0x38, 0x16, 0x64, 0xCD, 0x69, 0x3E, 0xA6, 0xA7, 0x87, 0xF4, 0xF5, 0x37, 0xDA, 0xEB, 0x94, 0xBA,
+    0xB8, 0xD5, 0x65, 0xBB, 0xD6, 0xFF, 0x00, 0x64, 0x25, 0x3D, 0x7F, 0xEF, 0xAE, 0x8D, 0xAE, 0x46,
+    0x6D, 0x74, 0xFA, 0x7D, 0x97, 0x50, 0x8C, 0xA4, 0xB7, 0xF4, 0x61, 0xFA, 0x4B, 0xF0, 0xC6, 0xB4,
+    0xCF, 0x58, 0xA3, 0xD2, 0x58, 0x79, 0x19, 0x15, 0x63, 0x57, 0x91, 0x25, 0x6C, 0xA3, 0x8F, 0x3B,
+    0x3B, 0x52, 0x94, 0x62, 0xAD, 0xE9, 0xF0, 0xFB, 0x79, 0x6B, 0xDC, 0x5E, 0x34, 0xB7, 0xA6, 0x53,
+    0xDD, 0xE9, 0x9E, 0x3A, 0xFA, 0x6D, 0xBE, 0xBC, 0xAC, 0x88, 0xE3, 0xD5, 0xA8, 0xCE, 0x4F, 0x1D,
+    0x76, 0xED, 0x2D, 0xE9, 0x28, 0xF7, 0xD3, 0xF0, 0x9B, 0xF2, 0xD7, 0xC1, 0x0E, 0x3C, 0xA5, 0x72,
+    0x7A, 0x6B, 0x47, 0x7C, 0x7F, 0x4C, 0xF3, 0xED, 0x06, 0x8D, 0x1B, 0xF4, 0xCD, 0x96, 0xF3, 0x37,
+    0x60, 0xE2, 0xE5, 0x51, 0x64, 0x21, 0x4D, 0x97, 0xC6, 0xE9, 0x49, 0x42, 0x32, 0x8C, 0x6B, 0x76,
+    0x69, 0xED, 0xF8, 0x7E, 0x34, 0xFC, 0xF8, 0x7B, 0xDF, 0x84, 0xD9, 0xC8, 0xBD, 0x3D, 0xC9, 0x4A,
+    0x50, 0x4A, 0x88, 0x37, 0x26, 0xD3, 0x5E, 0xF4, 0x3F, 0xB6, 0xD4, 0x5C, 0x9A, 0x9F, 0x9F, 0xA3,
+    0xE9, 0x8C, 0x9F, 0xD5, 0xAF, 0x11, 0x7F, 0x86, 0x4A, 0xFC, 0xD0, 0x6B, 0x69, 0x83, 0x73, 0xD7,
+    0xA6, 0x53, 0x68, 0x34, 0x5C, 0x72, 0x5C, 0x16, 0x57, 0x1D, 0xC6, 0x53, 0x99, 0x93, 0x2A, 0x57,
+    0xB9, 0x7C, 0xE8, 0xF6, 0xE3, 0x6C, 0x65, 0x24, 0xE3, 0x18, 0x4B, 0xB7, 0x86, 0xF6, 0x9A, 0x9A,
+    0xF2, 0xBC, 0x7C, 0x3F, 0xFC, 0x96, 0xE6, 0xCC, 0xE1, 0x71, 0x31, 0x6F, 0xC0, 0xED, 0xC9, 0xC6,
+    0x78, 0xB9, 0x38, 0xB2, 0xC9, 0x95, 0xD1, 0xA5, 0xAD, 0x75, 0x9D, 0x90, 0x71, 0x8A, 0x6D, 0x39,
+    0x36, 0xEB, 0xF1, 0xBE, 0xBB, 0xDA, 0xF8, 0x18, 0xED, 0x8F, 0x69, 0x8B, 0xF2, 0x22, 0x83, 0x41,
+    0xA3, 0x55, 0x8D, 0xE9, 0x7A, 0xAF, 0xE5, 0xAC, 0xC0, 0x59, 0xD6, 0x7B, 0xBD, 0x61, 0x38, 0x38,
+    0xE3, 0x37, 0xD6, 0x12, 0x82, 0x9F, 0x7B, 0x7E, 0xAD, 0x57, 0x18, 0xA9, 0x25, 0x2F, 0x32, 0xD3,
+    0xDF, 0xE3, 0xCE, 0x63, 0x40, 0xFC, 0xD4, 0xBA, 0x3A, 0xA6, 0x9F, 0x44, 0x7A, 0x13, 0x44, 0x9A,
+    0x0D, 0x0D, 0x6C, 0x77, 0x91, 0x1E, 0x83, 0x43, 0xF4, 0x1A, 0x06, 0xD9, 0xDF, 0x22, 0x3D, 0x09,
+    0xA2, 0x4D, 0x06, 0x81, 0xB6, 0x77, 0xC8, 0x8F, 0x42, 0x68, 0x97, 0x42, 0x68, 0x13, 0x67, 0x76,
+    0x47, 0xA1, 0x34, 0x4B, 0xA1, 0x34, 0x0D, 0xB1, 0x6C, 0x8F, 0x42, 0x68, 0x97, 0x43, 0xAB, 0xA6,
+    0x56, 0x4B, 0x51, 0x5B, 0x03, 0x39, 0x28, 0xAD, 0xB1, 0xC9, 0xEC, 0x83, 0xAE, 0xC9, 0xAA, 0xC5,
+    0xB2, 0xD7, 0xF4, 0xC5, 0x97, 0x58, 0x5C, 0x5A, 0x49, 0x4A, 0xCF, 0x9F, 0xC1, 0x69, 0x5D, 0x50,
+    0xAD, 0x6A, 0x31, 0x45, 0x16, 0x57, 0x33, 0x08, 0x3F, 0x1A, 0xD6, 0xC9, 0x50, 0xC7, 0x6F, 0xDC,
+    0x8C, 0xF5, 0x5C, 0x45, 0x92, 0xD7, 0x6F, 0x04, 0xFF, 0x00, 0xE8, 0x9F, 0xC9, 0x7A, 0x05, 0x4C,
+    0xF9, 0x5C, 0x89, 0x3E, 0xF4, 0x48, 0x54, 0x41, 0x14, 0x13, 0xE1, 0x1E, 0xBE, 0x96, 0x72, 0x5D,
+    0xC5, 0xDD, 0x5F, 0xC2, 0xD9, 0xAA, 0x06, 0x93, 0xF9, 0x14, 0x39, 0x5B, 0xE3, 0xDF, 0xB1, 0x3A,
+    0x22, 0xCE, 0xDF, 0x40, 0x61, 0xAA, 0xAA, 0x95, 0x93, 0x5A, 0x99, 0xB5, 0x30, 0xD8, 0x79, 0x53,
+    0xC5, 0x97, 0xF6, 0xDE, 0x91, 0xA3, 0xE3, 0xB9, 0x58, 0x5E, 0x94, 0x66, 0xF5, 0x21, 0xB2, 0xC9,
+    0xFC, 0xD2, 0xDB, 0x32, 0x1C, 0xB7, 0x17, 0x74, 0x66, 0xEE, 0x8F, 0xB4, 0x5B, 0x00, 0x89, 0xA6,
+    0xB6, 0xBE, 0x05, 0x1C, 0x67, 0x80, 0x00, 0x04, 0x20, 0x00, 0x01, 0x08, 0xE0, 0xE6, 0xB1, 0xE3,
+    0x91, 0xC7, 0xDB, 0x09, 0x2F, 0xB1, 0xE2, 0x99, 0xF4, 0xFB, 0x59, 0x56, 0x43, 0xF0, 0xCF, 0x76,
+    0xBD, 0x6E, 0x99, 0xA7, 0xF8, 0x3C, 0x67, 0xD4, 0x30, 0x4B, 0x94, 0xBB, 0x4B, 0xEE, 0x48, 0xA2,
+    0x5D, 0xA3, 0x43, 0xC1, 0x4D, 0xEE, 0x50, 0x29, 0xFA, 0x89, 0xD4, 0x9F, 0xA8, 0x9D, 0x42, 0xB6,
+    0x69, 0x4F, 0x4F, 0xC6, 0xC7, 0x85, 0x10, 0xEB, 0x04, 0x5A, 0xE1, 0x67, 0xD7, 0x8B, 0x8F, 0x38,
+    0xFE, 0x9D, 0x4A, 0xF7, 0x1B, 0x23, 0x1B, 0x54, 0xB5, 0xA5, 0x38, 0x74, 0x69, 0xAD, 0x79, 0xD2,
+    0xDE, 0xBC, 0xAD, 0x36, 0xFE, 0x4E, 0x00, 0x34, 0x32, 0x6E, 0x4F, 0x6C, 0x4E, 0x29, 0xAD, 0x16,
+    0xCB, 0x9B, 0xBF, 0xFD, 0x43, 0x06, 0xF9, 0x3B, 0x65, 0x46, 0x2B, 0xA1, 0xC6, 0x87, 0x6B, 0xEA,
+    0xDD, 0x71, 0x8A, 0xF1, 0xF6, 0x5B, 0xEA, 0xDF, 0xC7, 0x8D, 0xFD, 0xC7, 0x4F, 0x97, 0x85, 0x91,
+    0x9C, 0x2E, 0x8E, 0x6D, 0xB5, 0xCB, 0xAC, 0xB7, 0x66, 0x57, 0x69, 0xC6, 0x51, 0xDF, 0x57, 0x19,
+    0x75, 0xF1, 0xF3, 0x2F, 0x1A, 0x7F, 0x25, 0x38, 0x0D, 0xD2, 0x39, 0xF8, 0xE3, 0xFA, 0x3B, 0x39,
+    0x2C, 0xF8, 0x65, 0x72, 0x96, 0x67, 0x59, 0x8F, 0x26, 0xA7, 0x8F, 0x2C, 0x79, 0x43, 0xDC, 0xFA,
+    0x9A, 0x74, 0xBA, 0x9B, 0xEC, 0xD3, 0xF3, 0xA6, 0xDF, 0x94, 0xFF, 0x00, 0xF6, 0x50, 0x72, 0x7E,
+    0xAB, 0xB6, 0xDC, 0xE5, 0x65, 0xF0, 0xCE, 0x72, 0xF7, 0x9D, 0xF6, 0x2F, 0xD7, 0x4F, 0x51, 0x93,
+    0x8C, 0xA3, 0xFD, 0xA5, 0xAD, 0x41, 0x7D, 0x4D, 0xE9, 0xA9, 0x7D, 0x97, 0xC6, 0xD3, 0xB2, 0x7F,
+    0x06, 0x4F, 0x9D, 0xAB, 0xA6, 0x4B, 0x6B, 0xEE, 0x4F, 0xC2, 0xD3, 0x97, 0x8C, 0x88, 0xB9, 0x35,
+    0x45, 0x25, 0x24, 0x49, 0xCE, 0x73, 0x34, 0xF2, 0x78, 0xB1, 0xA6, 0xBC, 0x25, 0x8F, 0xD3, 0x22,
+    0x77, 0xC5, 0xC6, 0x6B, 0x5F, 0x55, 0x75, 0xC2, 0x5B, 0x4A, 0x29, 0x6D, 0xBA, 0x94, 0xB6, 0xB4,
+    0xB6, 0xDF, 0x8F, 0x8D, 0x26, 0x2F, 0x2F, 0x8D, 0x1B, 0xF8, 0x99, 0x66, 0x60, 0xBC, 0x8A, 0xF0,
+    0x31, 0xE5, 0x52, 0xAF, 0xDD, 0x51, 0x53, 0x93, 0xB2, 0xCB, 0x14, 0x9E, 0xE2, 0xD6, 0x93, 0xB3,
+    0xF6, 0xB4, 0xF7, 0xD7, 0xF9, 0xD1, 0x53, 0xA1, 0x34, 0x59, 0x38, 0x45, 0x2F, 0x12, 0x16, 0xD7,
+    0x45, 0xEE, 0x2F, 0x39, 0x8D, 0x8F, 0xC8, 0x3C, 0xD7, 0x83, 0x75, 0xD9, 0x30, 0xC8, 0xFD, 0x4D,
+    0x56, 0xDB, 0x90, 0x9C, 0xDC, 0xDA, 0x5B, 0x56, 0x3E, 0x9F, 0x5C, 0x76, 0xB7, 0xAF, 0xA7, 0xE5,
+    0xAD, 0xF9, 0x33, 0xFA, 0x1F, 0xA0, 0xD0, 0xCD, 0x28, 0xF4, 0x39, 0x3D, 0x11, 0xE8, 0x34, 0x49,
+    0xA1, 0x34, 0x31, 0xB1, 0xDE, 0x43, 0x34, 0x26, 0x89, 0x34, 0x1A, 0x06, 0xD9, 0xDF, 0x22, 0x3D,
+    0x06, 0x87, 0xE8, 0x34, 0x09, 0xB1, 0xDE, 0x44, 0x7A, 0x0D, 0x12, 0x68, 0x4D, 0x03, 0x6C, 0xEF,
+    0x91, 0x1E, 0x83, 0x44, 0x9A, 0x05, 0x1D, 0xB0, 0x52, 0x63, 0xB6, 0x25, 0x55, 0x3B, 0x26, 0xA2,
+    0x91, 0x7F, 0x83, 0x87, 0x1A, 0x60, 0x9B, 0x5F, 0x51, 0x17, 0x19, 0x8A, 0xA3, 0x1E, 0xF2, 0x5E,
+    0x4B, 0x13, 0x27, 0xCA, 0xF2, 0x0E, 0xC9, 0x3A, 0xA0, 0xFD, 0x22, 0xCB, 0x1A, 0x9D, 0x2F, 0x26,
+    0x00, 0x00, 0x52, 0x13, 0x00, 0x00, 0x04, 0x20, 0x00, 0x01, 0x08, 0x07, 0x42, 0x6E, 0x12, 0x4E,
+    0x2F, 0x44, 0xB4, 0x63, 0x59, 0x73, 0x4A, 0x11, 0x65, 0xB6, 0x3F, 0x07, 0x29, 0x2D, 0xCD, 0xE8,
+    0x45, 0x76, 0x67, 0x29, 0x89, 0x88, 0xB5, 0x74, 0xD7, 0xFD, 0x1D, 0x1C, 0x3F, 0x25, 0xDF, 0x55,
+    0xD8, 0xFC, 0x97, 0x89, 0xED, 0x6D, 0x15, 0x35, 0x70, 0xD5, 0xD7, 0x25, 0x24, 0xFC, 0xA2, 0xD6,
+    0x11, 0xEB, 0x04, 0xB7, 0xF0, 0x4A, 0xAE, 0xDD, 0x2D, 0x48, 0xF3, 0xFE, 0x47, 0x91, 0xC1, 0xB2,
+    0xCF, 0x3C, 0x77, 0xD8, 0xE0, 0x00, 0x0E, 0xA4, 0x9F, 0x44, 0x78, 0x5B, 0x1B, 0x16, 0xE2, 0xC0,
+    0x00, 0x0E, 0x8F, 0x39, 0xF3, 0xA7, 0xED, 0xE2, 0xD9, 0x2F, 0xC2, 0x3C, 0x73, 0x96, 0x9B, 0xB7,
+    0x3A, 0xD9, 0x7F, 0x27, 0xA4, 0xFA, 0xBF, 0x3E, 0x38, 0xF8, 0x32, 0x84, 0x65, 0xF5, 0x48, 0xF3,
+    0x19, 0xEE, 0x52, 0x6D, 0xFC, 0xB0, 0xD5, 0xFA, 0x5B, 0x34, 0xDC, 0x25, 0x2E, 0x31, 0x76, 0x3F,
+    0xB2, 0x0E, 0xA1, 0xD4, 0x97, 0xA8, 0x75, 0x1C, 0xD9, 0x7E, 0x7A, 0x50, 0x0C, 0xAA, 0xC8, 0xDB,
+    0x1E, 0xD1, 0x7B, 0x43, 0xCD, 0x2B, 0x4D, 0x3D, 0x31, 0xE9, 0xEF, 0xDA, 0x00, 0x00, 0x10, 0x80,
+    0xCB, 0x73, 0xD3, 0x52, 0xC9, 0xD2, 0xFB, 0x1A, 0x1C, 0xCB, 0xE3, 0x45, 0x4D, 0xB7, 0xE4, 0xC9,
+    0x65, 0x58, 0xED, 0xBA, 0x52, 0x7F, 0x72, 0x7E, 0x0D, 0x6F, 0xCB, 0xCC, 0x83, 0x9B, 0x6A, 0x51,
+    0xF1, 0x39, 0xF4, 0x26, 0x89, 0x34, 0x26, 0x8B, 0x16, 0xCA, 0xC5, 0x21, 0x9A, 0x0D, 0x0F, 0xD0,
+    0x68, 0x1B, 0x63, 0xBC, 0x86, 0x68, 0x34, 0x3F, 0x41, 0xA0, 0x4D, 0x8E, 0x52, 0x23, 0xD0, 0x68,
+    0x93, 0x42, 0x68, 0x13, 0x63, 0x94, 0x86, 0x68, 0x34, 0x3F, 0x41, 0xA0, 0x6D, 0x8E, 0x52, 0x23,
+    0xD0, 0x68, 0x93, 0x41, 0xA0, 0x4D, 0x8E, 0x52, 0x23, 0xD1, 0x36, 0x25, 0x5E, 0xE5, 0xC9, 0x0D,
+    0xD1, 0xDF, 0xC6, 0x43, 0xCB, 0x64, 0x0C, 0xEB, 0xBF, 0x15, 0x32, 0x90, 0x7C, 0x78, 0xF9, 0xCD,
+    0x22, 0xCA, 0x11, 0xEB, 0x14, 0x90, 0xA0, 0x06, 0x19, 0xBD, 0xBD, 0xB2, 0xF5, 0x7A, 0x00, 0x00,
+    0x11, 0xD0, 0x00, 0x01, 0x08, 0x0B, 0x2E, 0x33, 0x8F, 0x96, 0x44, 0xD3, 0x92, 0xFA, 0x48, 0x38,
+    0xEC, 0x67, 0x91, 0x7A, 0x4B, 0xE0, 0xD8, 0xE3, 0x53, 0x1A, 0x6A, 0x51, 0x8A, 0xD0, 0x92, 0x32,
+    0x9F, 0x24, 0xE7, 0x7F, 0x81, 0x0F, 0xC3, 0x57, 0xF9, 0xBF, 0xFD, 0x0D, 0xC6, 0xC5, 0xAE, 0x88,
+    0x25, 0x18, 0xA3, 0xA0, 0x00, 0x71, 0xE5, 0xB6, 0xDB, 0x3B, 0x64, 0xE7, 0x37, 0xB6, 0xC0, 0x00,
+    0x04, 0x0C, 0x00, 0x00, 0xEA, 0x93, 0x8B, 0xDA, 0x1F, 0x5D, 0x92, 0xAD, 0xEE, 0x2C, 0x0E, 0x1E,
+    0x4F, 0x3E, 0xBC, 0x2A, 0x25, 0x29, 0xC9, 0x6F, 0xEC, 0x89, 0xF3, 0x6D, 0x74, 0xE3, 0x4E, 0x71,
+    0x5B, 0x69, 0x1E, 0x67, 0xCC, 0xF2, 0x17, 0xE6, 0x5F, 0x25, 0x63, 0x69, 0x27, 0xF0, 0x4E, 0xA9,
+    0xF9, 0xAD, 0x9B, 0x0E, 0x1E, 0x9F, 0xFC, 0x87, 0xF6, 0x7D, 0x2E, 0xC8, 0x79, 0xBE, 0x42, 0x79,
+    0xF9, 0x2E, 0x4D, 0xBE, 0xBF, 0x64, 0x56, 0x75, 0x25, 0xD0, 0x75, 0x24, 0x37, 0xA3, 0x71, 0x5C,
+    0x23, 0x5C, 0x54, 0x63, 0xD1, 0x17, 0x51, 0x3A, 0x93, 0x75, 0x0E, 0xA0, 0xDC, 0x82, 0xA2, 0xDF,
+    0x03, 0x3E, 0x74, 0x34, 0xA4, 0xF7, 0x12, 0xF6, 0x9C, 0xEA, 0xAC, 0x4B, 0xEA, 0x49, 0x99, 0x5D,
+    0x0A, 0x9B, 0x5F, 0x0C, 0xF4, 0xAC, 0x8C, 0x38, 0x5A, 0xF7, 0xD3, 0x33, 0xF4, 0x67, 0xCE, 0xA5,
+    0xAE, 0xD1, 0xAF, 0xF7, 0xEB, 0xD7, 0xEE, 0x47, 0x36, 0x47, 0x21, 0x55, 0x71, 0x7A, 0x7B, 0x66,
+    0x73, 0xDD, 0xB3, 0xFE, 0x4C, 0x63, 0x6D, 0xFC, 0xB2, 0x24, 0x78, 0xF8, 0xA7, 0xED, 0x92, 0x65,
+    0xCA, 0x36, 0xBF, 0xAA, 0x3A, 0x33, 0xB3, 0x27, 0x91, 0x26, 0xB7, 0xF4, 0x9C, 0x7A, 0x1F, 0xA0,
+    0xD1, 0x2D, 0x45, 0x41, 0x69, 0x10, 0x65, 0x6B, 0x9B, 0xDC, 0x86, 0x68, 0x34, 0x3F, 0x41, 0xA1,
+    0xAD, 0x89, 0x48, 0x66, 0x83, 0x43, 0xF4, 0x1A, 0x04, 0xD8, 0xE5, 0x21, 0x9A, 0x0D, 0x0F, 0xD0,
+    0x68, 0x13, 0x63, 0x94, 0x86, 0x68, 0x34, 0x3F, 0x41, 0xA0, 0x4D, 0x8E, 0x52, 0x19, 0xA0, 0xD0,
+    0xFD, 0x06, 0x81, 0x36, 0x3D, 0x48, 0x66, 0x83, 0x43, 0xF4, 0x1A, 0x04, 0xD8, 0xE5, 0x21, 0x9A,
+    0x2C, 0xF8, 0xF5, 0xA8, 0x15, 0xFA, 0x2C, 0x70, 0x7F, 0x61, 0x51, 0xCB, 0xBD, 0xE3, 0xB2, 0x7E,
+    0x03, 0xFF, 0x00, 0x94, 0xEA, 0x00, 0x03, 0x24, 0x5E, 0x00, 0x00, 0x08, 0x40, 0x28, 0x83, 0xA0,
+    0xB7, 0x34, 0x23, 0x8D, 0xE9, 0x6C, 0xD2, 0xFA, 0x7B, 0x1D, 0x46, 0xAF, 0x71, 0xAF, 0x2C, 0xBB,
+    0x38, 0xF8, 0xB8, 0xA8, 0xE2, 0x43, 0x47, 0x60, 0xE4, 0x78, 0x97, 0x31, 0x93, 0x2C, 0x9C, 0xCB,
+    0x27, 0x2F, 0xD8, 0x00, 0x00, 0x8A, 0xC0, 0x02, 0x3B, 0x2D, 0xAE, 0xB5, 0xB9, 0xC9, 0x2F, 0xFD,
+    0x9C, 0x96, 0x72, 0xD8, 0x90, 0x96, 0xA5, 0x6C, 0x77, 0xFE, 0x44, 0x16, 0x14, 0x59, 0x67, 0xF8,
+    0x45, 0xB3, 0xBC, 0x0E, 0x1A, 0xB9, 0x4C, 0x4B, 0x5E, 0xA3, 0x6C, 0x77, 0xFE, 0x4E, 0xB8, 0x59,
+    0x09, 0xAD, 0xC6, 0x49, 0x88, 0xE4, 0xE9, 0xB2, 0xBF, 0xF3, 0x8B, 0x42, 0xD9, 0x15, 0x38, 0x38,
+    0xBF, 0x86, 0x79, 0xB7, 0xA9, 0x30, 0xFF, 0x00, 0x4F, 0x9D, 0x2D, 0x2D, 0x26, 0x7A, 0x59, 0x8E,
+    0xF5, 0xA5, 0x51, 0xEF, 0x19, 0x2F, 0x90, 0xF8, 0xF2, 0xD4, 0xB4, 0x5F, 0xFC, 0x63, 0x21, 0xD7,
+    0x97, 0xE1, 0xF5, 0x23, 0x1F, 0xD4, 0x3A, 0x92, 0xF5, 0x0E, 0xA4, 0xB6, 0xCF, 0x4A, 0x44, 0x3D,
+    0x43, 0xA9, 0x37, 0x50, 0xEA, 0x09, 0xB1, 0xC8, 0x5D, 0x06, 0x87, 0xE8, 0x34, 0x7A, 0xD3, 0x66,
+    0x2D, 0x4C, 0x6E, 0x83, 0x43, 0xB4, 0x1A, 0x05, 0x26, 0x39, 0x4C, 0x6E, 0x83, 0x43, 0xB4, 0x2E,
+    0x81, 0x36, 0x3D, 0x48, 0x66, 0x83, 0x43, 0xF4, 0x1A, 0x05, 0x26, 0x3D, 0x48, 0x66, 0x83, 0x43,
+    0xF4, 0x1A, 0x04, 0xD8, 0xF5, 0x21, 0x9A, 0x0D, 0x12, 0x68, 0x34, 0x09, 0xB1, 0xCA, 0x43, 0x34,
+    0x1A, 0x1F, 0xA0, 0xD0, 0x26, 0xC7, 0xA9, 0x0C, 0xD0, 0x68, 0x7E, 0x83, 0x40, 0xA4, 0xC7, 0xA9,
+    0x0C, 0xD0, 0x68, 0x93, 0x41, 0xA0, 0x4D, 0x8F, 0x52, 0x23, 0xD1, 0xD5, 0x84, 0xF4, 0xF4, 0x43,
+    0xA1, 0xF5, 0x3E, 0xB3, 0x4C, 0x85, 0x99, 0x5F, 0xE5, 0xAA, 0x51, 0x24, 0x63, 0xDB, 0xE1, 0x62,
+    0x91, 0x60, 0x02, 0x45, 0xED, 0x26, 0x29, 0x8C, 0x6B, 0x4F, 0x4C, 0xD3, 0xA7, 0xB5, 0xB4, 0x00,
+    0x00, 0x70, 0xE8, 0x0E, 0xAF, 0xF7, 0xA1, 0xA2, 0xAF, 0x91, 0x1C, 0x6B, 0x6B, 0x46, 0xDB, 0x8C,
+    0x69, 0xE2, 0x43, 0x5F, 0x83, 0xAC, 0xA7, 0xF4, 0xFD, 0xEA, 0x74, 0x74, 0x6F, 0xCA, 0x2E, 0x07,
+    0x1E, 0x21, 0xCB, 0x51, 0x2A, 0x33, 0x2C, 0x84, 0xBF, 0x63, 0x65, 0x25, 0x18, 0xB7, 0x27, 0xA4,
+    0x8C, 0xCF, 0x3D, 0xEA, 0x6A, 0xB1, 0x54, 0xAB, 0xA5, 0xA7, 0x32, 0x0F, 0x57, 0xF3, 0x7F, 0xA7,
+    0x83, 0xA2, 0x99, 0x7D, 0x4F, 0xE7, 0x47, 0x9F, 0x5B, 0x64, 0xAD, 0x9B, 0x94, 0xDB, 0x6D, 0x8C,
+    0x94, 0xB5, 0xE9, 0x1A, 0x4E, 0x03, 0xE3, 0x8B, 0x22, 0x2B, 0x23, 0x27, 0xAF, 0xA4, 0x59, 0x66,
+    0xF3, 0x99, 0x79, 0x32, 0x7B, 0xB1, 0xA4, 0x57, 0x4A, 0xFB, 0x64, 0xF7, 0x29, 0xC9, 0xBF, 0xF2,
+    0x46, 0x00, 0xB6, 0x6F, 0xAA, 0xC6, 0xAA, 0x95, 0xE3, 0x5C, 0x52, 0x25, 0x86, 0x45, 0xB0, 0x7B,
+    0x8C, 0xE4, 0x9F, 0xF9, 0x2D, 0x30, 0x3D, 0x41, 0x97, 0x8B, 0x25, 0xB9, 0xB7, 0x12, 0x98, 0x0E,
+    0xEF, 0x47, 0x2E, 0xC4, 0xA6, 0xF5, 0xE3, 0x64, 0x53, 0x3D, 0x4F, 0x83, 0xF5, 0x0D, 0x39, 0xD1,
+    0x8C, 0x66, 0xD2, 0xB0, 0xE2, 0xF5, 0x84, 0xA3, 0x27, 0x04, 0x99, 0xE7, 0xD8, 0xD7, 0xCF, 0x1E,
+    0xC5, 0x3A, 0xE4, 0xD3, 0x45, 0xDA, 0xE4, 0x67, 0x9D, 0x15, 0xEE, 0xBF, 0xA9, 0x12, 0x28, 0x96,
+    0xE5, 0xEC, 0xCC, 0xC3, 0xE3, 0xB1, 0xC4, 0xCC, 0x59, 0x14, 0xBF, 0xEB, 0xFA, 0x23, 0xEA, 0x1D,
+    0x49, 0x7A, 0x87, 0x52, 0x63, 0x66, 0x81, 0x11, 0x75, 0x0E, 0xA4, 0xDD, 0x43, 0xA8, 0x29, 0x31,
+    0xE8, 0x8B, 0x41, 0xA1, 0xDA, 0x17, 0x47, 0xAE, 0x49, 0x98, 0x15, 0x31, 0xBA, 0x0D, 0x0E, 0xD0,
+    0xA9, 0x03, 0x6C, 0x2C, 0x24, 0x9B, 0x49, 0xF4, 0x0A, 0xBD, 0xA1, 0xB2, 0x8E, 0x89, 0xD4, 0x96,
+    0x88, 0xE4, 0xD3, 0x64, 0x8C, 0x8A, 0xEA, 0x8D, 0x69, 0xC5, 0xFB, 0x35, 0xDC, 0xB6, 0x1F, 0x1F,
+    0x4E, 0x1C, 0x2C, 0xA2, 0x5F, 0xD9, 0x8C, 0xD0, 0x68, 0x76, 0x85, 0xD1, 0x59, 0x26, 0x65, 0x94,
+    0x86, 0x68, 0x34, 0x3F, 0x41, 0xA0, 0x52, 0x63, 0xD4, 0x86, 0xE8, 0x34, 0x3F, 0x41, 0xA0, 0x52,
+    0x61, 0x14, 0x86, 0x68, 0x34, 0x3F, 0x42, 0xE8, 0x14, 0x98, 0xF5, 0x21, 0x9A, 0x0D, 0x0F, 0xD0,
+    0x68, 0x0C, 0x98, 0xF5, 0x21, 0x9A, 0x17, 0x43, 0xF4, 0x1A, 0x04, 0xD8, 0xF5, 0x21, 0x9A, 0x0D,
+    0x12, 0x68, 0x34, 0x0A, 0x4C, 0x7A, 0x64, 0x94, 0x4F, 0xEC, 0xC9, 0xCE, 0x29, 0x59, 0x1A, 0xFC,
+    0xB9, 0x24, 0x3A, 0xBC, 0xEA, 0x5F, 0x87, 0x34, 0x67, 0x79, 0x1C, 0x5D, 0x4B, 0xF2, 0x40, 0xD1,
+    0xF1, 0xD6, 0x59, 0x64, 0x7C, 0x1C, 0x59, 0xD6, 0x03, 0x61, 0x64, 0x66, 0xBE, 0x99, 0x26, 0x38,
+    0xA9, 0x2C, 0x5A, 0x6B, 0xD3, 0x00, 0x00, 0x11, 0xC3, 0xBB, 0x8A, 0xCA, 0x78, 0xF7, 0xAF, 0x3E,
+    0x19, 0xA5, 0xCD, 0xCC, 0x8D, 0x7C, 0x7C, 0xEE, 0x4D, 0x7C, 0x18, 0xD5, 0xE0, 0x8F, 0x95, 0xE4,
+    0x6C, 0x86, 0x03, 0xA9, 0xB7, 0xA6, 0x2D, 0xE8, 0xCB, 0xF3, 0x9C, 0x02, 0xCE, 0xB6, 0x17, 0xC3,
+    0xB5, 0xDF, 0xFB, 0x46, 0x73, 0x93, 0xC9, 0x96, 0x4E, 0x5C, 0xE7, 0x27, 0xBF, 0x27, 0x20, 0x37,
+    0xB7, 0xB0, 0x02, 0x5F, 0x57, 0x05, 0x5C, 0x54, 0x23, 0xD2, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x01,
+    0x08, 0x09, 0xB1, 0x6C, 0x70, 0xB5, 0x79, 0xF0, 0x42, 0x2A, 0xF0, 0xD1, 0xD4, 0xF4, 0xF6, 0x71,
+    0xAD, 0xAD, 0x1A, 0x48, 0x7D, 0x51, 0x4F, 0xF2, 0x3B, 0xA9, 0x1E, 0x03, 0xEF, 0x44, 0x59, 0xD3,
+    0xD4, 0x9D, 0xE5, 0xB5, 0xB2, 0x16, 0xB4, 0xF4, 0x45, 0xD4, 0x3A, 0x92, 0xF5, 0x17, 0xA8, 0x39,
+    0x48, 0x72, 0x39, 0x34, 0x1A, 0x15, 0xB5, 0x14, 0xDB, 0xF0, 0x8A, 0x0E, 0x67, 0x9B, 0x8D, 0x29,
+    0xD7, 0x4B, 0xDC, 0x8F, 0x62, 0x8C, 0x25, 0x63, 0xD4, 0x4F, 0x3C, 0xAD, 0x39, 0xBD, 0x22, 0xD7,
+    0x27, 0x32, 0x9C, 0x74, 0xFB, 0xC9, 0x6C, 0xA5, 0xCC, 0xF5, 0x14, 0x23, 0xB5, 0x52, 0xD9, 0x99,
+    0xC9, 0xCB, 0xB7, 0x22, 0x4D, 0xD9, 0x26, 0xCE, 0x72, 0x7D, 0x78, 0x51, 0x5E, 0xE5, 0xEC, 0xB1,
+    0x86, 0x3A, 0x5D, 0x97, 0x57, 0x73, 0xF9, 0x13, 0xFD, 0xAF, 0x44, 0x5F, 0xEB, 0x79, 0x5F, 0xF2,
+    0x2A, 0x80, 0x3F, 0xE0, 0xAF, 0xF4, 0x1B, 0xC5, 0x17, 0x94, 0x7A, 0x82, 0xF8, 0x7E, 0xEF, 0x25,
+    0xB6, 0x17, 0xA8, 0x6A, 0xB3, 0x4A, 0xDF, 0x0C, 0xC6, 0x80, 0x2B, 0x30, 0xAA, 0x9A, 0xE8, 0xE3,
+    0xAD, 0x33, 0xD3, 0x71, 0xF2, 0x6A, 0xBD, 0x6E, 0xB9, 0x26, 0x4F, 0xA3, 0xCD, 0xB0, 0xF3, 0xEE,
+    0xC5, 0x9A, 0x70, 0x93, 0xD7, 0xE0, 0xD8, 0xF0, 0xDC, 0xCD, 0x79, 0x51, 0x50, 0x9B, 0xD4, 0xCA,
+    0x6C, 0xBC, 0x09, 0xD5, 0xFD, 0xA3, 0xED, 0x02, 0x94, 0x1C, 0x4B, 0x9D, 0x06, 0x87, 0xAF, 0x28,
+    0x5D, 0x15, 0x52, 0x67, 0x14, 0x86, 0x68, 0x34, 0x3F, 0x42, 0xE8, 0x0C, 0x98, 0xF5, 0x21, 0x9A,
+    0x0D, 0x0F, 0xD0, 0x68, 0x14, 0x98, 0x45, 0x21, 0xBA, 0x0D, 0x09, 0x2B, 0x23, 0x1F, 0xB9, 0x1B,
+    0xC8, 0x5F, 0x64, 0x57, 0xDD, 0x9F, 0x45, 0x7E, 0xA5, 0x22, 0x2D, 0xBC, 0x9E, 0x35, 0x3E, 0xA7,
+    0x22, 0x5D, 0x15, 0xBC, 0x8E, 0x7A, 0xA5, 0x38, 0xC3, 0xF7, 0x1D, 0x56, 0x5E, 0xDC, 0x1A, 0x8F,
+    0xC9, 0x9F, 0xCB, 0xA2, 0xD9, 0x58, 0xE4, 0xF6, 0xC8, 0x56, 0xF2, 0x55, 0x4D, 0x6A, 0xB6, 0x68,
+    0xFE, 0x31, 0x91, 0xC6, 0x67, 0x5F, 0xBB, 0xED, 0x4B, 0x5D, 0x27, 0xEB, 0x64, 0x36, 0xE4, 0xD9,
+    0x63, 0x6D, 0xC9, 0x91, 0x77, 0x97, 0xE5, 0x89, 0x24, 0xD3, 0xD3, 0x10, 0x88, 0xE4, 0xE5, 0xED,
+    0x9E, 0xCB, 0x55, 0x75, 0x46, 0x29, 0x56, 0x96, 0xBF, 0xD1, 0xD5, 0x8F, 0x9B, 0x6D, 0x32, 0x4D,
+    0x49, 0xE8, 0xD2, 0x71, 0xB9, 0xF1, 0xC9, 0x82, 0x4D, 0xFD, 0x46, 0x44, 0xE8, 0xC2, 0xBA, 0x54,
+    0xDD, 0x16, 0x9F, 0x8D, 0x81, 0x9D, 0x2A, 0x64, 0x2C, 0xFC, 0x08, 0x5D, 0x5B, 0x94, 0x57, 0xF6,
+    0x46, 0xD4, 0x08, 0xF1, 0xA7, 0xEE, 0x55, 0x19, 0x7E, 0x51, 0x20, 0x29, 0x61, 0x4D, 0x74, 0x79,
+    0xFB, 0xCF, 0xAE, 0x2D, 0xC6, 0x5E, 0x9A, 0x02, 0xBB, 0x9A, 0x4D, 0xD1, 0xE0, 0xB2, 0xD1, 0xCD,
+    0x9F, 0x57, 0xB9, 0x8F, 0x24, 0x31, 0xE2, 0x4F, 0x5B, 0x67, 0x1E, 0x7D, 0x6F, 0xD2, 0x32, 0xC0,
+    0x3A, 0x6B, 0xAC, 0x9A, 0x63, 0x48, 0x04, 0x80, 0x00, 0x01, 0x08, 0x00, 0x00, 0x42, 0x00, 0x5F,
+    0x20, 0x49, 0x8F, 0x07, 0x3B, 0x63, 0x15, 0xF9, 0x10, 0x9F, 0xA3, 0x43, 0xC6, 0x41, 0xFE, 0x9D,
+    0x6C, 0xEC, 0xEA, 0x18, 0xD5, 0x74, 0xA6, 0x2B, 0xF8, 0x26, 0xEA, 0x4A, 0xDE, 0x91, 0x05, 0xBD,
+    0xBD, 0x91, 0x75, 0x0E, 0xA4, 0xBD, 0x45, 0xEA, 0x0E, 0x4C, 0x72, 0x31, 0x1E, 0xA1, 0xE5, 0xBD,
+    0xA4, 0xEA, 0xA5, 0xF9, 0x7F, 0x74, 0x64, 0x67, 0x37, 0x39, 0x39, 0x49, 0xED, 0xB1, 0x6C, 0xB2,
+    0x56, 0x4B, 0xB4, 0xDB, 0x6C, 0x61, 0xEF, 0xD5, 0x54, 0xAB, 0x5A, 0x46, 0x42, 0x9A, 0x55, 0x51,
+    0xD2, 0x00, 0x00, 0x0A, 0x14, 0x00, 0x00, 0x42, 0x00, 0x00, 0x10, 0x80, 0x92, 0x8B, 0x65, 0x4D,
+    0x8A, 0x70, 0x7A, 0x68, 0x8C, 0x0E, 0x34, 0x9A, 0xD3, 0x11, 0xBD, 0xF4, 0xEF, 0x2A, 0xB2, 0xEB,
+    0x50, 0xB1, 0xFD, 0x68, 0xBF, 0xD1, 0xE6, 0x9C, 0x4F, 0xBD, 0x56, 0x44, 0x6C, 0x86, 0xD2, 0xD9,
+    0xB9, 0xC7, 0xE5, 0x2B, 0x71, 0x8A, 0x9F, 0xC9, 0x8D, 0xE5, 0x27, 0x45, 0x16, 0xEA, 0x32, 0x5E,
+    0xC2, 0xAE, 0x27, 0x2E, 0xC8, 0xFE, 0x4A, 0xE0, 0xDA, 0x2C, 0xB4, 0x2E, 0x86, 0xD3, 0x6C, 0x2D,
+    0x8E, 0xE2, 0xF6, 0x4B, 0xA2, 0xBD, 0xC9, 0x35, 0xB4, 0x40, 0x92, 0x95, 0x6F, 0xC6, 0x4B, 0x4C,
+    0x64, 0xB5, 0x15, 0xB6, 0x71, 0xDD, 0x73, 0x6F, 0x48, 0x7E, 0x5D, 0x9E, 0x7A, 0xA3, 0x94, 0xCA,
+    0xF2, 0xBC, 0x94, 0x9C, 0x9D, 0x55, 0x3F, 0x5F, 0x66, 0x5F, 0x96, 0xE5, 0x24, 0xE4, 0xE9, 0xA9,
+    0xFA, 0xFB, 0x06, 0xF6, 0x00, 0x06, 0x7D, 0xBD, 0xF6, 0x67, 0x1B, 0x6F, 0xB0, 0x11, 0xA4, 0xFE,
+    0x45, 0x01, 0x1D, 0x4D, 0xA7, 0xB4, 0x71, 0x65, 0x61, 0xC6, 0x69, 0xB8, 0xAD, 0x32, 0xA2, 0xDA,
+    0xDD, 0x72, 0x69, 0xA3, 0x48, 0x70, 0xF2, 0x18, 0xEA, 0x70, 0x72, 0x4B, 0xC9, 0x33, 0x1B, 0x21,
+    0xC5, 0xF8, 0xCB, 0xA3, 0xD5, 0x7E, 0x0B, 0xF3, 0x7B, 0xB1, 0x6F, 0x8E, 0x0E, 0x6C, 0xB7, 0x5C,
+    0xBD, 0x26, 0xFE, 0x8A, 0x60, 0x5F, 0x28, 0x56, 0xB4, 0xF4, 0x3A, 0x98, 0x39, 0xD9, 0x18, 0xAF,
+    0xBB, 0x2D, 0x4F, 0x7E, 0x72, 0x5E, 0x3E, 0x5F, 0x46, 0xBB, 0x86, 0xDC, 0xB1, 0x23, 0xB2, 0xC3,
+    0x44, 0x3C, 0x75, 0x3E, 0xD6, 0x34, 0x17, 0xF0, 0x75, 0x68, 0x91, 0xBD, 0x23, 0xC6, 0x33, 0xAC,
+    0x8C, 0xF2, 0x67, 0x28, 0xF5, 0xB6, 0x33, 0x42, 0x38, 0x6D, 0x34, 0xC9, 0x7A, 0x8B, 0xA0, 0x72,
+    0x60, 0x13, 0x32, 0xFC, 0xBE, 0x1B, 0xAA, 0x6E, 0x71, 0x5E, 0x19, 0x58, 0x6D, 0xEF, 0xA2, 0x37,
+    0x41, 0xC6, 0x48, 0xCE, 0x72, 0x1C, 0x64, 0xE9, 0x93, 0x94, 0x16, 0xE2, 0x54, 0xE4, 0x51, 0xA7,
+    0xE5, 0x12, 0xDF, 0x17, 0x25, 0x49, 0x78, 0xCB, 0xB2, 0xAC, 0x05, 0x71, 0x69, 0xF9, 0x5A, 0x10,
+    0x88, 0x4E, 0x00, 0x01, 0xD1, 0x84, 0xA4, 0xF5, 0x14, 0xD8, 0x84, 0x34, 0xBC, 0xE1, 0x30, 0x5C,
+    0x9F, 0xB9, 0x34, 0x37, 0x8C, 0xE2, 0x65, 0x39, 0x29, 0xDA, 0xB4, 0x8D, 0x1D, 0x55, 0x2A, 0xE0,
+    0xA3, 0x15, 0xA4, 0x82, 0x46, 0x3F, 0x6C, 0x8D, 0x6D, 0xCB, 0xA4, 0x35, 0x44, 0x5E, 0xA4, 0xBD,
+    0x43, 0xA8, 0xE9, 0x32, 0x3A, 0x23, 0xEA, 0x1D, 0x49, 0x7A, 0x87, 0x50, 0x32, 0x61, 0x11, 0xE1,
+    0xC0, 0x00, 0x7D, 0x12, 0x65, 0x80, 0x00, 0x7C, 0x2B, 0x9C, 0xFF, 0x00, 0x6C, 0x5B, 0x10, 0x86,
+    0x01, 0xD5, 0x0C, 0x1C, 0x89, 0x2D, 0xAA, 0xD8, 0xEF, 0xF4, 0xFC, 0x8F, 0xFF, 0x00, 0x36, 0x73,
+    0xC9, 0x7E, 0xCE, 0xE8, 0xE3, 0x02, 0x69, 0xE3, 0xDB, 0x0F, 0xDD, 0x06, 0x44, 0xD6, 0xBE, 0x4E,
+    0xEF, 0x67, 0x04, 0x3A, 0xB0, 0x69, 0xF7, 0x6D, 0x5B, 0xF8, 0x47, 0x29, 0x69, 0xC3, 0xB5, 0xB7,
+    0xF9, 0x2B, 0x39, 0x8B, 0xE7, 0x8F, 0x89, 0x39, 0xC3, 0xB2, 0xCF, 0x88, 0xA2, 0x17, 0xE5, 0xC2,
+    0x13, 0xE8, 0xB4, 0xAE, 0xB8, 0xC2, 0x29, 0x24, 0x3C, 0x00, 0xF2, 0x69, 0x49, 0xC9, 0xEE, 0x5D,
+    0x9E, 0xAF, 0x18, 0xA8, 0xAD, 0x25, 0xE8, 0xED, 0xE3, 0xB2, 0xA5, 0x4D, 0xC9, 0x36, 0xFA, 0xB3,
+    0x4F, 0xDD, 0x3A, 0x7B, 0x2F, 0xC1, 0x8D, 0xAF, 0xF7, 0xC7, 0x5F, 0x3B, 0x35, 0x70, 0x4D, 0x60,
+    0xC7, 0x7F, 0x82, 0x6E, 0x3D, 0xF2, 0x8D, 0x53, 0xFF, 0x00, 0x48, 0xF3, 0x9F, 0x9D, 0x51, 0x5D,
+    0x10, 0x59, 0x10, 0xF5, 0x27, 0xB3, 0x8A, 0x6F, 0xB4, 0x9B, 0x10, 0x00, 0xC9, 0x49, 0xF9, 0x36,
+    0xD9, 0xE0, 0xF2, 0x7E, 0x4D, 0xB6, 0x00, 0x00, 0x34, 0xE0, 0x00, 0x00, 0x84, 0x03, 0x66, 0xB7,
+    0x16, 0x87, 0x01, 0xD3, 0xB0, 0x93, 0x8C, 0x94, 0x97, 0xD1, 0x41, 0x93, 0x53, 0x57, 0xB5, 0x15,
+    0xF2, 0x5D, 0xF0, 0x7C, 0x5C, 0xBB, 0x2B, 0x6D, 0x45, 0xA7, 0x19, 0xC7, 0x43, 0x22, 0x6A, 0x5D,
+    0x3B, 0x48, 0xDA, 0xF1, 0x7E, 0x9F, 0xED, 0x18, 0xCA, 0xC5, 0xA5, 0xF8, 0x34, 0x38, 0xEB, 0xCA,
+    0x0A, 0x4C, 0xFA, 0x02, 0x8F, 0x94, 0x5D, 0x9D, 0xC6, 0xD7, 0x4D, 0x2B, 0x4D, 0xA4, 0x9B, 0x33,
+    0xF5, 0x63, 0xCE, 0x5A, 0x50, 0x8B, 0x67, 0x65, 0x5C, 0x56, 0x4D, 0x9F, 0x10, 0x66, 0xDF, 0x1B,
+    0x8E, 0xA2, 0x88, 0xA5, 0x18, 0x2D, 0x9D, 0x4A, 0x11, 0x5F, 0x09, 0x20, 0xEF, 0xD9, 0x5B, 0x0C,
+    0x3F, 0xB9, 0x33, 0x09, 0xFE, 0x87, 0x93, 0xFF, 0x00, 0x12, 0x1B, 0x78, 0xBC, 0x8A, 0xDF, 0x98,
+    0x33, 0xD0, 0xB4, 0xBF, 0x02, 0x4A, 0x11, 0x97, 0xCC, 0x53, 0x1A, 0xE1, 0xB0, 0x9F, 0xC5, 0x8F,
+    0xD3, 0x3C, 0xD2, 0x55, 0x4E, 0x0F, 0x52, 0x8B, 0x43, 0x25, 0x5A, 0x92, 0xD4, 0x96, 0xD1, 0xE8,
+    0x39, 0x5C, 0x65, 0x17, 0xC5, 0xEE, 0x29, 0x33, 0x3D, 0xC8, 0xF0, 0x93, 0xA1, 0x39, 0x57, 0xE5,
+    0x00, 0x9D, 0x6D, 0x02, 0x95, 0x32, 0x87, 0xB4, 0x64, 0xB2, 0x38, 0xAA, 0x6D, 0xFF, 0x00, 0xC7,
+    0x4C, 0xE1, 0x9F, 0x00, 0x9C, 0xBE, 0x97, 0xE0, 0xD1, 0xCA, 0xB7, 0x17, 0xA6, 0xB4, 0xC3, 0xA9,
+    0x0A, 0x70, 0x8B, 0xFA, 0x1F, 0x0B, 0xE7, 0x1F, 0x5B, 0x33, 0xB5, 0x70, 0x11, 0x4F, 0xEA, 0x7E,
+    0x0B, 0x1C, 0x7E, 0x32, 0x8A, 0x75, 0xA8, 0xA6, 0xCB, 0x2E, 0xA2, 0xF5, 0x07, 0xE2, 0x97, 0x41,
+    0x1D, 0xD3, 0x97, 0x6C, 0x86, 0x30, 0x51, 0x5A, 0x4B, 0x43, 0xBA, 0x92, 0x75, 0x17, 0xA8, 0x39,
+    0x31, 0x26, 0x47, 0xD4, 0x5E, 0xA4, 0x9D, 0x45, 0xEA, 0x0A, 0x4C, 0x22, 0x22, 0xEA, 0x2F, 0x52,
+    0x5E, 0xA1, 0xD4, 0x0C, 0x98, 0x54, 0x78, 0x19, 0x3E, 0x36, 0x35, 0x99, 0x12, 0xD5, 0x71, 0x6C,
+    0x9F, 0x8D, 0xC0, 0x9E, 0x5D, 0xA9, 0x25, 0xF4, 0xFD, 0xD9, 0xB2, 0xC0, 0xC0, 0xAB, 0x16, 0x09,
+    0x46, 0x2B, 0x67, 0xD1, 0x16, 0xDC, 0xA1, 0xE9, 0x76, 0x66, 0x14, 0x76, 0x53, 0x60, 0x70, 0x0B,
+    0x4A, 0x57, 0x7F, 0xD1, 0x75, 0x47, 0x1F, 0x45, 0x2B, 0x51, 0x82, 0x3A, 0xC0, 0x87, 0x2B, 0x25,
+    0x2E, 0xC2, 0x28, 0xA4, 0x32, 0x35, 0x42, 0x2B, 0x4A, 0x28, 0x5E, 0x91, 0xFF, 0x00, 0x8A, 0x1C,
+    0x03, 0x0E, 0x90, 0xD9, 0x8B, 0x4D, 0x89, 0xA9, 0x41, 0x15, 0x99, 0x9C, 0x1D, 0x36, 0xA6, 0xE0,
+    0xB4, 0xCB, 0x90, 0x1C, 0xA7, 0x28, 0xF4, 0xCE, 0x34, 0x8C, 0x26, 0x7F, 0x17, 0x76, 0x33, 0x6F,
+    0xAB, 0x71, 0x39, 0xB1, 0x2E, 0x74, 0xDA, 0xB6, 0x7A, 0x0D, 0xB5, 0x42, 0xD8, 0xB8, 0xCD, 0x26,
+    0x99, 0x97, 0xE6, 0xB8, 0x7F, 0x6F, 0x76, 0x52, 0xBC, 0x7E, 0x02, 0xC9, 0xC3, 0x22, 0x0E, 0xAB,
+    0x3A, 0x63, 0xAA, 0x9C, 0xA8, 0x9A, 0xB2, 0x1D, 0xA2, 0x5A, 0x6E, 0x8D, 0x91, 0x4D, 0x32, 0x55,
+    0xE7, 0xE0, 0xCC, 0xC2, 0xDB, 0x2A, 0x7A, 0x4D, 0xAD, 0x16, 0xFC, 0x0D, 0x96, 0x65, 0x67, 0xD7,
+    0x06, 0xF6, 0xB6, 0x63, 0x72, 0xFE, 0x2D, 0x65, 0x6D, 0xCE, 0xB9, 0x2F, 0x13, 0x65, 0x57, 0xCB,
+    0x6A, 0x8D, 0x5B, 0xB6, 0x3E, 0xD1, 0xA3, 0xE2, 0x70, 0x27, 0x6D, 0xAA, 0x52, 0x5F, 0x4A, 0x34,
+    0x79, 0x15, 0x6B, 0x1F, 0xAA, 0xFB, 0x22, 0x7A, 0x2A, 0x55, 0xD7, 0x14, 0x96, 0xBC, 0x0F, 0x9C,
+    0x7B, 0x45, 0xA2, 0xAF, 0xF8, 0xCA, 0x15, 0x4A, 0x1F, 0xB3, 0x03, 0xCE, 0xF2, 0xF6, 0x72, 0xF2,
+    0x6E, 0x5E, 0x97, 0xD2, 0x33, 0xAD, 0x69, 0xB0, 0x26, 0xCA, 0xAD, 0xD7, 0x6B, 0xF1, 0xE0, 0x84,
+    0xC4, 0x59, 0x07, 0x09, 0x38, 0xBF, 0xA3, 0xCC, 0x2C, 0x83, 0x84, 0x9C, 0x58, 0x00, 0x00, 0xC1,
+    0xA0, 0x00, 0x02, 0x10, 0x02, 0x5B, 0x7A, 0x03, 0xAB, 0x8C, 0xC6, 0x96, 0x4E, 0x5C, 0x21, 0x15,
+    0xBF, 0x27, 0x52, 0xDB, 0xD2, 0x1F, 0x5C, 0x1D, 0x93, 0x50, 0x8F, 0x6C, 0xDF, 0x7A, 0x33, 0x8C,
+    0x84, 0x31, 0x15, 0xD3, 0x8E, 0xDB, 0x35, 0x69, 0x24, 0xB4, 0xBE, 0x0E, 0x5E, 0x2F, 0x1D, 0x63,
+    0x61, 0xD7, 0x5A, 0x5A, 0xD2, 0x3A, 0xCD, 0x25, 0x51, 0xF0, 0x82, 0x89, 0xED, 0x9C, 0x76, 0x32,
+    0xC6, 0xC6, 0x85, 0x7F, 0xA4, 0x00, 0x00, 0x14, 0x9C, 0x00, 0x00, 0x21, 0x00, 0x92, 0x8A, 0x92,
+    0xD4, 0x96, 0xD0, 0xA2, 0x37, 0xAF, 0x91, 0x08, 0xA0, 0xE6, 0x78, 0xA5, 0x24, 0xEC, 0xA9, 0x19,
+    0x5C, 0xBC, 0x8A, 0xF1, 0x13, 0xF7, 0x5E, 0xB4, 0x6D, 0x39, 0x3E, 0x46, 0x30, 0xFE, 0xD5, 0x5A,
+    0x94, 0x9F, 0xC9, 0x9E, 0xC8, 0xE3, 0x68, 0xC9, 0x9B, 0x95, 0xD1, 0xDB, 0x7F, 0x62, 0x9B, 0x3B,
+    0x26, 0xAA, 0x65, 0xAF, 0xB1, 0x47, 0x05, 0xDA, 0xFC, 0x97, 0xA4, 0x62, 0xB9, 0x0F, 0x56, 0x63,
+    0xE3, 0xB6, 0xA0, 0x9B, 0x68, 0xAA, 0x7E, 0xB8, 0x5B, 0xFD, 0x86, 0xBF, 0x9A, 0xF4, 0x8E, 0x1E,
+    0x55, 0x13, 0xF6, 0xA0, 0xA3, 0x3D, 0x78, 0x3C, 0x97, 0x9C, 0xE2, 0xAE, 0xE3, 0x32, 0xA5, 0x5D,
+    0xB1, 0x69, 0x6F, 0xC3, 0x19, 0x8D, 0x7D, 0x57, 0xFA, 0x5D, 0x9C, 0xB7, 0x11, 0xD3, 0xD9, 0xBC,
+    0xC1, 0xF5, 0x9E, 0x35, 0xBA, 0x56, 0xAE, 0xAD, 0x9A, 0x2C, 0x1E, 0x4B, 0x1B, 0x31, 0x2F, 0x6A,
+    0xC4, 0xDF, 0xE3, 0x67, 0x87, 0x1D, 0xBC, 0x7F, 0x25, 0x91, 0x85, 0x6A, 0x9D, 0x53, 0x6B, 0x5F,
+    0x6D, 0x87, 0x9E, 0x32, 0x7D, 0x01, 0xD1, 0xEE, 0x69, 0x04, 0xB5, 0x15, 0xB9, 0x34, 0x91, 0x85,
+    0xC0, 0xF5, 0xBD, 0x51, 0xC2, 0x7F, 0xA8, 0xFF, 0x00, 0x71, 0x23, 0x35, 0xCC, 0xFA, 0xCF, 0x2F,
+    0x2A, 0x52, 0x8D, 0x32, 0x71, 0x8F, 0xDB, 0x47, 0x71, 0xF8, 0x9C, 0x8C, 0x87, 0xE9, 0x69, 0x7E,
+    0xC5, 0xE6, 0xA2, 0x7A, 0x8E, 0x4F, 0x2B, 0x87, 0x8E, 0xF5, 0x65, 0xD1, 0x4F, 0xFC, 0x95, 0xB6,
+    0x7A, 0xB3, 0x8E, 0x84, 0x9C, 0x7D, 0xC5, 0xE0, 0xF1, 0xBB, 0xF3, 0xB2, 0x2F, 0x93, 0x76, 0x5B,
+    0x26, 0xFF, 0x00, 0xC9, 0xCE, 0xE5, 0x27, 0xF2, 0xD9, 0x73, 0x5F, 0xC6, 0xEB, 0xD7, 0xFC, 0x92,
+    0x1B, 0xF9, 0xDF, 0xD1, 0xEA, 0x18, 0x58, 0x90, 0xC5, 0xAD, 0x46, 0x29, 0x6C, 0xE9, 0x00, 0x3D,
+    0x29, 0xBD, 0xFB, 0x65, 0x38, 0x00, 0x01, 0xC1, 0x00, 0x00, 0x08, 0x40, 0x00, 0x02, 0x10, 0x09,
+    0x38, 0x29, 0xC5, 0xA9, 0x2D, 0xA6, 0x28, 0x1D, 0x11, 0x8E, 0xE7, 0xF8, 0xE7, 0x45, 0x8E, 0xC8,
+    0x2F, 0xA5, 0x96, 0x5E, 0x86, 0xC3, 0x76, 0x64, 0xBB, 0x5A, 0xF0, 0x8B, 0x7C, 0xEC, 0x68, 0xE4,
+    0xD2, 0xE0, 0xD1, 0x6D, 0xE9, 0xBE, 0x3E, 0x38, 0x78, 0x9A, 0xD7, 0x96, 0x03, 0x90, 0xCB, 0xF0,
+    0xC6, 0x71, 0xFB, 0x64, 0x0C, 0xD9, 0xFE, 0x38, 0x7F, 0xD9, 0x6C, 0x97, 0x81, 0x52, 0x1F, 0xA1,
+    0x74, 0x63, 0xE4, 0xCA, 0x88, 0xC8, 0xE0, 0xCF, 0xC6, 0xF7, 0x61, 0xB4, 0xBC, 0x94, 0xB3, 0x83,
+    0x84, 0x9A, 0x68, 0xD5, 0x75, 0xD9, 0xC7, 0x95, 0x83, 0x1B, 0x53, 0x69, 0x69, 0x94, 0x5C, 0x8E,
+    0x07, 0xE5, 0x7F, 0x92, 0xBE, 0xCA, 0xCC, 0xFC, 0x0F, 0xCD, 0xFF, 0x00, 0x25, 0x7D, 0x99, 0xF0,
+    0x3A, 0xAE, 0xC2, 0xB6, 0xB6, 0xFC, 0x6D, 0x1C, 0xEE, 0x12, 0x5F, 0x31, 0x66, 0x7A, 0x75, 0x4E,
+    0x0F, 0x52, 0x45, 0x04, 0xEA, 0x9C, 0x1E, 0xA4, 0x86, 0x80, 0xE5, 0x09, 0x3F, 0x84, 0xC9, 0xE9,
+    0xC3, 0xB6, 0xC6, 0xB5, 0x16, 0x72, 0x30, 0x94, 0xBD, 0x24, 0x72, 0x15, 0x4E, 0x6F, 0x51, 0x5B,
+    0x20, 0xAA, 0xB9, 0x5B, 0x35, 0x18, 0x2D, 0xB6, 0x7A, 0x1F, 0xA3, 0xF8, 0x3F, 0xD3, 0x41, 0x5F,
+    0x7C, 0x7E, 0xA7, 0xF1, 0xB2, 0xB3, 0xD2, 0xFC, 0x4C, 0x56, 0x54, 0x65, 0x62, 0x4D, 0xA3, 0x7C,
+    0xDC, 0x29, 0xAF, 0xCE, 0xA3, 0x14, 0x8B, 0x5C, 0x5C, 0x3F, 0x07, 0xE7, 0x3E, 0xCD, 0xF7, 0xC6,
+    0xB8, 0x15, 0x07, 0xFC, 0xAB, 0xFB, 0x5D, 0x22, 0x41, 0xB2, 0x92, 0x8F, 0xCB, 0x48, 0xCE, 0xF2,
+    0xDE, 0xA4, 0xAB, 0x1D, 0xB8, 0x53, 0xF5, 0x48, 0xCC, 0x66, 0x73, 0xF9, 0x57, 0xB7, 0xA9, 0x38,
+    0xA2, 0xCB, 0x46, 0xB6, 0xEE, 0x42, 0xAA, 0xBD, 0x2F, 0x6C, 0xF4, 0x47, 0x95, 0x4A, 0x7A, 0x76,
+    0x47, 0xFE, 0xC5, 0x8E, 0x4D, 0x32, 0x7A, 0x56, 0x47, 0xFE, 0xCF, 0x29, 0x96, 0x6E, 0x44, 0x9E,
+    0xDD, 0x92, 0xFF, 0x00, 0xB1, 0x61, 0x9D, 0x91, 0x07, 0xB5, 0x64, 0xB7, 0xFE, 0x4E, 0xE8, 0x8B,
+    0xFF, 0x00, 0x96, 0x5B, 0xFF, 0x00, 0x13, 0xD6, 0x93, 0x4F, 0xE1, 0xEC, 0x1B, 0xD7, 0xC9, 0xE7,
+    0x18, 0x7E, 0xA3, 0xC9, 0xC7, 0xD7, 0x79, 0x6E, 0x2B, 0xF2, 0x70, 0x7A, 0xAB, 0xFA, 0x8D, 0x1C,
+    0x7C, 0x37, 0x56, 0x37, 0xFB, 0xED, 0x6B, 0xC1, 0x2F, 0x0B, 0x06, 0xEC, 0xDB, 0x55, 0x55, 0x2D,
+    0xB6, 0x4C, 0xA7, 0x3A, 0xBB, 0x7A, 0xEC, 0xDA, 0xFA, 0x83, 0xD5, 0x78, 0x1C, 0x3C, 0x25, 0xEF,
+    0x5B, 0x17, 0x35, 0xF6, 0xD9, 0xE6, 0x3C, 0xEF, 0xF5, 0x4E, 0xEB, 0x5C, 0xAB, 0xC2, 0x8F, 0x54,
+    0xFC, 0x6C, 0xF3, 0x5E, 0x57, 0x94, 0xC9, 0xE4, 0xB2, 0x25, 0x6E, 0x45, 0x92, 0x93, 0x7F, 0xC9,
+    0xC2, 0x7A, 0x57, 0x1D, 0xF1, 0x3C, 0x5C, 0x78, 0xA9, 0x5E, 0xBC, 0xA5, 0xFF, 0x00, 0xA1, 0xD2,
+    0xB9, 0xBE, 0x8F, 0x7C, 0xF4, 0x5E, 0x45, 0xB9, 0xD8, 0x1F, 0xA9, 0xBE, 0x5D, 0xA7, 0x3F, 0x3E,
+    0x4D, 0x21, 0xE6, 0xDF, 0xD3, 0x3E, 0x72, 0xA5, 0x8C, 0xB1, 0x2D, 0x9A, 0x52, 0xFB, 0x6C, 0xF4,
+    0x84, 0xD3, 0x5B, 0x4F, 0x68, 0xF0, 0xAF, 0x94, 0xE1, 0x59, 0x87, 0xC9, 0xDB, 0x09, 0xC7, 0x49,
+    0xBF, 0x5F, 0xF4, 0x68, 0x31, 0x64, 0xA5, 0x52, 0xD0, 0xA7, 0x9E, 0x7F, 0x54, 0xB1, 0x6B, 0xFD,
+    0x2C, 0x6E, 0xD2, 0x52, 0x3D, 0x06, 0x73, 0x8C, 0x22, 0xE5, 0x27, 0xA4, 0x8F, 0x25, 0xFE, 0xA6,
+    0xF3, 0x75, 0xE5, 0x4D, 0x63, 0x53, 0x24, 0xFA, 0xFC, 0xE8, 0x27, 0xC5, 0x38, 0xA9, 0xF2, 0x7C,
+    0x84, 0x2A, 0x49, 0xF8, 0xFD, 0xBF, 0xD0, 0xDC, 0xD9, 0xA8, 0xD4, 0xF6, 0x60, 0xD3, 0xD9, 0x1D,
+    0xB6, 0x6B, 0xC2, 0xF9, 0x23, 0xEE, 0xE2, 0x88, 0xDB, 0xDB, 0xF2, 0x6F, 0x32, 0xBE, 0x3E, 0xB0,
+    0x72, 0x5C, 0x25, 0x2D, 0xC7, 0xE8, 0xA0, 0x76, 0x6D, 0x0A, 0xDB, 0x7F, 0x2C, 0x40, 0x02, 0x4A,
+    0x49, 0x2D, 0x21, 0x80, 0x00, 0x07, 0x4E, 0x1E, 0xB4, 0x00, 0x06, 0x8C, 0xAE, 0x00, 0x00, 0x10,
+    0x80, 0x00, 0x04, 0x20, 0x00, 0x01, 0x08, 0x00, 0x00, 0x42, 0x02, 0xEF, 0x8B, 0x9F, 0x6A, 0xF5,
+    0xF8, 0x29, 0x0B, 0x4E, 0x1E, 0x5F, 0x5B, 0x44, 0x1E, 0x46, 0x1E, 0x54, 0xB7, 0xFA, 0x21, 0x67,
+    0xC3, 0xCA, 0x96, 0xFF, 0x00, 0x45, 0xBE, 0x85, 0xD0, 0xE4, 0x85, 0xD1, 0x94, 0x93, 0x33, 0xF1,
+    0x90, 0xD4, 0x87, 0x24, 0x39, 0x21, 0x74, 0x06, 0x4C, 0x34, 0x64, 0x31, 0xC1, 0x3F, 0x94, 0x47,
+    0x2C, 0x5A, 0xA4, 0xFC, 0xC5, 0x1D, 0x1A, 0x1C, 0x91, 0x1E, 0x6A, 0x32, 0xED, 0x04, 0xF1, 0x8C,
+    0xBB, 0x47, 0x2C, 0x71, 0x2A, 0x8B, 0xDA, 0x8A, 0x27, 0x8D, 0x71, 0x8F, 0xC2, 0x44, 0x9A, 0x17,
+    0x40, 0x7C, 0x63, 0x1E, 0x90, 0x5A, 0xE3, 0x18, 0xF4, 0x8B, 0x2E, 0x0E, 0x71, 0xAA, 0xC9, 0x4A,
+    0x4F, 0x49, 0x22, 0xAF, 0xD4, 0x3C, 0xED, 0x96, 0xDB, 0x2A, 0xA9, 0x96, 0xA2, 0xBC, 0x78, 0x39,
+    0x39, 0x0C, 0xD9, 0x51, 0x17, 0x0A, 0xDE, 0x9B, 0x29, 0x25, 0x27, 0x29, 0x36, 0xFE, 0x58, 0x91,
+    0x6B, 0x1C, 0xA9, 0x46, 0x95, 0x5C, 0x42, 0x52, 0x72, 0x7B, 0x93, 0xDB, 0x10, 0x00, 0xE9, 0x14,
+    0x00, 0x06, 0x5B, 0x25, 0x08, 0x4A, 0x4F, 0xEC, 0x8E, 0xA5, 0xB7, 0xA4, 0x22, 0x9F, 0xD4, 0x7C,
+    0x9C, 0x70, 0xB1, 0xDC, 0x53, 0xFA, 0xDA, 0x3C, 0xEB, 0x22, 0xE9, 0xDF, 0x6B, 0x9C, 0xDB, 0x6D,
+    0x96, 0x5E, 0xA3, 0xCC, 0x96, 0x4E, 0x74, 0xD6, 0xFE, 0x98, 0xB2, 0xA4, 0xF5, 0xFF, 0x00, 0x8E,
+    0xF1, 0x70, 0xC1, 0xC6, 0x52, 0x6B, 0xFB, 0x4B, 0xDB, 0x2E, 0xB1, 0xA9, 0x55, 0xC3, 0x7F, 0x60,
+    0x00, 0x06, 0x84, 0x92, 0x4F, 0x87, 0x95, 0x6E, 0x25, 0xD1, 0xB6, 0x99, 0x38, 0xC9, 0x3F, 0xB1,
+    0xBA, 0xE3, 0x3F, 0xA8, 0x57, 0xD1, 0x4A, 0x85, 0xF1, 0xED, 0xA5, 0xF2, 0x79, 0xF0, 0x15, 0x3C,
+    0x9F, 0x07, 0x85, 0xCA, 0x24, 0xB2, 0xAB, 0x52, 0xD0, 0x6A, 0xAF, 0x9D, 0x5F, 0xE2, 0xCD, 0xD7,
+    0x33, 0xEB, 0xEC, 0x9C, 0xBA, 0x65, 0x5D, 0x2B, 0xA2, 0x7E, 0x0C, 0x45, 0xF6, 0xCE, 0xEB, 0x1C,
+    0xEC, 0x6D, 0xC9, 0xFE, 0x49, 0x71, 0x30, 0xAF, 0xCB, 0x9A, 0x8D, 0x30, 0x72, 0xD9, 0xA7, 0xC0,
+    0xF4, 0x5E, 0x4D, 0xD1, 0x8C, 0xAD, 0x7D, 0x53, 0x22, 0xD1, 0x8D, 0xC6, 0xF0, 0x35, 0xB8, 0xD2,
+    0x94, 0x7F, 0xFA, 0xC2, 0x6A, 0xEC, 0x97, 0xBE, 0xCC, 0x6B, 0x7E, 0x44, 0x3D, 0x09, 0xFA, 0x0B,
+    0xC7, 0xFB, 0x9E, 0x4A, 0x9E, 0x47, 0xD1, 0xB9, 0x78, 0xF1, 0x94, 0xAB, 0x5D, 0x92, 0x31, 0x57,
+    0xE5, 0x2B, 0xED, 0x73, 0x6F, 0xB3, 0xB2, 0xC3, 0xB6, 0x2B, 0x6D, 0x19, 0x30, 0x26, 0xC9, 0xC6,
+    0xB7, 0x1E, 0x6E, 0x36, 0xC1, 0xC5, 0xFF, 0x00, 0x24, 0x23, 0x08, 0xCD, 0x6B, 0xB0, 0x00, 0x01,
+    0x1C, 0x3D, 0x68, 0x00, 0x0D, 0x19, 0x5C, 0x00, 0x00, 0x21, 0x00, 0x00, 0x08, 0x40, 0x00, 0x02,
+    0x10, 0x00, 0x00, 0x84, 0x05, 0x9F, 0x0C, 0xBF, 0xBC, 0x56, 0x17, 0x5C, 0x15, 0x7B, 0x6E, 0x5A,
+    0x21, 0xE7, 0xC9, 0x46, 0x89, 0x6C, 0x87, 0x9F, 0x25, 0x1A, 0x25, 0xB2, 0xE3, 0x42, 0xE8, 0x72,
+    0x42, 0xA4, 0x63, 0xE4, 0xCC, 0xC4, 0x64, 0x35, 0x21, 0xC9, 0x0E, 0xD0, 0xA9, 0x01, 0x93, 0x0D,
+    0x19, 0x0D, 0x48, 0x54, 0x87, 0xA4, 0x2A, 0x40, 0x24, 0xC3, 0xC6, 0x43, 0x52, 0x1B, 0x74, 0xD5,
+    0x75, 0xB9, 0x48, 0x97, 0x45, 0x2F, 0x31, 0x93, 0xB9, 0x7B, 0x71, 0x61, 0xB1, 0x31, 0x9E, 0x4D,
+    0x9E, 0x2B, 0xA5, 0xED, 0x9C, 0xBB, 0x21, 0x53, 0x1D, 0xFE, 0xCE, 0x0C, 0xCB, 0x7D, 0xDB, 0x9B,
+    0xFB, 0x10, 0x80, 0x11, 0xE4, 0x92, 0x7A, 0x45, 0x94, 0x7A, 0x40, 0x00, 0x07, 0x07, 0x01, 0xC1,
+    0xCD, 0x5B, 0xED, 0x60, 0x58, 0xF7, 0xA7, 0xA3, 0xBC, 0xA5, 0xF5, 0x4F, 0xFF, 0x00, 0x5B, 0x32,
+    0x6F, 0x1D, 0x5A, 0xB3, 0x2A, 0xB8, 0xBF, 0xB6, 0x87, 0xD4, 0xB7, 0x34, 0x8F, 0x38, 0xBE, 0x4E,
+    0x76, 0xCA, 0x4F, 0xEE, 0xC6, 0x03, 0xF9, 0x60, 0x7B, 0x9C, 0x56, 0x92, 0x48, 0xD0, 0x20, 0x00,
+    0x03, 0xA2, 0x02, 0xDF, 0xD3, 0xFC, 0x3D, 0x9C, 0x9E, 0x4C, 0x63, 0x14, 0xFA, 0x6F, 0xCB, 0x2B,
+    0x31, 0xEA, 0x77, 0x5D, 0x18, 0x45, 0x6D, 0xB7, 0xA3, 0xD7, 0xFD, 0x27, 0xC5, 0xC3, 0x07, 0x02,
+    0x0D, 0xC7, 0xEB, 0x92, 0xDB, 0x29, 0x79, 0xBE, 0x4B, 0xF8, 0x34, 0xFF, 0x00, 0x5F, 0xF2, 0x7D,
+    0x13, 0x30, 0xF1, 0xFF, 0x00, 0x34, 0xFD, 0xF4, 0x8E, 0x9E, 0x1F, 0x84, 0xC6, 0xE3, 0xEA, 0x8A,
+    0x8C, 0x13, 0x96, 0xBE, 0x74, 0x5B, 0x24, 0x97, 0xC0, 0x01, 0xE6, 0x96, 0xDD, 0x3B, 0xA4, 0xE7,
+    0x37, 0xB6, 0x68, 0xA3, 0x05, 0x05, 0xA8, 0x80, 0x92, 0x8A, 0x92, 0xD3, 0x5B, 0x42, 0x80, 0x31,
+    0xC5, 0x07, 0x3D, 0xE9, 0xEC, 0x7E, 0x42, 0x99, 0x35, 0x04, 0xAC, 0xD7, 0x86, 0x79, 0x3F, 0x31,
+    0xC6, 0xDB, 0xC7, 0x65, 0x4A, 0xBB, 0x13, 0xD6, 0xFC, 0x1E, 0xEE, 0x64, 0x7D, 0x75, 0xC4, 0x47,
+    0x2B, 0x0E, 0x57, 0x42, 0x3F, 0x5C, 0x7C, 0x86, 0xAA, 0xCD, 0x3D, 0x32, 0xBB, 0x37, 0x15, 0x4E,
+    0x3E, 0x71, 0xEC, 0xF2, 0x70, 0x16, 0x71, 0x70, 0x9B, 0x8B, 0xF9, 0x42, 0x12, 0xCA, 0x13, 0xD6,
+    0x80, 0x00, 0xD1, 0x95, 0xC0, 0x00, 0x02, 0x10, 0x00, 0x00, 0x84, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x08, 0x43, 0xA2, 0xBB, 0x49, 0x23, 0x51, 0xC5, 0xD1, 0xED, 0xE3, 0xAD, 0xFC, 0xB2, 0x97, 0x8A,
+    0xC5, 0x77, 0x5C, 0x9B, 0x5E, 0x11, 0xA8, 0x84, 0x3A, 0xC5, 0x25, 0xF6, 0x28, 0x79, 0x7C, 0x85,
+    0xEA, 0xA4, 0x67, 0xF9, 0x8C, 0xA5, 0xEA, 0xA4, 0x09, 0x0E, 0x48, 0x54, 0x87, 0x24, 0x67, 0xA4,
+    0xCA, 0x68, 0xC8, 0x6A, 0x43, 0x92, 0x1C, 0x90, 0xA9, 0x00, 0x93, 0x0D, 0x19, 0x0D, 0x48, 0x72,
+    0x43, 0x92, 0x1C, 0x90, 0x19, 0x30, 0xF1, 0x91, 0x05, 0xEF, 0xA5, 0x52, 0x97, 0xF0, 0x64, 0xF2,
+    0x67, 0xEE, 0x5D, 0x27, 0xFC, 0x9A, 0x8E, 0x56, 0x4E, 0x18, 0xB2, 0xD1, 0x92, 0x6F, 0x72, 0x66,
+    0xAF, 0xE3, 0xB8, 0xEA, 0x54, 0xD9, 0x3F, 0xB7, 0xE8, 0xA8, 0xE4, 0xEF, 0xD5, 0xB0, 0x5F, 0xAF,
+    0x62, 0x8A, 0x22, 0x14, 0xCC, 0x5D, 0x07, 0x5C, 0xDC, 0x5F, 0xD1, 0xAC, 0xAA, 0x6A, 0x70, 0x52,
+    0x5F, 0x60, 0x00, 0x00, 0xC2, 0x01, 0x55, 0xEA, 0x2A, 0xBD, 0xDE, 0x3A, 0xC5, 0xF8, 0x45, 0xA9,
+    0x0E, 0x5D, 0x6A, 0xDC, 0x79, 0xC1, 0xFD, 0xD1, 0x23, 0x12, 0xDF, 0xC3, 0x7C, 0x2C, 0xFD, 0x34,
+    0x3A, 0x0F, 0xC6, 0x49, 0x9E, 0x45, 0x35, 0xA9, 0xB5, 0xF8, 0x62, 0x1D, 0x9C, 0xAD, 0x0F, 0x1F,
+    0x36, 0xC8, 0xB5, 0xAF, 0x27, 0x19, 0xEE, 0x94, 0xD8, 0xAD, 0xAE, 0x33, 0x8F, 0x4D, 0x1A, 0x08,
+    0xBD, 0xAD, 0x80, 0x00, 0x05, 0x3A, 0x5C, 0xFA, 0x52, 0x85, 0x7F, 0x2D, 0x52, 0x7F, 0x66, 0x7B,
+    0x3D, 0x31, 0xE9, 0x5C, 0x62, 0xBE, 0xC8, 0xF1, 0xEF, 0x46, 0x4E, 0x30, 0xE5, 0xEB, 0xEC, 0xF5,
+    0xE4, 0xF6, 0x28, 0x3D, 0xC5, 0x34, 0x60, 0x3E, 0x57, 0x29, 0x7F, 0x22, 0x29, 0xF5, 0xA2, 0xF7,
+    0x8C, 0x4B, 0xF1, 0xB6, 0x28, 0x00, 0x19, 0x52, 0xCC, 0x00, 0x00, 0x42, 0x02, 0x0C, 0xFA, 0xD5,
+    0xB8, 0xB6, 0x41, 0xFD, 0xD1, 0x39, 0x1E, 0x4B, 0x51, 0xA2, 0x6D, 0xFC, 0x68, 0x47, 0x25, 0xD1,
+    0xE1, 0x7C, 0xDD, 0x3E, 0xCF, 0x23, 0x74, 0x17, 0xE5, 0x9C, 0x25, 0x97, 0xA8, 0xA4, 0xA7, 0xCA,
+    0xDC, 0xE2, 0xFC, 0x6C, 0xAD, 0x2C, 0x17, 0x46, 0x52, 0xCF, 0x52, 0x7A, 0x3D, 0x97, 0x2B, 0x1D,
+    0xC1, 0xED, 0x2F, 0x07, 0x21, 0x79, 0x38, 0xA9, 0x2D, 0x33, 0x83, 0x23, 0x1B, 0x5E, 0x62, 0x5E,
+    0xD7, 0x6E, 0xFD, 0x33, 0xB9, 0x98, 0x2E, 0x2F, 0xCE, 0xBE, 0x8E, 0x20, 0x15, 0xAD, 0x3D, 0x08,
+    0x1C, 0xAA, 0x00, 0x00, 0x10, 0x80, 0x00, 0x04, 0x20, 0x3A, 0x31, 0x31, 0xA7, 0x7D, 0x89, 0x45,
+    0x78, 0x25, 0xC1, 0xC1, 0x9E, 0x44, 0x97, 0x8F, 0xA4, 0xD3, 0x61, 0x61, 0x43, 0x1E, 0x1E, 0x17,
+    0x92, 0xBF, 0x33, 0x3E, 0x34, 0x2F, 0x18, 0xF6, 0x54, 0x72, 0x1C, 0xAD, 0x78, 0xC9, 0xC2, 0x3E,
+    0xE4, 0x26, 0x0E, 0x2A, 0xC7, 0xA9, 0x2D, 0x79, 0x3A, 0xD2, 0x1C, 0x90, 0xA9, 0x19, 0x5B, 0x6C,
+    0x73, 0x6E, 0x52, 0x32, 0x52, 0xB6, 0x56, 0x49, 0xCA, 0x4F, 0xDB, 0x11, 0x21, 0x52, 0x1C, 0x90,
+    0xE4, 0x88, 0xD2, 0x61, 0x23, 0x21, 0xA9, 0x0E, 0x48, 0x72, 0x42, 0xA4, 0x06, 0x4C, 0x3C, 0x64,
+    0x22, 0x42, 0xA4, 0x39, 0x21, 0xC9, 0x00, 0x93, 0x24, 0x46, 0x45, 0x77, 0x33, 0x1F, 0xFE, 0x24,
+    0x8C, 0x8B, 0xF9, 0x66, 0xE3, 0x3E, 0xBE, 0xF8, 0xD3, 0x5F, 0xC1, 0x89, 0xBA, 0x3D, 0x6D, 0x92,
+    0xFE, 0x4D, 0xB7, 0xC5, 0xAD, 0x52, 0xA6, 0x50, 0xFD, 0x32, 0x97, 0x96, 0x8F, 0xF7, 0x52, 0x1A,
+    0x87, 0x0C, 0x43, 0x91, 0x17, 0x9E, 0xE3, 0x5C, 0x65, 0xFC, 0x8A, 0xD7, 0xA7, 0xD9, 0x6D, 0xC2,
+    0xF2, 0x0A, 0x51, 0xFC, 0x13, 0x7E, 0xD7, 0x42, 0x80, 0x01, 0x97, 0x34, 0x40, 0x20, 0xA0, 0x21,
+    0x18, 0xFF, 0x00, 0x57, 0xF1, 0x6E, 0x7F, 0xDF, 0xAA, 0x3F, 0x1F, 0x26, 0x2D, 0xA6, 0x9E, 0x9F,
+    0xC9, 0xEC, 0x17, 0xD5, 0x1B, 0xAB, 0x94, 0x26, 0xB6, 0x99, 0x81, 0xF5, 0x27, 0x0C, 0xF1, 0x2C,
+    0x76, 0xD6, 0xBE, 0x86, 0x7A, 0x37, 0xC5, 0xB9, 0xC8, 0xCA, 0x2B, 0x0E, 0xE7, 0xED, 0x74, 0x59,
+    0xE2, 0x64, 0x6D, 0x78, 0x48, 0xCE, 0x80, 0x01, 0xBB, 0x2C, 0x0E, 0xAE, 0x2F, 0x23, 0xF4, 0xB9,
+    0xB5, 0xD9, 0xF8, 0x67, 0xB5, 0xF0, 0xF9, 0x71, 0xCB, 0xC2, 0xAE, 0xC8, 0xBD, 0xF8, 0x3C, 0x28,
+    0xDA, 0xFA, 0x23, 0x9E, 0x78, 0xF6, 0x2C, 0x7B, 0x9F, 0xD2, 0xFE, 0x0C, 0xD7, 0xC8, 0xF8, 0xE7,
+    0x93, 0x52, 0xB6, 0x1D, 0xC7, 0xFF, 0x00, 0x85, 0x8F, 0x1F, 0x90, 0xAB, 0x97, 0x8C, 0xBA, 0x67,
+    0xA6, 0x80, 0xDA, 0xE4, 0xA7, 0x05, 0x25, 0xF0, 0xC7, 0x1E, 0x77, 0xD1, 0x7E, 0x00, 0x00, 0x21,
+    0x01, 0x4F, 0xEA, 0x8C, 0xF8, 0xE1, 0x71, 0xD6, 0x36, 0xFC, 0xB5, 0xA4, 0x5A, 0x64, 0x5D, 0x1A,
+    0x2A, 0x95, 0x93, 0xF8, 0x4B, 0x67, 0x92, 0xFA, 0xCF, 0x9C, 0x96, 0x7E, 0x53, 0xAA, 0xB6, 0xFD,
+    0xB8, 0xB0, 0x95, 0xC3, 0xC9, 0x91, 0x72, 0xEF, 0x55, 0x43, 0xFD, 0xB3, 0x39, 0x95, 0x67, 0xBB,
+    0x7C, 0xE6, 0xFE, 0xEC, 0x88, 0x00, 0x9A, 0x66, 0xDB, 0xD9, 0xFF, 0xD9,
+};
@@ -0,0 +1,576 @@
+// BenchWorkloads.h
+// The DisplayBenchmark workload table and the state it draws with. Shared
+// with the host test (test/test_display_benchmark), which runs the same
+// table on ESP32S3BoxLiteRecordingBus.
+//
+// Call setupWorkloads() once after box.begin().
+
+#pragma once
+
+#include <ESP32S3BoxLite.h>
+#include <fonts/DejaVuSansBold24.h>
+
+#include "BenchArtQoi.h"
+#include "BenchArtRle.h"
+#include "BenchBounceGif.h"
+#include "BenchPhotoJpeg.h"
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Global state
+// ---------------------------------------------------------------------------
+
+ESP32S3BoxLite box;
+
+ESP32S3BoxLiteConsole console;
+ESP32S3BoxLiteLabel counterLabel;
+ESP32S3BoxLiteCompositor compositor;
+ESP32S3BoxLiteTileRenderer tiles;
+int16_t tileBoxX = 0;
+
+ESP32S3BoxLiteSprite sprite32;
+ESP32S3BoxLiteSprite sprite64;
+ESP32S3BoxLiteSprite sprite160;
+ESP32S3BoxLiteSprite sprite320;
+ESP32S3BoxLiteSprite sprite64Dma;   // wire order, internal RAM
+ESP32S3BoxLiteSprite sprite320Wire; // wire order, PSRAM
+ESP32S3BoxLiteSprite sprite320I8;   // 8 bpp palette, 75 KB
+ESP32S3BoxLiteSprite sprite320I4;   // 4 bpp palette, 38 KB
+ESP32S3BoxLiteSpriteSheet iconSheet; // 16x16 cells of sprite160
+
+constexpr uint16_t kBlack  = ESP32S3BoxLiteDisplay::ColorBlack;
+constexpr uint16_t kWhite  = ESP32S3BoxLiteDisplay::ColorWhite;
+constexpr uint16_t kBlue   = ESP32S3BoxLiteDisplay::ColorBlue;
+constexpr uint16_t kGreen  = ESP32S3BoxLiteDisplay::ColorGreen;
+constexpr uint16_t kYellow = ESP32S3BoxLiteDisplay::ColorYellow;
+
+// Widget screen for the uiprog workload
+ESP32S3BoxLiteUi uiScreen;
+ESP32S3BoxLiteStatusBarWidget uiStatus(kBlue);
+ESP32S3BoxLiteProgressWidget uiProgress(20, 110, 280, 16, kGreen, ESP32S3BoxLiteDisplay::ColorGray);
+ESP32S3BoxLiteLabelWidget uiPercent(142, 140, 4, 2, kWhite, kBlack);
+
+// Recorded frames for the bootdl and pagedl workloads
+ESP32S3BoxLiteDisplayList frameList;
+
+// 16x16 1-bit test pattern for drawBitmap
+const uint8_t kChecker16[32] = {
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+};
+
+uint16_t rgbTile[32 * 32];
+
+// Small deterministic PRNG so every run draws the same lines
+uint32_t rngState = 1;
+int16_t nextRandom(int16_t limit) {
+  rngState = rngState * 1103515245U + 12345U;
+  return static_cast<int16_t>((rngState >> 16) % static_cast<uint32_t>(limit));
+}
+
+// ---------------------------------------------------------------------------
+// Workloads
+// ---------------------------------------------------------------------------
+
+void wlFillScreen() {
+  box.display().fillScreen(kBlue);
+}
+
+void wlSmallRects() {
+  for (int i = 0; i < 100; ++i) {
+    box.display().fillRect(static_cast<uint16_t>((i * 37) % 300), static_cast<uint16_t>((i * 53) % 220),
+                           20, 20, static_cast<uint16_t>(i * 0x0841));
+  }
+}
+
+void wlLines() {
+  rngState = 1;
+  auto &d = box.display();
+  for (int i = 0; i < 100; ++i) {
+    d.drawLine(nextRandom(320), nextRandom(240), nextRandom(320), nextRandom(240), kGreen);
+  }
+}
+
+void wlRectOutlines() {
+  for (int i = 0; i < 50; ++i) {
+    box.display().drawRect(static_cast<int16_t>(i * 3), static_cast<int16_t>(i * 2),
+                           static_cast<int16_t>(320 - i * 6), static_cast<int16_t>(240 - i * 4), kYellow);
+  }
+}
+
+void wlCircles() {
+  for (int16_t r = 4; r < 120; r += 4) {
+    box.display().drawCircle(160, 120, r, kWhite);
+  }
+}
+
+void wlFillCircles() {
+  for (int i = 0; i < 20; ++i) {
+    box.display().fillCircle(static_cast<int16_t>(20 + i * 14), 120, 12, kGreen);
+  }
+}
+
+void wlShapes() {
+  // Scan-converted fills: every covered row is one span
+  auto &d = box.display();
+  for (int i = 0; i < 10; ++i) {
+    const int16_t x = static_cast<int16_t>(i * 32);
+    d.fillTriangle(x, 100, static_cast<int16_t>(x + 30), 100, static_cast<int16_t>(x + 15), 70, kYellow);
+    d.fillRoundRect(x, 110, 28, 40, 8, kBlue);
+    d.drawThickLine(x, 160, static_cast<int16_t>(x + 28), 200, 5, kGreen);
+  }
+  d.fillArc(160, 120, 60, 45, -90, 180, kWhite);
+}
+
+void wlAntiAliased() {
+  // Coverage blended against a known background through the channel LUTs
+  auto &d = box.display();
+  for (int i = 0; i < 20; ++i) {
+    d.drawLineAA(static_cast<int16_t>(i * 16), 0, static_cast<int16_t>(319 - i * 16), 239, kGreen, kBlack);
+  }
+  d.drawCircleAA(160, 120, 100, kWhite, kBlack);
+  d.fillCircleAA(160, 120, 40, kYellow, kBlack);
+  d.drawTextAA(40, 100, "SMOOTH", 4, kWhite, kBlack);
+}
+
+// The shape and AA scenes redrawn inside a 64x48 damaged region: only the
+// spans that cross it are sent
+void wlClipped() {
+  auto &d = box.display();
+  d.pushClipRect(128, 96, 64, 48);
+  wlShapes();
+  wlAntiAliased();
+  d.popClipRect();
+}
+
+void wlPixels() {
+  for (int16_t i = 0; i < 1000; ++i) {
+    box.display().drawPixel(static_cast<int16_t>(i % 320), static_cast<int16_t>((i * 7) % 240), kWhite);
+  }
+}
+
+void wlTextBlock() {
+  auto &d = box.display();
+  for (int16_t row = 0; row < 20; ++row) {
+    d.printf(0, static_cast<int16_t>(row * 12), 1, kWhite, kBlack,
+             "Line %02d: The quick brown fox 0123456789", row);
+  }
+}
+
+void wlTextLarge() {
+  auto &d = box.display();
+  for (int16_t row = 0; row < 6; ++row) {
+    d.drawText(0, static_cast<int16_t>(row * 36), "SCALE4 TEXT", 4, kYellow, kBlue);
+  }
+}
+
+void wlFont24() {
+  // Same text and similar height as text4, at the font's native size
+  auto &d = box.display();
+  for (int16_t row = 0; row < 6; ++row) {
+    d.drawString(FontDejaVuSansBold24, 0, static_cast<int16_t>(row * 36), "SCALE4 TEXT", kYellow, kBlue);
+  }
+}
+
+void wlBitmap() {
+  for (int i = 0; i < 100; ++i) {
+    box.display().drawBitmap(static_cast<int16_t>((i * 16) % 320), static_cast<int16_t>((i / 20) * 16),
+                             kChecker16, 16, 16, kWhite, kBlack);
+  }
+}
+
+void wlRgbBitmap() {
+  for (int i = 0; i < 50; ++i) {
+    box.display().drawRGBBitmap(static_cast<int16_t>((i * 32) % 320), static_cast<int16_t>((i / 10) * 32),
+                                rgbTile, 32, 32);
+  }
+}
+
+// Pixel conversion kernels alone, one 320x240 frame from a repeated row
+// kept in cache. Nothing is sent; at 240 MHz, cycles per pixel are the time
+// column divided by 320.
+uint8_t convertRow[320 * 4];
+uint8_t convertOut[320 * 2];
+ESP32S3BoxLitePixelConverter converter;
+
+void convertFrame() {
+  for (int y = 0; y < 240; ++y) {
+    converter.convert(convertRow, convertOut, 0, 320);
+    converter.nextRow();
+  }
+}
+
+void prepConvert()          { converter.begin(ESP32S3BoxLitePixelFormat::RGB888, 320); }
+void prepConvertBgr()       { converter.begin(ESP32S3BoxLitePixelFormat::BGR888, 320); }
+void prepConvertArgb()      { converter.begin(ESP32S3BoxLitePixelFormat::ARGB8888, 320); }
+void prepConvertGray()      { converter.begin(ESP32S3BoxLitePixelFormat::Gray8, 320); }
+void prepConvertOrdered()   { converter.begin(ESP32S3BoxLitePixelFormat::RGB888, 320, ESP32S3BoxLiteDither::Ordered); }
+void prepConvertDiffusion() { converter.begin(ESP32S3BoxLitePixelFormat::RGB888, 320, ESP32S3BoxLiteDither::Diffusion); }
+
+// 80x60 RGB888 gradient, 16 times over the screen with error diffusion
+uint8_t gradient888[80 * 60 * 3];
+
+void wlDraw888() {
+  for (int i = 0; i < 16; ++i) {
+    box.display().drawRGBBitmap(static_cast<int16_t>((i % 4) * 80), static_cast<int16_t>((i / 4) * 60), gradient888,
+                                80, 60, ESP32S3BoxLitePixelFormat::RGB888, ESP32S3BoxLiteDither::Diffusion);
+  }
+}
+
+void drawImageGrid(const uint8_t *data, size_t size) {
+  // 120x80 image, four times; each decode streams from flash
+  for (int i = 0; i < 4; ++i) {
+    ESP32S3BoxLiteImageSource src(data, size);
+    box.display().drawImage(src, static_cast<int16_t>((i % 2) * 160 + 20), static_cast<int16_t>((i / 2) * 120 + 20));
+  }
+}
+
+void wlQoi() { drawImageGrid(kBenchArtQoi, sizeof(kBenchArtQoi)); }
+void wlRle() { drawImageGrid(kBenchArtRle, sizeof(kBenchArtRle)); }
+
+// Full-screen photo; the time column is the decode time per 320x240 image
+void wlJpeg() {
+  ESP32S3BoxLiteImageSource src(kBenchPhotoJpeg, sizeof(kBenchPhotoJpeg));
+  box.display().drawImage(src, 0, 0);
+}
+
+void wlJpegHalf() {
+  ESP32S3BoxLiteImageSource src(kBenchPhotoJpeg, sizeof(kBenchPhotoJpeg));
+  box.display().drawImage(src, 80, 60, 2);
+}
+
+ESP32S3BoxLiteGifPlayer gifPlayer;
+
+void prepGif() {
+  gifPlayer.open(box.display(), kBenchBounceGif, sizeof(kBenchBounceGif), 80, 60);
+}
+
+void wlGif() {
+  // Every frame of a 160x120 loop, ignoring the delays; after the first
+  // full frame only the changed rectangles are sent
+  if (!gifPlayer.isOpen()) { return; }
+  for (uint16_t i = 0; i < gifPlayer.frameCount(); ++i) { gifPlayer.drawNextFrame(); }
+  gifPlayer.close();
+}
+
+// A counter ticking 100 times, repainted in full and through a label
+void wlCounterPrintf() {
+  for (int i = 0; i < 100; ++i) {
+    box.display().printf(10, 100, 2, kWhite, kBlack, "Heap: %d bytes", 100000 + i);
+  }
+}
+
+void prepCounterLabel() {
+  counterLabel.begin(box.display(), 10, 100, 2, kWhite, kBlack);
+  counterLabel.set("Heap: 99999 bytes");
+}
+
+void wlCounterLabel() {
+  for (int i = 0; i < 100; ++i) {
+    counterLabel.printf("Heap: %d bytes", 100000 + i);
+  }
+}
+
+void wlStatusUi() {
+  auto &d = box.display();
+  d.drawStatusBar("BENCH", "12:34", kBlue);
+  d.drawProgressBar(20, 110, 280, 16, 42, kGreen, ESP32S3BoxLiteDisplay::ColorGray);
+}
+
+// A progress bar stepping 0..99 %, repainted in full and through widgets
+void wlProgressFull() {
+  auto &d = box.display();
+  for (uint8_t p = 0; p < 100; ++p) {
+    d.drawProgressBar(20, 110, 280, 16, p, kGreen, ESP32S3BoxLiteDisplay::ColorGray);
+    d.printf(142, 140, 2, kWhite, kBlack, "%u%%", p);
+  }
+}
+
+void prepUiProgress() {
+  if (!uiScreen.begin(box.display(), kBlack)) { return; }
+  uiScreen.add(uiStatus);
+  uiScreen.add(uiProgress);
+  uiScreen.add(uiPercent);
+  uiStatus.setLeft("BENCH");
+  uiStatus.setRight("12:34");
+  uiProgress.setValue(0);
+  uiPercent.setText("0%");
+  uiScreen.render();
+}
+
+void wlUiProgress() {
+  for (uint8_t p = 0; p < 100; ++p) {
+    uiProgress.setValue(p);
+    uiPercent.printf("%u%%", p);
+    uiScreen.render();
+  }
+  uiScreen.end();
+}
+
+// Full screens that paint over their own background: drawn directly, and
+// recorded into a display list that is optimized before it is sent
+void drawBootFrame() {
+  auto &d = box.display();
+  d.showBootScreen("DisplayBenchmark", "v1.0.0");
+  d.drawStatusBar("BOOT", "12:34", kBlue);
+}
+
+void drawPageFrame() {
+  auto &d = box.display();
+  d.fillScreen(kBlack);
+  d.drawStatusBar("DISPLAY", "Phase 1", kBlue);
+  d.drawText(10, 24, "Uppercase ABCDEFG", 1, kWhite, kBlack);
+  d.drawText(10, 36, "Lowercase abcdefg", 1, kWhite, kBlack);
+  for (int16_t i = 0; i < 4; ++i) {
+    d.drawProgressBar(10, static_cast<int16_t>(100 + i * 16), 300, 12, static_cast<uint8_t>(25 * (i + 1)), kGreen,
+                      ESP32S3BoxLiteDisplay::ColorGray);
+  }
+  constexpr uint16_t swatches[] = {kBlue, kGreen, kYellow, kWhite};
+  for (int16_t i = 0; i < 8; ++i) {
+    d.fillRect(static_cast<uint16_t>(10 + i * 38), 186, 34, 20, swatches[i % 4]);
+  }
+  d.drawText(10, 218, "CFG=next page", 1, kWhite, kBlack);
+}
+
+void drawThroughList(void (*frame)()) {
+  auto &d = box.display();
+  if (!d.beginRecording(frameList)) { return; }
+  frame();
+  d.endRecording();
+  frameList.optimize();
+  d.drawList(frameList);
+  frameList.clear();
+}
+
+void prepDisplayList() { frameList.begin(); }
+
+void wlBootDirect() { drawBootFrame(); }
+void wlBootList()   { drawThroughList(drawBootFrame); }
+void wlPageDirect() { drawPageFrame(); }
+void wlPageList()   { drawThroughList(drawPageFrame); }
+
+void prepBufferedDashboard() {
+  // The initial full-screen sync is not part of the measurement
+  auto &d = box.display();
+  if (d.enableFramebuffer()) {
+    d.flush();
+  }
+}
+
+void wlBufferedDashboard() {
+  // Ten small widget updates drawn off-screen and flushed as dirty rects
+  auto &d = box.display();
+  if (!d.framebufferEnabled()) { return; }
+  for (int16_t i = 0; i < 10; ++i) {
+    d.printf(static_cast<int16_t>(10 + (i % 2) * 160), static_cast<int16_t>(30 + (i / 2) * 20), 1,
+             kWhite, kBlack, "val%d=%4d", i, i * 111);
+  }
+  d.flush();
+  d.enableFramebuffer(false);
+}
+
+void prepConsole() {
+  console.begin(box.display(), 116, 1, kWhite, kBlack);
+}
+
+void wlConsole() {
+  // Two full strips of text; every character past the first strip scrolls
+  for (int i = 0; i < 10; ++i) {
+    console.printf("log %d: value=%d", i, i * 37);
+    console.print("\n");
+  }
+  console.end();
+}
+
+void prepCompose() {
+  compositor.clearLayers();
+  compositor.setBackground(kBlack);
+  compositor.addLayer(sprite160, 80, 60);
+  compositor.addLayer(sprite32, 100, 80, ESP32S3BoxLiteBlend::ColorKey, kGreen);
+  compositor.addLayer(sprite64, 150, 100, ESP32S3BoxLiteBlend::Alpha, 0, 128);
+}
+
+void wlCompose() {
+  // One backdrop, a colour-keyed and a 50% layer, blended per scanline
+  compositor.render(box.display(), 80, 60, 160, 120);
+}
+
+void renderTileScene(ESP32S3BoxLiteSprite &tile, int16_t ox, int16_t oy, void *) {
+  tile.fillScreen(kBlue);
+  tile.drawText(static_cast<int16_t>(10 - ox), static_cast<int16_t>(10 - oy), "TILE SCENE", 2, kWhite, kBlue);
+  tile.fillRect(static_cast<int16_t>(tileBoxX - ox), static_cast<int16_t>(100 - oy), 20, 20, kYellow);
+}
+
+void prepTiles() {
+  tileBoxX = 0;
+  if (tiles.begin(renderTileScene)) {
+    tiles.renderFrame(box.display());
+  }
+}
+
+void wlTiles() {
+  // Ten frames of a 20x20 box moving right; only the tiles it touches change
+  for (int i = 0; i < 10; ++i) {
+    tiles.invalidate(tileBoxX, 100, 20, 20);
+    tileBoxX = static_cast<int16_t>(tileBoxX + 9);
+    tiles.invalidate(tileBoxX, 100, 20, 20);
+    tiles.renderFrame(box.display());
+  }
+  tiles.end();
+}
+
+void wlSpriteDraw() {
+  // CPU-only: drawing into a sprite never touches the bus
+  sprite160.fillScreen(kBlack);
+  for (int16_t row = 0; row < 10; ++row) {
+    sprite160.drawText(0, static_cast<int16_t>(row * 12), "Sprite text 0123456789", 1, kWhite, kBlack);
+  }
+  sprite160.fillRect(10, 10, 100, 50, kBlue);
+}
+
+void wlSpritePush32()  { for (int i = 0; i < 20; ++i) { sprite32.pushSprite(box.display(), static_cast<int16_t>(i * 16), 100); } }
+void wlSpritePush64()  { for (int i = 0; i < 10; ++i) { sprite64.pushSprite(box.display(), static_cast<int16_t>(i * 25), 80); } }
+void wlSpritePush160() { sprite160.pushSprite(box.display(), 80, 60); }
+void wlSpritePush320() { sprite320.pushSprite(box.display(), 0, 0); }
+void wlSpritePushClip() { sprite160.pushSprite(box.display(), -40, -30); }
+void wlSpritePush64Dma()   { for (int i = 0; i < 10; ++i) { sprite64Dma.pushSprite(box.display(), static_cast<int16_t>(i * 25), 80); } }
+void wlSpritePush320Wire() { sprite320Wire.pushSprite(box.display(), 0, 0); }
+void wlSpritePush320I8()   { sprite320I8.pushSprite(box.display(), 0, 0); }
+void wlSpritePush320I4()   { sprite320I4.pushSprite(box.display(), 0, 0); }
+
+void rotateSprites(ESP32S3BoxLiteFilter filter) {
+  for (int i = 0; i < 10; ++i) {
+    sprite64.pushRotateZoom(box.display(), static_cast<int16_t>(32 + i * 28), 120, static_cast<float>(i * 36), 1.5f,
+                            1.5f, filter);
+  }
+}
+
+void wlRotate()         { rotateSprites(ESP32S3BoxLiteFilter::Nearest); }
+void wlRotateBilinear() { rotateSprites(ESP32S3BoxLiteFilter::Bilinear); }
+
+void wlIcons() {
+  for (int i = 0; i < 100; ++i) {
+    iconSheet.drawFrame(box.display(), static_cast<uint16_t>(i % iconSheet.frameCount()),
+                        static_cast<int16_t>((i % 20) * 16), static_cast<int16_t>((i / 20) * 16));
+  }
+}
+
+void wlSpriteBlit() {
+  for (int i = 0; i < 10; ++i) {
+    sprite64.pushSprite(sprite320, static_cast<int16_t>(i * 25), 80, ESP32S3BoxLiteBlend::ColorKey, kBlack);
+  }
+  sprite320.pushSprite(box.display(), 0, 0);
+}
+
+struct Workload {
+  const char *id;    // NVS key stem, at most 8 characters
+  const char *name;
+  void (*run)();
+  ESP32S3BoxLiteSprite *needs;  // skipped when this sprite failed to allocate
+  void (*prepare)() = nullptr;  // untimed setup, may be null
+};
+
+const Workload kWorkloads[] = {
+    {"fill",    "fillScreen",            wlFillScreen,        nullptr},
+    {"rects",   "100 fillRect 20x20",    wlSmallRects,        nullptr},
+    {"lines",   "100 random lines",      wlLines,             nullptr},
+    {"outline", "50 drawRect",           wlRectOutlines,      nullptr},
+    {"circles", "29 drawCircle",         wlCircles,           nullptr},
+    {"fcircle", "20 fillCircle r12",     wlFillCircles,       nullptr},
+    {"shapes",  "tri/rrect/line/arc",    wlShapes,            nullptr},
+    {"aa",      "AA lines/circles/text", wlAntiAliased,       nullptr},
+    {"clip",    "shapes + AA in 64x48",  wlClipped,           nullptr},
+    {"pixels",  "1000 drawPixel",        wlPixels,            nullptr},
+    {"text1",   "20 text lines x1",      wlTextBlock,         nullptr},
+    {"text4",   "6 text lines x4",       wlTextLarge,         nullptr},
+    {"font24",  "6 lines 24px font",     wlFont24,            nullptr},
+    {"bitmap",  "100 drawBitmap 16x16",  wlBitmap,            nullptr},
+    {"rgbbmp",  "50 drawRGBBitmap 32x32", wlRgbBitmap,        nullptr},
+    {"cvt888",  "convert 320x240 RGB888", convertFrame,       nullptr, prepConvert},
+    {"cvtbgr",  "convert BGR888",        convertFrame,        nullptr, prepConvertBgr},
+    {"cvtargb", "convert ARGB8888",      convertFrame,        nullptr, prepConvertArgb},
+    {"cvtgray", "convert Gray8",         convertFrame,        nullptr, prepConvertGray},
+    {"cvtord",  "convert 888 ordered",   convertFrame,        nullptr, prepConvertOrdered},
+    {"cvtfs",   "convert 888 diffusion", convertFrame,        nullptr, prepConvertDiffusion},
+    {"draw888", "draw 888 diffused 16x", wlDraw888,           nullptr},
+    {"qoi",     "4 QOI images 120x80",   wlQoi,               nullptr},
+    {"rle",     "4 RLE565 images 120x80", wlRle,              nullptr},
+    {"jpeg",    "JPEG 320x240",          wlJpeg,              nullptr},
+    {"jpeg2",   "JPEG 320x240 at 1/2",   wlJpegHalf,          nullptr},
+    {"gif",     "GIF 160x120, 12 frames", wlGif,              nullptr, prepGif},
+    {"statui",  "status bar + progress", wlStatusUi,          nullptr},
+    {"progbar", "100 progress redraws",  wlProgressFull,      nullptr},
+    {"uiprog",  "100 progress widgets",  wlUiProgress,        nullptr, prepUiProgress},
+    {"boot",    "boot screen",           wlBootDirect,        nullptr},
+    {"bootdl",  "boot screen, list",     wlBootList,          nullptr, prepDisplayList},
+    {"page",    "demo page",             wlPageDirect,        nullptr},
+    {"pagedl",  "demo page, list",       wlPageList,          nullptr, prepDisplayList},
+    {"counter", "100 printf counter",    wlCounterPrintf,     nullptr},
+    {"label",   "100 label counter",     wlCounterLabel,      nullptr, prepCounterLabel},
+    {"fbdash",  "buffered 10 widgets",   wlBufferedDashboard, nullptr, prepBufferedDashboard},
+    {"console", "console 10 log lines",  wlConsole,           nullptr, prepConsole},
+    {"tiles",   "tiles 10 frames",       wlTiles,             nullptr, prepTiles},
+    {"spdraw",  "sprite draw (CPU)",     wlSpriteDraw,        &sprite160},
+    {"push32",  "20 pushSprite 32x32",   wlSpritePush32,      &sprite32},
+    {"push64",  "10 pushSprite 64x64",   wlSpritePush64,      &sprite64},
+    {"push160", "pushSprite 160x120",    wlSpritePush160,     &sprite160},
+    {"push320", "pushSprite 320x240",    wlSpritePush320,     &sprite320},
+    {"pushclp", "pushSprite clipped",    wlSpritePushClip,    &sprite160},
+    {"compose", "compose 3 layers",      wlCompose,           &sprite160, prepCompose},
+    {"push64d", "10 push 64x64 DMA",     wlSpritePush64Dma,   &sprite64Dma},
+    {"push320w", "push 320x240 wire",    wlSpritePush320Wire, &sprite320Wire},
+    {"push8bpp", "push 320x240 8 bpp",   wlSpritePush320I8,   &sprite320I8},
+    {"push4bpp", "push 320x240 4 bpp",   wlSpritePush320I4,   &sprite320I4},
+    {"rotate",  "10 rotate 64x64 x1.5",  wlRotate,            &sprite64},
+    {"rotbil",  "10 rotate bilinear",    wlRotateBilinear,    &sprite64},
+    {"icons",   "100 sheet frames 16x16", wlIcons,            &sprite160},
+    {"blit",    "10 keyed blits + push", wlSpriteBlit,        &sprite320},
+};
+
+constexpr size_t kWorkloadCount = sizeof(kWorkloads) / sizeof(kWorkloads[0]);
+
+// Test data and sprites. Sprites that fail to allocate keep width 0 and
+// their workloads are skipped.
+void setupWorkloads() {
+  for (int i = 0; i < 32 * 32; ++i) {
+    rgbTile[i] = static_cast<uint16_t>(i * 64);
+  }
+  for (int i = 0; i < static_cast<int>(sizeof(convertRow)); ++i) {
+    convertRow[i] = static_cast<uint8_t>(i * 7);
+  }
+  for (int y = 0; y < 60; ++y) {
+    for (int x = 0; x < 80; ++x) {
+      uint8_t *p = gradient888 + (y * 80 + x) * 3;
+      p[0] = static_cast<uint8_t>(x * 255 / 79);
+      p[1] = static_cast<uint8_t>(y * 255 / 59);
+      p[2] = static_cast<uint8_t>(128 + x - y);
+    }
+  }
+  sprite32.createSprite(32, 32);
+  sprite64.createSprite(64, 64);
+  sprite160.createSprite(160, 120);
+  sprite320.createSprite(320, 240);
+  sprite64Dma.createSprite(64, 64, ESP32S3BoxLiteSprite::WireOrder | ESP32S3BoxLiteSprite::InternalRam);
+  sprite320Wire.createSprite(320, 240, ESP32S3BoxLiteSprite::WireOrder);
+  sprite320I8.createSprite(320, 240, ESP32S3BoxLiteSprite::Indexed8);
+  sprite320I4.createSprite(320, 240, ESP32S3BoxLiteSprite::Indexed4);
+  sprite32.fillScreen(kGreen);
+  sprite64.fillScreen(kYellow);
+  sprite160.fillScreen(kBlue);
+  sprite320.fillScreen(kBlack);
+  sprite320.drawText(10, 10, "FULL SCREEN SPRITE", 2, kWhite, kBlack);
+  sprite64Dma.fillScreen(kYellow);
+  sprite320Wire.fillScreen(kBlack);
+  sprite320Wire.drawText(10, 10, "FULL SCREEN SPRITE", 2, kWhite, kBlack);
+  // Colours of indexed sprites are palette entries
+  sprite320I8.fillScreen(0);
+  sprite320I8.drawText(10, 10, "FULL SCREEN SPRITE", 2, 0xFF, 0);
+  sprite320I4.fillScreen(0);
+  sprite320I4.drawText(10, 10, "FULL SCREEN SPRITE", 2, 15, 0);
+  iconSheet.beginGrid(sprite160, 16, 16);
+}
+
+}  // namespace
@@ -0,0 +1,166 @@
+// DisplayBenchmark.ino
+// Measures the cost of every display and sprite operation on representative
+// workloads and prints one line per workload over serial (115200 baud):
+//
+//   time     measured wall time including waitIdle() (us)
+//   tx       SPI transactions
+//   cs       CS assert/release pairs
+//   win      address windows opened (RAMWR)
+//   bytes    bytes clocked out, commands included
+//   wire     estimated wire time at kEstimateClockHz (us)
+//
+// Baselines are stored in NVS. A workload is flagged REGRESSION when it
+// sends more bytes than its baseline, and SLOW when it takes more than
+// kSlowTolerancePercent longer.
+//
+// With kRecordOutput the display runs on ESP32S3BoxLiteRecordingBus instead
+// of the panel. Nothing is shown and times are CPU-only, but the counts are
+// the same and each workload also prints a hash of the emulated frame
+// memory; it is flagged PIXELS when the hash differs from the baseline.
+//
+// The workloads are in BenchWorkloads.h. `pio test -e native` runs the same
+// table on the host and prints bytes and transactions per workload.
+//
+// Controls:
+//   ENT  -> run the suite again
+//   CFG  -> save the last results as the new baseline
+
+#include <ESP32S3BoxLite.h>
+
+#include "BenchWorkloads.h"
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Configuration
+// ---------------------------------------------------------------------------
+
+// Clock used for the wire-time estimate. Defaults to the clock the library
+// drives the panel at; change it to see what a faster bus would buy.
+const uint32_t kEstimateClockHz      = ESP32S3BoxLiteDisplay::spiClockHz();
+constexpr int  kSlowTolerancePercent = 10;
+constexpr bool kRecordOutput         = false;
+
+// Stands in for the panel when kRecordOutput is set
+ESP32S3BoxLiteRecordingBus recorder;
+
+struct Result {
+  uint32_t timeUs;
+  ESP32S3BoxLiteBusStats stats;
+  uint32_t imageHash;
+  bool ran;
+};
+
+Result results[kWorkloadCount];
+
+// ---------------------------------------------------------------------------
+// Suite
+// ---------------------------------------------------------------------------
+
+void makeKey(char *key, size_t len, const char *id, const char *suffix) {
+  snprintf(key, len, "b_%s_%s", id, suffix);
+}
+
+void runSuite() {
+  auto &d = box.display();
+  Serial.printf("\n--- Display benchmark (estimate at %lu Hz) ---\n", (unsigned long)kEstimateClockHz);
+  Serial.printf("%-24s %9s %7s %7s %6s %9s %9s%s\n", "workload", "time", "tx", "cs", "win", "bytes", "wire",
+                kRecordOutput ? "    image" : "");
+
+  for (size_t i = 0; i < kWorkloadCount; ++i) {
+    const Workload &w = kWorkloads[i];
+    Result &r = results[i];
+    r.ran = w.needs == nullptr || w.needs->width() > 0;
+    if (!r.ran) {
+      Serial.printf("%-24s skipped (sprite allocation failed)\n", w.name);
+      continue;
+    }
+
+    d.fillScreen(kBlack);
+    if (w.prepare != nullptr) {
+      w.prepare();
+    }
+    d.waitIdle();
+    d.resetBusStats();
+
+    const uint32_t t0 = micros();
+    w.run();
+    d.waitIdle();
+    r.timeUs = micros() - t0;
+    r.stats  = d.busStats();
+
+    const uint32_t wireUs = static_cast<uint32_t>(r.stats.bytes * 8ULL * 1000000ULL / kEstimateClockHz);
+    Serial.printf("%-24s %9lu %7lu %7lu %6lu %9lu %9lu", w.name, (unsigned long)r.timeUs,
+                  (unsigned long)r.stats.transactions, (unsigned long)r.stats.csToggles,
+                  (unsigned long)r.stats.windows, (unsigned long)r.stats.bytes, (unsigned long)wireUs);
+    r.imageHash = kRecordOutput ? recorder.imageHash() : 0;
+    if (kRecordOutput) {
+      Serial.printf(" %08lx", (unsigned long)r.imageHash);
+    }
+
+    char key[16];
+    makeKey(key, sizeof(key), w.id, "by");
+    const int32_t baseBytes = box.nvsGetInt(key, -1);
+    makeKey(key, sizeof(key), w.id, "us");
+    const int32_t baseUs = box.nvsGetInt(key, -1);
+    if (baseBytes >= 0 && r.stats.bytes > static_cast<uint64_t>(baseBytes)) {
+      Serial.printf("  REGRESSION bytes %ld -> %lu", (long)baseBytes, (unsigned long)r.stats.bytes);
+    }
+    if (baseUs > 0 && r.timeUs > static_cast<uint32_t>(baseUs) * (100 + kSlowTolerancePercent) / 100) {
+      Serial.printf("  SLOW %ld -> %lu us", (long)baseUs, (unsigned long)r.timeUs);
+    }
+    if (kRecordOutput) {
+      makeKey(key, sizeof(key), w.id, "px");
+      const uint32_t baseHash = static_cast<uint32_t>(box.nvsGetInt(key, 0));
+      if (baseHash != 0 && baseHash != r.imageHash) {
+        Serial.printf("  PIXELS %08lx -> %08lx", (unsigned long)baseHash, (unsigned long)r.imageHash);
+      }
+    }
+    Serial.println();
+  }
+  Serial.println("ENT = run again, CFG = save as baseline");
+
+  d.showMessage("Benchmark done. See serial. ENT=rerun CFG=save", ESP32S3BoxLiteDisplay::ColorBlue);
+}
+
+void saveBaseline() {
+  for (size_t i = 0; i < kWorkloadCount; ++i) {
+    if (!results[i].ran) { continue; }
+    char key[16];
+    makeKey(key, sizeof(key), kWorkloads[i].id, "by");
+    box.nvsSetInt(key, static_cast<int32_t>(results[i].stats.bytes));
+    makeKey(key, sizeof(key), kWorkloads[i].id, "us");
+    box.nvsSetInt(key, static_cast<int32_t>(results[i].timeUs));
+    if (kRecordOutput) {
+      makeKey(key, sizeof(key), kWorkloads[i].id, "px");
+      box.nvsSetInt(key, static_cast<int32_t>(results[i].imageHash));
+    }
+  }
+  Serial.println("Baseline saved.");
+  box.display().showMessage("Baseline saved", ESP32S3BoxLiteDisplay::ColorGreen);
+}
+
+}  // namespace
+
+void setup() {
+  Serial.begin(115200);
+  delay(200);
+  if (kRecordOutput) {
+    box.display().setBus(&recorder);
+  }
+  box.begin(true, true, false);
+
+  setupWorkloads();
+
+  runSuite();
+}
+
+void loop() {
+  const ESP32S3BoxLiteButton button = box.input().pollButtonEvent();
+  if (button == ESP32S3BoxLiteButton::Enter) {
+    runSuite();
+  } else if (button == ESP32S3BoxLiteButton::Config) {
+    saveBaseline();
+  }
+  delay(10);
+}
@@ -41,13 +41,24 @@ uint8_t  volumePercent = 65;
 int      toneFreqHz    = 440;
 int      micLevel      = 0;
 
-// System state
+// System state: lines that change are labels, so a refresh only sends the
+// characters that differ
 char sysLine[64];
+ESP32S3BoxLiteLabel heapLabel;
+ESP32S3BoxLiteLabel bootCountLabel;
+ESP32S3BoxLiteLabel uptimeLabel;
+bool systemFullRedraw = true;
 
 // Sprite demo
-ESP32S3BoxLiteSprite sprite;
-bool spriteCreated = false;
-int  spriteAngle   = 0;
+ESP32S3BoxLiteSprite sprite;       // backdrop layer
+ESP32S3BoxLiteSprite ballSprite;   // colour-keyed layer
+ESP32S3BoxLiteSprite glassSprite;  // translucent layer
+ESP32S3BoxLiteCompositor compositor;
+int8_t ballLayer        = -1;
+int8_t glassLayer       = -1;
+bool   spriteCreated    = false;
+bool   spriteFullRedraw = true;
+int    spriteAngle      = 0;
 
 // ---------------------------------------------------------------------------
 // Forward declarations
@@ -149,10 +160,10 @@ void drawPage() {
     case DemoPage::Boot:           drawBootPage();        break;
     case DemoPage::Display:        drawDisplayPage();     break;
     case DemoPage::DrawPrimitives: drawPrimitivesPage();  break;
-    case DemoPage::Sprite:         drawSpritePage();      break;
+    case DemoPage::Sprite:         spriteFullRedraw = true; drawSpritePage(); break;
     case DemoPage::Input:          drawInputPage();       break;
     case DemoPage::Audio:          drawAudioPage();       break;
-    case DemoPage::System:         drawSystemPage();      break;
+    case DemoPage::System:         systemFullRedraw = true; drawSystemPage(); break;
     default: break;
   }
 }
@@ -332,46 +343,76 @@ void drawPrimitivesPage() {
 
 static constexpr float kPiLocal = 3.14159265f;
 
+// Layers: the backdrop sprite, a colour-keyed ball, and a translucent label
+constexpr uint16_t kSpriteKey = 0xF81F;  // magenta is transparent in the ball
+
+void buildSpriteScene() {
+  // The backdrop is drawn once; the compositor moves the other layers over it
+  sprite.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
+  sprite.drawText(2, 2, "Compositor", 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
+  for (int i = 0; i < 200; i += 4) {
+    const float rad = static_cast<float>(i) * kPiLocal / 100.0f;
+    sprite.drawPixel(static_cast<int16_t>(100 + 62 * cosf(rad)), static_cast<int16_t>(75 + 52 * sinf(rad)),
+                     ESP32S3BoxLiteDisplay::ColorGreen);
+  }
+  sprite.fillRect(0, 130, 200, 20, ESP32S3BoxLiteDisplay::ColorBlue);
+  sprite.drawText(2, 133, "Layers: key + alpha", 1,
+                  ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlue);
+
+  ballSprite.fillScreen(kSpriteKey);
+  for (int16_t y = 0; y < 24; ++y) {
+    for (int16_t x = 0; x < 24; ++x) {
+      if ((x - 12) * (x - 12) + (y - 12) * (y - 12) <= 121) {
+        ballSprite.drawPixel(x, y, ESP32S3BoxLiteDisplay::ColorYellow);
+      }
+    }
+  }
+
+  glassSprite.fillScreen(ESP32S3BoxLiteDisplay::ColorWhite);
+  glassSprite.drawText(6, 8, "50% ALPHA", 1, ESP32S3BoxLiteDisplay::ColorBlack, ESP32S3BoxLiteDisplay::ColorWhite);
+
+  compositor.setBackground(ESP32S3BoxLiteDisplay::ColorBlack);
+  compositor.addLayer(sprite, 60, 44);
+  ballLayer  = compositor.addLayer(ballSprite, 0, 0, ESP32S3BoxLiteBlend::ColorKey, kSpriteKey);
+  glassLayer = compositor.addLayer(glassSprite, 0, 0, ESP32S3BoxLiteBlend::Alpha, 0, 128);
+}
+
 void drawSpritePage() {
   auto &d = box.display();
 
   if (!spriteCreated) {
     d.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
     d.drawStatusBar("SPRITE", "Phase 2", ESP32S3BoxLiteDisplay::ColorBlue);
-    d.drawTextCentered(120, "Creating sprite...", 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawTextCentered(120, "Creating sprites...", 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
 
-    spriteCreated = sprite.createSprite(200, 150);
+    spriteCreated = sprite.createSprite(200, 150) && ballSprite.createSprite(24, 24) &&
+                    glassSprite.createSprite(120, 24);
     if (!spriteCreated) {
       d.showError("Sprite alloc failed");
       return;
     }
+    buildSpriteScene();
   }
 
-  // Draw into sprite
-  sprite.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
+  // Both moving layers stay inside the backdrop
+  const float rad = static_cast<float>(spriteAngle) * kPiLocal / 100.0f;
+  compositor.setPosition(static_cast<uint8_t>(ballLayer), static_cast<int16_t>(148 + 50 * cosf(rad)),
+                         static_cast<int16_t>(107 + 40 * sinf(rad)));
+  compositor.setPosition(static_cast<uint8_t>(glassLayer), static_cast<int16_t>(100 + 40 * sinf(rad * 2)), 140);
 
-  // Animated rectangle border
-  sprite.drawText(2, 2, "Sprite Demo", 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
-
-  // Draw some geometry into sprite
-  const int16_t cx = 100, cy = 80, r = 40 + (spriteAngle % 20) - 10;
-  for (int i = 0; i < 200; i += 4) {
-    const int16_t sx = static_cast<int16_t>(cx + r * cosf(static_cast<float>(i + spriteAngle) * kPiLocal / 100.0f));
-    const int16_t sy = static_cast<int16_t>(cy + r * sinf(static_cast<float>(i + spriteAngle) * kPiLocal / 100.0f));
-    sprite.drawPixel(sx, sy, ESP32S3BoxLiteDisplay::ColorGreen);
+  if (spriteFullRedraw) {
+    spriteFullRedraw = false;
+    d.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawStatusBar("SPRITE", "Phase 2", ESP32S3BoxLiteDisplay::ColorBlue);
+    d.drawText(10, 214, "Each row is blended once: no flicker", 1,
+               ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+    compositor.render(d, 60, 44, 200, 150);
   }
+  // Redraws only where the layers are now or were last frame
+  compositor.render(d);
 
-  sprite.fillRect(0, 130, 200, 20, ESP32S3BoxLiteDisplay::ColorBlue);
-  sprite.drawText(2, 133, "pushSprite -> no flicker", 1,
-                  ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlue);
-
-  sprite.pushSprite(d, 60, 44);
-
-  // Status below sprite
   d.printf(10, 200, 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack,
-           "Sprite %dx%d  angle=%d", sprite.width(), sprite.height(), spriteAngle);
-  d.drawText(10, 214, "Smooth animation without tearing", 1,
-             ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+           "3 layers  angle=%3d", spriteAngle);
 
   spriteAngle = (spriteAngle + 3) % 200;
 }
@@ -480,51 +521,49 @@ void drawAudioPage() {
 void drawSystemPage() {
   auto &d = box.display();
 
-  static DemoPage lastSysPage = DemoPage::Boot;
-  if (lastSysPage != DemoPage::System) {
-    lastSysPage = DemoPage::System;
+  if (systemFullRedraw) {
+    systemFullRedraw = false;
     d.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
     d.drawStatusBar("SYSTEM", "Phase 6", ESP32S3BoxLiteDisplay::ColorBlue);
-  }
 
-  d.fillRect(0, 20, ESP32S3BoxLiteDisplay::Width, ESP32S3BoxLiteDisplay::Height - 20, ESP32S3BoxLiteDisplay::ColorBlack);
+    heapLabel.begin(d, 10, 28, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    bootCountLabel.begin(d, 10, 104, 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
+    uptimeLabel.begin(d, 10, 210, 1, ESP32S3BoxLiteDisplay::ColorGreen, ESP32S3BoxLiteDisplay::ColorBlack);
 
-  snprintf(sysLine, sizeof(sysLine), "Free heap:  %lu bytes", (unsigned long)box.getFreeHeap());
-  d.drawText(10, 28, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    snprintf(sysLine, sizeof(sysLine), "CPU freq:   %lu MHz", (unsigned long)box.getCpuFreqMHz());
+    d.drawText(10, 42, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
 
-  snprintf(sysLine, sizeof(sysLine), "CPU freq:   %lu MHz", (unsigned long)box.getCpuFreqMHz());
-  d.drawText(10, 42, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    snprintf(sysLine, sizeof(sysLine), "Reset:      %s", box.getResetReason());
+    d.drawText(10, 56, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
 
-  snprintf(sysLine, sizeof(sysLine), "Reset:      %s", box.getResetReason());
-  d.drawText(10, 56, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    snprintf(sysLine, sizeof(sysLine), "Wakeup:     %s", box.getWakeupReason());
+    d.drawText(10, 70, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
 
-  snprintf(sysLine, sizeof(sysLine), "Wakeup:     %s", box.getWakeupReason());
-  d.drawText(10, 70, sysLine, 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    // NVS demo
+    d.drawText(10, 90, "NVS (non-volatile storage):", 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack);
 
-  // NVS demo
-  d.drawText(10, 90, "NVS (non-volatile storage):", 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack);
+    box.nvsSetStr("last_page", "System");
+    char nvsStr[32] = {};
+    box.nvsGetStr("last_page", nvsStr, sizeof(nvsStr));
+    snprintf(sysLine, sizeof(sysLine), "last_page:  \"%s\"", nvsStr);
+    d.drawText(10, 118, sysLine, 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
+
+    // showMessage demo button
+    d.drawText(10, 142, "Phase 7 - UI Helpers:", 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawText(10, 156, "ENT = showMessage demo", 1, ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawText(10, 170, "NXT = showError demo", 1, ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawText(10, 184, "PRV = showBootScreen demo", 1, ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+  }
+
+  heapLabel.printf("Free heap:  %lu bytes", (unsigned long)box.getFreeHeap());
 
   // Write and read back a counter
   int32_t counter = box.nvsGetInt("boot_cnt", 0) + 1;
   box.nvsSetInt("boot_cnt", counter);
-  snprintf(sysLine, sizeof(sysLine), "boot_cnt:   %ld", (long)counter);
-  d.drawText(10, 104, sysLine, 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
-
-  box.nvsSetStr("last_page", "System");
-  char nvsStr[32] = {};
-  box.nvsGetStr("last_page", nvsStr, sizeof(nvsStr));
-  snprintf(sysLine, sizeof(sysLine), "last_page:  \"%s\"", nvsStr);
-  d.drawText(10, 118, sysLine, 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
-
-  // showMessage demo button
-  d.drawText(10, 142, "Phase 7 - UI Helpers:", 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack);
-  d.drawText(10, 156, "ENT = showMessage demo", 1, ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
-  d.drawText(10, 170, "NXT = showError demo", 1, ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
-  d.drawText(10, 184, "PRV = showBootScreen demo", 1, ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+  bootCountLabel.printf("boot_cnt:   %ld", (long)counter);
 
   // Display uptime
-  snprintf(sysLine, sizeof(sysLine), "Uptime: %lu s", (unsigned long)(millis() / 1000));
-  d.drawText(10, 210, sysLine, 1, ESP32S3BoxLiteDisplay::ColorGreen, ESP32S3BoxLiteDisplay::ColorBlack);
+  uptimeLabel.printf("Uptime: %lu s", (unsigned long)(millis() / 1000));
 }
 
 }  // namespace
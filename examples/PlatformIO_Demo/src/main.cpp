@@ -35,9 +35,15 @@ int      micLevel      = 0;
 
 char sysLine[64];
 
-ESP32S3BoxLiteSprite sprite;
-bool spriteCreated = false;
-int  spriteAngle   = 0;
+ESP32S3BoxLiteSprite sprite;       // backdrop layer
+ESP32S3BoxLiteSprite ballSprite;   // colour-keyed layer
+ESP32S3BoxLiteSprite glassSprite;  // translucent layer
+ESP32S3BoxLiteCompositor compositor;
+int8_t ballLayer        = -1;
+int8_t glassLayer       = -1;
+bool   spriteCreated    = false;
+bool   spriteFullRedraw = true;
+int    spriteAngle      = 0;
 
 static constexpr float kPiLocal = 3.14159265f;
 
@@ -117,7 +123,7 @@ void drawPage() {
     case DemoPage::Boot:           drawBootPage();        break;
     case DemoPage::Display:        drawDisplayPage();     break;
     case DemoPage::DrawPrimitives: drawPrimitivesPage();  break;
-    case DemoPage::Sprite:         drawSpritePage();      break;
+    case DemoPage::Sprite:         spriteFullRedraw = true; drawSpritePage(); break;
     case DemoPage::Input:          drawInputPage();       break;
     case DemoPage::Audio:          drawAudioPage();       break;
     case DemoPage::System:         drawSystemPage();      break;
@@ -237,61 +243,78 @@ void drawPrimitivesPage() {
   d.drawText(50, 230, "drawCircle fillCircle bitmaps", 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack);
 }
 
+// Layers: the backdrop sprite, a colour-keyed ball, and a translucent label
+constexpr uint16_t kSpriteKey = 0xF81F;  // magenta is transparent in the ball
+
+void buildSpriteScene() {
+  // The backdrop is drawn once; the compositor moves the other layers over it
+  sprite.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
+  sprite.drawText(2, 2, "Compositor", 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
+  for (int i = 0; i < 200; i += 4) {
+    const float rad = static_cast<float>(i) * kPiLocal / 100.0f;
+    sprite.drawPixel(static_cast<int16_t>(100 + 62 * cosf(rad)), static_cast<int16_t>(75 + 52 * sinf(rad)),
+                     ESP32S3BoxLiteDisplay::ColorGreen);
+  }
+  sprite.fillRect(0, 130, 200, 20, ESP32S3BoxLiteDisplay::ColorBlue);
+  sprite.drawText(2, 133, "Layers: key + alpha", 1,
+                  ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlue);
+
+  ballSprite.fillScreen(kSpriteKey);
+  for (int16_t y = 0; y < 24; ++y) {
+    for (int16_t x = 0; x < 24; ++x) {
+      if ((x - 12) * (x - 12) + (y - 12) * (y - 12) <= 121) {
+        ballSprite.drawPixel(x, y, ESP32S3BoxLiteDisplay::ColorYellow);
+      }
+    }
+  }
+
+  glassSprite.fillScreen(ESP32S3BoxLiteDisplay::ColorWhite);
+  glassSprite.drawText(6, 8, "50% ALPHA", 1, ESP32S3BoxLiteDisplay::ColorBlack, ESP32S3BoxLiteDisplay::ColorWhite);
+
+  compositor.setBackground(ESP32S3BoxLiteDisplay::ColorBlack);
+  compositor.addLayer(sprite, 60, 44);
+  ballLayer  = compositor.addLayer(ballSprite, 0, 0, ESP32S3BoxLiteBlend::ColorKey, kSpriteKey);
+  glassLayer = compositor.addLayer(glassSprite, 0, 0, ESP32S3BoxLiteBlend::Alpha, 0, 128);
+}
+
 void drawSpritePage() {
   auto &d = box.display();
 
   if (!spriteCreated) {
     d.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
     d.drawStatusBar("SPRITE", "Phase 2", ESP32S3BoxLiteDisplay::ColorBlue);
-    d.drawTextCentered(120, "Allocating sprite...", 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawTextCentered(120, "Creating sprites...", 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlack);
 
-    spriteCreated = sprite.createSprite(200, 150);
+    spriteCreated = sprite.createSprite(200, 150) && ballSprite.createSprite(24, 24) &&
+                    glassSprite.createSprite(120, 24);
     if (!spriteCreated) {
       d.showError("Sprite alloc failed");
       return;
     }
-    d.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
-    d.drawStatusBar("SPRITE", "Phase 2", ESP32S3BoxLiteDisplay::ColorBlue);
+    buildSpriteScene();
   }
 
-  // Fill and draw content into sprite buffer
-  sprite.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
-  sprite.drawText(2, 2, "Sprite buffer", 1, ESP32S3BoxLiteDisplay::ColorCyan, ESP32S3BoxLiteDisplay::ColorBlack);
-
-  // Animated circle inside sprite
-  const int16_t cx = 100;
-  const int16_t cy = 75;
-  const int16_t r  = 30 + static_cast<int16_t>(spriteAngle % 15) - 7;
-  for (int i = 0; i < 360; i += 8) {
-    const float rad = static_cast<float>(i + spriteAngle) * kPiLocal / 180.0f;
-    const int16_t sx = static_cast<int16_t>(cx + r * cosf(rad));
-    const int16_t sy = static_cast<int16_t>(cy + r * sinf(rad));
-    const uint16_t color = (i < 120) ? ESP32S3BoxLiteDisplay::ColorRed :
-                           (i < 240) ? ESP32S3BoxLiteDisplay::ColorGreen : ESP32S3BoxLiteDisplay::ColorBlue;
-    sprite.drawPixel(sx, sy, color);
-  }
-
-  // Inner filled rect
-  sprite.fillRect(80, 55, 40, 40, ESP32S3BoxLiteDisplay::ColorPurple);
-  sprite.drawText(82, 65, "SP", 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorPurple);
-
-  // Footer bar
-  sprite.fillRect(0, 134, 200, 16, ESP32S3BoxLiteDisplay::ColorBlue);
-  sprite.drawText(4, 137, "No flicker - DMA push", 1, ESP32S3BoxLiteDisplay::ColorWhite, ESP32S3BoxLiteDisplay::ColorBlue);
+  // Both moving layers stay inside the backdrop
+  const float rad = static_cast<float>(spriteAngle) * kPiLocal / 100.0f;
+  compositor.setPosition(static_cast<uint8_t>(ballLayer), static_cast<int16_t>(148 + 50 * cosf(rad)),
+                         static_cast<int16_t>(107 + 40 * sinf(rad)));
+  compositor.setPosition(static_cast<uint8_t>(glassLayer), static_cast<int16_t>(100 + 40 * sinf(rad * 2)), 140);
 
-  // Push to display
-  sprite.pushSprite(d, 60, 44);
+  if (spriteFullRedraw) {
+    spriteFullRedraw = false;
+    d.fillScreen(ESP32S3BoxLiteDisplay::ColorBlack);
+    d.drawStatusBar("SPRITE", "Phase 2", ESP32S3BoxLiteDisplay::ColorBlue);
+    d.drawText(10, 214, "Each row is blended once: no flicker", 1,
+               ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+    compositor.render(d, 60, 44, 200, 150);
+  }
+  // Redraws only where the layers are now or were last frame
+  compositor.render(d);
 
-  // Info below sprite
-  d.fillRect(0, 198, ESP32S3BoxLiteDisplay::Width, 42, ESP32S3BoxLiteDisplay::ColorBlack);
   d.printf(10, 200, 1, ESP32S3BoxLiteDisplay::ColorGray, ESP32S3BoxLiteDisplay::ColorBlack,
-           "Sprite %dx%d  angle=%d", sprite.width(), sprite.height(), spriteAngle);
-  d.drawText(10, 214, "pushSprite bulk-transfers the buffer via SPI", 1,
-             ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
-  d.drawText(10, 228, "eliminating pixel-by-pixel flicker", 1,
-             ESP32S3BoxLiteDisplay::ColorYellow, ESP32S3BoxLiteDisplay::ColorBlack);
+           "3 layers  angle=%3d", spriteAngle);
 
-  spriteAngle = (spriteAngle + 4) % 360;
+  spriteAngle = (spriteAngle + 3) % 200;
 }
 
 void drawInputPage() {
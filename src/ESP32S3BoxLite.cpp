@@ -5,14 +5,18 @@
 #include <cstring>
 #include <cstdio>
 #include <cstdarg>
+#include <new>
 
+#include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "driver/i2s.h"
+#include "driver/spi_master.h"
 #include "esp_sleep.h"
 #include "esp_system.h"
 #include "nvs_flash.h"
 #include "nvs.h"
 #include "esp_heap_caps.h"
+#include "soc/soc_memory_layout.h"
 #include "SPIFFS.h"
 
 namespace {
@@ -71,6 +75,942 @@ constexpr uint8_t kEs7243eAddress = 0x20;
 
 constexpr int kBacklightLedcChannel = 0;
 
+// ---------------------------------------------------------------------------
+// LCD SPI transaction queue
+// ---------------------------------------------------------------------------
+
+constexpr int    kLcdQueueDepth   = 16;
+constexpr size_t kLcdLineBufBytes = ESP32S3BoxLiteBus::MaxTransferBytes;  // each of the two DMA line buffers
+
+// Runs in ISR context right before each transaction: drives D/C from the
+// value attached to the transaction.
+void IRAM_ATTR lcdPreTransfer(spi_transaction_t *t) {
+  gpio_set_level(static_cast<gpio_num_t>(kLcdDcPin), reinterpret_cast<uintptr_t>(t->user) != 0 ? 1 : 0);
+}
+
+// ---------------------------------------------------------------------------
+// Recording bus
+// ---------------------------------------------------------------------------
+
+constexpr size_t kLogChunkBytes = 0xFFFF;  // largest data record in the log
+
+// ---------------------------------------------------------------------------
+// Buffered mode
+// ---------------------------------------------------------------------------
+
+// Two touching dirty rects are merged when their bounding box wastes no more
+// than the overlap (which would otherwise be sent twice) plus this many pixels,
+// roughly the cost of one extra address window and transaction.
+constexpr int32_t kDirtyMergeSlackPixels = 64;
+
+// Adds the inclusive rect r to a list of at most `capacity` dirty rects
+template <class Rect>
+void addDirtyRect(Rect *rects, uint8_t &count, uint8_t capacity, Rect r) {
+  auto area = [](const Rect &a) -> int32_t {
+    return static_cast<int32_t>(a.x1 - a.x0 + 1) * (a.y1 - a.y0 + 1);
+  };
+  // Bounding box waste when merging a and b, or -1 if they neither touch nor
+  // overlap.
+  auto mergeWaste = [&](const Rect &a, const Rect &b) -> int32_t {
+    if (a.x0 > b.x1 + 1 || b.x0 > a.x1 + 1 || a.y0 > b.y1 + 1 || b.y0 > a.y1 + 1) {
+      return -1;
+    }
+    const Rect u = {std::min(a.x0, b.x0), std::min(a.y0, b.y0),
+                    std::max(a.x1, b.x1), std::max(a.y1, b.y1)};
+    return area(u) - area(a) - area(b);
+  };
+  auto unite = [](Rect &a, const Rect &b) {
+    a.x0 = std::min(a.x0, b.x0);
+    a.y0 = std::min(a.y0, b.y0);
+    a.x1 = std::max(a.x1, b.x1);
+    a.y1 = std::max(a.y1, b.y1);
+  };
+
+  // Absorb every rect that is cheaper to send together with r. Growing r may
+  // make it touch rects that were skipped, so repeat until nothing merges.
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < count; ++i) {
+      const int32_t waste = mergeWaste(r, rects[i]);
+      if (waste >= 0 && waste <= kDirtyMergeSlackPixels) {
+        unite(r, rects[i]);
+        rects[i] = rects[--count];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (count < capacity) {
+    rects[count++] = r;
+    return;
+  }
+
+  // List full: fold r into the rect whose bounding box grows the least
+  uint8_t best      = 0;
+  int32_t bestGrowth = INT32_MAX;
+  for (uint8_t i = 0; i < count; ++i) {
+    Rect u = rects[i];
+    unite(u, r);
+    const int32_t growth = area(u) - area(rects[i]);
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      best       = i;
+    }
+  }
+  unite(rects[best], r);
+}
+
+// ---------------------------------------------------------------------------
+// Display list
+// ---------------------------------------------------------------------------
+
+// CASET or RASET with its four parameter bytes; RAMWR adds one more
+constexpr uint32_t kWindowCommandBytes = 5;
+// Visible pieces tracked per rectangle during optimize(). A rectangle whose
+// remainder splits into more is left as it is.
+constexpr uint16_t kMaxVisiblePieces = 64;
+
+template <class Rect>
+bool rectsOverlap(const Rect &a, const Rect &b) {
+  return a.x0 <= b.x1 && b.x0 <= a.x1 && a.y0 <= b.y1 && b.y0 <= a.y1;
+}
+
+// True when b, drawn right after a, skips its CASET or RASET
+template <class Rect>
+bool sharesWindow(const Rect &a, const Rect &b) {
+  return (a.x0 == b.x0 && a.x1 == b.x1) || (a.y0 == b.y0 && a.y1 == b.y1);
+}
+
+// Stores the parts of inclusive rect r outside cut (up to four) in out and
+// returns how many there are
+template <class Rect>
+uint8_t subtractRect(const Rect &r, const Rect &cut, Rect *out) {
+  if (!rectsOverlap(r, cut)) {
+    out[0] = r;
+    return 1;
+  }
+  uint8_t n = 0;
+  Rect mid = r;
+  if (cut.y0 > r.y0) {
+    out[n]      = r;
+    out[n++].y1 = cut.y0 - 1;
+    mid.y0      = cut.y0;
+  }
+  if (cut.y1 < r.y1) {
+    out[n]      = r;
+    out[n++].y0 = cut.y1 + 1;
+    mid.y1      = cut.y1;
+  }
+  if (cut.x0 > r.x0) {
+    out[n]      = mid;
+    out[n++].x1 = cut.x0 - 1;
+  }
+  if (cut.x1 < r.x1) {
+    out[n]      = mid;
+    out[n++].x0 = cut.x1 + 1;
+  }
+  return n;
+}
+
+// Folds b into a when together they form one rectangle: fills of the same
+// colour side by side, or pixel rectangles whose rows continue in the pool.
+// Pixel rectangles only grow to the right or down, as recorded.
+template <class Op>
+bool joinOps(Op &a, const Op &b) {
+  const bool sameRows = a.y0 == b.y0 && a.y1 == b.y1;
+  const bool sameCols = a.x0 == b.x0 && a.x1 == b.x1;
+  if (a.stride == 0 || b.stride == 0) {
+    if (a.stride != b.stride || a.color != b.color) { return false; }
+    if (sameRows && (a.x1 + 1 == b.x0 || b.x1 + 1 == a.x0)) {
+      a.x0 = std::min(a.x0, b.x0);
+      a.x1 = std::max(a.x1, b.x1);
+      return true;
+    }
+    if (sameCols && (a.y1 + 1 == b.y0 || b.y1 + 1 == a.y0)) {
+      a.y0 = std::min(a.y0, b.y0);
+      a.y1 = std::max(a.y1, b.y1);
+      return true;
+    }
+    return false;
+  }
+
+  const uint32_t aW = static_cast<uint32_t>(a.x1 - a.x0 + 1);
+  const uint32_t bW = static_cast<uint32_t>(b.x1 - b.x0 + 1);
+  if (a.stride != aW || b.stride != bW || b.offset != a.offset + aW * (a.y1 - a.y0 + 1) * 2U) {
+    return false;
+  }
+  if (sameRows && a.y0 == a.y1 && a.x1 + 1 == b.x0) {
+    a.x1     = b.x1;
+    a.stride = static_cast<uint16_t>(aW + bW);
+    return true;
+  }
+  if (sameCols && a.y1 + 1 == b.y0) {
+    a.y1 = b.y1;
+    return true;
+  }
+  return false;
+}
+
+// ---------------------------------------------------------------------------
+// RGB565 blending
+// ---------------------------------------------------------------------------
+
+// Spreads R, G and B into separate lanes of a 32-bit word (G moves to the
+// top half) with enough headroom for a 5-bit multiply.
+inline uint32_t unpack565(uint16_t c) {
+  return (c | (static_cast<uint32_t>(c) << 16)) & 0x07E0F81Fu;
+}
+
+inline uint16_t pack565(uint32_t lanes) {
+  return static_cast<uint16_t>(lanes | (lanes >> 16));
+}
+
+// alpha32 is 0..32 (fg weight)
+inline uint16_t blend565(uint16_t fg, uint16_t bg, uint32_t alpha32) {
+  const uint32_t lanes = (unpack565(fg) * alpha32 + unpack565(bg) * (32U - alpha32)) >> 5;
+  return pack565(lanes & 0x07E0F81Fu);
+}
+
+inline uint16_t swap565(uint16_t c) {
+  return static_cast<uint16_t>((c << 8) | (c >> 8));
+}
+
+// ---------------------------------------------------------------------------
+// Scan conversion
+// ---------------------------------------------------------------------------
+// Shapes are emitted as horizontal spans through span(x, y, w), one call per
+// covered run of a scanline. Rows outside the clip rectangle are skipped, as
+// are shapes entirely left or right of it; x is left for the sink to clip.
+
+constexpr size_t kMaxPolygonPoints = 96;
+// A full ring uses both outlines: 2 * (kMaxArcSegments + 1) points
+constexpr int32_t kMaxArcSegments = 46;
+
+struct FixedPoint {
+  int32_t x;  // 16.16
+  int32_t y;
+};
+
+inline int32_t ceilFixed(int32_t v) {
+  return (v + 0xFFFF) >> 16;
+}
+
+// 16.16 holds about +-32767; outlines reaching past it, such as a thick
+// line ending at an int16 limit, are clamped to that range
+inline int32_t toFixed(float v) {
+  constexpr float kLimit = 32767.0f;
+  return static_cast<int32_t>(lroundf((v < -kLimit ? -kLimit : v > kLimit ? kLimit : v) * 65536.0f));
+}
+
+inline FixedPoint toFixed(float x, float y) {
+  return { toFixed(x), toFixed(y) };
+}
+
+// True when the inclusive box [x0, x1] x [y0, y1] misses the clip rectangle
+inline bool outsideClip(const ESP32S3BoxLiteClipRect &clip, int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  return x1 < clip.x0 || x0 >= clip.x1 || y1 < clip.y0 || y0 >= clip.y1;
+}
+
+// Calls fn(k, halfWidth) once for each row offset k = 0..r of a filled
+// Bresenham circle. The octant walk yields rows 0..xEnd with half-width y,
+// and every row above xEnd with the widest x reached on it.
+template <typename Fn>
+void circleRows(int16_t r, Fn fn) {
+  if (r < 0) { return; }
+  int32_t x = 0, y = r, d = 3 - 2 * r;
+  int32_t xEnd = 0;
+  auto step = [&]() {
+    ++x;
+    if (d > 0) {
+      --y;
+      d += 4 * (x - y) + 10;
+    } else {
+      d += 4 * x + 6;
+    }
+  };
+  while (y >= x) {
+    xEnd = x;
+    step();
+  }
+
+  x = 0;
+  y = r;
+  d = 3 - 2 * r;
+  while (y >= x) {
+    const int32_t curX = x;
+    const int32_t curY = y;
+    fn(curX, curY);
+    step();
+    if ((y != curY || y < x) && curY > xEnd) {
+      fn(curY, curX);
+    }
+  }
+}
+
+// Adafruit-compatible triangle: both edges are inclusive, each row is one span
+template <typename Span>
+void scanTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                  const ESP32S3BoxLiteClipRect &clip, Span &span) {
+  if (std::max(x0, std::max(x1, x2)) < clip.x0 || std::min(x0, std::min(x1, x2)) >= clip.x1) { return; }
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+  if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+  if (y0 == y2) {
+    if (y0 < clip.y0 || y0 >= clip.y1) { return; }
+    const int32_t a = std::min(x0, std::min(x1, x2));
+    const int32_t b = std::max(x0, std::max(x1, x2));
+    span(a, y0, b - a + 1);
+    return;
+  }
+
+  // The upper half owns row y1 only when the lower half is flat
+  const int32_t last = (y1 == y2) ? y1 : y1 - 1;
+  const int32_t yEnd = std::min<int32_t>(y2, clip.y1 - 1);
+  for (int32_t y = std::max<int32_t>(y0, clip.y0); y <= yEnd; ++y) {
+    int32_t a = (y <= last) ? x0 + (x1 - x0) * (y - y0) / (y1 - y0)
+                            : x1 + (x2 - x1) * (y - y1) / (y2 - y1);
+    int32_t b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
+    if (a > b) { std::swap(a, b); }
+    span(a, y, b - a + 1);
+  }
+}
+
+// Even-odd fill sampled at pixel centres: pixel (px, py) is inside when the
+// point (px, py) is, with left/top edges inclusive.
+template <typename Span>
+void scanPolygon(const FixedPoint *pts, size_t n, const ESP32S3BoxLiteClipRect &clip, Span &span) {
+  if (n < 3 || n > kMaxPolygonPoints) { return; }
+  // Filled columns lie in [ceil(min x), ceil(max x))
+  int32_t xMin = INT32_MAX, xMax = INT32_MIN;
+  for (size_t i = 0; i < n; ++i) {
+    xMin = std::min(xMin, pts[i].x);
+    xMax = std::max(xMax, pts[i].x);
+  }
+  if (ceilFixed(xMax) <= clip.x0 || ceilFixed(xMin) >= clip.x1) { return; }
+
+  struct Edge {
+    int32_t r0, r1;  // covered rows [r0, r1)
+    int32_t x;       // crossing on row r0, 16.16
+    int32_t slope;   // 16.16 per row
+  };
+  Edge    edges[kMaxPolygonPoints];
+  size_t  edgeCount = 0;
+  int32_t rowMin = INT32_MAX, rowMax = INT32_MIN;
+
+  for (size_t i = 0; i < n; ++i) {
+    FixedPoint a = pts[i];
+    FixedPoint b = pts[(i + 1) % n];
+    if (a.y > b.y) { std::swap(a, b); }
+    const int32_t r0 = ceilFixed(a.y);
+    const int32_t r1 = ceilFixed(b.y);
+    if (r0 >= r1) { continue; }  // no row centre between the ends
+    const int64_t dx = static_cast<int64_t>(b.x) - a.x;
+    const int64_t dy = static_cast<int64_t>(b.y) - a.y;
+    const int64_t slope = (dx * 65536) / dy;
+    Edge &e = edges[edgeCount++];
+    e.r0    = r0;
+    e.r1    = r1;
+    e.x     = static_cast<int32_t>(a.x + ((static_cast<int64_t>(r0) * 65536 - a.y) * dx) / dy);
+    e.slope = static_cast<int32_t>(std::max<int64_t>(std::min<int64_t>(slope, INT32_MAX), INT32_MIN));
+    rowMin  = std::min(rowMin, r0);
+    rowMax  = std::max(rowMax, r1);
+  }
+
+  int32_t crossings[kMaxPolygonPoints];
+  const int32_t yEnd = std::min<int32_t>(rowMax, clip.y1);
+  for (int32_t y = std::max<int32_t>(rowMin, clip.y0); y < yEnd; ++y) {
+    size_t count = 0;
+    for (size_t i = 0; i < edgeCount; ++i) {
+      const Edge &e = edges[i];
+      if (y < e.r0 || y >= e.r1) { continue; }
+      const int32_t x = static_cast<int32_t>(e.x + static_cast<int64_t>(y - e.r0) * e.slope);
+      size_t j = count++;
+      for (; j > 0 && crossings[j - 1] > x; --j) { crossings[j] = crossings[j - 1]; }
+      crossings[j] = x;
+    }
+    for (size_t i = 0; i + 1 < count; i += 2) {
+      const int32_t xl = ceilFixed(crossings[i]);
+      const int32_t xr = ceilFixed(crossings[i + 1]);
+      if (xr > xl) { span(xl, y, xr - xl); }
+    }
+  }
+}
+
+// Rectangle around the segment, extended half a pixel past both ends so the
+// end pixels are covered as drawLine() would.
+void thickLineOutline(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, FixedPoint *pts) {
+  float ux = static_cast<float>(x1 - x0);
+  float uy = static_cast<float>(y1 - y0);
+  const float len = sqrtf(ux * ux + uy * uy);
+  if (len > 0.0f) {
+    ux /= len;
+    uy /= len;
+  } else {
+    ux = 1.0f;
+    uy = 0.0f;
+  }
+  const float hw = width * 0.5f;
+  const float ex = ux * 0.5f, ey = uy * 0.5f;  // end extension
+  const float nx = -uy * hw, ny = ux * hw;     // half-width normal
+  pts[0] = toFixed(x0 - ex + nx, y0 - ey + ny);
+  pts[1] = toFixed(x1 + ex + nx, y1 + ey + ny);
+  pts[2] = toFixed(x1 + ex - nx, y1 + ey - ny);
+  pts[3] = toFixed(x0 - ex - nx, y0 - ey - ny);
+}
+
+// Outer arc from start to end, then the inner arc (or the centre) back.
+// Radii are widened by half a pixel so a ring covers innerR..outerR inclusive,
+// like fillCircle(). Returns the number of points written.
+size_t arcOutline(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, int16_t startDeg, int16_t endDeg,
+                  FixedPoint *pts) {
+  if (outerR <= 0 || innerR < 0 || innerR >= outerR) { return 0; }
+  int32_t sweep = static_cast<int32_t>(endDeg) - startDeg;
+  if (sweep == 0) { return 0; }
+  if (sweep < 0 || sweep > 360) {
+    sweep = ((sweep % 360) + 360) % 360;
+    if (sweep == 0) { sweep = 360; }
+  }
+
+  const float kDegToRad = 3.14159265f / 180.0f;
+  const float ro = outerR + 0.5f;
+  const float ri = innerR > 0 ? innerR - 0.5f : 0.0f;
+  // Segment angle that keeps the chord within a quarter pixel of the arc
+  const float   maxStep = 2.0f * acosf(1.0f - 0.25f / ro);
+  const int32_t segs    = std::min<int32_t>(
+      kMaxArcSegments, std::max<int32_t>(1, static_cast<int32_t>(ceilf(sweep * kDegToRad / maxStep))));
+
+  size_t n = 0;
+  for (int32_t i = 0; i <= segs; ++i) {
+    const float a = (startDeg + sweep * static_cast<float>(i) / segs) * kDegToRad;
+    pts[n++] = toFixed(cx + ro * cosf(a), cy + ro * sinf(a));
+  }
+  if (ri > 0.0f) {
+    for (int32_t i = segs; i >= 0; --i) {
+      const float a = (startDeg + sweep * static_cast<float>(i) / segs) * kDegToRad;
+      pts[n++] = toFixed(cx + ri * cosf(a), cy + ri * sinf(a));
+    }
+  } else if (sweep < 360) {
+    pts[n++] = toFixed(cx, cy);
+  }
+  return n;
+}
+
+// Joins identical spans on consecutive rows into one rectangle, so vertical
+// runs of a shape cost one address window instead of one per row.
+template <typename RectFn>
+class SpanMerger {
+ public:
+  explicit SpanMerger(RectFn rect) : rect_(rect) {}
+  ~SpanMerger() { flush(); }
+
+  void operator()(int32_t x, int32_t y, int32_t w) {
+    if (h_ > 0 && x == x_ && w == w_ && y == y_ + h_) {
+      ++h_;
+      return;
+    }
+    flush();
+    x_ = x;
+    y_ = y;
+    w_ = w;
+    h_ = 1;
+  }
+
+  void flush() {
+    if (h_ > 0) { rect_(x_, y_, w_, h_); }
+    h_ = 0;
+  }
+
+ private:
+  RectFn  rect_;
+  int32_t x_ = 0, y_ = 0, w_ = 0, h_ = 0;
+};
+
+template <typename RectFn>
+SpanMerger<RectFn> makeSpanMerger(RectFn rect) {
+  return SpanMerger<RectFn>(rect);
+}
+
+// Rect sink for the display; rows arrive already clipped
+struct DisplayRect {
+  ESP32S3BoxLiteDisplay *disp;
+  uint16_t               color;
+
+  void operator()(int32_t x, int32_t y, int32_t w, int32_t h) const {
+    const ESP32S3BoxLiteClipRect &clip = disp->clipBounds();
+    const int32_t x0 = std::max<int32_t>(x, clip.x0);
+    const int32_t x1 = std::min<int32_t>(x + w, clip.x1);
+    if (x0 >= x1) { return; }
+    disp->fillRect(static_cast<uint16_t>(x0), static_cast<uint16_t>(y), static_cast<uint16_t>(x1 - x0),
+                   static_cast<uint16_t>(h), color);
+  }
+};
+
+// Span sink for sprites
+struct SpriteSpan {
+  ESP32S3BoxLiteSprite *sprite;
+  uint16_t              color;
+
+  void operator()(int32_t x, int32_t y, int32_t w) const {
+    const ESP32S3BoxLiteClipRect &clip = sprite->clipBounds();
+    const int32_t x0 = std::max<int32_t>(x, clip.x0);
+    const int32_t x1 = std::min<int32_t>(x + w, clip.x1);
+    if (x0 < x1) {
+      sprite->drawFastHLine(static_cast<int16_t>(x0), static_cast<int16_t>(y), static_cast<int16_t>(x1 - x0),
+                            color);
+    }
+  }
+};
+
+// Palette lookup of n pixels from column x of an 8 or 4 bpp row, swapped to
+// wire order when Wire
+template <bool Wire>
+void expandIndexed(const uint8_t *row, uint8_t bpp, int32_t x, int32_t n, const uint16_t *palette, uint16_t *dst) {
+  auto out = [palette](uint8_t index) { return Wire ? swap565(palette[index]) : palette[index]; };
+  if (bpp == 8) {
+    row += x;
+    for (int32_t i = 0; i < n; ++i) { dst[i] = out(row[i]); }
+    return;
+  }
+  const uint8_t *src = row + (x >> 1);
+  int32_t        i   = 0;
+  if ((x & 1) != 0 && n > 0) { dst[i++] = out(*src++ & 0x0F); }
+  for (; i + 1 < n; i += 2) {
+    const uint8_t pair = *src++;
+    dst[i]     = out(pair >> 4);
+    dst[i + 1] = out(pair & 0x0F);
+  }
+  if (i < n) { dst[i] = out(*src >> 4); }
+}
+
+// Clips a w x h copy from (sx, sy) of a srcW x srcH image to (x, y) inside
+// the destination's clip rectangle; false when nothing is left
+bool clipBlit(int32_t srcW, int32_t srcH, const ESP32S3BoxLiteClipRect &dst, int32_t &x, int32_t &y, int32_t &sx,
+              int32_t &sy, int32_t &w, int32_t &h) {
+  if (sx < 0) { x -= sx; w += sx; sx = 0; }
+  if (sy < 0) { y -= sy; h += sy; sy = 0; }
+  if (x < dst.x0) { sx += dst.x0 - x; w -= dst.x0 - x; x = dst.x0; }
+  if (y < dst.y0) { sy += dst.y0 - y; h -= dst.y0 - y; y = dst.y0; }
+  w = std::min(w, std::min(srcW - sx, dst.x1 - x));
+  h = std::min(h, std::min(srcH - sy, dst.y1 - y));
+  return w > 0 && h > 0;
+}
+
+// ESP32S3BoxLiteSprite::nearestIndex() with the last answer kept: colours
+// written into an indexed sprite often repeat from one pixel to the next
+class NearestIndexCache {
+ public:
+  explicit NearestIndexCache(const ESP32S3BoxLiteSprite &sprite) : sprite_(sprite) {}
+
+  uint8_t operator()(uint16_t color) {
+    if (color != color_ || !valid_) {
+      color_ = color;
+      index_ = sprite_.nearestIndex(color);
+      valid_ = true;
+    }
+    return index_;
+  }
+
+ private:
+  const ESP32S3BoxLiteSprite &sprite_;
+  uint16_t color_ = 0;
+  uint8_t  index_ = 0;
+  bool     valid_ = false;
+};
+
+// ---------------------------------------------------------------------------
+// Affine blits
+// ---------------------------------------------------------------------------
+// Destination pixel (x, y) samples the source at (u, v) = (u0, v0) +
+// x * (dudx, dvdx) + y * (dudy, dvdy), 16.16 fixed point at pixel centres.
+// The run of each row that lands inside the source is solved exactly up
+// front, so the sampling loops carry no bounds tests.
+
+constexpr int32_t kAffineChunk = 64;
+constexpr float   kAffineMinZoom = 1.0f / 256;  // keeps the steps inside 16.16
+
+struct AffineMap {
+  int64_t u0, v0;
+  int32_t dudx, dvdx, dudy, dvdy;
+};
+
+// Sprite point (px, py) lands on destination point (x, y); false when the
+// zoom is too small to sample. rowMin/rowMax bound the destination rows hit.
+bool makeAffineMap(const ESP32S3BoxLiteSprite &sp, float x, float y, float angle, float zoomX, float zoomY,
+                   AffineMap &m, int32_t &rowMin, int32_t &rowMax) {
+  if (!(fabsf(zoomX) >= kAffineMinZoom) || !(fabsf(zoomY) >= kAffineMinZoom)) { return false; }
+  const float rad = angle * (kPi / 180.0f);
+  const float c = cosf(rad), s = sinf(rad);
+  const float px = sp.pivotX(), py = sp.pivotY();
+  // Inverse of rotate-then-scale, applied to the centre of pixel (0, 0)
+  const float dx = 0.5f - x, dy = 0.5f - y;
+  m.u0   = llroundf((px + (c * dx + s * dy) / zoomX) * 65536.0f);
+  m.v0   = llroundf((py + (c * dy - s * dx) / zoomY) * 65536.0f);
+  m.dudx = static_cast<int32_t>(lroundf(c / zoomX * 65536.0f));
+  m.dudy = static_cast<int32_t>(lroundf(s / zoomX * 65536.0f));
+  m.dvdx = static_cast<int32_t>(lroundf(-s / zoomY * 65536.0f));
+  m.dvdy = static_cast<int32_t>(lroundf(c / zoomY * 65536.0f));
+
+  // Rows under the rotated corners, a pixel wider for rounding
+  float top = y, bottom = y;
+  for (int corner = 0; corner < 4; ++corner) {
+    const float sx = ((corner & 1) ? sp.width() : 0) - px;
+    const float sy = ((corner & 2) ? sp.height() : 0) - py;
+    const float ty = y + s * zoomX * sx + c * zoomY * sy;
+    top    = std::min(top, ty);
+    bottom = std::max(bottom, ty);
+  }
+  rowMin = static_cast<int32_t>(std::max(floorf(top) - 1.0f, -32768.0f));
+  rowMax = static_cast<int32_t>(std::min(ceilf(bottom) + 1.0f, 32767.0f));
+  return true;
+}
+
+inline int64_t floorDiv(int64_t a, int64_t b) {
+  const int64_t q = a / b;
+  return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// Narrows [lo, hi] to the x where 0 <= start + x * step < limit
+void clipAffineAxis(int64_t start, int32_t step, int64_t limit, int32_t &lo, int32_t &hi) {
+  if (step == 0) {
+    if (start < 0 || start >= limit) { hi = lo - 1; }
+    return;
+  }
+  // x * step must fall in [a, b]
+  const int64_t a = -start, b = limit - 1 - start;
+  const int64_t first = step > 0 ? -floorDiv(-a, step) : -floorDiv(-b, step);
+  const int64_t last  = step > 0 ? floorDiv(b, step) : floorDiv(a, step);
+  if (first > lo) { lo = static_cast<int32_t>(std::min<int64_t>(first, INT32_MAX)); }
+  if (last < hi) { hi = static_cast<int32_t>(std::max<int64_t>(last, INT32_MIN)); }
+}
+
+// Native RGB565 of texel (x, y), per sprite format
+template <bool Wire>
+struct Texels565 {
+  const uint16_t *px;
+  int32_t         stride;
+  uint16_t operator()(int32_t x, int32_t y) const {
+    const uint16_t c = px[y * stride + x];
+    return Wire ? swap565(c) : c;
+  }
+};
+
+struct Texels8 {
+  const uint8_t  *px;
+  int32_t         stride;
+  const uint16_t *palette;
+  uint16_t operator()(int32_t x, int32_t y) const { return palette[px[y * stride + x]]; }
+};
+
+struct Texels4 {
+  const uint8_t  *px;
+  int32_t         stride;
+  const uint16_t *palette;
+  uint16_t operator()(int32_t x, int32_t y) const {
+    return palette[(px[y * stride + (x >> 1)] >> ((~x & 1) << 2)) & 0x0F];
+  }
+};
+
+// u and v wrap as unsigned so the step past the run is defined; inside the
+// run they are never negative
+template <bool Keyed, typename Texels>
+void sampleNearest(const Texels &tex, uint32_t u, uint32_t v, int32_t dudx, int32_t dvdx, int32_t n, uint16_t key,
+                   uint16_t *out, uint8_t *keep) {
+  for (int32_t i = 0; i < n; ++i) {
+    const uint16_t c = tex(static_cast<int32_t>(u >> 16), static_cast<int32_t>(v >> 16));
+    out[i] = c;
+    if (Keyed) { keep[i] = c != key; }
+    u += static_cast<uint32_t>(dudx);
+    v += static_cast<uint32_t>(dvdx);
+  }
+}
+
+// Taps are the four texel centres around the sample, clamped at the edges.
+// Keyed taps are replaced by the nearest texel so the key never bleeds in.
+template <bool Keyed, typename Texels>
+void sampleBilinear(const Texels &tex, int32_t w, int32_t h, uint32_t u, uint32_t v, int32_t dudx, int32_t dvdx,
+                    int32_t n, uint16_t key, uint16_t *out, uint8_t *keep) {
+  for (int32_t i = 0; i < n; ++i) {
+    const int32_t  su = static_cast<int32_t>(u) - 0x8000, sv = static_cast<int32_t>(v) - 0x8000;
+    const int32_t  x0 = std::max<int32_t>(su >> 16, 0), x1 = std::min<int32_t>((su >> 16) + 1, w - 1);
+    const int32_t  y0 = std::max<int32_t>(sv >> 16, 0), y1 = std::min<int32_t>((sv >> 16) + 1, h - 1);
+    const uint32_t fx = (static_cast<uint32_t>(su) >> 11) & 31, fy = (static_cast<uint32_t>(sv) >> 11) & 31;
+    uint16_t c00 = tex(x0, y0), c10 = tex(x1, y0), c01 = tex(x0, y1), c11 = tex(x1, y1);
+    if (Keyed) {
+      const uint16_t c = tex(static_cast<int32_t>(u >> 16), static_cast<int32_t>(v >> 16));
+      keep[i] = c != key;
+      c00 = c00 == key ? c : c00;
+      c10 = c10 == key ? c : c10;
+      c01 = c01 == key ? c : c01;
+      c11 = c11 == key ? c : c11;
+    }
+    out[i] = blend565(blend565(c11, c01, fx), blend565(c10, c00, fx), fy);
+    u += static_cast<uint32_t>(dudx);
+    v += static_cast<uint32_t>(dvdx);
+  }
+}
+
+template <bool Bilinear, bool Keyed, typename Texels, typename Out>
+void affineRows(const Texels &tex, int32_t w, int32_t h, const AffineMap &m, int32_t x0, int32_t y0, int32_t x1,
+                int32_t y1, uint16_t key, Out &out) {
+  uint16_t px[kAffineChunk];
+  uint8_t  keep[kAffineChunk];
+  for (int32_t y = y0; y < y1; ++y) {
+    const int64_t u = m.u0 + static_cast<int64_t>(y) * m.dudy;
+    const int64_t v = m.v0 + static_cast<int64_t>(y) * m.dvdy;
+    int32_t lo = x0, hi = x1 - 1;
+    clipAffineAxis(u, m.dudx, static_cast<int64_t>(w) << 16, lo, hi);
+    clipAffineAxis(v, m.dvdx, static_cast<int64_t>(h) << 16, lo, hi);
+    for (int32_t x = lo; x <= hi; x += kAffineChunk) {
+      const int32_t  n  = std::min<int32_t>(kAffineChunk, hi - x + 1);
+      const uint32_t su = static_cast<uint32_t>(u + static_cast<int64_t>(x) * m.dudx);
+      const uint32_t sv = static_cast<uint32_t>(v + static_cast<int64_t>(x) * m.dvdx);
+      if (Bilinear) {
+        sampleBilinear<Keyed>(tex, w, h, su, sv, m.dudx, m.dvdx, n, key, px, keep);
+      } else {
+        sampleNearest<Keyed>(tex, su, sv, m.dudx, m.dvdx, n, key, px, keep);
+      }
+      out(x, y, px, Keyed ? keep : nullptr, n);
+    }
+  }
+}
+
+template <typename Texels, typename Out>
+void affineBlit(const Texels &tex, int32_t w, int32_t h, const AffineMap &m, int32_t x0, int32_t y0, int32_t x1,
+                int32_t y1, bool bilinear, bool keyed, uint16_t key, Out &out) {
+  if (bilinear && keyed) {
+    affineRows<true, true>(tex, w, h, m, x0, y0, x1, y1, key, out);
+  } else if (bilinear) {
+    affineRows<true, false>(tex, w, h, m, x0, y0, x1, y1, key, out);
+  } else if (keyed) {
+    affineRows<false, true>(tex, w, h, m, x0, y0, x1, y1, key, out);
+  } else {
+    affineRows<false, false>(tex, w, h, m, x0, y0, x1, y1, key, out);
+  }
+}
+
+// Samples sp over destination rows [y0, y1) and columns [x0, x1), calling
+// out(x, y, px, keep, n) with native colours for each run inside the
+// sprite; keep marks the non-key pixels and is null without a key
+template <typename Out>
+void affineBlitSprite(const ESP32S3BoxLiteSprite &sp, const AffineMap &m, int32_t x0, int32_t y0, int32_t x1,
+                      int32_t y1, ESP32S3BoxLiteFilter filter, ESP32S3BoxLiteBlend mode, uint16_t key, Out &out) {
+  const bool    bilinear = filter == ESP32S3BoxLiteFilter::Bilinear;
+  const bool    keyed    = mode == ESP32S3BoxLiteBlend::ColorKey;
+  const int32_t w = sp.width(), h = sp.height();
+  switch (sp.bitsPerPixel()) {
+    case 8: {
+      const Texels8 tex{ sp.indices(), static_cast<int32_t>(sp.rowBytes()), sp.palette() };
+      affineBlit(tex, w, h, m, x0, y0, x1, y1, bilinear, keyed, key, out);
+      break;
+    }
+    case 4: {
+      const Texels4 tex{ sp.indices(), static_cast<int32_t>(sp.rowBytes()), sp.palette() };
+      affineBlit(tex, w, h, m, x0, y0, x1, y1, bilinear, keyed, key, out);
+      break;
+    }
+    default:
+      if (sp.wireOrder()) {
+        affineBlit(Texels565<true>{ sp.buffer(), w }, w, h, m, x0, y0, x1, y1, bilinear, keyed, key, out);
+      } else {
+        affineBlit(Texels565<false>{ sp.buffer(), w }, w, h, m, x0, y0, x1, y1, bilinear, keyed, key, out);
+      }
+      break;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Anti-aliasing
+// ---------------------------------------------------------------------------
+// Coverage is quantised to 16 levels: 0 leaves the background, 15 is solid.
+// Coverage is emitted as blocks through plot(x, y, w, h, levels), with
+// `levels` row-major; blocks are not clipped.
+
+constexpr uint8_t kCoverageMax = 15;
+constexpr int32_t kAaChunk     = 64;  // longest block emitted at once
+
+// round(v * level / 15) for every 5- and 6-bit channel value, so a blend is
+// two table reads and an add per channel
+struct ChannelLut {
+  uint8_t c5[kCoverageMax + 1][32];
+  uint8_t c6[kCoverageMax + 1][64];
+};
+
+constexpr ChannelLut makeChannelLut() {
+  ChannelLut lut{};
+  for (uint32_t level = 0; level <= kCoverageMax; ++level) {
+    for (uint32_t v = 0; v < 64; ++v) {
+      const auto scaled = static_cast<uint8_t>((v * level * 2 + kCoverageMax) / (2 * kCoverageMax));
+      if (v < 32) {
+        lut.c5[level][v] = scaled;
+      }
+      lut.c6[level][v] = scaled;
+    }
+  }
+  return lut;
+}
+
+constexpr ChannelLut kChannelLut = makeChannelLut();
+
+// The two weights of each channel always sum to the full value, so a
+// channel never overflows.
+inline uint16_t blendCoverage(uint16_t fg, uint16_t bg, uint8_t level) {
+  const uint8_t  inv = kCoverageMax - level;
+  const uint32_t r   = kChannelLut.c5[level][fg >> 11] + kChannelLut.c5[inv][bg >> 11];
+  const uint32_t g   = kChannelLut.c6[level][(fg >> 5) & 0x3F] + kChannelLut.c6[inv][(bg >> 5) & 0x3F];
+  const uint32_t b   = kChannelLut.c5[level][fg & 0x1F] + kChannelLut.c5[inv][bg & 0x1F];
+  return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+// Every coverage level of fg over a known background
+void makeCoverageRamp(uint16_t fg, uint16_t bg, uint16_t *ramp) {
+  for (uint8_t level = 0; level <= kCoverageMax; ++level) {
+    ramp[level] = blendCoverage(fg, bg, level);
+  }
+}
+
+inline uint8_t coverageLevel(float coverage) {
+  if (coverage <= 0.0f) { return 0; }
+  if (coverage >= 1.0f) { return kCoverageMax; }
+  return static_cast<uint8_t>(coverage * kCoverageMax + 0.5f);
+}
+
+// Xiaolin Wu's line between integer endpoints. Columns (rows for steep
+// lines) that share the same pixel pair are emitted as one 2-pixel-deep
+// block; a side with no coverage is left out. The walk starts and stops at
+// the clip rectangle's edges along the major axis.
+template <typename Plot>
+void wuLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, const ESP32S3BoxLiteClipRect &clip, Plot &plot) {
+  // The far side of each step reaches one pixel past the line
+  if (std::max(x0, x1) + 1 < clip.x0 || std::min(x0, x1) >= clip.x1 || std::max(y0, y1) + 1 < clip.y0 ||
+      std::min(y0, y1) >= clip.y1) {
+    return;
+  }
+  const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+  if (steep) {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1) {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+  const int32_t grad  = x1 > x0 ? static_cast<int32_t>(static_cast<int64_t>(y1 - y0) * 65536 / (x1 - x0)) : 0;
+  int32_t       inter = y0 * 65536;  // minor coordinate, 16.16
+
+  const int32_t majorLo = steep ? clip.y0 : clip.x0;
+  const int32_t majorHi = (steep ? clip.y1 : clip.x1) - 1;
+  int32_t start = x0;
+  if (start < majorLo) {
+    inter = static_cast<int32_t>(inter + static_cast<int64_t>(grad) * (majorLo - start));
+    start = majorLo;
+  }
+  x1 = std::min(x1, majorHi);
+
+  uint8_t near[kAaChunk], far[kAaChunk], both[2 * kAaChunk];
+  for (int32_t x = start; x <= x1;) {
+    const int32_t minor = inter >> 16;
+    int32_t n = 0;
+    bool anyNear = false, anyFar = false;
+    for (; x + n <= x1 && n < kAaChunk && (inter >> 16) == minor; ++n, inter += grad) {
+      const auto level = static_cast<uint8_t>(((inter & 0xFFFF) * kCoverageMax + 0x8000) >> 16);
+      near[n] = kCoverageMax - level;
+      far[n]  = level;
+      anyNear |= near[n] != 0;
+      anyFar  |= far[n] != 0;
+    }
+    if (anyNear && anyFar) {
+      for (int32_t i = 0; i < n; ++i) {
+        if (steep) {
+          both[2 * i]     = near[i];
+          both[2 * i + 1] = far[i];
+        } else {
+          both[i]     = near[i];
+          both[n + i] = far[i];
+        }
+      }
+      if (steep) {
+        plot(minor, x, 2, n, both);
+      } else {
+        plot(x, minor, n, 2, both);
+      }
+    } else {
+      const uint8_t *levels = anyNear ? near : far;
+      const int32_t  m      = anyNear ? minor : minor + 1;
+      if (steep) {
+        plot(m, x, 1, n, levels);
+      } else {
+        plot(x, m, n, 1, levels);
+      }
+    }
+    x += n;
+  }
+}
+
+// levelOf(x) for x in [x0, x1] clipped to the clip columns, as row blocks
+// without the uncovered pixels at either end
+template <typename LevelFn, typename Plot>
+void aaRow(int32_t y, int32_t x0, int32_t x1, const ESP32S3BoxLiteClipRect &clip, LevelFn levelOf, Plot &plot) {
+  x0 = std::max<int32_t>(x0, clip.x0);
+  x1 = std::min<int32_t>(x1, clip.x1 - 1);
+  uint8_t levels[kAaChunk];
+  while (x0 <= x1) {
+    const int32_t n = std::min<int32_t>(kAaChunk, x1 - x0 + 1);
+    int32_t first = n, last = -1;
+    for (int32_t i = 0; i < n; ++i) {
+      levels[i] = levelOf(x0 + i);
+      if (levels[i] != 0) {
+        first = std::min(first, i);
+        last  = i;
+      }
+    }
+    if (last >= first) {
+      plot(x0 + first, y, last - first + 1, 1, levels + first);
+    }
+    x0 += n;
+  }
+}
+
+// One-pixel ring centred on radius r (coverage 1 - |d - r|), or with `fill`
+// a disc whose edge lies half a pixel outside r, like fillCircle(). Each row
+// is one block, or one per side where the ring is split.
+template <typename Plot>
+void aaCircle(int32_t cx, int32_t cy, int32_t r, bool fill, const ESP32S3BoxLiteClipRect &clip, Plot &plot) {
+  if (r < 0 || cx + r + 1 < clip.x0 || cx - r - 1 >= clip.x1) { return; }
+  const float rf    = static_cast<float>(r);
+  const float outer = (rf + 1.0f) * (rf + 1.0f);
+  const int32_t yEnd = std::min<int32_t>(cy + r, clip.y1 - 1);
+  for (int32_t y = std::max<int32_t>(cy - r, clip.y0); y <= yEnd; ++y) {
+    const float   dy  = static_cast<float>(y - cy);
+    const float   dy2 = dy * dy;
+    const int32_t xb  = static_cast<int32_t>(sqrtf(outer - dy2));
+    if (fill) {
+      const float   solid = rf * rf - dy2;
+      const int32_t xs    = solid >= 0.0f ? static_cast<int32_t>(sqrtf(solid)) : -1;
+      aaRow(y, cx - xb, cx + xb, clip, [&](int32_t x) {
+        const int32_t dx = x - cx;
+        if (std::abs(dx) <= xs) { return kCoverageMax; }
+        return coverageLevel(rf + 1.0f - sqrtf(static_cast<float>(dx * dx) + dy2));
+      }, plot);
+      continue;
+    }
+    auto ringLevel = [&](int32_t x) {
+      const int32_t dx = x - cx;
+      return coverageLevel(1.0f - std::fabs(sqrtf(static_cast<float>(dx * dx) + dy2) - rf));
+    };
+    const float   hole = (rf - 1.0f) * (rf - 1.0f) - dy2;
+    const int32_t xa   = (r > 1 && hole > 0.0f) ? static_cast<int32_t>(sqrtf(hole)) : 0;
+    if (xa == 0) {
+      aaRow(y, cx - xb, cx + xb, clip, ringLevel, plot);
+    } else {
+      aaRow(y, cx - xb, cx - xa, clip, ringLevel, plot);
+      aaRow(y, cx + xa, cx + xb, clip, ringLevel, plot);
+    }
+  }
+}
+
 // ---------------------------------------------------------------------------
 // NVS namespace
 // ---------------------------------------------------------------------------
@@ -168,110 +1108,1366 @@ constexpr Glyph kGlyphs[] = {
     {'z',  {0b00000, 0b00000, 0b11111, 0b00010, 0b00100, 0b01000, 0b11111}},
 };
 
-const Glyph *findGlyph(char ch) {
-  for (const auto &glyph : kGlyphs) {
-    if (glyph.ch == ch) {
-      return &glyph;
+constexpr size_t kGlyphCount = sizeof(kGlyphs) / sizeof(kGlyphs[0]);
+static_assert(kGlyphCount <= 256, "glyph index must fit in uint8_t");
+
+// Direct ASCII -> kGlyphs index table, built at compile time. Characters
+// without a glyph map to entry 0 (space).
+struct GlyphIndex {
+  uint8_t slot[128];
+};
+
+constexpr GlyphIndex makeGlyphIndex() {
+  GlyphIndex index{};
+  for (size_t i = 0; i < kGlyphCount; ++i) {
+    const auto c = static_cast<unsigned char>(kGlyphs[i].ch);
+    if (c < 128) {
+      index.slot[c] = static_cast<uint8_t>(i);
     }
   }
-  return &kGlyphs[0];  // fallback to space
+  return index;
 }
 
-// ---------------------------------------------------------------------------
-// WAV header parsing helpers (Phase 4)
-// ---------------------------------------------------------------------------
+constexpr GlyphIndex kGlyphIndex = makeGlyphIndex();
 
-struct WavHeader {
-  uint32_t sampleRate;
-  uint16_t numChannels;
-  uint16_t bitsPerSample;
-  uint32_t dataOffset;
-  uint32_t dataSize;
-  bool     valid;
+const Glyph *findGlyph(char ch) {
+  const auto c = static_cast<unsigned char>(ch);
+  return &kGlyphs[c < 128 ? kGlyphIndex.slot[c] : 0];
+}
+
+// Coverage of pixel (px, py) of a glyph cell drawn at `scale`. The 5x7 bitmap
+// is interpolated bilinearly and cut at one half, which rounds diagonals and
+// stroke ends while keeping stroke widths; 4x4 samples per pixel give the
+// level. Coordinates are in units of 1/(8 * scale) glyph pixels.
+uint8_t glyphCoverage(const Glyph &glyph, int32_t px, int32_t py, uint8_t scale) {
+  const int32_t s2 = 8 * scale;  // one glyph pixel
+  auto bit = [&](int32_t gx, int32_t gy) -> int32_t {
+    return (gx >= 0 && gx < 5 && gy >= 0 && gy < 7 && (glyph.rows[gy] & (0x10 >> gx))) ? 1 : 0;
+  };
+  auto floorDiv = [](int32_t a, int32_t b) { return a >= 0 ? a / b : -((-a + b - 1) / b); };
+
+  int32_t inside = 0;
+  for (int32_t j = 0; j < 4; ++j) {
+    // Sample centre relative to the centre of glyph row 0
+    const int32_t ty = 2 * (4 * py + j) + 1 - 4 * scale;
+    const int32_t gy = floorDiv(ty, s2);
+    const int32_t fy = ty - gy * s2;
+    for (int32_t i = 0; i < 4; ++i) {
+      const int32_t tx = 2 * (4 * px + i) + 1 - 4 * scale;
+      const int32_t gx = floorDiv(tx, s2);
+      const int32_t fx = tx - gx * s2;
+      const int32_t v  = bit(gx, gy) * (s2 - fx) * (s2 - fy) + bit(gx + 1, gy) * fx * (s2 - fy) +
+                         bit(gx, gy + 1) * (s2 - fx) * fy + bit(gx + 1, gy + 1) * fx * fy;
+      inside += 2 * v >= s2 * s2 ? 1 : 0;
+    }
+  }
+  return static_cast<uint8_t>((inside * kCoverageMax + 8) / 16);
+}
+
+// ---------------------------------------------------------------------------
+// Proportional font helpers
+// ---------------------------------------------------------------------------
+
+// Decodes one UTF-8 sequence and advances p past it. Malformed input yields
+// U+FFFD and skips a single byte.
+uint32_t nextCodepoint(const char *&p) {
+  const auto lead = static_cast<uint8_t>(*p++);
+  if (lead < 0x80) { return lead; }
+  uint32_t cp;
+  int      extra;
+  if ((lead & 0xE0) == 0xC0) {
+    cp    = lead & 0x1F;
+    extra = 1;
+  } else if ((lead & 0xF0) == 0xE0) {
+    cp    = lead & 0x0F;
+    extra = 2;
+  } else if ((lead & 0xF8) == 0xF0) {
+    cp    = lead & 0x07;
+    extra = 3;
+  } else {
+    return 0xFFFD;
+  }
+  for (int i = 0; i < extra; ++i) {
+    const auto next = static_cast<uint8_t>(p[i]);
+    if ((next & 0xC0) != 0x80) { return 0xFFFD; }  // also stops at the terminator
+    cp = (cp << 6) | (next & 0x3F);
+  }
+  p += extra;
+  return cp;
+}
+
+// Font asset written by tools/fontconvert.py --asset, little-endian:
+//   0 "BXF1"   4 u16 glyph count   6 u8 bpp   7 u8 line height
+//   8 u8 baseline   10 u16 largest glyph bitmap   12 u32 index offset
+// The index is sorted by code point; each entry is u32 code point, u32
+// bitmap offset, u8 width, height, advance, i8 x/y offset and 3 pad bytes.
+constexpr uint8_t  kFontAssetMagic[4]    = {'B', 'X', 'F', '1'};
+constexpr size_t   kFontAssetHeaderBytes = 16;
+constexpr size_t   kFontIndexEntryBytes  = 16;
+constexpr uint16_t kFontIndexPage        = 32;  // index entries per RAM page entry
+constexpr uint32_t kNoCodepoint          = 0xFFFFFFFFu;
+
+inline uint16_t readLe16(const uint8_t *p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline uint32_t readLe32(const uint8_t *p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// Kerning between cp and the character that starts at next
+int8_t kernNext(const ESP32S3BoxLiteFont &font, uint32_t cp, const char *next) {
+  if (font.kernCount == 0 || *next == '\0' || cp > 0xFFFF) { return 0; }
+  const uint32_t right = nextCodepoint(next);
+  return right <= 0xFFFF ? font.kern(static_cast<uint16_t>(cp), static_cast<uint16_t>(right)) : 0;
+}
+
+// ORs one row of a packed glyph into levels; left is the glyph's pen x
+// relative to levels[0]. Overlapping glyphs keep the stronger coverage.
+void blitGlyphRow(const ESP32S3BoxLiteGlyph &g, const uint8_t *bits, uint8_t bpp, int32_t row, int32_t left,
+                  int32_t count, uint8_t *levels) {
+  const int32_t gy = row - g.yOffset;
+  left += g.xOffset;
+  if (gy < 0 || gy >= g.height || left >= count || left + g.width <= 0) { return; }
+  const int32_t c0  = std::max<int32_t>(0, -left);
+  const int32_t c1  = std::min<int32_t>(g.width, count - left);
+  uint32_t      bit = static_cast<uint32_t>(gy) * g.width + c0;  // pixel index in the glyph
+  uint8_t      *dst = levels + left;
+  for (int32_t c = c0; c < c1; ++c, ++bit) {
+    const uint8_t v = bpp == 4 ? ((bits[bit >> 1] >> ((bit & 1) ? 0 : 4)) & 0x0F)
+                               : (((bits[bit >> 3] >> (7 - (bit & 7))) & 1) ? kCoverageMax : 0);
+    if (v > dst[c]) { dst[c] = v; }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Streaming image decoders
+// ---------------------------------------------------------------------------
+
+constexpr int32_t kImageSpan = 64;  // pixels handed to an ImageSink at once
+
+// Receives decoded pixels (native RGB565) in left-to-right spans of at most
+// kImageSpan pixels, always inside the visible part set by begin().
+class ImageSink {
+ public:
+  // Visible columns [x0, x1) and rows [y0, y1) of the image
+  int32_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+  // Sets the visible part; false when nothing is visible
+  virtual bool begin(int32_t w, int32_t h) = 0;
+  virtual void span(int32_t x, int32_t y, const uint16_t *px, int32_t n) = 0;
+  virtual void end() {}
+
+ protected:
+  ~ImageSink() = default;
 };
 
-WavHeader parseWavHeader(const uint8_t *data, size_t len) {
-  WavHeader h{};
-  if (len < 44) {
-    return h;
+// Places decoded pixels in raster order, `step` rows at a time (-1 for
+// bottom-up BMP), and forwards the visible ones
+class PixelWriter {
+ public:
+  PixelWriter(ImageSink &sink, int32_t w, int32_t y, int32_t step) : sink_(sink), w_(w), y_(y), step_(step) {
+    visible_ = rowVisible();
   }
-  // Check RIFF
-  if (data[0] != 'R' || data[1] != 'I' || data[2] != 'F' || data[3] != 'F') {
-    return h;
+
+  void put(uint16_t c) {
+    if (visible_ && x_ >= sink_.x0 && x_ < sink_.x1) { append(x_, c); }
+    if (++x_ == w_) { nextRow(); }
   }
-  // Check WAVE
-  if (data[8] != 'W' || data[9] != 'A' || data[10] != 'V' || data[11] != 'E') {
-    return h;
+  void run(uint16_t c, uint32_t count) {
+    while (count > 0) {
+      const uint32_t n = std::min<uint32_t>(count, static_cast<uint32_t>(w_ - x_));
+      if (visible_) {
+        const int32_t a = std::max<int32_t>(x_, sink_.x0);
+        const int32_t b = std::min<int32_t>(x_ + static_cast<int32_t>(n), sink_.x1);
+        for (int32_t x = a; x < b; ++x) { append(x, c); }
+      }
+      x_ += static_cast<int32_t>(n);
+      count -= n;
+      if (x_ == w_) { nextRow(); }
+    }
+  }
+  // Skips the rest of the current row
+  void skipRow() { nextRow(); }
+
+  bool rowVisible() const { return y_ >= sink_.y0 && y_ < sink_.y1; }
+  // Every visible row is written
+  bool done() const { return step_ > 0 ? y_ >= sink_.y1 : y_ < sink_.y0; }
+
+ private:
+  void append(int32_t x, uint16_t c) {
+    if (n_ == 0) { spanX_ = x; }
+    buf_[n_++] = c;
+    if (n_ == kImageSpan) { flush(); }
+  }
+  void flush() {
+    if (n_ > 0) {
+      sink_.span(spanX_, y_, buf_, n_);
+      n_ = 0;
+    }
+  }
+  void nextRow() {
+    flush();
+    x_ = 0;
+    y_ += step_;
+    visible_ = rowVisible();
   }
 
-  // Scan for fmt  and data chunks
-  size_t offset = 12;
-  bool fmtFound = false;
-  bool dataFound = false;
+  ImageSink &sink_;
+  int32_t    w_;
+  int32_t    x_ = 0;
+  int32_t    y_;
+  int32_t    step_;
+  bool       visible_;
+  uint16_t   buf_[kImageSpan];
+  int32_t    spanX_ = 0;
+  int32_t    n_ = 0;
+};
 
-  while (offset + 8 <= len) {
-    uint32_t chunkId = (uint32_t)data[offset] | ((uint32_t)data[offset + 1] << 8) |
-                       ((uint32_t)data[offset + 2] << 16) | ((uint32_t)data[offset + 3] << 24);
-    uint32_t chunkSize = (uint32_t)data[offset + 4] | ((uint32_t)data[offset + 5] << 8) |
-                         ((uint32_t)data[offset + 6] << 16) | ((uint32_t)data[offset + 7] << 24);
+inline uint16_t rgbTo565(uint8_t r, uint8_t g, uint8_t b) {
+  return static_cast<uint16_t>(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
 
-    // "fmt "
-    if (chunkId == 0x20746D66u) {
-      if (offset + 8 + 16 > len) {
-        break;
+// Channel of a BMP bitfield pixel, scaled to 8 bits
+struct BitField {
+  uint32_t mask;
+  uint8_t  shift;
+  uint8_t  bits;
+
+  explicit BitField(uint32_t m) : mask(m), shift(0), bits(0) {
+    if (m == 0) { return; }
+    while (((m >> shift) & 1) == 0) { ++shift; }
+    while (bits < 32 - shift && ((m >> (shift + bits)) & 1)) { ++bits; }
+  }
+  uint8_t get(uint32_t v) const {
+    if (bits == 0) { return 0; }
+    const uint32_t c = (v & mask) >> shift;
+    return static_cast<uint8_t>(bits >= 8 ? c >> (bits - 8) : (c * 255U + ((1U << bits) - 1) / 2) / ((1U << bits) - 1));
+  }
+};
+
+// BMP, after the first four bytes. Uncompressed 1/4/8 bpp with a palette,
+// 16/32 bpp with or without bitfields, and 24 bpp; either row order.
+bool decodeBmp(ESP32S3BoxLiteImageSource &src, ImageSink &sink) {
+  uint8_t h[50];  // rest of the file header, then up to 40 bytes of info header
+  if (src.read(h, 10) != 10) { return false; }
+  const uint32_t dataOffset = readLe32(h + 6);
+  if (src.read(h, 4) != 4) { return false; }
+  const uint32_t infoSize = readLe32(h);
+  if (infoSize < 40 || src.read(h + 4, 36) != 36) { return false; }
+
+  const auto     width       = static_cast<int32_t>(readLe32(h + 4));
+  const auto     rawHeight   = static_cast<int32_t>(readLe32(h + 8));
+  const uint16_t bpp         = readLe16(h + 14);
+  const uint32_t compression = readLe32(h + 16);
+  uint32_t       colors      = readLe32(h + 32);
+  const bool     topDown     = rawHeight < 0;
+  const int32_t  height      = topDown ? -rawHeight : rawHeight;
+  if (width <= 0 || height <= 0 || width > 0x7FFF || height > 0x7FFF) { return false; }
+
+  // BI_RGB, or BI_BITFIELDS / BI_ALPHABITFIELDS for 16 and 32 bpp
+  const bool bitfields = compression == 3 || compression == 6;
+  if (compression != 0 && !(bitfields && (bpp == 16 || bpp == 32))) { return false; }
+  uint32_t masks[3];
+  if (bpp == 16) {
+    masks[0] = 0x7C00;  // X1R5G5B5
+    masks[1] = 0x03E0;
+    masks[2] = 0x001F;
+  } else {
+    masks[0] = 0xFF0000;
+    masks[1] = 0x00FF00;
+    masks[2] = 0x0000FF;
+  }
+  if (bitfields) {
+    // Right after a 40-byte header, or inside a larger one
+    uint8_t m[12];
+    if (src.read(m, sizeof(m)) != sizeof(m)) { return false; }
+    for (int i = 0; i < 3; ++i) { masks[i] = readLe32(m + 4 * i); }
+    if (infoSize > 52 && !src.skip(infoSize - 52)) { return false; }
+  } else if (!src.skip(infoSize - 40)) {
+    return false;
+  }
+
+  uint16_t palette[256];
+  if (bpp == 1 || bpp == 4 || bpp == 8) {
+    const uint32_t maxColors = 1U << bpp;
+    if (colors == 0 || colors > maxColors) { colors = maxColors; }
+    memset(palette, 0, sizeof(palette));
+    for (uint32_t i = 0; i < colors; ++i) {
+      uint8_t bgra[4];
+      if (src.read(bgra, 4) != 4) { return false; }
+      palette[i] = rgbTo565(bgra[2], bgra[1], bgra[0]);
+    }
+  } else if (bpp != 16 && bpp != 24 && bpp != 32) {
+    return false;
+  }
+  if (dataOffset < src.offset() || !src.skip(dataOffset - src.offset())) { return false; }
+
+  if (!sink.begin(width, height)) { return true; }
+  const uint32_t stride = ((static_cast<uint32_t>(width) * bpp + 31) / 32) * 4;
+  const uint32_t used   = (static_cast<uint32_t>(width) * bpp + 7) / 8;
+  const bool     is565  = bpp == 16 && masks[0] == 0xF800 && masks[1] == 0x07E0 && masks[2] == 0x001F;
+  const BitField red(masks[0]), green(masks[1]), blue(masks[2]);
+
+  PixelWriter out(sink, width, topDown ? 0 : height - 1, topDown ? 1 : -1);
+  for (int32_t row = 0; row < height && !out.done(); ++row) {
+    if (!out.rowVisible()) {
+      if (!src.skip(stride)) { return false; }
+      out.skipRow();
+      continue;
+    }
+    if (bpp <= 8) {
+      const uint8_t pixelMask = static_cast<uint8_t>((1U << bpp) - 1);
+      int32_t       x         = 0;
+      for (uint32_t i = 0; i < used; ++i) {
+        const int b = src.read();
+        if (b < 0) { return false; }
+        for (int shift = 8 - bpp; shift >= 0 && x < width; shift -= bpp, ++x) {
+          out.put(palette[(b >> shift) & pixelMask]);
+        }
+      }
+    } else {
+      for (int32_t x = 0; x < width; ++x) {
+        uint8_t p[4];
+        if (src.read(p, bpp / 8) != bpp / 8U) { return false; }
+        if (bpp == 24) {
+          out.put(rgbTo565(p[2], p[1], p[0]));
+        } else {
+          const uint32_t v = bpp == 16 ? readLe16(p) : readLe32(p);
+          out.put(is565 ? static_cast<uint16_t>(v) : rgbTo565(red.get(v), green.get(v), blue.get(v)));
+        }
       }
-      // audioFormat = data[offset+8] | data[offset+9]<<8  (should be 1 for PCM)
-      h.numChannels  = (uint16_t)data[offset + 10] | ((uint16_t)data[offset + 11] << 8);
-      h.sampleRate   = (uint32_t)data[offset + 12] | ((uint32_t)data[offset + 13] << 8) |
-                       ((uint32_t)data[offset + 14] << 16) | ((uint32_t)data[offset + 15] << 24);
-      h.bitsPerSample = (uint16_t)data[offset + 22] | ((uint16_t)data[offset + 23] << 8);
-      fmtFound = true;
     }
-    // "data"
-    else if (chunkId == 0x61746164u) {
-      h.dataOffset = static_cast<uint32_t>(offset + 8);
-      h.dataSize   = chunkSize;
-      dataFound = true;
+    if (!src.skip(stride - used)) { return false; }
+  }
+  return true;
+}
+
+// QOI (qoiformat.org), after the magic. Alpha is decoded but not used.
+bool decodeQoi(ESP32S3BoxLiteImageSource &src, ImageSink &sink) {
+  uint8_t h[10];
+  if (src.read(h, sizeof(h)) != sizeof(h)) { return false; }
+  const uint32_t width  = (uint32_t(h[0]) << 24) | (uint32_t(h[1]) << 16) | (uint32_t(h[2]) << 8) | h[3];
+  const uint32_t height = (uint32_t(h[4]) << 24) | (uint32_t(h[5]) << 16) | (uint32_t(h[6]) << 8) | h[7];
+  if (width == 0 || height == 0 || width > 0x7FFF || height > 0x7FFF) { return false; }
+  if (!sink.begin(width, height)) { return true; }
+
+  uint8_t  index[64][4] = {};
+  uint8_t  r = 0, g = 0, b = 0, a = 255;
+  uint32_t left = width * height;
+  PixelWriter out(sink, width, 0, 1);
+  while (left > 0 && !out.done()) {
+    const int op = src.read();
+    if (op < 0) { return false; }
+    uint32_t count = 1;
+    if (op == 0xFE || op == 0xFF) {
+      uint8_t p[4];
+      const size_t n = op == 0xFE ? 3 : 4;
+      if (src.read(p, n) != n) { return false; }
+      r = p[0], g = p[1], b = p[2];
+      if (n == 4) { a = p[3]; }
+    } else if ((op & 0xC0) == 0x00) {
+      r = index[op][0], g = index[op][1], b = index[op][2], a = index[op][3];
+    } else if ((op & 0xC0) == 0x40) {
+      r += ((op >> 4) & 3) - 2;
+      g += ((op >> 2) & 3) - 2;
+      b += (op & 3) - 2;
+    } else if ((op & 0xC0) == 0x80) {
+      const int next = src.read();
+      if (next < 0) { return false; }
+      const int dg = (op & 0x3F) - 32;
+      r += dg - 8 + ((next >> 4) & 0x0F);
+      g += dg;
+      b += dg - 8 + (next & 0x0F);
+    } else {
+      count = (op & 0x3F) + 1;
     }
+    uint8_t *slot = index[(r * 3 + g * 5 + b * 7 + a * 11) & 63];
+    slot[0] = r, slot[1] = g, slot[2] = b, slot[3] = a;
 
-    offset += 8 + chunkSize;
-    // Align to 2-byte boundary
-    if (chunkSize & 1) {
-      offset++;
+    count = std::min(count, left);
+    out.run(rgbTo565(r, g, b), count);
+    left -= count;
+  }
+  return true;
+}
+
+// RLE565, written by tools/imageconvert.py, after the magic: u16 width,
+// u16 height, then packets over the pixels in raster order. A control byte
+// c < 0x80 is followed by c + 1 literal pixels; c >= 0x80 by one pixel
+// repeated (c & 0x7F) + 1 times. Pixels are little-endian RGB565.
+bool decodeRle(ESP32S3BoxLiteImageSource &src, ImageSink &sink) {
+  uint8_t h[4];
+  if (src.read(h, sizeof(h)) != sizeof(h)) { return false; }
+  const uint16_t width  = readLe16(h);
+  const uint16_t height = readLe16(h + 2);
+  if (width == 0 || height == 0 || width > 0x7FFF || height > 0x7FFF) { return false; }
+  if (!sink.begin(width, height)) { return true; }
+
+  uint32_t    left = uint32_t(width) * height;
+  PixelWriter out(sink, width, 0, 1);
+  while (left > 0 && !out.done()) {
+    const int c = src.read();
+    if (c < 0) { return false; }
+    const uint32_t count = std::min<uint32_t>((c & 0x7F) + 1U, left);
+    if (c & 0x80) {
+      uint8_t p[2];
+      if (src.read(p, 2) != 2) { return false; }
+      out.run(readLe16(p), count);
+    } else {
+      for (uint32_t i = 0; i < count; ++i) {
+        uint8_t p[2];
+        if (src.read(p, 2) != 2) { return false; }
+        out.put(readLe16(p));
+      }
     }
+    left -= count;
   }
+  return true;
+}
 
-  h.valid = fmtFound && dataFound;
-  return h;
+// Baseline JPEG: Huffman-coded, 8-bit, one scan with every component, 1 or
+// 3 components sampled 1x or 2x. Decoded one MCU row at a time into a strip
+// as tall as the MCU and as wide as the visible part; IDCT and colour
+// conversion are skipped for MCUs outside it.
+
+// Zigzag index -> natural (row-major) index
+constexpr uint8_t kZigzag[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48,
+    41, 34, 27, 20, 13, 6,  7,  14, 21, 28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23,
+    30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+constexpr int kHuffFastBits = 9;
+
+struct JpegHuffman {
+  uint16_t fast[1 << kHuffFastBits];  // (length << 8) | symbol, 0 for longer codes
+  int32_t  maxCode[18];               // largest code of each length, -1 for none
+  int32_t  delta[17];                 // symbol index = code + delta[length]
+  uint8_t  symbols[256];
+  bool     present;
+};
+
+// Tables kept off the stack: about 6 KB
+struct JpegTables {
+  uint16_t    quant[4][64];  // zigzag order
+  JpegHuffman dc[2];
+  JpegHuffman ac[2];
+};
+
+bool buildHuffman(JpegHuffman &t, const uint8_t *counts, const uint8_t *symbols, int total) {
+  memcpy(t.symbols, symbols, total);
+  memset(t.fast, 0, sizeof(t.fast));
+  int32_t code = 0;
+  int     k    = 0;
+  for (int len = 1; len <= 16; ++len) {
+    t.delta[len] = k - code;
+    for (int i = 0; i < counts[len - 1]; ++i, ++code, ++k) {
+      if (code >= (1 << len)) { return false; }  // more codes than the length holds
+      if (len <= kHuffFastBits) {
+        const int shift = kHuffFastBits - len;
+        for (int j = 0; j < (1 << shift); ++j) {
+          t.fast[(code << shift) | j] = static_cast<uint16_t>((len << 8) | symbols[k]);
+        }
+      }
+    }
+    if (code > (1 << len)) { return false; }
+    t.maxCode[len] = counts[len - 1] > 0 ? code - 1 : -1;
+    code <<= 1;
+  }
+  t.maxCode[17] = 0x7FFFFFFF;
+  t.present     = true;
+  return true;
 }
 
+// Fixed-point IDCT: Loeffler, Ligtenberg and Moschytz with 13-bit constants,
+// as in libjpeg's jidctint.c. Each pass runs one 1-D IDCT per lane, reading
+// in[k * 8 + lane] and writing out[lane * 8 + n], so the columns of pass 1
+// become the rows of pass 2 without a transpose. Lanes are independent and
+// unit-stride, which lets the compiler unroll and vectorise the loop.
+constexpr int     kIdctPass1Shift = 11;  // keeps 2 fraction bits between the passes
+constexpr int     kIdctPass2Shift = 18;
+constexpr int32_t kIdctPass1Add   = 1 << (kIdctPass1Shift - 1);
+constexpr int32_t kIdctPass2Add   = (1 << (kIdctPass2Shift - 1)) + (128 << kIdctPass2Shift);  // level shift
+
+void idctPass(const int32_t *in, int32_t *out, int shift, int32_t add) {
+  for (int lane = 0; lane < 8; ++lane) {
+    const int32_t *c = in + lane;
+    // Even part
+    int32_t       z1  = (c[16] + c[48]) * 4433;
+    const int32_t t2  = z1 - c[48] * 15137;
+    const int32_t t3  = z1 + c[16] * 6270;
+    const int32_t t0  = (c[0] + c[32]) * 8192 + add;
+    const int32_t t1  = (c[0] - c[32]) * 8192 + add;
+    const int32_t e10 = t0 + t3, e13 = t0 - t3, e11 = t1 + t2, e12 = t1 - t2;
+    // Odd part
+    int32_t       o0 = c[56], o1 = c[40], o2 = c[24], o3 = c[8];
+    z1               = o0 + o3;
+    int32_t       z2 = o1 + o2, z3 = o0 + o2, z4 = o1 + o3;
+    const int32_t z5 = (z3 + z4) * 9633;
+    o0 *= 2446;
+    o1 *= 16819;
+    o2 *= 25172;
+    o3 *= 12299;
+    z1 *= -7373;
+    z2 *= -20995;
+    z3 = z3 * -16069 + z5;
+    z4 = z4 * -3196 + z5;
+    o0 += z1 + z3;
+    o1 += z2 + z4;
+    o2 += z2 + z3;
+    o3 += z1 + z4;
+
+    int32_t *d = out + lane * 8;
+    d[0] = (e10 + o3) >> shift;
+    d[7] = (e10 - o3) >> shift;
+    d[1] = (e11 + o2) >> shift;
+    d[6] = (e11 - o2) >> shift;
+    d[2] = (e12 + o1) >> shift;
+    d[5] = (e12 - o1) >> shift;
+    d[3] = (e13 + o0) >> shift;
+    d[4] = (e13 - o0) >> shift;
+  }
+}
+
+// N-point IDCTs of the lowest N coefficients, for output at 1/2 and 1/4
+// size: the 8-point basis sampled at the centre of each group of 8/N pixels,
+// scaled like idctPass(). kIdctN[n][u] = 8192 * sqrt(2) * C(u) * cos((2n+1)u*pi/2N).
+constexpr int16_t kIdct4[4][4] = {
+    {8192, 10703, 8192, 4433},
+    {8192, 4433, -8192, -10703},
+    {8192, -4433, -8192, 10703},
+    {8192, -10703, 8192, -4433},
+};
+constexpr int16_t kIdct2[2][2] = {
+    {8192, 8192},
+    {8192, -8192},
+};
+
+template <int N>
+void idctReducedPass(const int32_t *in, int32_t *out, const int16_t (*table)[N], int shift, int32_t add) {
+  for (int lane = 0; lane < N; ++lane) {
+    for (int n = 0; n < N; ++n) {
+      int32_t acc = add;
+      for (int u = 0; u < N; ++u) { acc += in[u * 8 + lane] * table[n][u]; }
+      out[lane * 8 + n] = acc >> shift;
+    }
+  }
+}
+
+inline uint8_t clampSample(int32_t v) {
+  return static_cast<uint8_t>(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// Coefficients and pass-1 results of 8-bit images stay well inside 16 bits.
+// Damaged data can hold anything; clamped to 16 bits, neither pass can
+// overflow 32 bits.
+constexpr int32_t kMaxCoefficient = 32767;
+
+inline int32_t clampCoefficient(int32_t v) {
+  return v < -kMaxCoefficient ? -kMaxCoefficient : v > kMaxCoefficient ? kMaxCoefficient : v;
+}
+
+void clampPass1(int32_t *ws, int size) {
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) { ws[y * 8 + x] = clampCoefficient(ws[y * 8 + x]); }
+  }
+}
+
+// Dequantised coefficients (natural order) -> size x size samples at dst.
+// last is the highest zigzag index that may be non-zero.
+void idctBlock(const int32_t *coef, int last, int size, uint8_t *dst, int stride) {
+  if (last == 0 || size == 1) {
+    const uint8_t v = clampSample(((coef[0] + 4) >> 3) + 128);
+    for (int y = 0; y < size; ++y) { memset(dst + y * stride, v, size); }
+    return;
+  }
+  int32_t ws[64], px[64];
+  if (size == 8) {
+    idctPass(coef, ws, kIdctPass1Shift, kIdctPass1Add);
+    clampPass1(ws, size);
+    idctPass(ws, px, kIdctPass2Shift, kIdctPass2Add);
+  } else if (size == 4) {
+    idctReducedPass<4>(coef, ws, kIdct4, kIdctPass1Shift, kIdctPass1Add);
+    clampPass1(ws, size);
+    idctReducedPass<4>(ws, px, kIdct4, kIdctPass2Shift, kIdctPass2Add);
+  } else {
+    idctReducedPass<2>(coef, ws, kIdct2, kIdctPass1Shift, kIdctPass1Add);
+    clampPass1(ws, size);
+    idctReducedPass<2>(ws, px, kIdct2, kIdctPass2Shift, kIdctPass2Add);
+  }
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) { dst[y * stride + x] = clampSample(px[y * 8 + x]); }
+  }
+}
+
+// Entropy-coded data: byte stuffing removed, stops at the next marker
+class JpegBits {
+ public:
+  explicit JpegBits(ESP32S3BoxLiteImageSource &src) : src_(src) {}
+
+  int decode(const JpegHuffman &t) {
+    fill();
+    const uint16_t e = t.fast[buf_ >> (32 - kHuffFastBits)];
+    if (e != 0) {
+      consume(e >> 8);
+      return e & 0xFF;
+    }
+    for (int len = kHuffFastBits + 1; len <= 16; ++len) {
+      const auto code = static_cast<int32_t>(buf_ >> (32 - len));
+      if (code <= t.maxCode[len]) {
+        consume(len);
+        return t.symbols[code + t.delta[len]];
+      }
+    }
+    bad_ = true;
+    return 0;
+  }
+  // Next s bits as a signed coefficient (JPEG "receive and extend")
+  int32_t receive(int s) {
+    if (s == 0) { return 0; }
+    fill();
+    auto v = static_cast<int32_t>(buf_ >> (32 - s));
+    consume(s);
+    return v < (1 << (s - 1)) ? v - (1 << s) + 1 : v;
+  }
+  // Skips to just past the next RSTn marker
+  void restart() {
+    buf_  = 0;
+    bits_ = 0;
+    while (marker_ < 0) {
+      const int b = src_.read();
+      if (b < 0) {
+        bad_ = true;
+        return;
+      }
+      if (b == 0xFF) { marker_ = nextMarkerByte(); }
+      if (marker_ == 0) { marker_ = -1; }  // stuffed byte
+    }
+    if (marker_ >= 0xD0 && marker_ <= 0xD7) { marker_ = -1; }
+  }
+  bool bad() const { return bad_; }
+
+ private:
+  int nextMarkerByte() {
+    int b;
+    do { b = src_.read(); } while (b == 0xFF);
+    if (b < 0) { bad_ = true; }
+    return b < 0 ? 0xD9 : b;
+  }
+  void fill() {
+    while (bits_ <= 24) {
+      int b = 0;
+      if (marker_ < 0) {
+        b = src_.read();
+        if (b < 0) {
+          bad_    = true;
+          marker_ = 0xD9;
+          b       = 0;
+        } else if (b == 0xFF) {
+          const int m = nextMarkerByte();
+          if (m != 0) {
+            marker_ = m;
+            b       = 0;
+          }
+        }
+      }
+      buf_ |= static_cast<uint32_t>(b) << (24 - bits_);
+      bits_ += 8;
+    }
+  }
+  void consume(int n) {
+    buf_ <<= n;
+    bits_ -= n;
+  }
+
+  ESP32S3BoxLiteImageSource &src_;
+  uint32_t buf_    = 0;  // next bit in bit 31
+  int      bits_   = 0;
+  int      marker_ = -1;  // marker that ended the data, -1 while in data
+  bool     bad_    = false;
+};
+
+struct JpegComponent {
+  uint8_t id, h, v, tq, td, ta;
+  int32_t pred;
+  uint8_t plane[16 * 16];  // one MCU of samples, stride 16
+};
+
+class JpegDecoder {
+ public:
+  JpegDecoder(ESP32S3BoxLiteImageSource &src, ImageSink &sink, uint8_t shrink)
+      : src_(src), sink_(sink), shrink_(shrink == 2 || shrink == 4 || shrink == 8 ? shrink : 1) {}
+  ~JpegDecoder() {
+    heap_caps_free(tables_);
+    heap_caps_free(strip_);
+  }
+
+  bool run(int marker) {
+    tables_ = static_cast<JpegTables *>(allocInternalFirst(sizeof(JpegTables)));
+    if (tables_ == nullptr) { return false; }
+    memset(tables_, 0, sizeof(JpegTables));
+    for (;;) {
+      if (marker == 0xC0 || marker == 0xC1) {
+        if (!readFrame()) { return false; }
+      } else if (marker == 0xC4) {
+        if (!readHuffman()) { return false; }
+      } else if (marker == 0xDB) {
+        if (!readQuant()) { return false; }
+      } else if (marker == 0xDD) {
+        uint8_t b[4];
+        if (src_.read(b, 4) != 4) { return false; }
+        restartInterval_ = static_cast<uint16_t>((b[2] << 8) | b[3]);
+      } else if (marker == 0xDA) {
+        return readScan() && decodeScan();
+      } else if ((marker >= 0xC2 && marker <= 0xCF) || marker == 0xD9) {
+        return false;  // progressive, lossless, arithmetic, or no image
+      } else if (!skipSegment()) {
+        return false;
+      }
+      // Next marker; fill bytes are allowed before it
+      int b = src_.read();
+      if (b != 0xFF) { return false; }
+      while (b == 0xFF) { b = src_.read(); }
+      if (b < 0) { return false; }
+      marker = b;
+    }
+  }
+
+ private:
+  static void *allocInternalFirst(size_t bytes) {
+    void *p = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return p != nullptr ? p : heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+  }
+
+  // Segment payload length, after the length field itself
+  int32_t segmentLength() {
+    const int hi = src_.read(), lo = src_.read();
+    if (lo < 0) { return -1; }
+    return ((hi << 8) | lo) - 2;
+  }
+  bool skipSegment() {
+    const int32_t len = segmentLength();
+    return len >= 0 && src_.skip(static_cast<uint32_t>(len));
+  }
+
+  bool readQuant() {
+    int32_t len = segmentLength();
+    while (len > 0) {
+      const int pq = src_.read();
+      if (pq < 0 || (pq & 0x0F) > 3 || (pq >> 4) > 1) { return false; }
+      uint16_t *q = tables_->quant[pq & 0x0F];
+      for (int i = 0; i < 64; ++i) {
+        int v = src_.read();
+        if (pq >> 4) { v = (v << 8) | src_.read(); }
+        if (v < 0) { return false; }
+        q[i] = static_cast<uint16_t>(v);
+      }
+      len -= 1 + ((pq >> 4) ? 128 : 64);
+    }
+    return len == 0;
+  }
+
+  bool readHuffman() {
+    int32_t len = segmentLength();
+    while (len > 0) {
+      uint8_t head[17];
+      if (src_.read(head, sizeof(head)) != sizeof(head)) { return false; }
+      const int tc = head[0] >> 4, th = head[0] & 0x0F;
+      int       total = 0;
+      for (int i = 1; i <= 16; ++i) { total += head[i]; }
+      uint8_t symbols[256];
+      if (tc > 1 || th > 1 || total > 256 || src_.read(symbols, total) != static_cast<size_t>(total)) {
+        return false;
+      }
+      JpegHuffman &t = tc == 0 ? tables_->dc[th] : tables_->ac[th];
+      if (!buildHuffman(t, head + 1, symbols, total)) { return false; }
+      len -= 17 + total;
+    }
+    return len == 0;
+  }
+
+  bool readFrame() {
+    uint8_t h[6];
+    if (segmentLength() < 6 || src_.read(h, sizeof(h)) != sizeof(h)) { return false; }
+    height_     = static_cast<uint16_t>((h[1] << 8) | h[2]);
+    width_      = static_cast<uint16_t>((h[3] << 8) | h[4]);
+    compCount_  = h[5];
+    if (h[0] != 8 || width_ == 0 || height_ == 0 || (compCount_ != 1 && compCount_ != 3)) { return false; }
+    hMax_ = vMax_ = 1;
+    for (int i = 0; i < compCount_; ++i) {
+      uint8_t c[3];
+      if (src_.read(c, sizeof(c)) != sizeof(c)) { return false; }
+      JpegComponent &comp = comps_[i];
+      comp.id = c[0];
+      comp.h  = c[1] >> 4;
+      comp.v  = c[1] & 0x0F;
+      comp.tq = c[2] & 0x03;
+      if (comp.h < 1 || comp.h > 2 || comp.v < 1 || comp.v > 2) { return false; }
+      hMax_ = std::max(hMax_, comp.h);
+      vMax_ = std::max(vMax_, comp.v);
+    }
+    if (compCount_ == 1) { comps_[0].h = comps_[0].v = hMax_ = vMax_ = 1; }  // non-interleaved: 8x8 units
+    // Luma at full resolution; only chroma may be subsampled
+    return comps_[0].h == hMax_ && comps_[0].v == vMax_;
+  }
+
+  bool readScan() {
+    if (compCount_ == 0 || segmentLength() < 0) { return false; }
+    const int count = src_.read();
+    if (count != compCount_) { return false; }  // every component in one scan
+    for (int i = 0; i < count; ++i) {
+      uint8_t c[2];
+      if (src_.read(c, sizeof(c)) != sizeof(c)) { return false; }
+      JpegComponent *comp = nullptr;
+      for (int j = 0; j < compCount_; ++j) {
+        if (comps_[j].id == c[0]) { comp = &comps_[j]; }
+      }
+      if (comp == nullptr) { return false; }
+      comp->td = (c[1] >> 4) & 1;
+      comp->ta = c[1] & 1;
+      if (!tables_->dc[comp->td].present || !tables_->ac[comp->ta].present) { return false; }
+    }
+    return src_.skip(3);  // spectral selection and approximation: fixed in baseline
+  }
+
+  // One block into natural order, dequantised and clamped; returns the
+  // highest zigzag index that may be non-zero. A 15-bit value times a 16-bit
+  // quantiser still fits 32 bits.
+  int decodeBlock(JpegBits &bits, JpegComponent &comp, int32_t *coef) {
+    const uint16_t    *q  = tables_->quant[comp.tq];
+    const JpegHuffman &ac = tables_->ac[comp.ta];
+    memset(coef, 0, 64 * sizeof(int32_t));
+    comp.pred = clampCoefficient(comp.pred + bits.receive(bits.decode(tables_->dc[comp.td]) & 0x0F));
+    coef[0]   = clampCoefficient(comp.pred * q[0]);
+    int last  = 0;
+    for (int k = 1; k < 64;) {
+      const int rs = bits.decode(ac);
+      const int s  = rs & 0x0F;
+      if (s == 0) {
+        if (rs != 0xF0) { break; }  // end of block
+        k += 16;
+        continue;
+      }
+      k += rs >> 4;
+      if (k > 63) { break; }
+      coef[kZigzag[k]] = clampCoefficient(bits.receive(s) * q[k]);
+      last             = k;
+      ++k;
+    }
+    return last;
+  }
+
+  bool decodeScan() {
+    const int32_t outW = (width_ + shrink_ - 1) / shrink_;
+    const int32_t outH = (height_ + shrink_ - 1) / shrink_;
+    if (!sink_.begin(outW, outH)) { return true; }
+
+    const int     size    = 8 / shrink_;  // block edge after scaling
+    const int32_t mcuW    = size * hMax_, mcuH = size * vMax_;
+    const int32_t mcusX   = (width_ + 8 * hMax_ - 1) / (8 * hMax_);
+    const int32_t mcusY   = (height_ + 8 * vMax_ - 1) / (8 * vMax_);
+    const int32_t stripW  = sink_.x1 - sink_.x0;
+    strip_ = static_cast<uint16_t *>(allocInternalFirst(static_cast<size_t>(stripW) * mcuH * 2U));
+    if (strip_ == nullptr) { return false; }
+
+    JpegBits bits(src_);
+    int32_t  coef[64];
+    uint16_t toGo = restartInterval_;
+    for (int32_t my = 0; my < mcusY; ++my) {
+      const int32_t top = my * mcuH;
+      if (top >= sink_.y1) { break; }
+      const bool rowVisible = top + mcuH > sink_.y0;
+      for (int32_t mx = 0; mx < mcusX; ++mx) {
+        if (restartInterval_ != 0) {
+          if (toGo == 0) {
+            bits.restart();
+            for (int i = 0; i < compCount_; ++i) { comps_[i].pred = 0; }
+            toGo = restartInterval_;
+          }
+          --toGo;
+        }
+        const int32_t left    = mx * mcuW;
+        const bool    visible = rowVisible && left < sink_.x1 && left + mcuW > sink_.x0;
+        for (int i = 0; i < compCount_; ++i) {
+          JpegComponent &comp = comps_[i];
+          for (int by = 0; by < comp.v; ++by) {
+            for (int bx = 0; bx < comp.h; ++bx) {
+              const int last = decodeBlock(bits, comp, coef);
+              if (visible) { idctBlock(coef, last, size, comp.plane + by * size * 16 + bx * size, 16); }
+            }
+          }
+        }
+        if (visible) { convertMcu(left, mcuW, mcuH); }
+      }
+      if (bits.bad()) { return false; }
+      if (rowVisible) { emitStrip(top, mcuH, outH); }
+    }
+    return true;
+  }
+
+  // YCbCr -> RGB565 into the strip, chroma replicated over 2x2, 2x1 or 1x2
+  void convertMcu(int32_t left, int32_t mcuW, int32_t mcuH) {
+    const int32_t  x0 = std::max(left, sink_.x0), x1 = std::min(left + mcuW, sink_.x1);
+    const int32_t  stripW = sink_.x1 - sink_.x0;
+    const uint8_t *yp = comps_[0].plane;
+    if (compCount_ == 1) {
+      for (int32_t py = 0; py < mcuH; ++py) {
+        uint16_t *dst = strip_ + py * stripW - sink_.x0;
+        for (int32_t x = x0; x < x1; ++x) {
+          const uint8_t v = yp[py * 16 + x - left];
+          dst[x] = rgbTo565(v, v, v);
+        }
+      }
+      return;
+    }
+    const JpegComponent &cb = comps_[1], &cr = comps_[2];
+    const int cbxs = hMax_ / cb.h - 1, cbys = vMax_ / cb.v - 1;  // 0 or 1: shift into the chroma plane
+    const int crxs = hMax_ / cr.h - 1, crys = vMax_ / cr.v - 1;
+    for (int32_t py = 0; py < mcuH; ++py) {
+      uint16_t      *dst = strip_ + py * stripW - sink_.x0;
+      const uint8_t *cbRow = cb.plane + (py >> cbys) * 16;
+      const uint8_t *crRow = cr.plane + (py >> crys) * 16;
+      for (int32_t x = x0; x < x1; ++x) {
+        const int32_t px = x - left;
+        const int32_t Y  = yp[py * 16 + px];
+        const int32_t u  = cbRow[px >> cbxs] - 128;
+        const int32_t v  = crRow[px >> crxs] - 128;
+        // ITU-R BT.601 full range, 16 fraction bits
+        dst[x] = rgbTo565(clampSample(Y + ((91881 * v + 32768) >> 16)),
+                          clampSample(Y - ((22554 * u + 46802 * v - 32768) >> 16)),
+                          clampSample(Y + ((116130 * u + 32768) >> 16)));
+      }
+    }
+  }
+
+  void emitStrip(int32_t top, int32_t mcuH, int32_t outH) {
+    const int32_t stripW = sink_.x1 - sink_.x0;
+    for (int32_t py = 0; py < mcuH; ++py) {
+      const int32_t y = top + py;
+      if (y < sink_.y0) { continue; }
+      if (y >= sink_.y1 || y >= outH) { break; }
+      for (int32_t x = sink_.x0; x < sink_.x1; x += kImageSpan) {
+        sink_.span(x, y, strip_ + py * stripW + (x - sink_.x0), std::min<int32_t>(kImageSpan, sink_.x1 - x));
+      }
+    }
+  }
+
+  ESP32S3BoxLiteImageSource &src_;
+  ImageSink                 &sink_;
+  uint8_t                    shrink_;
+  JpegTables                *tables_ = nullptr;
+  uint16_t                  *strip_  = nullptr;
+  JpegComponent              comps_[3] = {};
+  uint8_t                    compCount_ = 0;
+  uint8_t                    hMax_ = 1, vMax_ = 1;
+  uint16_t                   width_ = 0, height_ = 0;
+  uint16_t                   restartInterval_ = 0;
+};
+
+// Picks the decoder from the first bytes of src
+bool decodeImage(ESP32S3BoxLiteImageSource &src, ImageSink &sink, uint8_t shrink) {
+  uint8_t magic[4];
+  if (src.read(magic, sizeof(magic)) != sizeof(magic)) { return false; }
+  if (magic[0] == 0xFF && magic[1] == 0xD8 && magic[2] == 0xFF) {
+    JpegDecoder jpeg(src, sink, shrink);
+    return jpeg.run(magic[3]);
+  }
+  if (magic[0] == 'B' && magic[1] == 'M') { return decodeBmp(src, sink); }
+  if (memcmp(magic, "qoif", 4) == 0) { return decodeQoi(src, sink); }
+  if (memcmp(magic, "R565", 4) == 0) { return decodeRle(src, sink); }
+  return false;
+}
+
+// Streams spans into the panel. A window runs from the span's start to the
+// visible right and bottom edges, so a top-down image is one window; a span
+// that skips pixels (bottom-up rows, transparent runs) opens a new one.
+class DisplayImageSink : public ImageSink {
+ public:
+  DisplayImageSink(ESP32S3BoxLiteDisplay &disp, int32_t x, int32_t y) : disp_(disp), ox_(x), oy_(y) {}
+
+  bool begin(int32_t w, int32_t h) override {
+    const ESP32S3BoxLiteClipRect &clip = disp_.clipBounds();
+    x0 = std::max<int32_t>(0, clip.x0 - ox_);
+    y0 = std::max<int32_t>(0, clip.y0 - oy_);
+    x1 = std::min<int32_t>(w, clip.x1 - ox_);
+    y1 = std::min<int32_t>(h, clip.y1 - oy_);
+    return x0 < x1 && y0 < y1;
+  }
+  void span(int32_t x, int32_t y, const uint16_t *px, int32_t n) override {
+    if (x != nextX_ || y != nextY_) {
+      disp_.setAddressWindowPublic(static_cast<uint16_t>(ox_ + x), static_cast<uint16_t>(oy_ + y),
+                                   static_cast<uint16_t>(ox_ + x1 - 1), static_cast<uint16_t>(oy_ + y1 - 1));
+      winX_ = x;
+    }
+    uint16_t wire[kImageSpan];
+    for (int32_t i = 0; i < n; ++i) { wire[i] = swap565(px[i]); }
+    disp_.pushPixels(reinterpret_cast<const uint8_t *>(wire), static_cast<size_t>(n) * 2U);
+    nextX_ = x + n;
+    nextY_ = y;
+    if (nextX_ == x1) {
+      nextX_ = winX_;
+      ++nextY_;
+    }
+  }
+  void end() override { disp_.endPixels(); }
+
+ private:
+  ESP32S3BoxLiteDisplay &disp_;
+  int32_t ox_, oy_;
+  int32_t winX_ = 0;
+  int32_t nextX_ = -1, nextY_ = -1;
+};
+
 // ---------------------------------------------------------------------------
-// WAV file write helper for SPIFFS (Phase 5)
+// Pixel conversion
 // ---------------------------------------------------------------------------
 
-bool writeWavFile(File &f, const int16_t *samples, size_t count, uint32_t sampleRate) {
-  const uint32_t dataBytes = static_cast<uint32_t>(count) * 2U;
-  const uint32_t riffSize  = 36U + dataBytes;
+// Byte offsets of r, g and b in a source pixel of Step bytes
+template <uint8_t Step, uint8_t R, uint8_t G, uint8_t B>
+struct PixelLayout {
+  static constexpr uint8_t kStep = Step, kR = R, kG = G, kB = B;
+};
 
-  // RIFF header
-  const uint8_t riff[] = {'R', 'I', 'F', 'F'};
-  f.write(riff, 4);
-  uint8_t size4[4];
-  size4[0] = riffSize & 0xFF;
-  size4[1] = (riffSize >> 8) & 0xFF;
-  size4[2] = (riffSize >> 16) & 0xFF;
-  size4[3] = (riffSize >> 24) & 0xFF;
-  f.write(size4, 4);
-  const uint8_t wave[] = {'W', 'A', 'V', 'E'};
-  f.write(wave, 4);
+constexpr uint8_t kBayer4[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
 
-  // fmt chunk
-  const uint8_t fmt[] = {'f', 'm', 't', ' '};
-  f.write(fmt, 4);
-  // chunk size = 16
-  const uint8_t fmtSize[] = {16, 0, 0, 0};
-  f.write(fmtSize, 4);
-  // PCM = 1
+// Bytes are stored one at a time, so `wire` needs no alignment
+inline void putWire(uint8_t *wire, uint32_t r, uint32_t g, uint32_t b) {
+  wire[0] = static_cast<uint8_t>((r & 0xF8) | (g >> 5));
+  wire[1] = static_cast<uint8_t>(((g << 3) & 0xE0) | (b >> 3));
+}
+
+// Pixels are independent and the layout is a constant, so the loop unrolls
+// and vectorises
+template <class L>
+void convertTruncate(const uint8_t *src, uint8_t *wire, uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i, src += L::kStep, wire += 2) {
+    putWire(wire, src[L::kR], src[L::kG], src[L::kB]);
+  }
+}
+
+// Adds a threshold below one step of each channel's 5 or 6 bits before
+// truncating, so the average over a 4x4 cell matches the input
+template <class L>
+void convertOrdered(const uint8_t *src, uint8_t *wire, uint32_t count, uint32_t x, uint32_t y) {
+  const uint8_t *t = kBayer4[y & 3];
+  for (uint32_t i = 0; i < count; ++i, src += L::kStep, wire += 2) {
+    const uint32_t d = t[(x + i) & 3];
+    putWire(wire, std::min<uint32_t>(src[L::kR] + (d >> 1), 255), std::min<uint32_t>(src[L::kG] + (d >> 2), 255),
+            std::min<uint32_t>(src[L::kB] + (d >> 1), 255));
+  }
+}
+
+// Floyd-Steinberg without serpentine order. err[c][p + 1] holds the error
+// coming into pixel p from the row above; the entry of the pixel below-left
+// is rewritten for the next row once its last contributor is known, so one
+// row per channel is enough. Errors are in 1/16 units; returns the level.
+template <uint8_t Bits>
+inline uint32_t diffuseChannel(uint32_t in, int16_t *err, int16_t &carry, int16_t (&below)[2], uint32_t x) {
+  const int32_t v     = static_cast<int32_t>(in) + ((err[x + 1] + carry + 8) >> 4);
+  const int32_t q     = std::min<int32_t>(std::max<int32_t>(v, 0), 255);
+  const int32_t level = q >> (8 - Bits);
+  const int32_t e     = q - ((level << (8 - Bits)) | (level >> (2 * Bits - 8)));
+  carry    = static_cast<int16_t>(7 * e);
+  err[x]   = static_cast<int16_t>(below[0] + 3 * e);
+  below[0] = static_cast<int16_t>(below[1] + 5 * e);
+  below[1] = static_cast<int16_t>(e);
+  return static_cast<uint32_t>(level);
+}
+
+template <class L>
+void convertDiffusion(const uint8_t *src, uint8_t *wire, uint32_t count, uint32_t x, int16_t *err, uint32_t errStride,
+                      int16_t (&carry)[3], int16_t (&below)[3][2]) {
+  for (uint32_t i = 0; i < count; ++i, src += L::kStep, wire += 2) {
+    const uint32_t r = diffuseChannel<5>(src[L::kR], err, carry[0], below[0], x + i);
+    const uint32_t g = diffuseChannel<6>(src[L::kG], err + errStride, carry[1], below[1], x + i);
+    const uint32_t b = diffuseChannel<5>(src[L::kB], err + 2 * errStride, carry[2], below[2], x + i);
+    wire[0] = static_cast<uint8_t>((r << 3) | (g >> 3));
+    wire[1] = static_cast<uint8_t>(((g & 7) << 5) | b);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// GIF decoding
+// ---------------------------------------------------------------------------
+
+constexpr uint16_t kGifMaxCodes = 4096;  // 12-bit LZW codes
+constexpr uint8_t  kGifPassStart[4] = {0, 4, 2, 1};
+constexpr uint8_t  kGifPassStep[4]  = {8, 8, 4, 2};
+
+// Reads one sub-block, keeping up to cap bytes of it; returns its length (0
+// for the terminator) or -1 when the data ends
+int32_t readGifSubBlock(ESP32S3BoxLiteImageSource &src, uint8_t *buf, size_t cap) {
+  const int n = src.read();
+  if (n < 0) { return -1; }
+  const size_t keep = std::min<size_t>(static_cast<size_t>(n), cap);
+  if (src.read(buf, keep) != keep || !src.skip(static_cast<uint32_t>(n - keep))) { return -1; }
+  return n;
+}
+
+bool skipGifSubBlocks(ESP32S3BoxLiteImageSource &src) {
+  for (;;) {
+    const int n = src.read();
+    if (n <= 0) { return n == 0; }
+    if (!src.skip(static_cast<uint32_t>(n))) { return false; }
+  }
+}
+
+// Where one frame's pixels go: the coded size, and the part of it inside the
+// logical screen at (x, y) there
+struct GifFrame {
+  uint16_t       codedW, codedH;
+  int32_t        x, y, w, h;
+  bool           interlaced;
+  int16_t        transparent;  // -1 for none
+  const uint16_t *palette;     // 256 entries
+  uint16_t       *canvas;      // logical screen, or nullptr
+  int32_t        canvasW;
+  bool           keep;         // write the frame into the canvas
+};
+
+// Expands one frame's LZW codes, read straight from the sub-blocks, into a
+// line of palette indices and sends each finished row as spans. Transparent
+// pixels are taken from the canvas, or skipped when there is none.
+class GifFrameDecoder {
+ public:
+  GifFrameDecoder(ESP32S3BoxLiteImageSource &src, ImageSink &sink, bool visible, const GifFrame &f,
+                  uint16_t *prefix, uint8_t *suffix, uint8_t *stack, uint8_t *line)
+      : src_(src), sink_(sink), visible_(visible), f_(f), prefix_(prefix), suffix_(suffix), stack_(stack),
+        line_(line) {}
+
+  bool run() {
+    const int minSize = src_.read();
+    if (minSize < 1 || minSize > 8) { return false; }
+    if (f_.codedW == 0 || f_.codedH == 0) { return skipGifSubBlocks(src_); }
+
+    const uint16_t clear = static_cast<uint16_t>(1U << minSize);
+    for (uint16_t i = 0; i < clear; ++i) { suffix_[i] = static_cast<uint8_t>(i); }
+    uint8_t  size = static_cast<uint8_t>(minSize + 1);
+    uint16_t next = clear + 2;
+    int32_t  old = -1;
+    uint8_t  first = 0;
+    uint32_t bits = 0;
+    uint8_t  bitCount = 0;
+    int      blockLeft = 0;
+
+    for (;;) {
+      while (bitCount < size) {
+        if (blockLeft == 0) {
+          blockLeft = src_.read();
+          if (blockLeft < 0) { return false; }
+          // Data ended before the end code; the missing rows stay as they were
+          if (blockLeft == 0) { return true; }
+        }
+        const int b = src_.read();
+        if (b < 0) { return false; }
+        bits |= static_cast<uint32_t>(b) << bitCount;
+        bitCount += 8;
+        --blockLeft;
+      }
+      uint16_t code = static_cast<uint16_t>(bits & ((1U << size) - 1));
+      bits >>= size;
+      bitCount -= size;
+
+      if (code == clear) {
+        size = static_cast<uint8_t>(minSize + 1);
+        next = clear + 2;
+        old  = -1;
+        continue;
+      }
+      if (code == clear + 1) { break; }
+
+      const uint16_t in = code;
+      uint16_t sp = 0;
+      if (old < 0) {
+        if (code >= clear) { return false; }
+        first = static_cast<uint8_t>(code);
+        stack_[sp++] = first;
+      } else {
+        if (code > next) { return false; }
+        // The code being defined: the previous string plus its own first index
+        if (code == next) {
+          stack_[sp++] = first;
+          code = static_cast<uint16_t>(old);
+        }
+        while (code >= clear) {
+          if (sp == kGifMaxCodes - 1) { return false; }
+          stack_[sp++] = suffix_[code];
+          code = prefix_[code];
+        }
+        first = static_cast<uint8_t>(code);
+        stack_[sp++] = first;
+        if (next < kGifMaxCodes) {
+          prefix_[next] = static_cast<uint16_t>(old);
+          suffix_[next] = first;
+          if (++next == (1U << size) && size < 12) { ++size; }
+        }
+      }
+      old = in;
+      while (sp > 0) {
+        if (!put(stack_[--sp])) { return src_.skip(static_cast<uint32_t>(blockLeft)) && skipGifSubBlocks(src_); }
+      }
+    }
+    return src_.skip(static_cast<uint32_t>(blockLeft)) && skipGifSubBlocks(src_);
+  }
+
+ private:
+  // False once every row is in
+  bool put(uint8_t index) {
+    if (x_ < f_.w) { line_[x_] = index; }
+    if (++x_ < f_.codedW) { return true; }
+    x_ = 0;
+    if (row_ < f_.h) { emitRow(); }
+    if (!f_.interlaced) { return ++row_ < f_.codedH; }
+    row_ += kGifPassStep[pass_];
+    while (row_ >= f_.codedH) {
+      if (++pass_ == 4) { return false; }
+      row_ = kGifPassStart[pass_];
+    }
+    return true;
+  }
+
+  void emitRow() {
+    uint16_t *canvas = f_.canvas != nullptr ? f_.canvas + (f_.y + row_) * f_.canvasW + f_.x : nullptr;
+    const bool show = visible_ && row_ >= sink_.y0 && row_ < sink_.y1;
+    uint16_t px[kImageSpan];
+    int32_t  n = 0, start = 0;
+    for (int32_t x = 0; x < f_.w; ++x) {
+      const uint8_t index = line_[x];
+      uint16_t c;
+      if (index == f_.transparent) {
+        if (canvas == nullptr) {
+          flush(px, n, start);
+          continue;
+        }
+        c = canvas[x];
+      } else {
+        c = f_.palette[index];
+        if (f_.keep) { canvas[x] = c; }
+      }
+      if (!show || x < sink_.x0 || x >= sink_.x1) { continue; }
+      if (n == 0) { start = x; }
+      px[n++] = c;
+      if (n == kImageSpan) { flush(px, n, start); }
+    }
+    flush(px, n, start);
+  }
+
+  void flush(const uint16_t *px, int32_t &n, int32_t start) {
+    if (n > 0) {
+      sink_.span(start, row_, px, n);
+      n = 0;
+    }
+  }
+
+  ESP32S3BoxLiteImageSource &src_;
+  ImageSink                 &sink_;
+  bool                       visible_;
+  const GifFrame            &f_;
+  uint16_t                  *prefix_;
+  uint8_t                   *suffix_;
+  uint8_t                   *stack_;
+  uint8_t                   *line_;
+  int32_t                    x_ = 0, row_ = 0;
+  uint8_t                    pass_ = 0;
+};
+
+// ---------------------------------------------------------------------------
+// WAV header parsing helpers (Phase 4)
+// ---------------------------------------------------------------------------
+
+struct WavHeader {
+  uint32_t sampleRate;
+  uint16_t numChannels;
+  uint16_t bitsPerSample;
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  bool     valid;
+};
+
+WavHeader parseWavHeader(const uint8_t *data, size_t len) {
+  WavHeader h{};
+  if (len < 44) {
+    return h;
+  }
+  // Check RIFF
+  if (data[0] != 'R' || data[1] != 'I' || data[2] != 'F' || data[3] != 'F') {
+    return h;
+  }
+  // Check WAVE
+  if (data[8] != 'W' || data[9] != 'A' || data[10] != 'V' || data[11] != 'E') {
+    return h;
+  }
+
+  // Scan for fmt  and data chunks
+  size_t offset = 12;
+  bool fmtFound = false;
+  bool dataFound = false;
+
+  while (offset + 8 <= len) {
+    uint32_t chunkId = (uint32_t)data[offset] | ((uint32_t)data[offset + 1] << 8) |
+                       ((uint32_t)data[offset + 2] << 16) | ((uint32_t)data[offset + 3] << 24);
+    uint32_t chunkSize = (uint32_t)data[offset + 4] | ((uint32_t)data[offset + 5] << 8) |
+                         ((uint32_t)data[offset + 6] << 16) | ((uint32_t)data[offset + 7] << 24);
+
+    // "fmt "
+    if (chunkId == 0x20746D66u) {
+      if (offset + 8 + 16 > len) {
+        break;
+      }
+      // audioFormat = data[offset+8] | data[offset+9]<<8  (should be 1 for PCM)
+      h.numChannels  = (uint16_t)data[offset + 10] | ((uint16_t)data[offset + 11] << 8);
+      h.sampleRate   = (uint32_t)data[offset + 12] | ((uint32_t)data[offset + 13] << 8) |
+                       ((uint32_t)data[offset + 14] << 16) | ((uint32_t)data[offset + 15] << 24);
+      h.bitsPerSample = (uint16_t)data[offset + 22] | ((uint16_t)data[offset + 23] << 8);
+      fmtFound = true;
+    }
+    // "data"
+    else if (chunkId == 0x61746164u) {
+      h.dataOffset = static_cast<uint32_t>(offset + 8);
+      h.dataSize   = chunkSize;
+      dataFound = true;
+    }
+
+    offset += 8 + chunkSize;
+    // Align to 2-byte boundary
+    if (chunkSize & 1) {
+      offset++;
+    }
+  }
+
+  h.valid = fmtFound && dataFound;
+  return h;
+}
+
+// ---------------------------------------------------------------------------
+// WAV file write helper for SPIFFS (Phase 5)
+// ---------------------------------------------------------------------------
+
+bool writeWavFile(File &f, const int16_t *samples, size_t count, uint32_t sampleRate) {
+  const uint32_t dataBytes = static_cast<uint32_t>(count) * 2U;
+  const uint32_t riffSize  = 36U + dataBytes;
+
+  // RIFF header
+  const uint8_t riff[] = {'R', 'I', 'F', 'F'};
+  f.write(riff, 4);
+  uint8_t size4[4];
+  size4[0] = riffSize & 0xFF;
+  size4[1] = (riffSize >> 8) & 0xFF;
+  size4[2] = (riffSize >> 16) & 0xFF;
+  size4[3] = (riffSize >> 24) & 0xFF;
+  f.write(size4, 4);
+  const uint8_t wave[] = {'W', 'A', 'V', 'E'};
+  f.write(wave, 4);
+
+  // fmt chunk
+  const uint8_t fmt[] = {'f', 'm', 't', ' '};
+  f.write(fmt, 4);
+  // chunk size = 16
+  const uint8_t fmtSize[] = {16, 0, 0, 0};
+  f.write(fmtSize, 4);
+  // PCM = 1
   const uint8_t audioFmt[] = {1, 0};
   f.write(audioFmt, 2);
   // channels = 1 (mono)
@@ -309,610 +2505,4229 @@ bool writeWavFile(File &f, const int16_t *samples, size_t count, uint32_t sample
   ds[3] = (dataBytes >> 24) & 0xFF;
   f.write(ds, 4);
 
-  // PCM samples
-  f.write(reinterpret_cast<const uint8_t *>(samples), dataBytes);
-  return true;
+  // PCM samples
+  f.write(reinterpret_cast<const uint8_t *>(samples), dataBytes);
+  return true;
+}
+
+}  // namespace
+
+// ===========================================================================
+// ESP32S3BoxLiteSpiBus
+// ===========================================================================
+
+// Ring of in-flight SPI transactions plus two DMA-capable line buffers.
+// Transactions complete in the order they were queued, so `queued` and `done`
+// are running sequence numbers and a slot or buffer is free once `done` has
+// caught up with the sequence number that last used it.
+struct ESP32S3BoxLiteSpiBus::Queue {
+  spi_device_handle_t device = nullptr;
+  spi_transaction_t   ring[kLcdQueueDepth] = {};
+  uint32_t queued = 0;
+  uint32_t done   = 0;
+  ESP32S3BoxLiteBusStats *stats = nullptr;
+
+  // Ping-pong line buffers: the CPU fills one while the other is on the wire
+  uint8_t *line[2]    = {nullptr, nullptr};
+  uint32_t lineSeq[2] = {0, 0};
+  uint8_t  active     = 0;
+  size_t   staged     = 0;  // bytes waiting in line[active]
+
+  void reclaimOne() {
+    spi_transaction_t *t = nullptr;
+    spi_device_get_trans_result(device, &t, portMAX_DELAY);
+    ++done;
+  }
+
+  void waitFor(uint32_t seq) {
+    while (static_cast<int32_t>(seq - done) > 0) {
+      reclaimOne();
+    }
+  }
+
+  // Queue one transaction. Payloads of up to 4 bytes are copied inline;
+  // larger payloads must stay valid until the transaction completes.
+  void submit(bool dc, const uint8_t *data, size_t len) {
+    if (queued - done >= static_cast<uint32_t>(kLcdQueueDepth)) {
+      reclaimOne();
+    }
+    spi_transaction_t *t = &ring[queued % kLcdQueueDepth];
+    memset(t, 0, sizeof(*t));
+    t->length = len * 8;
+    t->user   = reinterpret_cast<void *>(static_cast<uintptr_t>(dc ? 1 : 0));
+    if (len <= 4) {
+      t->flags = SPI_TRANS_USE_TXDATA;
+      memcpy(t->tx_data, data, len);
+    } else {
+      t->tx_buffer = data;
+    }
+    spi_device_queue_trans(device, t, portMAX_DELAY);
+    ++queued;
+
+    ++stats->transactions;
+    ++stats->csToggles;
+    stats->bytes += len;
+    if (!dc) {
+      stats->commands += static_cast<uint32_t>(len);
+      if (len == 1 && data[0] == 0x2C) { ++stats->windows; }
+    }
+  }
+
+  // Send whatever is staged in the active line buffer and switch buffers
+  void submitStaged() {
+    if (staged == 0) { return; }
+    submit(true, line[active], staged);
+    lineSeq[active] = queued;
+    active ^= 1;
+    staged = 0;
+  }
+
+  // Copy pixel data into the line buffers, queueing each one as it fills
+  void stage(const uint8_t *src, size_t len) {
+    while (len > 0) {
+      if (staged == 0) {
+        waitFor(lineSeq[active]);
+      }
+      const size_t n = std::min(len, kLcdLineBufBytes - staged);
+      memcpy(line[active] + staged, src, n);
+      staged += n;
+      src    += n;
+      len    -= n;
+      if (staged == kLcdLineBufBytes) {
+        submitStaged();
+      }
+    }
+  }
+
+  // Solid fill: one line buffer is filled once and queued repeatedly
+  void fill(uint16_t color, uint32_t count) {
+    submitStaged();
+    uint8_t *buf = line[active];
+    waitFor(lineSeq[active]);
+    const uint32_t cap = std::min<uint32_t>(count, kLcdLineBufBytes / 2);
+    for (uint32_t i = 0; i < cap; ++i) {
+      buf[i * 2]     = color >> 8;
+      buf[i * 2 + 1] = color & 0xFF;
+    }
+    while (count > 0) {
+      const uint32_t chunk = std::min(count, cap);
+      submit(true, buf, chunk * 2);
+      count -= chunk;
+    }
+    lineSeq[active] = queued;
+    active ^= 1;
+  }
+
+  void waitIdle() {
+    submitStaged();
+    waitFor(queued);
+  }
+};
+
+void ESP32S3BoxLiteBus::delayMs(uint32_t ms) {
+  delay(ms);
+}
+
+bool ESP32S3BoxLiteBus::writePixelsInPlace(const uint8_t *data, size_t len) {
+  writePixels(data, len);
+  return false;
+}
+
+bool ESP32S3BoxLiteSpiBus::begin() {
+  pinMode(kLcdDcPin, OUTPUT);
+  pinMode(kLcdRstPin, OUTPUT);
+  digitalWrite(kLcdDcPin, HIGH);
+
+  if (queue_ == nullptr) {
+    Queue *q = new (std::nothrow) Queue();
+    if (q == nullptr) { return false; }
+    q->stats = &stats_;
+    for (auto &buf : q->line) {
+      buf = static_cast<uint8_t *>(heap_caps_malloc(kLcdLineBufBytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+    }
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num     = kLcdMosiPin;
+    bus.miso_io_num     = -1;
+    bus.sclk_io_num     = kLcdClkPin;
+    bus.quadwp_io_num   = -1;
+    bus.quadhd_io_num   = -1;
+    bus.max_transfer_sz = static_cast<int>(kLcdLineBufBytes);
+
+    spi_device_interface_config_t dev = {};
+    dev.mode           = 0;
+    dev.clock_speed_hz = static_cast<int>(ClockHz);
+    dev.spics_io_num   = kLcdCsPin;
+    dev.queue_size     = kLcdQueueDepth;
+    dev.pre_cb         = lcdPreTransfer;
+
+    bool ok = q->line[0] != nullptr && q->line[1] != nullptr;
+    if (ok) {
+      const esp_err_t err = spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO);
+      ok = err == ESP_OK || err == ESP_ERR_INVALID_STATE;
+    }
+    ok = ok && spi_bus_add_device(SPI2_HOST, &dev, &q->device) == ESP_OK;
+    if (!ok) {
+      for (auto &buf : q->line) {
+        if (buf != nullptr) { heap_caps_free(buf); }
+      }
+      delete q;
+      return false;
+    }
+    queue_ = q;
+  }
+
+  digitalWrite(kLcdRstPin, HIGH);
+  delay(50);
+  digitalWrite(kLcdRstPin, LOW);
+  delay(50);
+  digitalWrite(kLcdRstPin, HIGH);
+  delay(150);
+  return true;
+}
+
+void ESP32S3BoxLiteSpiBus::writeCommand(uint8_t command) {
+  if (queue_ == nullptr) { return; }
+  // Pending pixel data must reach the panel before the next command
+  queue_->submitStaged();
+  queue_->submit(false, &command, 1);
+}
+
+void ESP32S3BoxLiteSpiBus::writeData(const uint8_t *data, size_t len) {
+  if (queue_ == nullptr) { return; }
+  if (len <= 4) {
+    queue_->submitStaged();
+    queue_->submit(true, data, len);
+    return;
+  }
+  queue_->stage(data, len);
+  queue_->submitStaged();
+}
+
+void ESP32S3BoxLiteSpiBus::writePixels(const uint8_t *data, size_t len) {
+  if (queue_ == nullptr) { return; }
+  // Copied into the DMA line buffers, so the caller may reuse the data right
+  // away
+  queue_->stage(data, len);
+}
+
+void ESP32S3BoxLiteSpiBus::flushPixels() {
+  if (queue_ != nullptr) {
+    queue_->submitStaged();
+  }
+}
+
+bool ESP32S3BoxLiteSpiBus::writePixelsInPlace(const uint8_t *data, size_t len) {
+  if (queue_ == nullptr) { return false; }
+  // DMA reads word-aligned internal RAM directly. PSRAM goes through the
+  // line buffers, which then act as bounce buffers.
+  if (!esp_ptr_dma_capable(data) || (reinterpret_cast<uintptr_t>(data) & 3U) != 0) {
+    queue_->stage(data, len);
+    return false;
+  }
+  queue_->submitStaged();
+  for (size_t off = 0; off < len; off += kLcdLineBufBytes) {
+    queue_->submit(true, data + off, std::min(len - off, kLcdLineBufBytes));
+  }
+  return true;
+}
+
+void ESP32S3BoxLiteSpiBus::writeColor(uint16_t color, uint32_t count) {
+  if (queue_ != nullptr) {
+    queue_->fill(color, count);
+  }
+}
+
+void ESP32S3BoxLiteSpiBus::waitIdle() {
+  if (queue_ != nullptr) {
+    queue_->waitIdle();
+  }
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteRecordingBus
+// ===========================================================================
+
+// Log records: 'C' cmd | 'D' len16 bytes | 'P' len16 bytes | 'E' |
+// 'F' color16 count32. Multi-byte fields are little-endian.
+
+ESP32S3BoxLiteRecordingBus::~ESP32S3BoxLiteRecordingBus() {
+  if (ram_ != nullptr) {
+    heap_caps_free(ram_);
+  }
+}
+
+bool ESP32S3BoxLiteRecordingBus::begin() {
+  const size_t bytes = static_cast<size_t>(Width) * Height * sizeof(uint16_t);
+  if (ram_ == nullptr) {
+    ram_ = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (ram_ == nullptr) {
+      ram_ = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
+    }
+    if (ram_ == nullptr) { return false; }
+  }
+  memset(ram_, 0, bytes);
+  command_ = 0;
+  paramCount_ = 0;
+  winX0_ = 0;
+  winY0_ = 0;
+  winX1_ = Width - 1;
+  winY1_ = Height - 1;
+  curX_ = 0;
+  curY_ = 0;
+  oddByteValid_ = false;
+  pendingPixelBytes_ = 0;
+  return true;
+}
+
+void ESP32S3BoxLiteRecordingBus::writeCommand(uint8_t command) {
+  flushPixels();
+  log('C', &command, 1, nullptr, 0);
+  countTransfer(1);
+  ++stats_.commands;
+
+  command_ = command;
+  paramCount_ = 0;
+  oddByteValid_ = false;
+  if (command == 0x2C) {
+    ++stats_.windows;
+    curX_ = winX0_;
+    curY_ = winY0_;
+  }
+}
+
+void ESP32S3BoxLiteRecordingBus::writeData(const uint8_t *data, size_t len) {
+  flushPixels();
+  for (size_t off = 0; off < len; off += kLogChunkBytes) {
+    const size_t n = std::min(len - off, kLogChunkBytes);
+    const uint8_t head[2] = {static_cast<uint8_t>(n & 0xFF), static_cast<uint8_t>(n >> 8)};
+    log('D', head, 2, data + off, n);
+  }
+  for (size_t off = 0; off < len; off += MaxTransferBytes) {
+    countTransfer(std::min(len - off, MaxTransferBytes));
+  }
+
+  if (command_ == 0x2C) {
+    ramWrite(data, len);
+    return;
+  }
+  if (command_ != 0x2A && command_ != 0x2B) { return; }
+  for (size_t i = 0; i < len && paramCount_ < 4; ++i) {
+    param_[paramCount_++] = data[i];
+  }
+  if (paramCount_ == 4) {
+    const uint16_t start = static_cast<uint16_t>((param_[0] << 8) | param_[1]);
+    const uint16_t end   = static_cast<uint16_t>((param_[2] << 8) | param_[3]);
+    if (command_ == 0x2A) {
+      winX0_ = start;
+      winX1_ = end;
+    } else {
+      winY0_ = start;
+      winY1_ = end;
+    }
+  }
+}
+
+void ESP32S3BoxLiteRecordingBus::writePixels(const uint8_t *data, size_t len) {
+  for (size_t off = 0; off < len; off += kLogChunkBytes) {
+    const size_t n = std::min(len - off, kLogChunkBytes);
+    const uint8_t head[2] = {static_cast<uint8_t>(n & 0xFF), static_cast<uint8_t>(n >> 8)};
+    log('P', head, 2, data + off, n);
+  }
+  // Same coalescing as the SPI bus: a transfer goes out per full line buffer
+  pendingPixelBytes_ += len;
+  while (pendingPixelBytes_ >= MaxTransferBytes) {
+    countTransfer(MaxTransferBytes);
+    pendingPixelBytes_ -= MaxTransferBytes;
+  }
+  if (command_ == 0x2C) {
+    ramWrite(data, len);
+  }
+}
+
+void ESP32S3BoxLiteRecordingBus::flushPixels() {
+  if (pendingPixelBytes_ == 0) { return; }
+  log('E', nullptr, 0, nullptr, 0);
+  countTransfer(pendingPixelBytes_);
+  pendingPixelBytes_ = 0;
+}
+
+bool ESP32S3BoxLiteRecordingBus::writePixelsInPlace(const uint8_t *data, size_t len) {
+  // Counted as the SPI bus's direct path: separate transfers of up to
+  // MaxTransferBytes, never coalesced with neighbouring pixel data
+  flushPixels();
+  writePixels(data, len);
+  flushPixels();
+  return false;
+}
+
+void ESP32S3BoxLiteRecordingBus::writeColor(uint16_t color, uint32_t count) {
+  flushPixels();
+  const uint8_t head[6] = {
+      static_cast<uint8_t>(color & 0xFF), static_cast<uint8_t>(color >> 8),
+      static_cast<uint8_t>(count & 0xFF), static_cast<uint8_t>(count >> 8),
+      static_cast<uint8_t>(count >> 16),  static_cast<uint8_t>(count >> 24),
+  };
+  log('F', head, sizeof(head), nullptr, 0);
+
+  // One line buffer is filled once and sent repeatedly
+  const uint32_t cap = std::min<uint32_t>(count, MaxTransferBytes / 2);
+  for (uint32_t left = count; left > 0;) {
+    const uint32_t chunk = std::min(left, cap);
+    countTransfer(chunk * 2U);
+    left -= chunk;
+  }
+  if (command_ == 0x2C) {
+    ramFill(color, count);
+  }
+}
+
+void ESP32S3BoxLiteRecordingBus::countTransfer(size_t len) {
+  ++stats_.transactions;
+  ++stats_.csToggles;
+  stats_.bytes += len;
+}
+
+void ESP32S3BoxLiteRecordingBus::ramWrite(const uint8_t *data, size_t len) {
+  if (ram_ == nullptr) { return; }
+  size_t i = 0;
+  if (oddByteValid_ && len > 0) {
+    ramFill(static_cast<uint16_t>((oddByte_ << 8) | data[0]), 1);
+    oddByteValid_ = false;
+    i = 1;
+  }
+  for (; i + 1 < len; i += 2) {
+    ramFill(static_cast<uint16_t>((data[i] << 8) | data[i + 1]), 1);
+  }
+  if (i < len) {
+    oddByte_ = data[i];
+    oddByteValid_ = true;
+  }
+}
+
+void ESP32S3BoxLiteRecordingBus::ramFill(uint16_t color, uint32_t count) {
+  if (ram_ == nullptr || winX0_ > winX1_ || winY0_ > winY1_) { return; }
+  // The write pointer walks the window row by row and wraps to its origin
+  while (count-- > 0) {
+    if (curX_ < Width && curY_ < Height) {
+      ram_[static_cast<size_t>(curY_) * Width + curX_] = color;
+    }
+    if (curX_ < winX1_) {
+      ++curX_;
+    } else {
+      curX_ = winX0_;
+      curY_ = curY_ < winY1_ ? curY_ + 1 : winY0_;
+    }
+  }
+}
+
+uint16_t ESP32S3BoxLiteRecordingBus::pixel(int16_t x, int16_t y) const {
+  if (ram_ == nullptr || x < 0 || y < 0 || x >= static_cast<int16_t>(Width) || y >= static_cast<int16_t>(Height)) {
+    return 0;
+  }
+  return ram_[static_cast<size_t>(y) * Width + x];
+}
+
+uint32_t ESP32S3BoxLiteRecordingBus::imageHash() const {
+  uint32_t hash = 2166136261u;
+  if (ram_ == nullptr) { return hash; }
+  for (size_t i = 0; i < static_cast<size_t>(Width) * Height; ++i) {
+    hash = (hash ^ (ram_[i] & 0xFF)) * 16777619u;
+    hash = (hash ^ (ram_[i] >> 8)) * 16777619u;
+  }
+  return hash;
+}
+
+void ESP32S3BoxLiteRecordingBus::setLogBuffer(uint8_t *buf, size_t capacity) {
+  log_ = buf;
+  logCap_ = buf != nullptr ? capacity : 0;
+  clearLog();
+}
+
+void ESP32S3BoxLiteRecordingBus::clearLog() {
+  logLen_ = 0;
+  logOverflow_ = false;
+}
+
+void ESP32S3BoxLiteRecordingBus::log(uint8_t tag, const uint8_t *head, size_t headLen,
+                                     const uint8_t *body, size_t bodyLen) {
+  if (log_ == nullptr || logOverflow_) { return; }
+  if (logCap_ - logLen_ < 1 + headLen + bodyLen) {
+    // Stop at the first record that does not fit so the log stays replayable
+    logOverflow_ = true;
+    return;
+  }
+  log_[logLen_++] = tag;
+  if (headLen > 0) {
+    memcpy(log_ + logLen_, head, headLen);
+    logLen_ += headLen;
+  }
+  if (bodyLen > 0) {
+    memcpy(log_ + logLen_, body, bodyLen);
+    logLen_ += bodyLen;
+  }
+}
+
+void ESP32S3BoxLiteRecordingBus::replay(ESP32S3BoxLiteBus &target) const {
+  size_t pos = 0;
+  while (pos < logLen_) {
+    const uint8_t tag = log_[pos++];
+    switch (tag) {
+      case 'C':
+        target.writeCommand(log_[pos++]);
+        break;
+      case 'D':
+      case 'P': {
+        const size_t n = log_[pos] | (static_cast<size_t>(log_[pos + 1]) << 8);
+        pos += 2;
+        if (tag == 'D') {
+          target.writeData(log_ + pos, n);
+        } else {
+          target.writePixels(log_ + pos, n);
+        }
+        pos += n;
+        break;
+      }
+      case 'E':
+        target.flushPixels();
+        break;
+      case 'F': {
+        const uint16_t color = static_cast<uint16_t>(log_[pos] | (log_[pos + 1] << 8));
+        const uint32_t count = static_cast<uint32_t>(log_[pos + 2]) | (static_cast<uint32_t>(log_[pos + 3]) << 8) |
+                               (static_cast<uint32_t>(log_[pos + 4]) << 16) |
+                               (static_cast<uint32_t>(log_[pos + 5]) << 24);
+        pos += 6;
+        target.writeColor(color, count);
+        break;
+      }
+      default:
+        return;
+    }
+  }
+  target.flushPixels();
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteClipStack implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteClipStack::reset(int16_t w, int16_t h) {
+  rects_[0] = ESP32S3BoxLiteClipRect{0, 0, std::max<int16_t>(w, 0), std::max<int16_t>(h, 0)};
+  depth_    = 0;
+}
+
+bool ESP32S3BoxLiteClipStack::push(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (depth_ >= MaxDepth) { return false; }
+  const ESP32S3BoxLiteClipRect &top = rects_[depth_];
+  // An empty intersection is kept with x1 == x0 or y1 == y0
+  const int32_t x0 = std::max<int32_t>(x, top.x0);
+  const int32_t y0 = std::max<int32_t>(y, top.y0);
+  const int32_t x1 = std::max<int32_t>(std::min<int32_t>(x + std::max<int32_t>(w, 0), top.x1), x0);
+  const int32_t y1 = std::max<int32_t>(std::min<int32_t>(y + std::max<int32_t>(h, 0), top.y1), y0);
+  rects_[++depth_] = ESP32S3BoxLiteClipRect{static_cast<int16_t>(x0), static_cast<int16_t>(y0),
+                                            static_cast<int16_t>(x1), static_cast<int16_t>(y1)};
+  return true;
+}
+
+void ESP32S3BoxLiteClipStack::pop() {
+  if (depth_ > 0) { --depth_; }
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteDisplayList implementation
+// ===========================================================================
+
+bool ESP32S3BoxLiteDisplayList::begin(uint16_t maxOps, size_t pixelBytes) {
+  end();
+  if (maxOps == 0 || pixelBytes < ESP32S3BoxLiteDisplay::Width * 2U) { return false; }
+
+  // Rectangles, their copy for optimize(), scratch and pixels share one block
+  const size_t opBytes = (2U * maxOps + 2U * kMaxVisiblePieces) * sizeof(Op);
+  uint8_t *block = nullptr;
+  if (esp_spiram_is_initialized()) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(opBytes + pixelBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(opBytes + pixelBytes, MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) { return false; }
+
+  ops_      = reinterpret_cast<Op *>(block);
+  capacity_ = maxOps;
+  pool_     = block + opBytes;
+  poolSize_ = pixelBytes;
+  clear();
+  return true;
+}
+
+void ESP32S3BoxLiteDisplayList::end() {
+  if (ops_ != nullptr) {
+    heap_caps_free(ops_);
+  }
+  ops_      = nullptr;
+  capacity_ = 0;
+  pool_     = nullptr;
+  poolSize_ = 0;
+  clear();
+}
+
+void ESP32S3BoxLiteDisplayList::clear() {
+  // The window stays, so a recording can continue after a spill
+  count_    = 0;
+  poolUsed_ = 0;
+}
+
+void ESP32S3BoxLiteDisplayList::setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  winX0_ = x0;
+  winY0_ = y0;
+  winX1_ = x1;
+  winY1_ = y1;
+  curX_  = x0;
+  curY_  = y0;
+}
+
+uint32_t ESP32S3BoxLiteDisplayList::nextRun(uint32_t count, Op &op) const {
+  const uint32_t rowLeft = winX1_ - curX_ + 1U;
+  op.x0 = static_cast<int16_t>(curX_);
+  op.y0 = static_cast<int16_t>(curY_);
+  if (curX_ != winX0_ || count < rowLeft) {
+    const uint32_t n = std::min(count, rowLeft);
+    op.x1 = static_cast<int16_t>(curX_ + n - 1);
+    op.y1 = op.y0;
+    return n;
+  }
+  const uint32_t rows = std::min<uint32_t>(count / rowLeft, winY1_ - curY_ + 1U);
+  op.x1 = static_cast<int16_t>(winX1_);
+  op.y1 = static_cast<int16_t>(curY_ + rows - 1);
+  return rows * rowLeft;
+}
+
+void ESP32S3BoxLiteDisplayList::advance(uint32_t count) {
+  // count never runs past the end of the window, which wraps to its start
+  const uint32_t width = winX1_ - winX0_ + 1U;
+  const uint32_t pos   = (curX_ - winX0_) + count;
+  const uint32_t row   = curY_ + pos / width;
+  curX_ = static_cast<uint16_t>(winX0_ + pos % width);
+  curY_ = row > winY1_ ? winY0_ : static_cast<uint16_t>(row);
+}
+
+void ESP32S3BoxLiteDisplayList::append(const Op &op) {
+  // A write that continues the last rectangle extends it, so rows pushed in
+  // chunks end up as one rectangle
+  ops_[count_++] = op;
+  while (count_ >= 2 && joinOps(ops_[count_ - 2], ops_[count_ - 1])) {
+    --count_;
+  }
+}
+
+uint32_t ESP32S3BoxLiteDisplayList::recordFill(uint16_t color, uint32_t count) {
+  if (count_ >= capacity_) { return 0; }
+  Op op;
+  const uint32_t n = nextRun(count, op);
+  op.offset = 0;
+  op.color  = color;
+  op.stride = 0;
+  append(op);
+  advance(n);
+  return n;
+}
+
+uint32_t ESP32S3BoxLiteDisplayList::recordPixels(const uint8_t *wire, uint32_t count) {
+  if (count_ >= capacity_) { return 0; }
+  Op op;
+  uint32_t n = nextRun(count, op);
+
+  // Cut the run to whole rows that fit the pool, or to part of one row
+  const uint32_t room = static_cast<uint32_t>((poolSize_ - poolUsed_) / 2U);
+  const uint32_t w    = static_cast<uint32_t>(op.x1 - op.x0 + 1);
+  if (n > room) {
+    if (room >= w) {
+      op.y1 = static_cast<int16_t>(op.y0 + room / w - 1);
+      n     = room / w * w;
+    } else {
+      if (room == 0) { return 0; }
+      op.x1 = static_cast<int16_t>(op.x0 + room - 1);
+      op.y1 = op.y0;
+      n     = room;
+    }
+  }
+
+  memcpy(pool_ + poolUsed_, wire, n * 2U);
+  op.offset = static_cast<uint32_t>(poolUsed_);
+  op.color  = 0;
+  op.stride = static_cast<uint16_t>(op.x1 - op.x0 + 1);
+  poolUsed_ += n * 2U;
+  append(op);
+  advance(n);
+  return n;
+}
+
+void ESP32S3BoxLiteDisplayList::removeDropped() {
+  // Dropped rectangles are marked with x1 < x0
+  uint16_t kept = 0;
+  for (uint16_t i = 0; i < count_; ++i) {
+    if (ops_[i].x1 >= ops_[i].x0) {
+      ops_[kept++] = ops_[i];
+    }
+  }
+  count_ = kept;
+}
+
+void ESP32S3BoxLiteDisplayList::optimize() {
+  if (count_ < 2) { return; }
+
+  // Trimming and joining change windows, so a rectangle can lose the CASET
+  // or RASET it shared with its neighbour. The recorded rectangles come back
+  // if that costs more than the pixels saved.
+  Op *saved = ops_ + capacity_;
+  const uint16_t savedCount = count_;
+  const uint32_t savedBytes = wireBytes();
+  memcpy(saved, ops_, count_ * sizeof(Op));
+
+  // Occlusion, back to front: each rectangle minus everything drawn after it.
+  // Nothing left drops it. A fill is replaced by the pieces left when the
+  // pixels saved outweigh the extra windows and the list has room; otherwise
+  // the rectangle shrinks to the bounding box of the pieces. Pixel rectangles
+  // keep their stride and skip into their rows.
+  Op *pieces = saved + capacity_;
+  Op *next   = pieces + kMaxVisiblePieces;
+  for (int32_t i = count_ - 2; i >= 0; --i) {
+    Op &op = ops_[i];
+    uint16_t n = 1;
+    bool tooMany = false;
+    pieces[0] = op;
+    for (uint16_t j = i + 1; j < count_ && n > 0 && !tooMany; ++j) {
+      const Op &cut = ops_[j];
+      if (cut.x1 < cut.x0 || !rectsOverlap(op, cut)) { continue; }
+      uint16_t m = 0;
+      for (uint16_t k = 0; k < n; ++k) {
+        if (m + 4 > kMaxVisiblePieces) {
+          tooMany = true;
+          break;
+        }
+        m += subtractRect(pieces[k], cut, next + m);
+      }
+      std::swap(pieces, next);
+      n = m;
+    }
+    if (tooMany) { continue; }
+    if (n == 0) {
+      op.x1 = static_cast<int16_t>(op.x0 - 1);
+      continue;
+    }
+
+    int16_t x0 = pieces[0].x0, y0 = pieces[0].y0, x1 = pieces[0].x1, y1 = pieces[0].y1;
+    uint32_t visible = 0;
+    for (uint16_t k = 0; k < n; ++k) {
+      x0 = std::min(x0, pieces[k].x0);
+      y0 = std::min(y0, pieces[k].y0);
+      x1 = std::max(x1, pieces[k].x1);
+      y1 = std::max(y1, pieces[k].y1);
+      visible += static_cast<uint32_t>(pieces[k].x1 - pieces[k].x0 + 1) * (pieces[k].y1 - pieces[k].y0 + 1);
+    }
+    const uint32_t hidden = static_cast<uint32_t>(x1 - x0 + 1) * (y1 - y0 + 1) - visible;
+    if (op.stride == 0 && n > 1 && count_ + n - 1U <= capacity_ &&
+        hidden * 2U > (n - 1U) * (2U * kWindowCommandBytes + 1U)) {
+      // The pieces do not overlap, so their order is free
+      memmove(ops_ + i + n, ops_ + i + 1, (count_ - i - 1U) * sizeof(Op));
+      memcpy(ops_ + i, pieces, n * sizeof(Op));
+      count_ = static_cast<uint16_t>(count_ + n - 1U);
+      continue;
+    }
+    if (op.stride != 0) {
+      op.offset += (static_cast<uint32_t>(y0 - op.y0) * op.stride + (x0 - op.x0)) * 2U;
+    }
+    op.x0 = x0;
+    op.y0 = y0;
+    op.x1 = x1;
+    op.y1 = y1;
+  }
+  removeDropped();
+
+  // Same-colour fills that form a rectangle become one. The later fill moves
+  // back to the earlier one, so nothing drawn in between may overlap it.
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint16_t j = 1; j < count_; ++j) {
+      const Op &b = ops_[j];
+      if (b.stride != 0) { continue; }
+      for (int32_t i = j - 1; i >= 0; --i) {
+        if (ops_[i].x1 < ops_[i].x0) { continue; }
+        if (joinOps(ops_[i], b)) {
+          ops_[j].x1 = static_cast<int16_t>(ops_[j].x0 - 1);
+          merged = true;
+          break;
+        }
+        if (rectsOverlap(ops_[i], b)) { break; }
+      }
+    }
+    removeDropped();
+  }
+  if (wireBytes() > savedBytes) {
+    memcpy(ops_, saved, savedCount * sizeof(Op));
+    count_ = savedCount;
+  }
+
+  // Scanline order: by top row, then bottom row, then left edge, so
+  // rectangles on the same rows share their RASET. Rectangles that already
+  // share a window with the one before move as one run and are never split,
+  // so the order costs no window that it does not save. A run never moves
+  // past one it overlaps, which keeps the picture.
+  auto before = [](const Op &a, const Op &b) {
+    if (a.y0 != b.y0) { return a.y0 < b.y0; }
+    if (a.y1 != b.y1) { return a.y1 < b.y1; }
+    return a.x0 < b.x0;
+  };
+  auto runsOverlap = [this](uint16_t a, uint16_t aEnd, uint16_t b, uint16_t bEnd) {
+    for (uint16_t i = a; i < aEnd; ++i) {
+      for (uint16_t j = b; j < bEnd; ++j) {
+        if (rectsOverlap(ops_[i], ops_[j])) { return true; }
+      }
+    }
+    return false;
+  };
+  for (uint16_t k = 1, end = 1; k < count_; k = end) {
+    end = static_cast<uint16_t>(k + 1);
+    while (end < count_ && sharesWindow(ops_[end - 1], ops_[end])) { ++end; }
+    if (sharesWindow(ops_[k - 1], ops_[k])) { continue; }
+    uint16_t m = k;
+    while (m > 0) {
+      uint16_t p = static_cast<uint16_t>(m - 1);
+      while (p > 0 && sharesWindow(ops_[p - 1], ops_[p])) { --p; }
+      if (!before(ops_[m], ops_[p]) || runsOverlap(p, m, m, static_cast<uint16_t>(m + end - k))) { break; }
+      std::rotate(ops_ + p, ops_ + m, ops_ + m + (end - k));
+      m = p;
+    }
+  }
+}
+
+uint32_t ESP32S3BoxLiteDisplayList::wireBytes() const {
+  uint32_t bytes = 0;
+  for (uint16_t i = 0; i < count_; ++i) {
+    const Op &op = ops_[i];
+    // The display skips a CASET or RASET that repeats the previous window
+    if (i == 0 || op.x0 != ops_[i - 1].x0 || op.x1 != ops_[i - 1].x1) { bytes += kWindowCommandBytes; }
+    if (i == 0 || op.y0 != ops_[i - 1].y0 || op.y1 != ops_[i - 1].y1) { bytes += kWindowCommandBytes; }
+    bytes += 1U + static_cast<uint32_t>(op.x1 - op.x0 + 1) * (op.y1 - op.y0 + 1) * 2U;
+  }
+  return bytes;
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteDisplay implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteDisplay::setBus(ESP32S3BoxLiteBus *bus) {
+  bus_ = bus != nullptr ? bus : &spiBus_;
+  windowValid_ = false;
+  initialized_ = false;
+}
+
+void ESP32S3BoxLiteDisplay::waitIdle() {
+  bus_->waitIdle();
+}
+
+ESP32S3BoxLiteBusStats ESP32S3BoxLiteDisplay::busStats() const {
+  return bus_->stats();
+}
+
+void ESP32S3BoxLiteDisplay::resetBusStats() {
+  bus_->resetStats();
+}
+
+uint32_t ESP32S3BoxLiteDisplay::spiClockHz() {
+  return ESP32S3BoxLiteSpiBus::ClockHz;
+}
+
+bool ESP32S3BoxLiteDisplay::begin() {
+  pinMode(kLcdBacklightPin, OUTPUT);
+  // Backlight off during init
+  digitalWrite(kLcdBacklightPin, LOW);
+
+  // The bus sets up its transport and resets the panel
+  if (!bus_->begin()) { return false; }
+  windowValid_ = false;
+  scrollLeft_ = 0;
+  scrollWidth_ = Width;
+  scrollOffset_ = 0;
+
+  writeCommand(0x01);
+  bus_->delayMs(150);
+
+  const uint8_t porch[] = {0x0C, 0x0C, 0x00, 0x33, 0x33};
+  writeCommandWithData(0xB2, porch, sizeof(porch));
+
+  const uint8_t gateCtrl[] = {0x35};
+  writeCommandWithData(0xB7, gateCtrl, sizeof(gateCtrl));
+
+  const uint8_t vcoms[] = {0x28};
+  writeCommandWithData(0xBB, vcoms, sizeof(vcoms));
+
+  const uint8_t lcmCtrl[] = {0x0C};
+  writeCommandWithData(0xC0, lcmCtrl, sizeof(lcmCtrl));
+
+  const uint8_t vdvVrhEn[] = {0x01, 0xFF};
+  writeCommandWithData(0xC2, vdvVrhEn, sizeof(vdvVrhEn));
+
+  const uint8_t vrhs[] = {0x10};
+  writeCommandWithData(0xC3, vrhs, sizeof(vrhs));
+
+  const uint8_t vdvs[] = {0x20};
+  writeCommandWithData(0xC4, vdvs, sizeof(vdvs));
+
+  const uint8_t frameRate[] = {0x0F};
+  writeCommandWithData(0xC6, frameRate, sizeof(frameRate));
+
+  const uint8_t powerCtrl[] = {0xA4, 0xA1};
+  writeCommandWithData(0xD0, powerCtrl, sizeof(powerCtrl));
+
+  const uint8_t positiveGamma[] = {
+      0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x32, 0x44,
+      0x42, 0x06, 0x0E, 0x12, 0x14, 0x17,
+  };
+  writeCommandWithData(0xE0, positiveGamma, sizeof(positiveGamma));
+
+  const uint8_t negativeGamma[] = {
+      0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x31, 0x54,
+      0x47, 0x0E, 0x1C, 0x17, 0x1B, 0x1E,
+  };
+  writeCommandWithData(0xE1, negativeGamma, sizeof(negativeGamma));
+
+  const uint8_t colorMode[] = {0x55};
+  writeCommandWithData(0x3A, colorMode, sizeof(colorMode));
+
+  const uint8_t madctl[] = {0xA0};
+  writeCommandWithData(0x36, madctl, sizeof(madctl));
+
+  writeCommand(0x21);
+  writeCommand(0x11);
+  bus_->delayMs(120);
+  writeCommand(0x13);
+  writeCommand(0x29);
+  bus_->delayMs(50);
+
+  // Turn on backlight at 100%
+  setBacklight(100);
+  initialized_ = true;
+  return true;
+}
+
+void ESP32S3BoxLiteDisplay::setBacklight(uint8_t percent) {
+  if (!backlightPwmSetup_) {
+    ledcSetup(kBacklightLedcChannel, 5000, 8);
+    ledcAttachPin(kLcdBacklightPin, kBacklightLedcChannel);
+    backlightPwmSetup_ = true;
+  }
+  const uint8_t duty = static_cast<uint8_t>((static_cast<uint16_t>(percent > 100 ? 100 : percent) * 255U) / 100U);
+  ledcWrite(kBacklightLedcChannel, duty);
+}
+
+void ESP32S3BoxLiteDisplay::writeCommand(uint8_t command) {
+  bus_->writeCommand(command);
+}
+
+void ESP32S3BoxLiteDisplay::writeData(const uint8_t *data, size_t length) {
+  bus_->writeData(data, length);
+}
+
+void ESP32S3BoxLiteDisplay::writeCommandWithData(uint8_t command, const uint8_t *data, size_t length) {
+  writeCommand(command);
+  writeData(data, length);
+}
+
+void ESP32S3BoxLiteDisplay::setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  if (recording_ != nullptr) {
+    recording_->setWindow(x0, y0, x1, y1);
+    return;
+  }
+  if (framebuffer_ != nullptr) {
+    // Emulate the controller's address window inside the framebuffer
+    fbWinX0_ = x0;
+    fbWinY0_ = y0;
+    fbWinX1_ = x1;
+    fbWinY1_ = y1;
+    fbCurX_  = x0;
+    fbCurY_  = y0;
+    markDirty(x0, y0, x1, y1);
+    return;
+  }
+  writeAddressWindow(x0, y0, x1, y1);
+}
+
+void ESP32S3BoxLiteDisplay::writeAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  uint8_t data[4];
+
+  // RAMWR always restarts at (x0, y0), so an unchanged CASET or RASET can be
+  // skipped.
+  if (!windowValid_ || x0 != winX0_ || x1 != winX1_) {
+    writeCommand(0x2A);
+    data[0] = x0 >> 8;
+    data[1] = x0 & 0xFF;
+    data[2] = x1 >> 8;
+    data[3] = x1 & 0xFF;
+    writeData(data, sizeof(data));
+    winX0_ = x0;
+    winX1_ = x1;
+  }
+
+  if (!windowValid_ || y0 != winY0_ || y1 != winY1_) {
+    writeCommand(0x2B);
+    data[0] = y0 >> 8;
+    data[1] = y0 & 0xFF;
+    data[2] = y1 >> 8;
+    data[3] = y1 & 0xFF;
+    writeData(data, sizeof(data));
+    winY0_ = y0;
+    winY1_ = y1;
+  }
+  windowValid_ = true;
+
+  writeCommand(0x2C);
+}
+
+void ESP32S3BoxLiteDisplay::setAddressWindowPublic(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  setAddressWindow(x0, y0, x1, y1);
+}
+
+void ESP32S3BoxLiteDisplay::sendRawBuffer(const uint8_t *buf, size_t len) {
+  pushPixels(buf, len);
+  endPixels();
+}
+
+void ESP32S3BoxLiteDisplay::pushPixels(const uint8_t *wire, size_t len) {
+  if (recording_ != nullptr) {
+    uint32_t count = static_cast<uint32_t>(len / 2);
+    while (count > 0) {
+      uint32_t n = recording_->recordPixels(wire, count);
+      if (n == 0) {
+        spillRecording();
+        n = recording_->recordPixels(wire, count);
+      }
+      wire  += n * 2U;
+      count -= n;
+    }
+    return;
+  }
+  if (framebuffer_ != nullptr) {
+    fbWrite(wire, 0, len / 2);
+    return;
+  }
+  // The bus copies the data, so the caller may reuse it right away.
+  // Consecutive calls are coalesced into line-buffer-sized transfers.
+  bus_->writePixels(wire, len);
+}
+
+bool ESP32S3BoxLiteDisplay::pushPixelsInPlace(const uint8_t *wire, size_t len) {
+  if (recording_ != nullptr) {
+    // Copied into the list, so the caller need not wait
+    pushPixels(wire, len);
+    return false;
+  }
+  if (framebuffer_ != nullptr) {
+    fbWrite(wire, 0, len / 2);
+    return false;
+  }
+  return bus_->writePixelsInPlace(wire, len);
+}
+
+void ESP32S3BoxLiteDisplay::endPixels() {
+  if (framebuffer_ == nullptr && recording_ == nullptr) {
+    bus_->flushPixels();
+  }
+}
+
+bool ESP32S3BoxLiteDisplay::clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+  if (w <= 0 || h <= 0) { return false; }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  int32_t x0 = x, y0 = y;
+  int32_t x1 = static_cast<int32_t>(x) + w;
+  int32_t y1 = static_cast<int32_t>(y) + h;
+  x0 = std::max<int32_t>(x0, clip.x0);
+  y0 = std::max<int32_t>(y0, clip.y0);
+  x1 = std::min<int32_t>(x1, clip.x1);
+  y1 = std::min<int32_t>(y1, clip.y1);
+  if (x0 >= x1 || y0 >= y1) { return false; }
+  x = static_cast<int16_t>(x0);
+  y = static_cast<int16_t>(y0);
+  w = static_cast<int16_t>(x1 - x0);
+  h = static_cast<int16_t>(y1 - y0);
+  return true;
+}
+
+void ESP32S3BoxLiteDisplay::sendColor(uint16_t color, uint32_t count) {
+  if (recording_ != nullptr) {
+    while (count > 0) {
+      uint32_t n = recording_->recordFill(color, count);
+      if (n == 0) {
+        spillRecording();
+        n = recording_->recordFill(color, count);
+      }
+      count -= n;
+    }
+    return;
+  }
+  if (framebuffer_ != nullptr) {
+    fbWrite(nullptr, color, count);
+    return;
+  }
+  bus_->writeColor(color, count);
+}
+
+void ESP32S3BoxLiteDisplay::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+  if (!initialized_ || x >= Width || y >= Height || w == 0 || h == 0) {
+    return;
+  }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int32_t x0 = std::max<int32_t>(x, clip.x0);
+  const int32_t y0 = std::max<int32_t>(y, clip.y0);
+  const int32_t x1 = std::min<int32_t>(x + w, clip.x1);
+  const int32_t y1 = std::min<int32_t>(y + h, clip.y1);
+  if (x0 >= x1 || y0 >= y1) { return; }
+
+  setAddressWindow(x0, y0, x1 - 1, y1 - 1);
+  sendColor(color, static_cast<uint32_t>(x1 - x0) * (y1 - y0));
+}
+
+void ESP32S3BoxLiteDisplay::fillScreen(uint16_t color) {
+  fillRect(0, 0, Width, Height, color);
+}
+
+void ESP32S3BoxLiteDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!initialized_ || !clip_.current().contains(x, y)) {
+    return;
+  }
+  fillRect(static_cast<uint16_t>(x), static_cast<uint16_t>(y), 1, 1, color);
+}
+
+void ESP32S3BoxLiteDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  int16_t h = 1;
+  if (!initialized_ || !clipRect(x, y, w, h)) { return; }
+  setAddressWindow(x, y, x + w - 1, y);
+  sendColor(color, static_cast<uint32_t>(w));
+}
+
+void ESP32S3BoxLiteDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  int16_t w = 1;
+  if (!initialized_ || !clipRect(x, y, w, h)) { return; }
+  setAddressWindow(x, y, x, y + h - 1);
+  sendColor(color, static_cast<uint32_t>(h));
+}
+
+void ESP32S3BoxLiteDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (outsideClip(clip_.current(), std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1))) {
+    return;
+  }
+  if (y0 == y1) {
+    drawFastHLine(std::min(x0, x1), y0, std::abs(x1 - x0) + 1, color);
+    return;
+  }
+  if (x0 == x1) {
+    drawFastVLine(x0, std::min(y0, y1), std::abs(y1 - y0) + 1, color);
+    return;
+  }
+
+  // Bresenham's line algorithm, emitted as maximal runs along the major axis
+  const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+  int16_t dx  =  std::abs(x1 - x0);
+  int16_t dy  = -std::abs(y1 - y0);
+  int16_t sx  = x0 < x1 ? 1 : -1;
+  int16_t sy  = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+
+  // A run covers major-axis coordinates [runStart, end] at one minor coordinate
+  auto emitRun = [&](int16_t runStart, int16_t ex, int16_t ey) {
+    if (steep) {
+      drawFastVLine(ex, std::min(runStart, ey), std::abs(ey - runStart) + 1, color);
+    } else {
+      drawFastHLine(std::min(runStart, ex), ey, std::abs(ex - runStart) + 1, color);
+    }
+  };
+
+  int16_t runStart = steep ? y0 : x0;
+  while (true) {
+    if (x0 == x1 && y0 == y1) {
+      break;
+    }
+    const int16_t px = x0;
+    const int16_t py = y0;
+    int16_t e2 = 2 * err;
+    if (e2 >= dy) {
+      if (x0 == x1) { break; }
+      err += dy;
+      x0  += sx;
+    }
+    if (e2 <= dx) {
+      if (y0 == y1) { break; }
+      err += dx;
+      y0  += sy;
+    }
+    // A step on the minor axis ends the current run at the previous point
+    if (steep ? (x0 != px) : (y0 != py)) {
+      emitRun(runStart, px, py);
+      runStart = steep ? y0 : x0;
+    }
+  }
+  emitRun(runStart, x0, y0);
+}
+
+void ESP32S3BoxLiteDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w <= 0 || h <= 0) { return; }
+  drawFastHLine(x, y, w, color);                  // top
+  if (h > 1) {
+    drawFastHLine(x, y + h - 1, w, color);        // bottom
+  }
+  if (h > 2) {
+    drawFastVLine(x, y + 1, h - 2, color);        // left
+    if (w > 1) {
+      drawFastVLine(x + w - 1, y + 1, h - 2, color);  // right
+    }
+  }
+}
+
+void ESP32S3BoxLiteDisplay::drawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+  // Bresenham's circle algorithm. In the octant being walked x advances every
+  // step and y only sometimes, so points sharing a y form horizontal runs at
+  // the top/bottom and (mirrored across the diagonal) vertical runs at the
+  // sides. Each run [a, b] is emitted once per mirror image.
+  if (r < 0 || outsideClip(clip_.current(), cx - r, cy - r, cx + r, cy + r)) { return; }
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t d = 3 - 2 * r;
+
+  auto emitRuns = [&](int16_t a, int16_t b, int16_t yy) {
+    const int16_t len = b - a + 1;
+    if (a == 0) {
+      // The run crosses the axis: mirror images join into one span
+      drawFastHLine(cx - b, cy + yy, 2 * b + 1, color);
+      drawFastHLine(cx - b, cy - yy, 2 * b + 1, color);
+      drawFastVLine(cx + yy, cy - b, 2 * b + 1, color);
+      drawFastVLine(cx - yy, cy - b, 2 * b + 1, color);
+      return;
+    }
+    drawFastHLine(cx + a, cy + yy, len, color);
+    drawFastHLine(cx - b, cy + yy, len, color);
+    drawFastHLine(cx + a, cy - yy, len, color);
+    drawFastHLine(cx - b, cy - yy, len, color);
+    drawFastVLine(cx + yy, cy + a, len, color);
+    drawFastVLine(cx - yy, cy + a, len, color);
+    drawFastVLine(cx + yy, cy - b, len, color);
+    drawFastVLine(cx - yy, cy - b, len, color);
+  };
+
+  int16_t runStart = 0;
+  while (y >= x) {
+    const int16_t curX = x;
+    const int16_t curY = y;
+    ++x;
+    if (d > 0) {
+      --y;
+      d += 4 * (x - y) + 10;
+    } else {
+      d += 4 * x + 6;
+    }
+    if (y != curY || y < x) {
+      emitRuns(runStart, curX, curY);
+      runStart = x;
+    }
+  }
+}
+
+void ESP32S3BoxLiteDisplay::fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+  if (!initialized_ || outsideClip(clip_.current(), cx - r, cy - r, cx + r, cy + r)) { return; }
+  circleRows(r, [&](int32_t k, int32_t hw) {
+    drawFastHLine(cx - hw, cy - k, 2 * hw + 1, color);
+    if (k != 0) {
+      drawFastHLine(cx - hw, cy + k, 2 * hw + 1, color);
+    }
+  });
+}
+
+void ESP32S3BoxLiteDisplay::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                         uint16_t color) {
+  if (!initialized_) { return; }
+  auto merger = makeSpanMerger(DisplayRect{ this, color });
+  scanTriangle(x0, y0, x1, y1, x2, y2, clip_.current(), merger);
+}
+
+void ESP32S3BoxLiteDisplay::fillPolygon(const int16_t *points, uint8_t count, uint16_t color) {
+  if (!initialized_ || points == nullptr || count < 3 || count > kMaxPolygonPoints) { return; }
+  FixedPoint pts[kMaxPolygonPoints];
+  for (uint8_t i = 0; i < count; ++i) {
+    pts[i] = { static_cast<int32_t>(points[2 * i]) * 65536, static_cast<int32_t>(points[2 * i + 1]) * 65536 };
+  }
+  auto merger = makeSpanMerger(DisplayRect{ this, color });
+  scanPolygon(pts, count, clip_.current(), merger);
+}
+
+void ESP32S3BoxLiteDisplay::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  if (!initialized_ || w <= 0 || h <= 0) { return; }
+  r = std::min<int16_t>(r, std::min(w, h) / 2);
+  if (r <= 0) {
+    if (clipRect(x, y, w, h)) { fillRect(x, y, w, h, color); }
+    return;
+  }
+  // Straight middle band in one window, then one span per corner row
+  int16_t mx = x, my = y + r, mw = w, mh = h - 2 * r;
+  if (clipRect(mx, my, mw, mh)) { fillRect(mx, my, mw, mh, color); }
+  circleRows(r, [&](int32_t k, int32_t hw) {
+    if (k == 0) { return; }
+    const int16_t sx = x + r - hw;
+    const int16_t sw = w - 2 * r + 2 * hw;
+    drawFastHLine(sx, y + r - k, sw, color);
+    drawFastHLine(sx, y + h - 1 - r + k, sw, color);
+  });
+}
+
+void ESP32S3BoxLiteDisplay::drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width,
+                                          uint16_t color) {
+  if (width <= 1) {
+    drawLine(x0, y0, x1, y1, color);
+    return;
+  }
+  if (!initialized_) { return; }
+  FixedPoint pts[4];
+  thickLineOutline(x0, y0, x1, y1, width, pts);
+  auto merger = makeSpanMerger(DisplayRect{ this, color });
+  scanPolygon(pts, 4, clip_.current(), merger);
+}
+
+void ESP32S3BoxLiteDisplay::fillArc(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, int16_t startDeg,
+                                    int16_t endDeg, uint16_t color) {
+  if (!initialized_) { return; }
+  FixedPoint   pts[kMaxPolygonPoints];
+  const size_t n = arcOutline(cx, cy, outerR, innerR, startDeg, endDeg, pts);
+  auto merger = makeSpanMerger(DisplayRect{ this, color });
+  scanPolygon(pts, n, clip_.current(), merger);
+}
+
+void ESP32S3BoxLiteDisplay::pushCoverage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels,
+                                         uint16_t color, const uint16_t *ramp) {
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int32_t x0 = std::max<int32_t>(x, clip.x0);
+  const int32_t y0 = std::max<int32_t>(y, clip.y0);
+  const int32_t x1 = std::min<int32_t>(x + w, clip.x1);
+  const int32_t y1 = std::min<int32_t>(y + h, clip.y1);
+  if (x0 >= x1 || y0 >= y1) { return; }
+
+  setAddressWindow(x0, y0, x1 - 1, y1 - 1);
+  uint16_t buf[kAaChunk];
+  size_t   n = 0;
+  for (int32_t row = y0; row < y1; ++row) {
+    const uint8_t *src = levels + (row - y) * w - x;
+    for (int32_t col = x0; col < x1; ++col) {
+      // Pixels are read before pushPixels() writes them, so buffered mode
+      // blends over the previous contents
+      const uint16_t c = framebuffer_ != nullptr
+                             ? blendCoverage(color, swap565(framebuffer_[row * Width + col]), src[col])
+                             : ramp[src[col]];
+      buf[n++] = swap565(c);
+      if (n == kAaChunk) {
+        pushPixels(reinterpret_cast<const uint8_t *>(buf), n * 2U);
+        n = 0;
+      }
+    }
+  }
+  if (n > 0) {
+    pushPixels(reinterpret_cast<const uint8_t *>(buf), n * 2U);
+  }
+  endPixels();
+}
+
+void ESP32S3BoxLiteDisplay::drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color,
+                                       uint16_t bg) {
+  if (!initialized_) { return; }
+  uint16_t ramp[kCoverageMax + 1];
+  makeCoverageRamp(color, bg, ramp);
+  auto plot = [&](int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels) {
+    pushCoverage(x, y, w, h, levels, color, ramp);
+  };
+  wuLine(x0, y0, x1, y1, clip_.current(), plot);
+}
+
+void ESP32S3BoxLiteDisplay::drawCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color, uint16_t bg) {
+  if (!initialized_) { return; }
+  uint16_t ramp[kCoverageMax + 1];
+  makeCoverageRamp(color, bg, ramp);
+  auto plot = [&](int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels) {
+    pushCoverage(x, y, w, h, levels, color, ramp);
+  };
+  aaCircle(cx, cy, r, false, clip_.current(), plot);
+}
+
+void ESP32S3BoxLiteDisplay::fillCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color, uint16_t bg) {
+  if (!initialized_) { return; }
+  uint16_t ramp[kCoverageMax + 1];
+  makeCoverageRamp(color, bg, ramp);
+  auto plot = [&](int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels) {
+    pushCoverage(x, y, w, h, levels, color, ramp);
+  };
+  aaCircle(cx, cy, r, true, clip_.current(), plot);
+}
+
+void ESP32S3BoxLiteDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                        int16_t w, int16_t h, uint16_t fgColor, uint16_t bgColor) {
+  if (!initialized_ || bitmap == nullptr || w <= 0 || h <= 0) {
+    return;
+  }
+  int16_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipRect(cx, cy, cw, ch)) { return; }
+
+  // One address window for the visible part, streamed row by row
+  setAddressWindow(cx, cy, cx + cw - 1, cy + ch - 1);
+  uint8_t line[Width * 2];
+  const int16_t bytesPerRow = (w + 7) / 8;
+  for (int16_t row = cy - y; row < cy - y + ch; ++row) {
+    const uint8_t *src = bitmap + row * bytesPerRow;
+    for (int16_t i = 0; i < cw; ++i) {
+      const int16_t  col = cx - x + i;
+      const uint16_t c   = (src[col / 8] & (0x80 >> (col % 8))) ? fgColor : bgColor;
+      line[i * 2]     = c >> 8;
+      line[i * 2 + 1] = c & 0xFF;
+    }
+    pushPixels(line, static_cast<size_t>(cw) * 2U);
+  }
+  endPixels();
+}
+
+void ESP32S3BoxLiteDisplay::drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h) {
+  if (!initialized_ || bitmap == nullptr || w <= 0 || h <= 0) {
+    return;
+  }
+  int16_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipRect(cx, cy, cw, ch)) { return; }
+  setAddressWindow(cx, cy, cx + cw - 1, cy + ch - 1);
+
+  // Send pixel data (big-endian RGB565)
+  constexpr size_t kBufPixels = 64;
+  uint8_t buf[kBufPixels * 2];
+  size_t bufIdx = 0;
+
+  auto flushBuf = [&]() {
+    if (bufIdx > 0) {
+      sendRawBuffer(buf, bufIdx);
+      bufIdx = 0;
+    }
+  };
+
+  // Only the visible part of each row is read
+  for (int16_t row = cy - y; row < cy - y + ch; ++row) {
+    for (int16_t col = cx - x; col < cx - x + cw; ++col) {
+      const uint16_t px = bitmap[row * w + col];
+      buf[bufIdx++] = px >> 8;
+      buf[bufIdx++] = px & 0xFF;
+      if (bufIdx >= sizeof(buf)) {
+        flushBuf();
+      }
+    }
+  }
+  flushBuf();
+}
+
+bool ESP32S3BoxLiteDisplay::drawRGBBitmap(int16_t x, int16_t y, const uint8_t *pixels, int16_t w, int16_t h,
+                                          ESP32S3BoxLitePixelFormat format, ESP32S3BoxLiteDither dither,
+                                          size_t stride) {
+  if (!initialized_ || pixels == nullptr || w <= 0 || h <= 0) {
+    return true;
+  }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int32_t x0 = std::max<int32_t>(x, clip.x0), y0 = std::max<int32_t>(y, clip.y0);
+  const int32_t x1 = std::min<int32_t>(x + w, clip.x1), y1 = std::min<int32_t>(y + h, clip.y1);
+  if (x0 >= x1 || y0 >= y1) {
+    return true;
+  }
+  const size_t bpp = ESP32S3BoxLitePixelConverter::bytesPerPixel(format);
+  if (stride == 0) {
+    stride = static_cast<size_t>(w) * bpp;
+  }
+  // The ordered pattern follows the image, so moving it does not make the
+  // pattern crawl. Diffusion only sees the visible part.
+  ESP32S3BoxLitePixelConverter converter;
+  if (!converter.begin(format, static_cast<uint16_t>(w), dither)) {
+    return false;
+  }
+  setAddressWindow(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0), static_cast<uint16_t>(x1 - 1),
+                   static_cast<uint16_t>(y1 - 1));
+
+  const uint16_t sx = static_cast<uint16_t>(x0 - x);
+  const uint16_t n  = static_cast<uint16_t>(x1 - x0);
+  constexpr uint16_t kBufPixels = 80;
+  uint8_t buf[kBufPixels * 2];
+  for (int32_t row = 0; row < y1 - y; ++row) {
+    if (y + row >= y0) {
+      const uint8_t *src = pixels + static_cast<size_t>(row) * stride + sx * bpp;
+      if (framebuffer_ != nullptr) {
+        // Wire order already, so rows are converted in place
+        converter.convert(src, reinterpret_cast<uint8_t *>(framebuffer_ + (y + row) * Width + x0), sx, n);
+      } else {
+        for (uint16_t i = 0; i < n; i += kBufPixels) {
+          const uint16_t count = std::min<uint16_t>(kBufPixels, n - i);
+          converter.convert(src + i * bpp, buf, sx + i, count);
+          pushPixels(buf, count * 2U);
+        }
+      }
+    }
+    converter.nextRow();
+  }
+  if (framebuffer_ == nullptr) {
+    endPixels();
+  }
+  return true;
+}
+
+void ESP32S3BoxLiteDisplay::drawProgressBar(int16_t x, int16_t y, int16_t w, int16_t h,
+                                              uint8_t percent, uint16_t fgColor, uint16_t bgColor) {
+  if (!initialized_ || w <= 0 || h <= 0) {
+    return;
+  }
+  const uint8_t clampedPct = percent > 100 ? 100 : percent;
+  // Background
+  fillRect(static_cast<uint16_t>(x), static_cast<uint16_t>(y),
+           static_cast<uint16_t>(w), static_cast<uint16_t>(h), bgColor);
+  // Foreground fill
+  const int16_t fillW = static_cast<int16_t>((static_cast<int32_t>(w) * clampedPct) / 100);
+  if (fillW > 0) {
+    fillRect(static_cast<uint16_t>(x), static_cast<uint16_t>(y),
+             static_cast<uint16_t>(fillW), static_cast<uint16_t>(h), fgColor);
+  }
+}
+
+void ESP32S3BoxLiteDisplay::printf(int16_t x, int16_t y, uint8_t scale, uint16_t fg, uint16_t bg, const char *fmt, ...) {
+  char buf[128];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  drawText(x, y, buf, scale, fg, bg);
+}
+
+void ESP32S3BoxLiteDisplay::drawText(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg) {
+  if (!initialized_ || text == nullptr) { return; }
+  if (scale == 0) { scale = 1; }
+
+  // The whole string is one block: 6-pixel cells (5 glyph columns + 1 gap
+  // painted in bg), without the trailing gap after the last character.
+  const size_t  len       = strlen(text);
+  const int16_t charWidth = 6 * scale;
+  if (len == 0 || x >= clip_.current().x1) { return; }
+  int32_t textWidth = static_cast<int32_t>(len) * charWidth - scale;
+  textWidth = std::min<int32_t>(textWidth, clip_.current().x1 - x);
+
+  int16_t bx = x, by = y;
+  int16_t bw = static_cast<int16_t>(textWidth);
+  int16_t bh = 7 * scale;
+  if (!clipRect(bx, by, bw, bh)) { return; }
+
+  const uint8_t fgHi = fg >> 8, fgLo = fg & 0xFF;
+  const uint8_t bgHi = bg >> 8, bgLo = bg & 0xFF;
+  uint8_t line[Width * 2];
+
+  // Rasterize one glyph row across the visible part of the string
+  auto buildRow = [&](uint8_t glyphRow) {
+    int32_t rel = bx - x;  // offset into the text block
+    int16_t i   = 0;
+    while (i < bw) {
+      const uint8_t bits = findGlyph(text[rel / charWidth])->rows[glyphRow];
+      int16_t col = static_cast<int16_t>((rel % charWidth) / scale);
+      int16_t rep = static_cast<int16_t>(scale - (rel % charWidth) % scale);
+      for (; col < 6 && i < bw; ++col) {
+        const bool on = col < 5 && (bits & (0x10 >> col));
+        for (; rep > 0 && i < bw; --rep, ++i, ++rel) {
+          line[i * 2]     = on ? fgHi : bgHi;
+          line[i * 2 + 1] = on ? fgLo : bgLo;
+        }
+        rep = scale;
+      }
+    }
+  };
+
+  setAddressWindow(bx, by, bx + bw - 1, by + bh - 1);
+  int16_t builtRow = -1;
+  for (int16_t py = by; py < by + bh; ++py) {
+    // Scaled glyph rows repeat the same line, so it is only rebuilt once per row
+    const int16_t glyphRow = (py - y) / scale;
+    if (glyphRow != builtRow) {
+      buildRow(static_cast<uint8_t>(glyphRow));
+      builtRow = glyphRow;
+    }
+    pushPixels(line, static_cast<size_t>(bw) * 2U);
+  }
+  endPixels();
+}
+
+void ESP32S3BoxLiteDisplay::drawTextAA(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t fg,
+                                       uint16_t bg) {
+  if (!initialized_ || text == nullptr) { return; }
+  if (scale == 0) { scale = 1; }
+
+  const size_t  len       = strlen(text);
+  const int16_t charWidth = 6 * scale;
+  const int16_t cellWidth = 5 * scale;
+  if (len == 0 || x >= clip_.current().x1) { return; }
+  int32_t textWidth = static_cast<int32_t>(len) * charWidth - scale;
+  textWidth = std::min<int32_t>(textWidth, clip_.current().x1 - x);
+
+  int16_t bx = x, by = y;
+  int16_t bw = static_cast<int16_t>(textWidth);
+  int16_t bh = 7 * scale;
+  if (!clipRect(bx, by, bw, bh)) { return; }
+
+  uint16_t ramp[kCoverageMax + 1];
+  makeCoverageRamp(fg, bg, ramp);
+  uint16_t line[Width];
+
+  setAddressWindow(bx, by, bx + bw - 1, by + bh - 1);
+  for (int16_t py = by; py < by + bh; ++py) {
+    for (int16_t i = 0; i < bw; ++i) {
+      const int32_t rel = bx - x + i;
+      const int32_t col = rel % charWidth;
+      const uint8_t level =
+          col < cellWidth ? glyphCoverage(*findGlyph(text[rel / charWidth]), col, py - y, scale) : 0;
+      line[i] = swap565(ramp[level]);
+    }
+    pushPixels(reinterpret_cast<const uint8_t *>(line), static_cast<size_t>(bw) * 2U);
+  }
+  endPixels();
+}
+
+int16_t ESP32S3BoxLiteDisplay::drawString(const ESP32S3BoxLiteFont &font, int16_t x, int16_t y, const char *text,
+                                          uint16_t fg, uint16_t bg) {
+  if (!initialized_ || text == nullptr) { return x; }
+  const int16_t width = font.measure(text);
+
+  int16_t bx = x, by = y;
+  int16_t bw = width;
+  int16_t bh = font.lineHeight;
+  if (!clipRect(bx, by, bw, bh)) { return static_cast<int16_t>(x + width); }
+
+  uint16_t ramp[kCoverageMax + 1];
+  makeCoverageRamp(fg, bg, ramp);
+  for (uint16_t &c : ramp) { c = swap565(c); }
+
+  // Each row is rasterised into coverage levels, then mapped in place
+  uint8_t  levels[Width];
+  uint16_t line[Width];
+  setAddressWindow(bx, by, bx + bw - 1, by + bh - 1);
+  for (int16_t py = by; py < by + bh; ++py) {
+    font.renderRow(text, py - y, bx - x, bw, levels);
+    for (int16_t i = 0; i < bw; ++i) {
+      line[i] = ramp[levels[i]];
+    }
+    pushPixels(reinterpret_cast<const uint8_t *>(line), static_cast<size_t>(bw) * 2U);
+  }
+  endPixels();
+  return static_cast<int16_t>(x + width);
+}
+
+int16_t ESP32S3BoxLiteDisplay::drawString(ESP32S3BoxLiteFontFile &font, int16_t x, int16_t y, const char *text,
+                                          uint16_t fg, uint16_t bg) {
+  if (!initialized_ || text == nullptr || !font.ready()) { return x; }
+
+  uint16_t ramp[kCoverageMax + 1];
+  makeCoverageRamp(fg, bg, ramp);
+  for (uint16_t &c : ramp) { c = swap565(c); }
+
+  uint8_t  levels[Width];
+  uint16_t line[Width];
+  int32_t  pen = x;
+  // Text past the clip's right edge is not laid out, so it costs no flash reads
+  for (const char *p = text; *p != '\0' && pen < clip_.current().x1;) {
+    const int16_t runWidth = font.layoutRun(p);
+    int16_t bx = static_cast<int16_t>(pen), by = y;
+    int16_t bw = runWidth;
+    int16_t bh = font.lineHeight();
+    if (clipRect(bx, by, bw, bh)) {
+      setAddressWindow(bx, by, bx + bw - 1, by + bh - 1);
+      for (int16_t py = by; py < by + bh; ++py) {
+        font.renderRow(py - y, static_cast<int16_t>(bx - pen), bw, levels);
+        for (int16_t i = 0; i < bw; ++i) {
+          line[i] = ramp[levels[i]];
+        }
+        pushPixels(reinterpret_cast<const uint8_t *>(line), static_cast<size_t>(bw) * 2U);
+      }
+      endPixels();
+    }
+    pen += runWidth;
+  }
+  return static_cast<int16_t>(pen);
+}
+
+bool ESP32S3BoxLiteDisplay::drawImage(ESP32S3BoxLiteImageSource &src, int16_t x, int16_t y, uint8_t shrink) {
+  if (!initialized_) { return false; }
+
+  DisplayImageSink sink(*this, x, y);
+  const bool ok = decodeImage(src, sink, shrink);
+  sink.end();
+  return ok;
+}
+
+bool ESP32S3BoxLiteDisplay::drawImageFromSPIFFS(const char *path, int16_t x, int16_t y, uint8_t shrink) {
+  if (!initialized_ || path == nullptr) { return false; }
+  if (!SPIFFS.begin(true)) { return false; }
+  File f = SPIFFS.open(path, FILE_READ);
+  if (!f) { return false; }
+
+  ESP32S3BoxLiteImageSource src(f);
+  const bool ok = drawImage(src, x, y, shrink);
+  f.close();
+  return ok;
+}
+
+void ESP32S3BoxLiteDisplay::drawTextCentered(int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg) {
+  if (scale == 0) { scale = 1; }
+  const size_t  len       = strlen(text);
+  const int16_t charWidth = 6 * scale;
+  const int16_t textWidth = static_cast<int16_t>(len) * charWidth - scale;
+  const int16_t x         = (Width - textWidth) / 2;
+  drawText(x, y, text, scale, fg, bg);
+}
+
+// Phase 7 - UI helpers
+
+void ESP32S3BoxLiteDisplay::showMessage(const char *text, uint16_t bgColor) {
+  if (!initialized_) { return; }
+  fillScreen(bgColor);
+
+  // Split text into lines at '\n' or auto-wrap at ~26 chars per line (scale=1)
+  // We'll use scale=2 for readability, wrap at 13 chars (Width/12 = ~26 pixels per char)
+  constexpr uint8_t kScale = 2;
+  constexpr int16_t kMaxCharsPerLine = (Width - 20) / (6 * kScale);
+  constexpr int16_t kLineHeight = 7 * kScale + 4;
+
+  char lineBuf[64];
+  size_t len = strlen(text);
+  int16_t curY = (Height - kLineHeight * ((int16_t)((len + kMaxCharsPerLine - 1) / kMaxCharsPerLine))) / 2;
+  if (curY < 4) { curY = 4; }
+
+  size_t pos = 0;
+  while (pos < len) {
+    size_t end = pos + kMaxCharsPerLine;
+    if (end > len) { end = len; }
+    // Try to break at space
+    if (end < len && text[end] != ' ') {
+      size_t breakAt = end;
+      while (breakAt > pos && text[breakAt] != ' ') { --breakAt; }
+      if (breakAt > pos) { end = breakAt; }
+    }
+    const size_t lineLen = end - pos;
+    memcpy(lineBuf, text + pos, lineLen);
+    lineBuf[lineLen] = '\0';
+    drawTextCentered(curY, lineBuf, kScale, ColorWhite, bgColor);
+    curY += kLineHeight;
+    pos = end;
+    if (pos < len && text[pos] == ' ') { ++pos; }
+  }
+}
+
+void ESP32S3BoxLiteDisplay::showError(const char *text) {
+  showMessage(text, ColorRed);
+}
+
+void ESP32S3BoxLiteDisplay::showBootScreen(const char *appName, const char *version) {
+  if (!initialized_) { return; }
+  fillScreen(ColorBlack);
+
+  // Title bar
+  fillRect(0, 0, Width, 50, ColorBlue);
+  drawTextCentered(16, appName, 2, ColorWhite, ColorBlue);
+
+  // Version
+  drawTextCentered(70, version, 1, ColorCyan, ColorBlack);
+
+  // Divider
+  fillRect(20, 90, Width - 40, 2, ColorGray);
+
+  // Progress bar animation placeholder
+  drawProgressBar(20, 110, Width - 40, 16, 100, ColorGreen, ColorGray);
+  drawTextCentered(140, "Initializing...", 1, ColorWhite, ColorBlack);
+}
+
+void ESP32S3BoxLiteDisplay::drawStatusBar(const char *left, const char *right, uint16_t bgColor) {
+  if (!initialized_) { return; }
+  constexpr uint16_t kBarHeight = 16;
+  fillRect(0, 0, Width, kBarHeight, bgColor);
+  drawText(4, 4, left, 1, ColorWhite, bgColor);
+
+  // Right-align the right string
+  const size_t  rLen  = strlen(right);
+  const int16_t rX    = static_cast<int16_t>(Width) - static_cast<int16_t>(rLen) * 6 - 4;
+  drawText(rX, 4, right, 1, ColorWhite, bgColor);
+}
+
+// Display list
+
+bool ESP32S3BoxLiteDisplay::beginRecording(ESP32S3BoxLiteDisplayList &list) {
+  if (framebuffer_ != nullptr || list.capacity_ == 0) { return false; }
+  list.setWindow(0, 0, Width - 1, Height - 1);
+  recording_ = &list;
+  return true;
+}
+
+void ESP32S3BoxLiteDisplay::endRecording() {
+  recording_ = nullptr;
+}
+
+void ESP32S3BoxLiteDisplay::drawList(const ESP32S3BoxLiteDisplayList &list) {
+  if (!initialized_) { return; }
+  // A list being spilled goes to the panel; any other list sent while
+  // recording is recorded like the rest of the frame
+  ESP32S3BoxLiteDisplayList *const recording = recording_;
+  if (recording_ == &list) {
+    recording_ = nullptr;
+  }
+
+  for (uint16_t i = 0; i < list.count_; ++i) {
+    const ESP32S3BoxLiteDisplayList::Op &op = list.ops_[i];
+    const uint16_t w = static_cast<uint16_t>(op.x1 - op.x0 + 1);
+    const uint16_t h = static_cast<uint16_t>(op.y1 - op.y0 + 1);
+    setAddressWindow(op.x0, op.y0, op.x1, op.y1);
+    if (op.stride == 0) {
+      sendColor(op.color, static_cast<uint32_t>(w) * h);
+    } else if (op.stride == w) {
+      pushPixels(list.pool_ + op.offset, static_cast<size_t>(w) * h * 2U);
+    } else {
+      // Trimmed by optimize(): rows are a stride apart
+      for (uint16_t row = 0; row < h; ++row) {
+        pushPixels(list.pool_ + op.offset + static_cast<size_t>(row) * op.stride * 2U, w * 2U);
+      }
+    }
+  }
+  endPixels();
+  recording_ = recording;
+}
+
+void ESP32S3BoxLiteDisplay::spillRecording() {
+  recording_->optimize();
+  drawList(*recording_);
+  recording_->clear();
+}
+
+// Buffered mode - PSRAM framebuffer with dirty rectangles
+
+bool ESP32S3BoxLiteDisplay::enableFramebuffer(bool enable) {
+  if (!enable) {
+    if (framebuffer_ != nullptr) {
+      flush();
+      heap_caps_free(framebuffer_);
+      framebuffer_ = nullptr;
+    }
+    return true;
+  }
+  if (framebuffer_ != nullptr) { return true; }
+  if (recording_ != nullptr) { return false; }
+
+  const size_t bytes = static_cast<size_t>(Width) * Height * 2U;
+  uint16_t *fb = nullptr;
+  if (esp_spiram_is_initialized()) {
+    fb = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  }
+  if (fb == nullptr) {
+    fb = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
+  }
+  if (fb == nullptr) { return false; }
+
+  // The panel contents are unknown, so start black and sync everything on
+  // the first flush().
+  memset(fb, 0, bytes);
+  framebuffer_ = fb;
+  dirtyCount_  = 0;
+  markDirty(0, 0, Width - 1, Height - 1);
+  return true;
+}
+
+void ESP32S3BoxLiteDisplay::fbWrite(const uint8_t *bytes, uint16_t color, uint32_t count) {
+  // Either copies `count` wire-order pixels from `bytes`, or repeats `color`
+  // when `bytes` is null. Advances and wraps like the controller's RAM pointer.
+  const uint16_t wire = static_cast<uint16_t>((color >> 8) | (color << 8));
+  while (count > 0) {
+    const uint32_t seg = std::min<uint32_t>(count, fbWinX1_ - fbCurX_ + 1U);
+    uint16_t *dst = framebuffer_ + static_cast<size_t>(fbCurY_) * Width + fbCurX_;
+    if (bytes != nullptr) {
+      memcpy(dst, bytes, seg * 2U);
+      bytes += seg * 2U;
+    } else {
+      for (uint32_t i = 0; i < seg; ++i) {
+        dst[i] = wire;
+      }
+    }
+    count   -= seg;
+    fbCurX_ += seg;
+    if (fbCurX_ > fbWinX1_) {
+      fbCurX_ = fbWinX0_;
+      fbCurY_ = (fbCurY_ >= fbWinY1_) ? fbWinY0_ : fbCurY_ + 1;
+    }
+  }
+}
+
+void ESP32S3BoxLiteDisplay::markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  addDirtyRect(dirty_, dirtyCount_, kMaxDirtyRects, DirtyRect{x0, y0, x1, y1});
+}
+
+void ESP32S3BoxLiteDisplay::flush() {
+  if (framebuffer_ == nullptr || !initialized_) { return; }
+
+  for (uint8_t i = 0; i < dirtyCount_; ++i) {
+    const DirtyRect &r = dirty_[i];
+    const uint16_t w = static_cast<uint16_t>(r.x1 - r.x0 + 1);
+    writeAddressWindow(r.x0, r.y0, r.x1, r.y1);
+
+    // Rows are gathered into the DMA line buffers, so narrow rects still go
+    // out in line-buffer-sized bursts
+    if (w == Width) {
+      // Full-width rows are contiguous in the framebuffer
+      const uint16_t *src = framebuffer_ + static_cast<size_t>(r.y0) * Width;
+      bus_->writePixels(reinterpret_cast<const uint8_t *>(src),
+                        static_cast<size_t>(r.y1 - r.y0 + 1) * Width * 2U);
+    } else {
+      for (int16_t row = r.y0; row <= r.y1; ++row) {
+        const uint16_t *src = framebuffer_ + static_cast<size_t>(row) * Width + r.x0;
+        bus_->writePixels(reinterpret_cast<const uint8_t *>(src), w * 2U);
+      }
+    }
+    bus_->flushPixels();
+  }
+  dirtyCount_ = 0;
+}
+
+// Hardware scroll
+//
+// With MADCTL MY|MV, gate line 0 is the rightmost screen column. The top
+// fixed area (TFA) is therefore the right margin, and a scroll start address
+// of TFA + k shows the picture moved k pixels to the right.
+
+void ESP32S3BoxLiteDisplay::setScrollArea(uint16_t left, uint16_t right) {
+  if (!initialized_ || left + right >= Width) { return; }
+  scrollLeft_ = left;
+  scrollWidth_ = Width - left - right;
+  const uint8_t data[] = {
+      static_cast<uint8_t>(right >> 8), static_cast<uint8_t>(right & 0xFF),
+      static_cast<uint8_t>(scrollWidth_ >> 8), static_cast<uint8_t>(scrollWidth_ & 0xFF),
+      static_cast<uint8_t>(left >> 8), static_cast<uint8_t>(left & 0xFF),
+  };
+  writeCommandWithData(0x33, data, sizeof(data));
+  scrollTo(0);
+}
+
+void ESP32S3BoxLiteDisplay::scrollTo(uint16_t offset) {
+  if (!initialized_) { return; }
+  // Pixels drawn before the scroll must reach the panel first
+  flush();
+  scrollOffset_ = offset % scrollWidth_;
+  const uint16_t tfa = Width - scrollLeft_ - scrollWidth_;
+  const uint16_t ssa = tfa + (scrollWidth_ - scrollOffset_) % scrollWidth_;
+  const uint8_t data[] = {static_cast<uint8_t>(ssa >> 8), static_cast<uint8_t>(ssa & 0xFF)};
+  writeCommandWithData(0x37, data, sizeof(data));
+}
+
+void ESP32S3BoxLiteDisplay::resetScroll() {
+  if (!initialized_) { return; }
+  setScrollArea(0, 0);
+  // NORON leaves scroll mode
+  writeCommand(0x13);
+}
+
+int16_t ESP32S3BoxLiteDisplay::scrollMemoryX(int16_t x) const {
+  if (x < static_cast<int16_t>(scrollLeft_) || x >= static_cast<int16_t>(scrollLeft_ + scrollWidth_)) {
+    return x;
+  }
+  return static_cast<int16_t>(scrollLeft_ + (x - scrollLeft_ + scrollOffset_) % scrollWidth_);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteConsole implementation
+// ===========================================================================
+
+bool ESP32S3BoxLiteConsole::begin(ESP32S3BoxLiteDisplay &disp, int16_t y, uint8_t scale, uint16_t fg,
+                                  uint16_t bg, uint16_t left, uint16_t right) {
+  if (scale == 0) { scale = 1; }
+  const uint16_t cellW = 6U * scale;
+  if (left + right + cellW > ESP32S3BoxLiteDisplay::Width) { return false; }
+
+  disp_  = &disp;
+  y_     = y;
+  scale_ = scale;
+  fg_    = fg;
+  bg_    = bg;
+  left_  = left;
+  // Whole cells only, so a cell never wraps around the end of the area
+  width_ = static_cast<uint16_t>((ESP32S3BoxLiteDisplay::Width - left - right) / cellW * cellW);
+  disp.setScrollArea(left_, ESP32S3BoxLiteDisplay::Width - left_ - width_);
+  clear();
+  return true;
+}
+
+void ESP32S3BoxLiteConsole::end() {
+  if (disp_ == nullptr) { return; }
+  disp_->resetScroll();
+  disp_ = nullptr;
+}
+
+void ESP32S3BoxLiteConsole::clear() {
+  if (disp_ == nullptr) { return; }
+  // Everything outside the text row stays bg, so columns that wrap around
+  // need no redraw there
+  disp_->fillRect(left_, 0, width_, ESP32S3BoxLiteDisplay::Height, bg_);
+  offset_ = 0;
+  cursor_ = 0;
+  disp_->scrollTo(0);
+}
+
+void ESP32S3BoxLiteConsole::putChar(char ch) {
+  const uint16_t cellW = 6U * scale_;
+  if (cursor_ + cellW > width_) {
+    // Move the strip one cell left; the cell that left the screen on the
+    // left is the one that now appears on the right
+    offset_ = static_cast<uint16_t>((offset_ + cellW) % width_);
+    disp_->scrollTo(offset_);
+    cursor_ = static_cast<uint16_t>(width_ - cellW);
+  }
+  const int16_t x = disp_->scrollMemoryX(static_cast<int16_t>(left_ + cursor_));
+  const char text[2] = {ch, '\0'};
+  disp_->drawText(x, y_, text, scale_, fg_, bg_);
+  disp_->fillRect(static_cast<uint16_t>(x + 5 * scale_), static_cast<uint16_t>(y_), scale_, 7U * scale_, bg_);
+  cursor_ = static_cast<uint16_t>(cursor_ + cellW);
+}
+
+void ESP32S3BoxLiteConsole::print(const char *text) {
+  if (disp_ == nullptr || text == nullptr) { return; }
+  for (const char *p = text; *p != '\0'; ++p) {
+    if (*p == '\n') {
+      // Lines are separated by two blank cells
+      putChar(' ');
+      putChar(' ');
+    } else {
+      putChar(*p);
+    }
+  }
+}
+
+void ESP32S3BoxLiteConsole::println(const char *text) {
+  print(text);
+  print("\n");
+}
+
+void ESP32S3BoxLiteConsole::printf(const char *fmt, ...) {
+  char buf[128];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  print(buf);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteLabel implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteLabel::begin(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, uint8_t scale, uint16_t fg,
+                                uint16_t bg) {
+  disp_    = &disp;
+  x_       = x;
+  y_       = y;
+  scale_   = scale == 0 ? 1 : scale;
+  fg_      = fg;
+  bg_      = bg;
+  shown_   = 0;
+  repaint_ = false;
+  text_[0] = '\0';
+}
+
+void ESP32S3BoxLiteLabel::set(const char *text) {
+  if (disp_ == nullptr || text == nullptr) { return; }
+  const uint8_t len  = static_cast<uint8_t>(strnlen(text, MaxChars));
+  const int32_t cell = 6 * scale_;
+  auto same = [&](uint8_t i) { return !repaint_ && i < shown_ && text_[i] == text[i]; };
+
+  // Each run of changed cells is one drawText() block
+  cellsDrawn_ = 0;
+  char run[MaxChars + 1];
+  for (uint8_t i = 0; i < len;) {
+    if (same(i)) {
+      ++i;
+      continue;
+    }
+    uint8_t end = static_cast<uint8_t>(i + 1);
+    while (end < len && !same(end)) { ++end; }
+    // drawText() leaves out the gap after the last character
+    const int32_t px = x_ + i * cell;
+    if (i == shown_ && i > 0) { fillBg(px - scale_, px); }
+    if (px >= ESP32S3BoxLiteDisplay::Width) { break; }
+    memcpy(run, text + i, end - i);
+    run[end - i] = '\0';
+    disp_->drawText(static_cast<int16_t>(px), y_, run, scale_, fg_, bg_);
+    cellsDrawn_ = static_cast<uint8_t>(cellsDrawn_ + end - i);
+    i = end;
+  }
+  if (len < shown_) { fillBg(x_ + (len > 0 ? len * cell - scale_ : 0), x_ + shown_ * cell - scale_); }
+
+  memcpy(text_, text, len);
+  text_[len] = '\0';
+  shown_     = len;
+  repaint_   = false;
+}
+
+void ESP32S3BoxLiteLabel::printf(const char *fmt, ...) {
+  char buf[MaxChars + 1];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  set(buf);
+}
+
+void ESP32S3BoxLiteLabel::setPosition(int16_t x, int16_t y) {
+  if (x == x_ && y == y_) { return; }
+  fillBg(x_, x_ + shown_ * 6 * scale_ - scale_);
+  shown_ = 0;
+  x_     = x;
+  y_     = y;
+}
+
+void ESP32S3BoxLiteLabel::setScale(uint8_t scale) {
+  if (scale == 0) { scale = 1; }
+  if (scale == scale_) { return; }
+  fillBg(x_, x_ + shown_ * 6 * scale_ - scale_);
+  shown_ = 0;
+  scale_ = scale;
+}
+
+void ESP32S3BoxLiteLabel::setColors(uint16_t fg, uint16_t bg) {
+  if (fg == fg_ && bg == bg_) { return; }
+  fg_      = fg;
+  bg_      = bg;
+  repaint_ = true;
+}
+
+void ESP32S3BoxLiteLabel::fillBg(int32_t x0, int32_t x1) {
+  if (disp_ == nullptr) { return; }
+  x0 = std::max<int32_t>(x0, 0);
+  x1 = std::min<int32_t>(x1, ESP32S3BoxLiteDisplay::Width);
+  const int32_t y0 = std::max<int32_t>(y_, 0);
+  const int32_t y1 = std::min<int32_t>(y_ + 7 * scale_, ESP32S3BoxLiteDisplay::Height);
+  if (x0 >= x1 || y0 >= y1) { return; }
+  disp_->fillRect(static_cast<uint16_t>(x0), static_cast<uint16_t>(y0), static_cast<uint16_t>(x1 - x0),
+                  static_cast<uint16_t>(y1 - y0), bg_);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteWidget implementation
+// ===========================================================================
+
+ESP32S3BoxLiteWidget::~ESP32S3BoxLiteWidget() {
+  if (ui_ != nullptr) { ui_->remove(*this); }
+}
+
+void ESP32S3BoxLiteWidget::setBounds(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (x == x_ && y == y_ && w == w_ && h == h_) { return; }
+  invalidate();
+  x_ = x;
+  y_ = y;
+  w_ = w;
+  h_ = h;
+  invalidate();
+}
+
+void ESP32S3BoxLiteWidget::setVisible(bool visible) {
+  if (visible == visible_) { return; }
+  // Either way the area changes: the widget appears or uncovers what is below
+  visible_ = true;
+  invalidate();
+  visible_ = visible;
+}
+
+void ESP32S3BoxLiteWidget::invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (ui_ == nullptr || !visible_) { return; }
+  const int32_t x0 = std::max<int32_t>(x, 0);
+  const int32_t y0 = std::max<int32_t>(y, 0);
+  const int32_t x1 = std::min<int32_t>(x + w, w_);
+  const int32_t y1 = std::min<int32_t>(y + h, h_);
+  if (x0 >= x1 || y0 >= y1) { return; }
+  ui_->invalidate(static_cast<int16_t>(x_ + x0), static_cast<int16_t>(y_ + y0), static_cast<int16_t>(x1 - x0),
+                  static_cast<int16_t>(y1 - y0));
+}
+
+void ESP32S3BoxLiteWidget::invalidateText(int16_t x, int16_t y, uint8_t scale, const char *before, const char *after,
+                                          bool alignRight) {
+  if (scale == 0) { scale = 1; }
+  const int32_t lenA = static_cast<int32_t>(strlen(before));
+  const int32_t lenB = static_cast<int32_t>(strlen(after));
+  // k counts cells from the start, or from the end when right-aligned
+  auto at = [&](const char *s, int32_t len, int32_t k) -> char {
+    if (k >= len) { return '\0'; }
+    return alignRight ? s[len - 1 - k] : s[k];
+  };
+  int32_t first = -1;
+  int32_t last  = -1;
+  for (int32_t k = 0; k < std::max(lenA, lenB); ++k) {
+    if (at(before, lenA, k) == at(after, lenB, k)) { continue; }
+    if (first < 0) { first = k; }
+    last = k;
+  }
+  if (first < 0) { return; }
+  const int32_t cell = 6 * scale;
+  const int32_t left = alignRight ? x - (last + 1) * cell : x + first * cell;
+  invalidate(static_cast<int16_t>(left), y, static_cast<int16_t>((last - first + 1) * cell),
+             static_cast<int16_t>(7 * scale));
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteProgressWidget implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteProgressWidget::setValue(uint8_t percent) {
+  if (percent > 100) { percent = 100; }
+  if (percent == percent_) { return; }
+  // Only the band between the old and the new fill edge changes colour
+  const int16_t a = fillWidth(percent_);
+  const int16_t b = fillWidth(percent);
+  percent_ = percent;
+  if (a != b) { invalidate(std::min(a, b), 0, static_cast<int16_t>(std::abs(b - a)), h_); }
+}
+
+void ESP32S3BoxLiteProgressWidget::setColors(uint16_t fg, uint16_t bg) {
+  if (fg == fg_ && bg == bg_) { return; }
+  fg_ = fg;
+  bg_ = bg;
+  invalidate();
+}
+
+void ESP32S3BoxLiteProgressWidget::paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const {
+  const int16_t x    = static_cast<int16_t>(x_ - originX);
+  const int16_t y    = static_cast<int16_t>(y_ - originY);
+  const int16_t fill = fillWidth(percent_);
+  canvas.fillRect(x, y, fill, h_, fg_);
+  canvas.fillRect(static_cast<int16_t>(x + fill), y, static_cast<int16_t>(w_ - fill), h_, bg_);
+}
+
+int16_t ESP32S3BoxLiteProgressWidget::fillWidth(uint8_t percent) const {
+  // Same rounding as drawProgressBar()
+  return static_cast<int16_t>((static_cast<int32_t>(w_) * percent) / 100);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteStatusBarWidget implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteStatusBarWidget::setLeft(const char *text) {
+  if (text == nullptr) { return; }
+  char next[MaxChars + 1];
+  const size_t len = strnlen(text, MaxChars);
+  memcpy(next, text, len);
+  next[len] = '\0';
+  invalidateText(4, 4, 1, left_, next);
+  memcpy(left_, next, len + 1);
+}
+
+void ESP32S3BoxLiteStatusBarWidget::setRight(const char *text) {
+  if (text == nullptr) { return; }
+  char next[MaxChars + 1];
+  const size_t len = strnlen(text, MaxChars);
+  memcpy(next, text, len);
+  next[len] = '\0';
+  invalidateText(static_cast<int16_t>(w_ - 4), 4, 1, right_, next, true);
+  memcpy(right_, next, len + 1);
+}
+
+void ESP32S3BoxLiteStatusBarWidget::setColor(uint16_t bg) {
+  if (bg == bg_) { return; }
+  bg_ = bg;
+  invalidate();
+}
+
+void ESP32S3BoxLiteStatusBarWidget::paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const {
+  // Laid out as drawStatusBar()
+  const int16_t x = static_cast<int16_t>(x_ - originX);
+  const int16_t y = static_cast<int16_t>(y_ - originY);
+  constexpr uint16_t kText = ESP32S3BoxLiteDisplay::ColorWhite;
+  canvas.fillRect(x, y, w_, h_, bg_);
+  canvas.drawText(static_cast<int16_t>(x + 4), static_cast<int16_t>(y + 4), left_, 1, kText, bg_);
+  const int16_t rX = static_cast<int16_t>(x + w_ - static_cast<int16_t>(strlen(right_)) * 6 - 4);
+  canvas.drawText(rX, static_cast<int16_t>(y + 4), right_, 1, kText, bg_);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteLabelWidget implementation
+// ===========================================================================
+
+ESP32S3BoxLiteLabelWidget::ESP32S3BoxLiteLabelWidget(int16_t x, int16_t y, uint8_t maxChars, uint8_t scale,
+                                                     uint16_t fg, uint16_t bg)
+    : ESP32S3BoxLiteWidget(x, y, 0, 0),
+      maxChars_(std::min(std::max<uint8_t>(maxChars, 1), MaxChars)),
+      scale_(scale == 0 ? 1 : scale),
+      fg_(fg),
+      bg_(bg) {
+  w_ = static_cast<int16_t>(maxChars_ * 6 * scale_ - scale_);
+  h_ = static_cast<int16_t>(7 * scale_);
+}
+
+void ESP32S3BoxLiteLabelWidget::setText(const char *text) {
+  if (text == nullptr) { return; }
+  char next[MaxChars + 1];
+  const size_t len = strnlen(text, maxChars_);
+  memcpy(next, text, len);
+  next[len] = '\0';
+  invalidateText(0, 0, scale_, text_, next);
+  memcpy(text_, next, len + 1);
+}
+
+void ESP32S3BoxLiteLabelWidget::printf(const char *fmt, ...) {
+  char buf[MaxChars + 1];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  setText(buf);
+}
+
+void ESP32S3BoxLiteLabelWidget::setColors(uint16_t fg, uint16_t bg) {
+  if (fg == fg_ && bg == bg_) { return; }
+  fg_ = fg;
+  bg_ = bg;
+  invalidate();
+}
+
+void ESP32S3BoxLiteLabelWidget::paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const {
+  const int16_t x = static_cast<int16_t>(x_ - originX);
+  const int16_t y = static_cast<int16_t>(y_ - originY);
+  canvas.fillRect(x, y, w_, h_, bg_);
+  canvas.drawText(x, y, text_, scale_, fg_, bg_);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteMessageWidget implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteMessageWidget::show(const char *text, uint16_t bg) {
+  if (text == nullptr) { return; }
+  const size_t len = strnlen(text, MaxChars);
+  if (visible_ && bg == bg_ && strlen(text_) == len && memcmp(text_, text, len) == 0) { return; }
+  memcpy(text_, text, len);
+  text_[len] = '\0';
+  bg_        = bg;
+  if (visible_) {
+    invalidate();
+  } else {
+    setVisible(true);
+  }
+}
+
+void ESP32S3BoxLiteMessageWidget::paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const {
+  // Wrapped and centred as showMessage(), inside the box
+  constexpr uint8_t kScale      = 2;
+  constexpr int16_t kLineHeight = 7 * kScale + 4;
+  const int16_t x = static_cast<int16_t>(x_ - originX);
+  const int16_t y = static_cast<int16_t>(y_ - originY);
+  canvas.fillRect(x, y, w_, h_, bg_);
+
+  const size_t len      = strlen(text_);
+  const size_t perLine  = static_cast<size_t>(std::max<int16_t>((w_ - 20) / (6 * kScale), 1));
+  // End of the line that starts at pos, breaking at a space when possible
+  auto lineEnd = [&](size_t pos) {
+    size_t end = std::min(pos + perLine, len);
+    if (end < len && text_[end] != ' ') {
+      size_t breakAt = end;
+      while (breakAt > pos && text_[breakAt] != ' ') { --breakAt; }
+      if (breakAt > pos) { end = breakAt; }
+    }
+    return end;
+  };
+  auto nextLine = [&](size_t end) { return end < len && text_[end] == ' ' ? end + 1 : end; };
+
+  int16_t lines = 0;
+  for (size_t pos = 0; pos < len; pos = nextLine(lineEnd(pos))) { ++lines; }
+  int16_t curY = static_cast<int16_t>(y + std::max<int16_t>((h_ - kLineHeight * lines) / 2, 4));
+
+  char lineBuf[64];
+  for (size_t pos = 0; pos < len && curY + 7 * kScale <= y + h_; curY += kLineHeight) {
+    const size_t end     = lineEnd(pos);
+    const size_t lineLen = std::min(end - pos, sizeof(lineBuf) - 1);
+    memcpy(lineBuf, text_ + pos, lineLen);
+    lineBuf[lineLen] = '\0';
+    const int16_t textW = static_cast<int16_t>(lineLen * 6 * kScale - kScale);
+    canvas.drawText(static_cast<int16_t>(x + (w_ - textW) / 2), curY, lineBuf, kScale,
+                    ESP32S3BoxLiteDisplay::ColorWhite, bg_);
+    pos = nextLine(end);
+  }
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteUi implementation
+// ===========================================================================
+
+bool ESP32S3BoxLiteUi::begin(ESP32S3BoxLiteDisplay &disp, uint16_t background) {
+  end();
+  if (!canvas_.createSprite(ESP32S3BoxLiteDisplay::Width, BandRows,
+                            ESP32S3BoxLiteSprite::WireOrder | ESP32S3BoxLiteSprite::InternalRam)) {
+    return false;
+  }
+  disp_       = &disp;
+  background_ = background;
+  invalidateAll();
+  return true;
+}
+
+void ESP32S3BoxLiteUi::end() {
+  while (count_ > 0) { widgets_[--count_]->ui_ = nullptr; }
+  canvas_.deleteSprite();
+  disp_       = nullptr;
+  dirtyCount_ = 0;
+}
+
+bool ESP32S3BoxLiteUi::add(ESP32S3BoxLiteWidget &widget) {
+  if (count_ >= MaxWidgets || widget.ui_ != nullptr) { return false; }
+  widgets_[count_++] = &widget;
+  widget.ui_         = this;
+  widget.invalidate();
+  return true;
+}
+
+void ESP32S3BoxLiteUi::remove(ESP32S3BoxLiteWidget &widget) {
+  if (widget.ui_ != this) { return; }
+  widget.invalidate();
+  for (uint8_t i = 0; i < count_; ++i) {
+    if (widgets_[i] != &widget) { continue; }
+    memmove(&widgets_[i], &widgets_[i + 1], (count_ - i - 1) * sizeof(widgets_[0]));
+    --count_;
+    break;
+  }
+  widget.ui_ = nullptr;
+}
+
+void ESP32S3BoxLiteUi::setBackground(uint16_t color) {
+  if (color == background_) { return; }
+  background_ = color;
+  invalidateAll();
+}
+
+void ESP32S3BoxLiteUi::invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (disp_ == nullptr) { return; }
+  const int32_t x0 = std::max<int32_t>(x, 0);
+  const int32_t y0 = std::max<int32_t>(y, 0);
+  const int32_t x1 = std::min<int32_t>(x + w, ESP32S3BoxLiteDisplay::Width) - 1;
+  const int32_t y1 = std::min<int32_t>(y + h, ESP32S3BoxLiteDisplay::Height) - 1;
+  if (x0 > x1 || y0 > y1) { return; }
+  addDirtyRect(dirty_, dirtyCount_, kMaxDirtyRects,
+               DirtyRect{static_cast<int16_t>(x0), static_cast<int16_t>(y0), static_cast<int16_t>(x1),
+                         static_cast<int16_t>(y1)});
+}
+
+uint32_t ESP32S3BoxLiteUi::render() {
+  if (disp_ == nullptr) { return 0; }
+  uint32_t sent = 0;
+  for (uint8_t i = 0; i < dirtyCount_; ++i) {
+    const DirtyRect &r = dirty_[i];
+    const int16_t    w = static_cast<int16_t>(r.x1 - r.x0 + 1);
+    for (int16_t y = r.y0; y <= r.y1; y = static_cast<int16_t>(y + BandRows)) {
+      const int16_t h = std::min<int16_t>(BandRows, static_cast<int16_t>(r.y1 - y + 1));
+      renderBand(r.x0, y, w, h);
+      sent += static_cast<uint32_t>(w) * h;
+    }
+  }
+  dirtyCount_ = 0;
+  return sent;
+}
+
+void ESP32S3BoxLiteUi::renderBand(int16_t x0, int16_t y0, int16_t w, int16_t h) {
+  auto covers = [&](const ESP32S3BoxLiteWidget &wd) {
+    return wd.visible_ && wd.x_ <= x0 && wd.y_ <= y0 && wd.x_ + wd.w_ >= x0 + w && wd.y_ + wd.h_ >= y0 + h;
+  };
+  auto touches = [&](const ESP32S3BoxLiteWidget &wd) {
+    return wd.visible_ && wd.x_ < x0 + w && wd.y_ < y0 + h && wd.x_ + wd.w_ > x0 && wd.y_ + wd.h_ > y0;
+  };
+
+  // Widgets are opaque: nothing under the topmost one that covers the band
+  // can show, so painting starts there
+  uint8_t first = count_;
+  while (first > 0 && !covers(*widgets_[first - 1])) { --first; }
+  if (first == 0) {
+    canvas_.fillRect(0, 0, w, h, background_);
+  } else {
+    --first;
+  }
+  for (uint8_t i = first; i < count_; ++i) {
+    if (touches(*widgets_[i])) { widgets_[i]->paint(canvas_, x0, y0); }
+  }
+  canvas_.pushSubRect(*disp_, x0, y0, 0, 0, w, h);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteFont implementation
+// ===========================================================================
+
+const ESP32S3BoxLiteGlyph *ESP32S3BoxLiteFont::glyph(uint16_t ch) const {
+  if (ch < first || ch > last) { return nullptr; }
+  return &glyphs[ch - first];
+}
+
+int8_t ESP32S3BoxLiteFont::kern(uint16_t left, uint16_t right) const {
+  const uint32_t key = (static_cast<uint32_t>(left) << 16) | right;
+  uint16_t lo = 0, hi = kernCount;
+  while (lo < hi) {
+    const uint16_t mid   = (lo + hi) / 2;
+    const uint32_t probe = (static_cast<uint32_t>(kerning[mid].left) << 16) | kerning[mid].right;
+    if (probe == key) { return kerning[mid].adjust; }
+    if (probe < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+int16_t ESP32S3BoxLiteFont::measure(const char *text) const {
+  if (text == nullptr) { return 0; }
+  int32_t pen = 0;
+  for (const char *p = text; *p != '\0';) {
+    const uint32_t cp = nextCodepoint(p);
+    const ESP32S3BoxLiteGlyph *g = cp <= 0xFFFF ? glyph(static_cast<uint16_t>(cp)) : nullptr;
+    if (g == nullptr) { continue; }
+    pen += g->advance + kernNext(*this, cp, p);
+  }
+  return static_cast<int16_t>(pen);
+}
+
+void ESP32S3BoxLiteFont::renderRow(const char *text, int16_t row, int16_t x, int16_t count,
+                                   uint8_t *levels) const {
+  if (count <= 0) { return; }
+  memset(levels, 0, static_cast<size_t>(count));
+  if (text == nullptr) { return; }
+
+  int32_t pen = 0;
+  for (const char *p = text; *p != '\0';) {
+    const uint32_t cp = nextCodepoint(p);
+    const ESP32S3BoxLiteGlyph *g = cp <= 0xFFFF ? glyph(static_cast<uint16_t>(cp)) : nullptr;
+    if (g == nullptr) { continue; }
+    blitGlyphRow(*g, bitmap + g->offset, bpp, row, pen - x, count, levels);
+    pen += g->advance + kernNext(*this, cp, p);
+  }
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteFontFile implementation
+// ===========================================================================
+
+bool ESP32S3BoxLiteFontFile::begin(const char *path, uint16_t cacheGlyphs) {
+  end();
+  if (path == nullptr || cacheGlyphs == 0 || cacheGlyphs >= NoSlot) { return false; }
+  if (!SPIFFS.begin(true)) { return false; }
+  file_ = SPIFFS.open(path, FILE_READ);
+  if (!file_) { return false; }
+
+  uint8_t header[kFontAssetHeaderBytes];
+  if (file_.read(header, sizeof(header)) != sizeof(header) || memcmp(header, kFontAssetMagic, 4) != 0) {
+    end();
+    return false;
+  }
+  glyphCount_    = readLe16(header + 4);
+  bpp_           = header[6];
+  lineHeight_    = header[7];
+  baseline_      = header[8];
+  maxGlyphBytes_ = readLe16(header + 10);
+  indexOffset_   = readLe32(header + 12);
+  if (glyphCount_ == 0 || (bpp_ != 1 && bpp_ != 4)) {
+    end();
+    return false;
+  }
+
+  // Page index, slots, hash buckets and glyph bitmaps share one block
+  const size_t pages = (glyphCount_ + kFontIndexPage - 1) / kFontIndexPage;
+  bucketBits_ = 1;
+  while ((1U << bucketBits_) < 2U * cacheGlyphs) { ++bucketBits_; }
+  const size_t pageBytes   = pages * sizeof(uint32_t);
+  const size_t slotBytes   = cacheGlyphs * sizeof(Slot);
+  const size_t bucketBytes = (size_t(1) << bucketBits_) * sizeof(uint16_t);
+  const size_t bytes       = pageBytes + slotBytes + bucketBytes + size_t(cacheGlyphs) * maxGlyphBytes_;
+
+  uint8_t *block = nullptr;
+  if (esp_spiram_is_initialized()) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) {
+    end();
+    return false;
+  }
+  block_     = block;
+  pageFirst_ = reinterpret_cast<uint32_t *>(block);
+  slots_     = reinterpret_cast<Slot *>(block + pageBytes);
+  buckets_   = reinterpret_cast<uint16_t *>(block + pageBytes + slotBytes);
+  bits_      = block + pageBytes + slotBytes + bucketBytes;
+  slotCount_ = cacheGlyphs;
+
+  for (size_t page = 0; page < pages; ++page) {
+    uint8_t cp[4];
+    if (!file_.seek(indexOffset_ + page * kFontIndexPage * kFontIndexEntryBytes) ||
+        file_.read(cp, sizeof(cp)) != sizeof(cp)) {
+      end();
+      return false;
+    }
+    pageFirst_[page] = readLe32(cp);
+  }
+
+  // Every slot starts empty, oldest first
+  for (uint16_t i = 0; i < slotCount_; ++i) {
+    slots_[i]         = Slot{};
+    slots_[i].cp      = kNoCodepoint;
+    slots_[i].older   = i == 0 ? NoSlot : static_cast<uint16_t>(i - 1);
+    slots_[i].newer   = i + 1 == slotCount_ ? NoSlot : static_cast<uint16_t>(i + 1);
+    slots_[i].chain   = NoSlot;
+  }
+  for (size_t b = 0; b < (size_t(1) << bucketBits_); ++b) {
+    buckets_[b] = NoSlot;
+  }
+  oldest_      = 0;
+  newest_      = static_cast<uint16_t>(slotCount_ - 1);
+  run_         = 0;
+  placedCount_ = 0;
+  stats_       = ESP32S3BoxLiteGlyphCacheStats{};
+  return true;
+}
+
+void ESP32S3BoxLiteFontFile::end() {
+  if (block_ != nullptr) {
+    heap_caps_free(block_);
+    block_ = nullptr;
+  }
+  pageFirst_   = nullptr;
+  slots_       = nullptr;
+  buckets_     = nullptr;
+  bits_        = nullptr;
+  slotCount_   = 0;
+  placedCount_ = 0;
+  if (file_) { file_.close(); }
+}
+
+uint16_t ESP32S3BoxLiteFontFile::bucketOf(uint32_t cp) const {
+  return static_cast<uint16_t>((cp * 2654435761U) >> (32 - bucketBits_));
+}
+
+void ESP32S3BoxLiteFontFile::touch(uint16_t i) {
+  if (i == newest_) { return; }
+  Slot &s = slots_[i];
+  if (s.older != NoSlot) {
+    slots_[s.older].newer = s.newer;
+  } else {
+    oldest_ = s.newer;
+  }
+  slots_[s.newer].older = s.older;
+  s.older = newest_;
+  s.newer = NoSlot;
+  slots_[newest_].newer = i;
+  newest_ = i;
+}
+
+uint16_t ESP32S3BoxLiteFontFile::lookup(uint32_t cp) {
+  const uint16_t bucket = bucketOf(cp);
+  for (uint16_t i = buckets_[bucket]; i != NoSlot; i = slots_[i].chain) {
+    if (slots_[i].cp == cp) {
+      ++stats_.hits;
+      touch(i);
+      return i;
+    }
+  }
+
+  // Replace the least recently used slot the current run does not need
+  uint16_t victim = oldest_;
+  while (victim != NoSlot && slots_[victim].run == run_) {
+    victim = slots_[victim].newer;
+  }
+  if (victim == NoSlot) { return NoSlot; }
+  Slot &slot = slots_[victim];
+  if (slot.cp != kNoCodepoint) {
+    uint16_t *link = &buckets_[bucketOf(slot.cp)];
+    while (*link != victim) { link = &slots_[*link].chain; }
+    *link = slot.chain;
+    ++stats_.evictions;
+  }
+  ++stats_.misses;
+  slot.cp      = cp;
+  slot.present = loadGlyph(cp, slot.glyph, bits_ + size_t(victim) * maxGlyphBytes_);
+  slot.chain   = buckets_[bucket];
+  buckets_[bucket] = victim;
+  touch(victim);
+  return victim;
+}
+
+bool ESP32S3BoxLiteFontFile::loadGlyph(uint32_t cp, ESP32S3BoxLiteGlyph &glyph, uint8_t *bits) {
+  glyph = ESP32S3BoxLiteGlyph{};
+
+  // The page that would hold cp, then a search of its entries
+  const uint16_t pages = (glyphCount_ + kFontIndexPage - 1) / kFontIndexPage;
+  uint16_t lo = 0, hi = pages;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (pageFirst_[mid] <= cp) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == 0) { return false; }
+  const uint32_t first = static_cast<uint32_t>(lo - 1) * kFontIndexPage;
+  const size_t   n     = std::min<uint32_t>(kFontIndexPage, glyphCount_ - first);
+  uint8_t entries[kFontIndexPage * kFontIndexEntryBytes];
+  if (!file_.seek(indexOffset_ + first * kFontIndexEntryBytes) ||
+      file_.read(entries, n * kFontIndexEntryBytes) != n * kFontIndexEntryBytes) {
+    return false;
+  }
+
+  size_t a = 0, b = n;
+  while (a < b) {
+    const size_t   mid   = (a + b) / 2;
+    const uint32_t probe = readLe32(entries + mid * kFontIndexEntryBytes);
+    if (probe == cp) {
+      const uint8_t *e = entries + mid * kFontIndexEntryBytes;
+      glyph.width   = e[8];
+      glyph.height  = e[9];
+      glyph.advance = e[10];
+      glyph.xOffset = static_cast<int8_t>(e[11]);
+      glyph.yOffset = static_cast<int8_t>(e[12]);
+      const size_t bytes = (static_cast<size_t>(glyph.width) * glyph.height * bpp_ + 7) / 8;
+      if (bytes > maxGlyphBytes_) { return false; }
+      return bytes == 0 || (file_.seek(readLe32(e + 4)) && file_.read(bits, bytes) == bytes);
+    }
+    if (probe < cp) {
+      a = mid + 1;
+    } else {
+      b = mid;
+    }
+  }
+  return false;
+}
+
+int16_t ESP32S3BoxLiteFontFile::measure(const char *text) {
+  if (!ready() || text == nullptr) { return 0; }
+  ++run_;  // nothing pinned
+  int32_t pen = 0;
+  for (const char *p = text; *p != '\0';) {
+    const uint16_t i = lookup(nextCodepoint(p));
+    if (i != NoSlot && slots_[i].present) {
+      pen += slots_[i].glyph.advance;
+    }
+  }
+  return static_cast<int16_t>(pen);
+}
+
+int16_t ESP32S3BoxLiteFontFile::layoutRun(const char *&text) {
+  placedCount_ = 0;
+  if (!ready() || text == nullptr) { return 0; }
+  ++run_;
+  int32_t pen = 0;
+  while (*text != '\0' && placedCount_ < MaxRun) {
+    const char    *p = text;
+    const uint16_t i = lookup(nextCodepoint(p));
+    if (i == NoSlot) { break; }  // every slot holds a glyph of this run
+    text = p;
+    Slot &slot = slots_[i];
+    slot.run   = run_;
+    if (!slot.present) { continue; }
+    placed_[placedCount_++] = Placed{ i, static_cast<int16_t>(pen) };
+    pen += slot.glyph.advance;
+  }
+  return static_cast<int16_t>(pen);
+}
+
+void ESP32S3BoxLiteFontFile::renderRow(int16_t row, int16_t x, int16_t count, uint8_t *levels) const {
+  if (count <= 0) { return; }
+  memset(levels, 0, static_cast<size_t>(count));
+  for (uint8_t i = 0; i < placedCount_; ++i) {
+    const Placed &placed = placed_[i];
+    blitGlyphRow(slots_[placed.slot].glyph, bits_ + size_t(placed.slot) * maxGlyphBytes_, bpp_, row,
+                 placed.pen - x, count, levels);
+  }
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteImageSource implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteImageSource::setMemory(const uint8_t *data, size_t size) {
+  file_ = nullptr;
+  data_ = data != nullptr ? data : chunk_;
+  pos_  = 0;
+  end_  = data != nullptr ? size : 0;
+  base_ = 0;
+}
+
+void ESP32S3BoxLiteImageSource::setFile(fs::File &file) {
+  file_      = &file;
+  data_      = chunk_;
+  pos_ = end_ = 0;
+  base_      = 0;
+  fileStart_ = static_cast<uint32_t>(file.position());
+}
+
+bool ESP32S3BoxLiteImageSource::seek(uint32_t offset) {
+  if (file_ == nullptr) {
+    // A memory block is one chunk that starts at offset 0
+    if (offset > end_) { return false; }
+    pos_ = offset;
+    return true;
+  }
+  if (offset >= base_ && offset <= base_ + end_) {
+    pos_ = offset - base_;
+    return true;
+  }
+  if (!file_->seek(fileStart_ + offset)) { return false; }
+  base_ = offset;
+  pos_ = end_ = 0;
+  return true;
+}
+
+bool ESP32S3BoxLiteImageSource::refill() {
+  if (file_ == nullptr) { return false; }
+  base_ += static_cast<uint32_t>(end_);
+  pos_ = 0;
+  end_ = file_->read(chunk_, sizeof(chunk_));
+  return end_ > 0;
+}
+
+size_t ESP32S3BoxLiteImageSource::read(uint8_t *dst, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    if (pos_ == end_ && !refill()) { break; }
+    const size_t n = std::min(len - done, end_ - pos_);
+    memcpy(dst + done, data_ + pos_, n);
+    pos_ += n;
+    done += n;
+  }
+  return done;
+}
+
+bool ESP32S3BoxLiteImageSource::skip(uint32_t len) {
+  if (len <= end_ - pos_) {
+    pos_ += len;
+    return true;
+  }
+  if (file_ == nullptr) {
+    pos_ = end_;
+    return false;
+  }
+  // Past the buffered chunk: seek and start a fresh one
+  return seek(offset() + len);
+}
+
+// ===========================================================================
+// ESP32S3BoxLitePixelConverter implementation
+// ===========================================================================
+
+bool ESP32S3BoxLitePixelConverter::begin(ESP32S3BoxLitePixelFormat format, uint16_t width,
+                                         ESP32S3BoxLiteDither dither) {
+  end();
+  if (dither == ESP32S3BoxLiteDither::Diffusion) {
+    // Read and written for every pixel, so internal RAM is tried first
+    const size_t bytes = 3U * (width + 2U) * sizeof(int16_t);
+    error_ = static_cast<int16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    if (error_ == nullptr) {
+      error_ = static_cast<int16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
+    }
+    if (error_ == nullptr) { return false; }
+  }
+  format_ = format;
+  dither_ = dither;
+  width_  = width;
+  reset();
+  return true;
+}
+
+void ESP32S3BoxLitePixelConverter::end() {
+  if (error_ != nullptr) {
+    heap_caps_free(error_);
+    error_ = nullptr;
+  }
+  dither_ = ESP32S3BoxLiteDither::None;
+  width_  = 0;
+}
+
+void ESP32S3BoxLitePixelConverter::reset() {
+  row_      = 0;
+  col_      = 0;
+  spanOpen_ = false;
+  memset(carry_, 0, sizeof(carry_));
+  memset(below_, 0, sizeof(below_));
+  if (error_ != nullptr) { memset(error_, 0, 3U * (width_ + 2U) * sizeof(int16_t)); }
+}
+
+uint8_t ESP32S3BoxLitePixelConverter::bytesPerPixel(ESP32S3BoxLitePixelFormat format) {
+  switch (format) {
+    case ESP32S3BoxLitePixelFormat::ARGB8888: return 4;
+    case ESP32S3BoxLitePixelFormat::Gray8:    return 1;
+    default:                                  return 3;
+  }
+}
+
+void ESP32S3BoxLitePixelConverter::convert(const uint8_t *src, uint8_t *wire, uint16_t x, uint16_t count) {
+  if (src == nullptr || wire == nullptr || x >= width_) { return; }
+  count = std::min<uint16_t>(count, width_ - x);
+  if (spanOpen_ && x != col_) { closeSpan(); }
+
+  auto run = [&](auto layout) {
+    using L = decltype(layout);
+    switch (dither_) {
+      case ESP32S3BoxLiteDither::None:
+        convertTruncate<L>(src, wire, count);
+        break;
+      case ESP32S3BoxLiteDither::Ordered:
+        convertOrdered<L>(src, wire, count, x, row_);
+        break;
+      case ESP32S3BoxLiteDither::Diffusion:
+        convertDiffusion<L>(src, wire, count, x, error_, width_ + 2U, carry_, below_);
+        break;
+    }
+  };
+  switch (format_) {
+    case ESP32S3BoxLitePixelFormat::RGB888:   run(PixelLayout<3, 0, 1, 2>{}); break;
+    case ESP32S3BoxLitePixelFormat::BGR888:   run(PixelLayout<3, 2, 1, 0>{}); break;
+    case ESP32S3BoxLitePixelFormat::ARGB8888: run(PixelLayout<4, 2, 1, 0>{}); break;
+    case ESP32S3BoxLitePixelFormat::Gray8:    run(PixelLayout<1, 0, 0, 0>{}); break;
+  }
+  col_      = x + count;
+  spanOpen_ = dither_ == ESP32S3BoxLiteDither::Diffusion;
+}
+
+void ESP32S3BoxLitePixelConverter::nextRow() {
+  if (spanOpen_) { closeSpan(); }
+  ++row_;
+  col_ = 0;
+}
+
+void ESP32S3BoxLitePixelConverter::closeSpan() {
+  // The last pixel and the one after it get no more error from this row
+  for (int c = 0; c < 3; ++c) {
+    int16_t *err = error_ + c * (width_ + 2U);
+    err[col_]     = below_[c][0];
+    err[col_ + 1] = below_[c][1];
+    carry_[c]     = 0;
+    below_[c][0]  = 0;
+    below_[c][1]  = 0;
+  }
+  spanOpen_ = false;
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteSprite implementation
+// ===========================================================================
+
+bool ESP32S3BoxLiteSprite::createSprite(int16_t w, int16_t h, uint8_t flags) {
+  deleteSprite();
+  if (w <= 0 || h <= 0) { return false; }
+  bpp_    = (flags & Indexed8) ? 8 : (flags & Indexed4) ? 4 : 16;
+  w_      = w;
+  h_      = h;
+  pivotX_ = static_cast<int16_t>(w / 2);
+  pivotY_ = static_cast<int16_t>(h / 2);
+  // Indexed sprites keep their palette in front of the pixels
+  const size_t paletteBytes = bpp_ == 16 ? 0 : (size_t(1) << bpp_) * 2U;
+  const size_t bytes        = paletteBytes + rowBytes() * static_cast<size_t>(h);
+
+  uint8_t *block = nullptr;
+  if (flags & InternalRam) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+  }
+  // Try PSRAM first, then regular heap
+  if (block == nullptr && esp_spiram_is_initialized()) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) {
+    w_ = h_ = 0;
+    bpp_ = 16;
+    return false;
+  }
+  memset(block, 0, bytes);
+  clip_.reset(w, h);
+
+  if (bpp_ == 16) {
+    buffer_    = reinterpret_cast<uint16_t *>(block);
+    wireOrder_ = (flags & WireOrder) != 0;
+    return true;
+  }
+  palette_   = reinterpret_cast<uint16_t *>(block);
+  indices_   = block + paletteBytes;
+  wireOrder_ = false;
+  for (uint16_t i = 0; i < (1U << bpp_); ++i) {
+    if (bpp_ == 8) {
+      // rrrgggbb, each field widened by repeating its top bits
+      const uint8_t r = i & 0xE0, g = (i << 3) & 0xE0, b = (i << 6) & 0xC0;
+      palette_[i] = rgbTo565(r | r >> 3 | r >> 6, g | g >> 3 | g >> 6, b | b >> 2 | b >> 4 | b >> 6);
+    } else {
+      palette_[i] = rgbTo565(i * 17, i * 17, i * 17);
+    }
+  }
+  return true;
+}
+
+void ESP32S3BoxLiteSprite::sync() {
+  if (inFlight_ != nullptr) {
+    inFlight_->waitIdle();
+    inFlight_ = nullptr;
+  }
+}
+
+void ESP32S3BoxLiteSprite::deleteSprite() {
+  sync();
+  if (buffer_ != nullptr) {
+    heap_caps_free(buffer_);
+    buffer_ = nullptr;
+  }
+  if (palette_ != nullptr) {
+    heap_caps_free(palette_);
+    palette_ = nullptr;
+    indices_ = nullptr;
+  }
+  w_   = 0;
+  h_   = 0;
+  bpp_ = 16;
+  clip_.reset(0, 0);
+}
+
+void ESP32S3BoxLiteSprite::setPaletteColor(uint8_t index, uint16_t color) {
+  if (palette_ != nullptr && index < (1U << bpp_)) { palette_[index] = color; }
+}
+
+void ESP32S3BoxLiteSprite::setPalette(const uint16_t *colors, uint16_t count, uint8_t first) {
+  if (palette_ == nullptr || colors == nullptr) { return; }
+  const uint16_t size = static_cast<uint16_t>(1U << bpp_);
+  for (uint16_t i = 0; i < count && first + i < size; ++i) { palette_[first + i] = colors[i]; }
+}
+
+uint16_t ESP32S3BoxLiteSprite::paletteColor(uint8_t index) const {
+  return palette_ != nullptr && index < (1U << bpp_) ? palette_[index] : 0;
 }
 
-}  // namespace
+void ESP32S3BoxLiteSprite::cyclePalette(uint8_t first, uint16_t count, int8_t step) {
+  if (palette_ == nullptr || step == 0) { return; }
+  count = static_cast<uint16_t>(std::min<uint32_t>(count, (1U << bpp_) - std::min<uint32_t>(first, 1U << bpp_)));
+  if (count < 2) { return; }
+  uint16_t *entries = palette_ + first;
+  const uint16_t shift = static_cast<uint16_t>(((step % count) + count) % count);
+  std::rotate(entries, entries + (count - shift), entries + count);
+}
 
-// ===========================================================================
-// ESP32S3BoxLiteDisplay implementation
-// ===========================================================================
+uint8_t ESP32S3BoxLiteSprite::nearestIndex(uint16_t color) const {
+  if (palette_ == nullptr) { return 0; }
+  const int32_t r = (color >> 11) << 1, g = (color >> 5) & 0x3F, b = (color & 0x1F) << 1;
+  uint8_t  best = 0;
+  uint32_t bestDist = UINT32_MAX;
+  for (uint16_t i = 0; i < (1U << bpp_) && bestDist != 0; ++i) {
+    const uint16_t c  = palette_[i];
+    const int32_t  dr = ((c >> 11) << 1) - r, dg = ((c >> 5) & 0x3F) - g, db = ((c & 0x1F) << 1) - b;
+    const uint32_t dist = static_cast<uint32_t>(dr * dr + dg * dg + db * db);
+    if (dist < bestDist) {
+      bestDist = dist;
+      best     = static_cast<uint8_t>(i);
+    }
+  }
+  return best;
+}
 
-bool ESP32S3BoxLiteDisplay::begin() {
-  pinMode(kLcdCsPin, OUTPUT);
-  pinMode(kLcdDcPin, OUTPUT);
-  pinMode(kLcdRstPin, OUTPUT);
-  pinMode(kLcdBacklightPin, OUTPUT);
+void ESP32S3BoxLiteSprite::writeSpan(int32_t x, int32_t y, int32_t n, uint16_t color) {
+  if (bpp_ == 16) {
+    color = stored(color);
+    uint16_t *dst = buffer_ + y * w_ + x;
+    for (int32_t i = 0; i < n; ++i) { dst[i] = color; }
+    return;
+  }
+  uint8_t *row = indices_ + static_cast<size_t>(y) * rowBytes();
+  if (bpp_ == 8) {
+    memset(row + x, static_cast<uint8_t>(color), static_cast<size_t>(n));
+    return;
+  }
+  const uint8_t index = color & 0x0F;
+  uint8_t *dst = row + (x >> 1);
+  if ((x & 1) != 0 && n > 0) {
+    *dst = static_cast<uint8_t>((*dst & 0xF0) | index);
+    ++dst;
+    --n;
+  }
+  memset(dst, index * 0x11, static_cast<size_t>(n >> 1));
+  if ((n & 1) != 0) { dst[n >> 1] = static_cast<uint8_t>((dst[n >> 1] & 0x0F) | (index << 4)); }
+}
 
-  digitalWrite(kLcdCsPin, HIGH);
-  digitalWrite(kLcdDcPin, HIGH);
-  // Backlight off during init
-  digitalWrite(kLcdBacklightPin, LOW);
+uint8_t ESP32S3BoxLiteSprite::indexAt(int32_t x, int32_t y) const {
+  const uint8_t *row = indices_ + static_cast<size_t>(y) * rowBytes();
+  return bpp_ == 8 ? row[x] : static_cast<uint8_t>((row[x >> 1] >> ((~x & 1) << 2)) & 0x0F);
+}
 
-  spi_.begin(kLcdClkPin, -1, kLcdMosiPin, kLcdCsPin);
-  spi_.beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+void ESP32S3BoxLiteSprite::fillScreen(uint16_t color) {
+  if (!created()) { return; }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  if (clip.x0 != 0 || clip.y0 != 0 || clip.x1 != w_ || clip.y1 != h_) {
+    fillRect(clip.x0, clip.y0, static_cast<int16_t>(clip.x1 - clip.x0), static_cast<int16_t>(clip.y1 - clip.y0),
+             color);
+    return;
+  }
+  sync();
+  if (bpp_ != 16) {
+    const uint8_t fill = bpp_ == 8 ? static_cast<uint8_t>(color) : static_cast<uint8_t>((color & 0x0F) * 0x11);
+    memset(indices_, fill, rowBytes() * h_);
+    return;
+  }
+  color = stored(color);
+  const int32_t total = static_cast<int32_t>(w_) * h_;
+  for (int32_t i = 0; i < total; ++i) {
+    buffer_[i] = color;
+  }
+}
 
-  digitalWrite(kLcdRstPin, HIGH);
-  delay(50);
-  digitalWrite(kLcdRstPin, LOW);
-  delay(50);
-  digitalWrite(kLcdRstPin, HIGH);
-  delay(150);
+void ESP32S3BoxLiteSprite::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!created() || w <= 0 || h <= 0) { return; }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int32_t x0 = std::max<int32_t>(x, clip.x0);
+  const int32_t y0 = std::max<int32_t>(y, clip.y0);
+  const int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, clip.x1);
+  const int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, clip.y1);
+  if (x0 >= x1 || y0 >= y1) { return; }
+  sync();
+  for (int32_t row = y0; row < y1; ++row) {
+    writeSpan(x0, row, x1 - x0, color);
+  }
+}
 
-  writeCommand(0x01);
-  delay(150);
+void ESP32S3BoxLiteSprite::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!created() || !clip_.current().contains(x, y)) { return; }
+  sync();
+  writeSpan(x, y, 1, color);
+}
 
-  const uint8_t porch[] = {0x0C, 0x0C, 0x00, 0x33, 0x33};
-  writeCommandWithData(0xB2, porch, sizeof(porch));
+void ESP32S3BoxLiteSprite::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  if (!created() || y < clip.y0 || y >= clip.y1 || w <= 0) { return; }
+  const int16_t x0 = std::max<int16_t>(x, clip.x0);
+  const int16_t x1 = static_cast<int16_t>(std::min<int32_t>(static_cast<int32_t>(x) + w, clip.x1));
+  if (x0 >= x1) { return; }
+  sync();
+  writeSpan(x0, y, x1 - x0, color);
+}
 
-  const uint8_t gateCtrl[] = {0x35};
-  writeCommandWithData(0xB7, gateCtrl, sizeof(gateCtrl));
+uint16_t ESP32S3BoxLiteSprite::readPixel(int16_t x, int16_t y) const {
+  if (!created() || x < 0 || y < 0 || x >= w_ || y >= h_) { return 0; }
+  if (bpp_ != 16) { return palette_[indexAt(x, y)]; }
+  const uint16_t c = buffer_[y * w_ + x];
+  return wireOrder_ ? swap565(c) : c;
+}
 
-  const uint8_t vcoms[] = {0x28};
-  writeCommandWithData(0xBB, vcoms, sizeof(vcoms));
+void ESP32S3BoxLiteSprite::fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+  if (outsideClip(clip_.current(), cx - r, cy - r, cx + r, cy + r)) { return; }
+  circleRows(r, [&](int32_t k, int32_t hw) {
+    drawFastHLine(cx - hw, cy - k, 2 * hw + 1, color);
+    if (k != 0) {
+      drawFastHLine(cx - hw, cy + k, 2 * hw + 1, color);
+    }
+  });
+}
 
-  const uint8_t lcmCtrl[] = {0x0C};
-  writeCommandWithData(0xC0, lcmCtrl, sizeof(lcmCtrl));
+void ESP32S3BoxLiteSprite::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                        uint16_t color) {
+  SpriteSpan span{ this, color };
+  scanTriangle(x0, y0, x1, y1, x2, y2, clip_.current(), span);
+}
 
-  const uint8_t vdvVrhEn[] = {0x01, 0xFF};
-  writeCommandWithData(0xC2, vdvVrhEn, sizeof(vdvVrhEn));
+void ESP32S3BoxLiteSprite::fillPolygon(const int16_t *points, uint8_t count, uint16_t color) {
+  if (points == nullptr || count < 3 || count > kMaxPolygonPoints) { return; }
+  FixedPoint pts[kMaxPolygonPoints];
+  for (uint8_t i = 0; i < count; ++i) {
+    pts[i] = { static_cast<int32_t>(points[2 * i]) * 65536, static_cast<int32_t>(points[2 * i + 1]) * 65536 };
+  }
+  SpriteSpan span{ this, color };
+  scanPolygon(pts, count, clip_.current(), span);
+}
 
-  const uint8_t vrhs[] = {0x10};
-  writeCommandWithData(0xC3, vrhs, sizeof(vrhs));
+void ESP32S3BoxLiteSprite::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  if (w <= 0 || h <= 0) { return; }
+  r = std::min<int16_t>(r, std::min(w, h) / 2);
+  if (r <= 0) {
+    fillRect(x, y, w, h, color);
+    return;
+  }
+  fillRect(x, y + r, w, h - 2 * r, color);
+  circleRows(r, [&](int32_t k, int32_t hw) {
+    if (k == 0) { return; }
+    const int16_t sx = x + r - hw;
+    const int16_t sw = w - 2 * r + 2 * hw;
+    drawFastHLine(sx, y + r - k, sw, color);
+    drawFastHLine(sx, y + h - 1 - r + k, sw, color);
+  });
+}
 
-  const uint8_t vdvs[] = {0x20};
-  writeCommandWithData(0xC4, vdvs, sizeof(vdvs));
+void ESP32S3BoxLiteSprite::drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width,
+                                         uint16_t color) {
+  FixedPoint pts[4];
+  thickLineOutline(x0, y0, x1, y1, std::max<uint8_t>(width, 1), pts);
+  SpriteSpan span{ this, color };
+  scanPolygon(pts, 4, clip_.current(), span);
+}
 
-  const uint8_t frameRate[] = {0x0F};
-  writeCommandWithData(0xC6, frameRate, sizeof(frameRate));
+void ESP32S3BoxLiteSprite::fillArc(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, int16_t startDeg,
+                                   int16_t endDeg, uint16_t color) {
+  FixedPoint   pts[kMaxPolygonPoints];
+  const size_t n = arcOutline(cx, cy, outerR, innerR, startDeg, endDeg, pts);
+  SpriteSpan span{ this, color };
+  scanPolygon(pts, n, clip_.current(), span);
+}
 
-  const uint8_t powerCtrl[] = {0xA4, 0xA1};
-  writeCommandWithData(0xD0, powerCtrl, sizeof(powerCtrl));
+void ESP32S3BoxLiteSprite::blendBlock(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels,
+                                      uint16_t color) {
+  if (!created()) { return; }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int32_t x0 = std::max<int32_t>(x, clip.x0);
+  const int32_t y0 = std::max<int32_t>(y, clip.y0);
+  const int32_t x1 = std::min<int32_t>(x + w, clip.x1);
+  const int32_t y1 = std::min<int32_t>(y + h, clip.y1);
+  if (x0 >= x1 || y0 >= y1) { return; }
+  sync();
+  if (bpp_ != 16) {
+    // No colours to blend between: pixels at least half covered take the index
+    for (int32_t row = y0; row < y1; ++row) {
+      const uint8_t *src = levels + (row - y) * w - x;
+      for (int32_t col = x0; col < x1; ++col) {
+        if (src[col] * 2 >= kCoverageMax) { writeSpan(col, row, 1, color); }
+      }
+    }
+    return;
+  }
+  const uint16_t solid = stored(color);
+  for (int32_t row = y0; row < y1; ++row) {
+    const uint8_t *src = levels + (row - y) * w - x;
+    uint16_t      *dst = buffer_ + row * w_;
+    for (int32_t col = x0; col < x1; ++col) {
+      const uint8_t level = src[col];
+      if (level == kCoverageMax) {
+        dst[col] = solid;
+      } else if (level != 0) {
+        dst[col] = stored(blendCoverage(color, stored(dst[col]), level));
+      }
+    }
+  }
+}
 
-  const uint8_t positiveGamma[] = {
-      0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x32, 0x44,
-      0x42, 0x06, 0x0E, 0x12, 0x14, 0x17,
+void ESP32S3BoxLiteSprite::drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  auto plot = [&](int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels) {
+    blendBlock(x, y, w, h, levels, color);
   };
-  writeCommandWithData(0xE0, positiveGamma, sizeof(positiveGamma));
+  wuLine(x0, y0, x1, y1, clip_.current(), plot);
+}
 
-  const uint8_t negativeGamma[] = {
-      0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x31, 0x54,
-      0x47, 0x0E, 0x1C, 0x17, 0x1B, 0x1E,
+void ESP32S3BoxLiteSprite::drawCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+  auto plot = [&](int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels) {
+    blendBlock(x, y, w, h, levels, color);
   };
-  writeCommandWithData(0xE1, negativeGamma, sizeof(negativeGamma));
-
-  const uint8_t colorMode[] = {0x55};
-  writeCommandWithData(0x3A, colorMode, sizeof(colorMode));
-
-  const uint8_t madctl[] = {0xA0};
-  writeCommandWithData(0x36, madctl, sizeof(madctl));
-
-  writeCommand(0x21);
-  writeCommand(0x11);
-  delay(120);
-  writeCommand(0x13);
-  writeCommand(0x29);
-  delay(50);
-
-  // Turn on backlight at 100%
-  setBacklight(100);
-  initialized_ = true;
-  return true;
+  aaCircle(cx, cy, r, false, clip_.current(), plot);
 }
 
-void ESP32S3BoxLiteDisplay::setBacklight(uint8_t percent) {
-  if (!backlightPwmSetup_) {
-    ledcSetup(kBacklightLedcChannel, 5000, 8);
-    ledcAttachPin(kLcdBacklightPin, kBacklightLedcChannel);
-    backlightPwmSetup_ = true;
-  }
-  const uint8_t duty = static_cast<uint8_t>((static_cast<uint16_t>(percent > 100 ? 100 : percent) * 255U) / 100U);
-  ledcWrite(kBacklightLedcChannel, duty);
+void ESP32S3BoxLiteSprite::fillCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+  auto plot = [&](int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels) {
+    blendBlock(x, y, w, h, levels, color);
+  };
+  aaCircle(cx, cy, r, true, clip_.current(), plot);
 }
 
-void ESP32S3BoxLiteDisplay::writeCommand(uint8_t command) {
-  digitalWrite(kLcdDcPin, LOW);
-  digitalWrite(kLcdCsPin, LOW);
-  spi_.write(command);
-  digitalWrite(kLcdCsPin, HIGH);
+void ESP32S3BoxLiteSprite::drawTextAA(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t color) {
+  if (!created() || text == nullptr) { return; }
+  if (scale == 0) { scale = 1; }
+  const int16_t charWidth = 6 * scale;
+  const int16_t cellWidth = 5 * scale;
+  const int16_t cellHeight = 7 * scale;
+  // One glyph row at a time, so each block is a single span
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  uint8_t levels[kAaChunk];
+  int16_t cx = x;
+  for (size_t i = 0; text[i] != '\0' && cx < clip.x1; ++i, cx += charWidth) {
+    if (cx + cellWidth <= clip.x0) { continue; }
+    const Glyph &glyph = *findGlyph(text[i]);
+    for (int16_t py = 0; py < cellHeight; ++py) {
+      if (y + py < clip.y0 || y + py >= clip.y1) { continue; }
+      for (int16_t px0 = 0; px0 < cellWidth; px0 += kAaChunk) {
+        const int16_t n = std::min<int16_t>(kAaChunk, cellWidth - px0);
+        for (int16_t k = 0; k < n; ++k) {
+          levels[k] = glyphCoverage(glyph, px0 + k, py, scale);
+        }
+        blendBlock(cx + px0, y + py, n, 1, levels, color);
+      }
+    }
+  }
 }
 
-void ESP32S3BoxLiteDisplay::writeData(const uint8_t *data, size_t length) {
-  digitalWrite(kLcdDcPin, HIGH);
-  digitalWrite(kLcdCsPin, LOW);
-  spi_.writeBytes(data, length);
-  digitalWrite(kLcdCsPin, HIGH);
+int16_t ESP32S3BoxLiteSprite::drawString(const ESP32S3BoxLiteFont &font, int16_t x, int16_t y, const char *text,
+                                         uint16_t color) {
+  if (!created() || text == nullptr) { return x; }
+  const int16_t width = font.measure(text);
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int32_t x0 = std::max<int32_t>(x, clip.x0);
+  const int32_t x1 = std::min<int32_t>(x + width, clip.x1);
+  uint8_t levels[kAaChunk];
+  for (int16_t row = 0; row < font.lineHeight; ++row) {
+    if (y + row < clip.y0 || y + row >= clip.y1) { continue; }
+    for (int32_t cx = x0; cx < x1; cx += kAaChunk) {
+      const int16_t n = static_cast<int16_t>(std::min<int32_t>(kAaChunk, x1 - cx));
+      font.renderRow(text, row, static_cast<int16_t>(cx - x), n, levels);
+      blendBlock(cx, y + row, n, 1, levels, color);
+    }
+  }
+  return static_cast<int16_t>(x + width);
 }
 
-void ESP32S3BoxLiteDisplay::writeCommandWithData(uint8_t command, const uint8_t *data, size_t length) {
-  writeCommand(command);
-  writeData(data, length);
+int16_t ESP32S3BoxLiteSprite::drawString(ESP32S3BoxLiteFontFile &font, int16_t x, int16_t y, const char *text,
+                                         uint16_t color) {
+  if (!created() || text == nullptr || !font.ready()) { return x; }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  uint8_t levels[kAaChunk];
+  int32_t pen = x;
+  for (const char *p = text; *p != '\0' && pen < clip.x1;) {
+    const int16_t runWidth = font.layoutRun(p);
+    const int32_t x0 = std::max<int32_t>(pen, clip.x0);
+    const int32_t x1 = std::min<int32_t>(pen + runWidth, clip.x1);
+    for (int16_t row = 0; row < font.lineHeight(); ++row) {
+      if (y + row < clip.y0 || y + row >= clip.y1) { continue; }
+      for (int32_t cx = x0; cx < x1; cx += kAaChunk) {
+        const int16_t n = static_cast<int16_t>(std::min<int32_t>(kAaChunk, x1 - cx));
+        font.renderRow(row, static_cast<int16_t>(cx - pen), n, levels);
+        blendBlock(cx, y + row, n, 1, levels, color);
+      }
+    }
+    pen += runWidth;
+  }
+  return static_cast<int16_t>(pen);
 }
 
-void ESP32S3BoxLiteDisplay::setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-  uint8_t data[4];
-
-  writeCommand(0x2A);
-  data[0] = x0 >> 8;
-  data[1] = x0 & 0xFF;
-  data[2] = x1 >> 8;
-  data[3] = x1 & 0xFF;
-  writeData(data, sizeof(data));
+bool ESP32S3BoxLiteSprite::drawImage(ESP32S3BoxLiteImageSource &src, int16_t x, int16_t y, uint8_t shrink) {
+  if (!created()) { return false; }
+  sync();
+
+  class Sink : public ImageSink {
+   public:
+    Sink(ESP32S3BoxLiteSprite &sprite, int32_t x, int32_t y) : sprite_(sprite), ox_(x), oy_(y), nearest_(sprite) {}
+
+    bool begin(int32_t w, int32_t h) override {
+      const ESP32S3BoxLiteClipRect &clip = sprite_.clip_.current();
+      x0 = std::max<int32_t>(0, clip.x0 - ox_);
+      y0 = std::max<int32_t>(0, clip.y0 - oy_);
+      x1 = std::min<int32_t>(w, clip.x1 - ox_);
+      y1 = std::min<int32_t>(h, clip.y1 - oy_);
+      return x0 < x1 && y0 < y1;
+    }
+    void span(int32_t x, int32_t y, const uint16_t *px, int32_t n) override {
+      if (sprite_.bpp_ == 16) {
+        uint16_t *dst = sprite_.buffer_ + (oy_ + y) * sprite_.w_ + ox_ + x;
+        for (int32_t i = 0; i < n; ++i) { dst[i] = sprite_.stored(px[i]); }
+        return;
+      }
+      for (int32_t i = 0; i < n; ++i) { sprite_.writeSpan(ox_ + x + i, oy_ + y, 1, nearest_(px[i])); }
+    }
 
-  writeCommand(0x2B);
-  data[0] = y0 >> 8;
-  data[1] = y0 & 0xFF;
-  data[2] = y1 >> 8;
-  data[3] = y1 & 0xFF;
-  writeData(data, sizeof(data));
+   private:
+    ESP32S3BoxLiteSprite &sprite_;
+    int32_t ox_, oy_;
+    NearestIndexCache nearest_;
+  };
 
-  writeCommand(0x2C);
+  Sink sink(*this, x, y);
+  return decodeImage(src, sink, shrink);
 }
 
-void ESP32S3BoxLiteDisplay::setAddressWindowPublic(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-  setAddressWindow(x0, y0, x1, y1);
+void ESP32S3BoxLiteSprite::drawText(int16_t x, int16_t y, const char *text, uint8_t scale,
+                                     uint16_t fg, uint16_t bg) {
+  if (!created() || text == nullptr) { return; }
+  if (scale == 0) { scale = 1; }
+  sync();
+  const bool indexed = bpp_ != 16;
+  if (!indexed) {
+    fg = stored(fg);
+    bg = stored(bg);
+  }
+  const ESP32S3BoxLiteClipRect &clip = clip_.current();
+  const int16_t charWidth = 6 * scale;
+  const int16_t cellWidth = 5 * scale;
+  int16_t cx = x;
+  for (size_t i = 0; text[i] != '\0' && cx < clip.x1; ++i, cx += charWidth) {
+    if (cx + cellWidth <= clip.x0) { continue; }
+    const Glyph  *glyph = findGlyph(text[i]);
+    const int16_t c0    = std::max<int16_t>(cx, clip.x0);
+    const int16_t c1    = std::min<int16_t>(cx + cellWidth, clip.x1);
+    for (uint8_t row = 0; row < 7; ++row) {
+      const int16_t r0 = std::max<int16_t>(y + row * scale, clip.y0);
+      const int16_t r1 = std::min<int16_t>(y + (row + 1) * scale, clip.y1);
+      if (r0 >= r1) { continue; }
+      if (indexed) {
+        for (int16_t rr = r0; rr < r1; ++rr) {
+          for (int16_t px = c0; px < c1; ++px) {
+            writeSpan(px, rr, 1, (glyph->rows[row] & (0x10 >> ((px - cx) / scale))) ? fg : bg);
+          }
+        }
+        continue;
+      }
+      // Expand the glyph row once, then copy it to the remaining scaled rows
+      uint16_t *dst = buffer_ + r0 * w_;
+      for (int16_t px = c0; px < c1; ++px) {
+        dst[px] = (glyph->rows[row] & (0x10 >> ((px - cx) / scale))) ? fg : bg;
+      }
+      for (int16_t rr = r0 + 1; rr < r1; ++rr) {
+        memcpy(buffer_ + rr * w_ + c0, dst + c0, static_cast<size_t>(c1 - c0) * 2U);
+      }
+    }
+  }
 }
 
-void ESP32S3BoxLiteDisplay::sendRawBuffer(const uint8_t *buf, size_t len) {
-  digitalWrite(kLcdDcPin, HIGH);
-  digitalWrite(kLcdCsPin, LOW);
-  spi_.writeBytes(buf, len);
-  digitalWrite(kLcdCsPin, HIGH);
+void ESP32S3BoxLiteSprite::pushSprite(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y) {
+  pushSubRect(disp, x, y, 0, 0, w_, h_);
 }
 
-void ESP32S3BoxLiteDisplay::sendColor(uint16_t color, uint32_t count) {
-  uint8_t buffer[128];
-  for (size_t i = 0; i < sizeof(buffer); i += 2) {
-    buffer[i]     = color >> 8;
-    buffer[i + 1] = color & 0xFF;
-  }
+void ESP32S3BoxLiteSprite::pushSubRect(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, int16_t sx, int16_t sy,
+                                       int16_t w, int16_t h) {
+  if (!created()) { return; }
+  int32_t dstX = x, dstY = y, srcX = sx, srcY = sy, copyW = w, copyH = h;
+  if (!clipBlit(w_, h_, disp.clipBounds(), dstX, dstY, srcX, srcY, copyW, copyH)) { return; }
 
-  digitalWrite(kLcdDcPin, HIGH);
-  digitalWrite(kLcdCsPin, LOW);
-  while (count > 0) {
-    const uint32_t chunkPixels = std::min<uint32_t>(count, sizeof(buffer) / 2);
-    spi_.writeBytes(buffer, chunkPixels * 2);
-    count -= chunkPixels;
+  disp.setAddressWindowPublic(
+      static_cast<uint16_t>(dstX), static_cast<uint16_t>(dstY),
+      static_cast<uint16_t>(dstX + copyW - 1), static_cast<uint16_t>(dstY + copyH - 1));
+
+  if (bpp_ != 16) {
+    // Indices are expanded through the palette straight into the line
+    // buffer, so only a byte or half a byte per pixel is read
+    constexpr int32_t kBufPixels = 256;
+    uint16_t txBuf[kBufPixels];
+    const uint8_t *row = indices_ + static_cast<size_t>(srcY) * rowBytes();
+    for (int32_t r = 0; r < copyH; ++r, row += rowBytes()) {
+      for (int32_t col = 0; col < copyW; col += kBufPixels) {
+        const int32_t n = std::min<int32_t>(kBufPixels, copyW - col);
+        expandIndexed<true>(row, bpp_, srcX + col, n, palette_, txBuf);
+        disp.pushPixels(reinterpret_cast<const uint8_t *>(txBuf), static_cast<size_t>(n) * 2U);
+      }
+    }
+    disp.endPixels();
+    return;
   }
-  digitalWrite(kLcdCsPin, HIGH);
-}
 
-void ESP32S3BoxLiteDisplay::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-  if (!initialized_ || x >= Width || y >= Height || w == 0 || h == 0) {
+  const uint16_t *src = buffer_ + srcY * w_ + srcX;
+  if (wireOrder_) {
+    if (copyW == w_) {
+      // Full-width rows are contiguous: one bulk transfer, straight from the
+      // sprite when it lives in DMA-capable RAM
+      const size_t bytes = static_cast<size_t>(copyW) * copyH * 2U;
+      if (disp.pushPixelsInPlace(reinterpret_cast<const uint8_t *>(src), bytes)) {
+        inFlight_ = &disp;
+      }
+    } else {
+      for (int32_t row = 0; row < copyH; ++row, src += w_) {
+        disp.pushPixels(reinterpret_cast<const uint8_t *>(src), static_cast<size_t>(copyW) * 2U);
+      }
+    }
+    disp.endPixels();
     return;
   }
-  if (x + w > Width)  { w = Width  - x; }
-  if (y + h > Height) { h = Height - y; }
 
-  setAddressWindow(x, y, x + w - 1, y + h - 1);
-  sendColor(color, static_cast<uint32_t>(w) * h);
+  // Native order: byte-swap through a staging buffer. The display coalesces
+  // the chunks into full-size transfers.
+  constexpr size_t kBufPixels = 256;
+  uint16_t txBuf[kBufPixels];
+  size_t   n = 0;
+  for (int32_t row = 0; row < copyH; ++row, src += w_) {
+    for (int32_t col = 0; col < copyW; ++col) {
+      const uint16_t px = src[col];
+      txBuf[n++] = static_cast<uint16_t>((px << 8) | (px >> 8));
+      if (n == kBufPixels) {
+        disp.pushPixels(reinterpret_cast<const uint8_t *>(txBuf), n * 2U);
+        n = 0;
+      }
+    }
+  }
+  if (n > 0) {
+    disp.pushPixels(reinterpret_cast<const uint8_t *>(txBuf), n * 2U);
+  }
+  disp.endPixels();
 }
 
-void ESP32S3BoxLiteDisplay::fillScreen(uint16_t color) {
-  fillRect(0, 0, Width, Height, color);
+void ESP32S3BoxLiteSprite::pushSprite(ESP32S3BoxLiteSprite &dst, int16_t x, int16_t y, ESP32S3BoxLiteBlend mode,
+                                      uint16_t key) {
+  pushSubRect(dst, x, y, 0, 0, w_, h_, mode, key);
 }
 
-void ESP32S3BoxLiteDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if (!initialized_ || x < 0 || y < 0 || x >= static_cast<int16_t>(Width) || y >= static_cast<int16_t>(Height)) {
-    return;
+void ESP32S3BoxLiteSprite::pushSubRect(ESP32S3BoxLiteSprite &dst, int16_t x, int16_t y, int16_t sx, int16_t sy,
+                                       int16_t w, int16_t h, ESP32S3BoxLiteBlend mode, uint16_t key) {
+  if (!created() || !dst.created()) { return; }
+  int32_t dstX = x, dstY = y, srcX = sx, srcY = sy, copyW = w, copyH = h;
+  if (!clipBlit(w_, h_, dst.clip_.current(), dstX, dstY, srcX, srcY, copyW, copyH)) { return; }
+  dst.sync();
+
+  const bool keyed = mode == ESP32S3BoxLiteBlend::ColorKey;
+  // An overlapping copy within one sprite runs from the far end
+  const bool backwards = &dst == this && (dstY > srcY || (dstY == srcY && dstX > srcX));
+  const int32_t step = backwards ? -1 : 1;
+  NearestIndexCache nearest(dst);
+
+  for (int32_t i = 0; i < copyH; ++i) {
+    const int32_t r  = backwards ? copyH - 1 - i : i;
+    const int32_t ys = srcY + r, yd = dstY + r;
+
+    if (bpp_ == 16 && dst.bpp_ == 16 && wireOrder_ == dst.wireOrder_) {
+      const uint16_t *s = buffer_ + ys * w_ + srcX;
+      uint16_t       *d = dst.buffer_ + yd * dst.w_ + dstX;
+      if (!keyed) {
+        memmove(d, s, static_cast<size_t>(copyW) * 2U);
+        continue;
+      }
+      const uint16_t k = stored(key);
+      for (int32_t j = backwards ? copyW - 1 : 0; j >= 0 && j < copyW; j += step) {
+        if (s[j] != k) { d[j] = s[j]; }
+      }
+      continue;
+    }
+
+    if (bpp_ == 8 && dst.bpp_ == 8) {
+      const uint8_t *s = indices_ + static_cast<size_t>(ys) * rowBytes() + srcX;
+      uint8_t       *d = dst.indices_ + static_cast<size_t>(yd) * dst.rowBytes() + dstX;
+      if (!keyed) {
+        memmove(d, s, static_cast<size_t>(copyW));
+        continue;
+      }
+      for (int32_t j = backwards ? copyW - 1 : 0; j >= 0 && j < copyW; j += step) {
+        if (palette_[s[j]] != key) { d[j] = s[j]; }
+      }
+      continue;
+    }
+
+    if (bpp_ == 4 && dst.bpp_ == 4 && !keyed && ((srcX ^ dstX) & 1) == 0) {
+      // Same nibble phase: whole bytes move at once. The odd ends are read
+      // first and written last, in case the copy overlaps itself.
+      const int32_t j0   = srcX & 1;
+      const int32_t j1   = std::max(j0, copyW - ((srcX + copyW) & 1));
+      const uint8_t head = indexAt(srcX, ys), tail = indexAt(srcX + copyW - 1, ys);
+      memmove(dst.indices_ + static_cast<size_t>(yd) * dst.rowBytes() + ((dstX + j0) >> 1),
+              indices_ + static_cast<size_t>(ys) * rowBytes() + ((srcX + j0) >> 1), static_cast<size_t>(j1 - j0) / 2);
+      if (j0 != 0) { dst.writeSpan(dstX, yd, 1, head); }
+      if (j1 < copyW) { dst.writeSpan(dstX + copyW - 1, yd, 1, tail); }
+      continue;
+    }
+
+    // Mixed formats go through colours, or indices between equal depths
+    const bool sameIndexed = bpp_ != 16 && bpp_ == dst.bpp_;
+    for (int32_t j = backwards ? copyW - 1 : 0; j >= 0 && j < copyW; j += step) {
+      const uint8_t  index = bpp_ != 16 ? indexAt(srcX + j, ys) : 0;
+      const uint16_t c     = bpp_ != 16 ? palette_[index] : readPixel(static_cast<int16_t>(srcX + j),
+                                                                       static_cast<int16_t>(ys));
+      if (keyed && c == key) { continue; }
+      if (sameIndexed || dst.bpp_ == 16) {
+        dst.writeSpan(dstX + j, yd, 1, sameIndexed ? index : c);
+        continue;
+      }
+      dst.writeSpan(dstX + j, yd, 1, nearest(c));
+    }
   }
-  fillRect(static_cast<uint16_t>(x), static_cast<uint16_t>(y), 1, 1, color);
 }
 
-void ESP32S3BoxLiteDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-  // Bresenham's line algorithm
-  int16_t dx  =  std::abs(x1 - x0);
-  int16_t dy  = -std::abs(y1 - y0);
-  int16_t sx  = x0 < x1 ? 1 : -1;
-  int16_t sy  = y0 < y1 ? 1 : -1;
-  int16_t err = dx + dy;
+void ESP32S3BoxLiteSprite::setPivot(int16_t x, int16_t y) {
+  pivotX_ = x;
+  pivotY_ = y;
+}
 
-  while (true) {
-    drawPixel(x0, y0, color);
-    if (x0 == x1 && y0 == y1) {
-      break;
+void ESP32S3BoxLiteSprite::pushRotateZoom(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, float angle, float zoomX,
+                                          float zoomY, ESP32S3BoxLiteFilter filter, ESP32S3BoxLiteBlend mode,
+                                          uint16_t key) {
+  if (!created()) { return; }
+  AffineMap m;
+  int32_t   rowMin, rowMax;
+  if (!makeAffineMap(*this, x, y, angle, zoomX, zoomY, m, rowMin, rowMax)) { return; }
+
+  // Each row's run is a one-line window; keyed pixels split it and the
+  // next visible pixel opens a new window
+  int32_t nextX = -1, nextY = -1;
+  auto out = [&](int32_t x0, int32_t row, const uint16_t *px, const uint8_t *keep, int32_t n) {
+    uint16_t wire[kAffineChunk];
+    for (int32_t i = 0; i < n;) {
+      if (keep != nullptr && keep[i] == 0) {
+        ++i;
+        continue;
+      }
+      int32_t end = i + 1;
+      while (end < n && (keep == nullptr || keep[end] != 0)) { ++end; }
+      if (x0 + i != nextX || row != nextY) {
+        disp.setAddressWindowPublic(static_cast<uint16_t>(x0 + i), static_cast<uint16_t>(row),
+                                    ESP32S3BoxLiteDisplay::Width - 1, static_cast<uint16_t>(row));
+      }
+      for (int32_t j = i; j < end; ++j) { wire[j - i] = swap565(px[j]); }
+      disp.pushPixels(reinterpret_cast<const uint8_t *>(wire), static_cast<size_t>(end - i) * 2U);
+      nextX = x0 + end;
+      nextY = row;
+      i     = end;
     }
-    int16_t e2 = 2 * err;
-    if (e2 >= dy) {
-      if (x0 == x1) { break; }
-      err += dy;
-      x0  += sx;
+  };
+  const ESP32S3BoxLiteClipRect &clip = disp.clipBounds();
+  affineBlitSprite(*this, m, clip.x0, std::max<int32_t>(rowMin, clip.y0), clip.x1,
+                   std::min<int32_t>(rowMax + 1, clip.y1), filter, mode, key, out);
+  disp.endPixels();
+}
+
+void ESP32S3BoxLiteSprite::pushRotateZoom(ESP32S3BoxLiteSprite &dst, int16_t x, int16_t y, float angle, float zoomX,
+                                          float zoomY, ESP32S3BoxLiteFilter filter, ESP32S3BoxLiteBlend mode,
+                                          uint16_t key) {
+  if (!created() || !dst.created() || &dst == this) { return; }
+  AffineMap m;
+  int32_t   rowMin, rowMax;
+  if (!makeAffineMap(*this, x, y, angle, zoomX, zoomY, m, rowMin, rowMax)) { return; }
+  dst.sync();
+
+  NearestIndexCache nearest(dst);
+  auto out = [&](int32_t x0, int32_t row, const uint16_t *px, const uint8_t *keep, int32_t n) {
+    if (dst.bpp_ == 16) {
+      uint16_t *d = dst.buffer_ + row * dst.w_ + x0;
+      if (keep == nullptr) {
+        for (int32_t i = 0; i < n; ++i) { d[i] = dst.stored(px[i]); }
+      } else {
+        for (int32_t i = 0; i < n; ++i) { d[i] = keep[i] != 0 ? dst.stored(px[i]) : d[i]; }
+      }
+      return;
     }
-    if (e2 <= dx) {
-      if (y0 == y1) { break; }
-      err += dx;
-      y0  += sy;
+    for (int32_t i = 0; i < n; ++i) {
+      if (keep == nullptr || keep[i] != 0) { dst.writeSpan(x0 + i, row, 1, nearest(px[i])); }
     }
+  };
+  const ESP32S3BoxLiteClipRect &clip = dst.clip_.current();
+  affineBlitSprite(*this, m, clip.x0, std::max<int32_t>(rowMin, clip.y0), clip.x1,
+                   std::min<int32_t>(rowMax + 1, clip.y1), filter, mode, key, out);
+}
+
+// ===========================================================================
+// ESP32S3BoxLiteSpriteSheet implementation
+// ===========================================================================
+
+void ESP32S3BoxLiteSpriteSheet::begin(ESP32S3BoxLiteSprite &atlas, const ESP32S3BoxLiteSpriteFrame *frames,
+                                      uint16_t count) {
+  atlas_  = &atlas;
+  frames_ = frames;
+  count_  = frames != nullptr ? count : 0;
+  cellW_  = 0;
+  cellH_  = 0;
+}
+
+void ESP32S3BoxLiteSpriteSheet::beginGrid(ESP32S3BoxLiteSprite &atlas, int16_t cellW, int16_t cellH) {
+  atlas_  = &atlas;
+  frames_ = nullptr;
+  count_  = 0;
+  cellW_  = cellW;
+  cellH_  = cellH;
+}
+
+uint16_t ESP32S3BoxLiteSpriteSheet::frameCount() const {
+  if (frames_ != nullptr) { return count_; }
+  if (atlas_ == nullptr || cellW_ <= 0 || cellH_ <= 0) { return 0; }
+  return static_cast<uint16_t>(std::min<int32_t>((atlas_->width() / cellW_) * (atlas_->height() / cellH_), 0xFFFF));
+}
+
+int16_t ESP32S3BoxLiteSpriteSheet::find(const char *name) const {
+  if (name == nullptr) { return -1; }
+  for (uint16_t i = 0; i < count_ && i <= INT16_MAX; ++i) {
+    if (frames_[i].name != nullptr && strcmp(frames_[i].name, name) == 0) { return static_cast<int16_t>(i); }
   }
+  return -1;
 }
 
-void ESP32S3BoxLiteDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  if (w <= 0 || h <= 0) { return; }
-  drawLine(x,         y,         x + w - 1, y,         color);  // top
-  drawLine(x,         y + h - 1, x + w - 1, y + h - 1, color);  // bottom
-  drawLine(x,         y,         x,         y + h - 1, color);  // left
-  drawLine(x + w - 1, y,         x + w - 1, y + h - 1, color);  // right
+bool ESP32S3BoxLiteSpriteSheet::frame(uint16_t index, ESP32S3BoxLiteSpriteFrame &out) const {
+  if (index >= frameCount()) { return false; }
+  if (frames_ != nullptr) {
+    out = frames_[index];
+    return true;
+  }
+  const int16_t columns = static_cast<int16_t>(atlas_->width() / cellW_);
+  out = { nullptr, static_cast<int16_t>((index % columns) * cellW_), static_cast<int16_t>((index / columns) * cellH_),
+          cellW_, cellH_ };
+  return true;
 }
 
-void ESP32S3BoxLiteDisplay::drawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
-  // Bresenham's circle algorithm
-  int16_t x = 0;
-  int16_t y = r;
-  int16_t d = 3 - 2 * r;
+bool ESP32S3BoxLiteSpriteSheet::drawFrame(ESP32S3BoxLiteDisplay &disp, uint16_t index, int16_t x, int16_t y) const {
+  ESP32S3BoxLiteSpriteFrame f;
+  if (!frame(index, f)) { return false; }
+  atlas_->pushSubRect(disp, x, y, f.x, f.y, f.w, f.h);
+  return true;
+}
+
+bool ESP32S3BoxLiteSpriteSheet::drawFrame(ESP32S3BoxLiteSprite &dst, uint16_t index, int16_t x, int16_t y,
+                                          ESP32S3BoxLiteBlend mode, uint16_t key) const {
+  ESP32S3BoxLiteSpriteFrame f;
+  if (!frame(index, f)) { return false; }
+  atlas_->pushSubRect(dst, x, y, f.x, f.y, f.w, f.h, mode, key);
+  return true;
+}
 
-  auto plot = [&]() {
-    drawPixel(cx + x, cy + y, color);
-    drawPixel(cx - x, cy + y, color);
-    drawPixel(cx + x, cy - y, color);
-    drawPixel(cx - x, cy - y, color);
-    drawPixel(cx + y, cy + x, color);
-    drawPixel(cx - y, cy + x, color);
-    drawPixel(cx + y, cy - x, color);
-    drawPixel(cx - y, cy - x, color);
-  };
+bool ESP32S3BoxLiteSpriteSheet::draw(ESP32S3BoxLiteDisplay &disp, const char *name, int16_t x, int16_t y) const {
+  const int16_t index = find(name);
+  return index >= 0 && drawFrame(disp, static_cast<uint16_t>(index), x, y);
+}
 
-  while (y >= x) {
-    plot();
-    ++x;
-    if (d > 0) {
-      --y;
-      d += 4 * (x - y) + 10;
-    } else {
-      d += 4 * x + 6;
-    }
-  }
+bool ESP32S3BoxLiteSpriteSheet::draw(ESP32S3BoxLiteSprite &dst, const char *name, int16_t x, int16_t y,
+                                     ESP32S3BoxLiteBlend mode, uint16_t key) const {
+  const int16_t index = find(name);
+  return index >= 0 && drawFrame(dst, static_cast<uint16_t>(index), x, y, mode, key);
 }
 
-void ESP32S3BoxLiteDisplay::fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
-  int16_t x = 0;
-  int16_t y = r;
-  int16_t d = 3 - 2 * r;
+// ===========================================================================
+// ESP32S3BoxLiteGifPlayer implementation
+// ===========================================================================
 
-  auto hline = [&](int16_t ax, int16_t bx, int16_t row) {
-    if (ax > bx) { int16_t t = ax; ax = bx; bx = t; }
-    if (ax < 0)  { ax = 0; }
-    if (bx >= static_cast<int16_t>(Width)) { bx = static_cast<int16_t>(Width) - 1; }
-    if (row < 0 || row >= static_cast<int16_t>(Height)) { return; }
-    fillRect(static_cast<uint16_t>(ax), static_cast<uint16_t>(row),
-             static_cast<uint16_t>(bx - ax + 1), 1, color);
-  };
+bool ESP32S3BoxLiteGifPlayer::open(ESP32S3BoxLiteDisplay &disp, const uint8_t *data, size_t size, int16_t x,
+                                   int16_t y) {
+  close();
+  if (data == nullptr) { return false; }
+  src_.setMemory(data, size);
+  return begin(disp, x, y);
+}
 
-  while (y >= x) {
-    hline(cx - x, cx + x, cy + y);
-    hline(cx - x, cx + x, cy - y);
-    hline(cx - y, cx + y, cy + x);
-    hline(cx - y, cx + y, cy - x);
-    ++x;
-    if (d > 0) {
-      --y;
-      d += 4 * (x - y) + 10;
-    } else {
-      d += 4 * x + 6;
-    }
-  }
+bool ESP32S3BoxLiteGifPlayer::openFromSPIFFS(ESP32S3BoxLiteDisplay &disp, const char *path, int16_t x, int16_t y) {
+  close();
+  if (path == nullptr || !SPIFFS.begin(true)) { return false; }
+  file_ = SPIFFS.open(path, FILE_READ);
+  if (!file_) { return false; }
+  src_.setFile(file_);
+  return begin(disp, x, y);
 }
 
-void ESP32S3BoxLiteDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
-                                        int16_t w, int16_t h, uint16_t fgColor, uint16_t bgColor) {
-  if (!initialized_ || bitmap == nullptr || w <= 0 || h <= 0) {
-    return;
+void ESP32S3BoxLiteGifPlayer::close() {
+  if (block_ != nullptr) {
+    heap_caps_free(block_);
+    block_ = nullptr;
   }
-  const int16_t bytesPerRow = (w + 7) / 8;
-  for (int16_t row = 0; row < h; ++row) {
-    for (int16_t col = 0; col < w; ++col) {
-      const int16_t byteIdx = row * bytesPerRow + col / 8;
-      const uint8_t bitMask = 0x80 >> (col % 8);
-      const bool    on      = bitmap[byteIdx] & bitMask;
-      drawPixel(x + col, y + row, on ? fgColor : bgColor);
-    }
+  if (canvas_ != nullptr) {
+    heap_caps_free(canvas_);
+    canvas_ = nullptr;
   }
+  prefix_ = palettes_ = nullptr;
+  suffix_ = stack_ = line_ = nullptr;
+  src_.setMemory(nullptr, 0);
+  if (file_) { file_.close(); }
+  disp_       = nullptr;
+  width_      = 0;
+  height_     = 0;
+  frameCount_ = 0;
 }
 
-void ESP32S3BoxLiteDisplay::drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h) {
-  if (!initialized_ || bitmap == nullptr || w <= 0 || h <= 0) {
-    return;
+bool ESP32S3BoxLiteGifPlayer::begin(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y) {
+  uint8_t header[13];
+  if (src_.read(header, sizeof(header)) != sizeof(header) || memcmp(header, "GIF8", 4) != 0 ||
+      (header[4] != '7' && header[4] != '9') || header[5] != 'a') {
+    close();
+    return false;
   }
-  // Clip
-  if (x >= static_cast<int16_t>(Width) || y >= static_cast<int16_t>(Height)) {
-    return;
+  width_         = readLe16(header + 6);
+  height_        = readLe16(header + 8);
+  globalPalette_ = (header[10] & 0x80) != 0;
+  if (width_ == 0 || height_ == 0) {
+    close();
+    return false;
   }
-  // We send row by row to handle potential clipping
-  setAddressWindow(
-      static_cast<uint16_t>(std::max<int16_t>(x, 0)),
-      static_cast<uint16_t>(std::max<int16_t>(y, 0)),
-      static_cast<uint16_t>(std::min<int16_t>(x + w - 1, static_cast<int16_t>(Width)  - 1)),
-      static_cast<uint16_t>(std::min<int16_t>(y + h - 1, static_cast<int16_t>(Height) - 1)));
 
-  // Send pixel data (big-endian RGB565)
-  constexpr size_t kBufPixels = 64;
-  uint8_t buf[kBufPixels * 2];
-  size_t bufIdx = 0;
+  // LZW tables, both palettes and the line share one block; the decoder
+  // touches them for every pixel, so internal RAM is tried first
+  const size_t prefixBytes  = kGifMaxCodes * sizeof(uint16_t);
+  const size_t paletteBytes = 2 * 256 * sizeof(uint16_t);
+  const size_t bytes        = prefixBytes + paletteBytes + 2 * kGifMaxCodes + width_;
+  uint8_t *block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  if (block == nullptr) {
+    block = static_cast<uint8_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
+  }
+  if (block == nullptr) {
+    close();
+    return false;
+  }
+  block_    = block;
+  prefix_   = reinterpret_cast<uint16_t *>(block);
+  palettes_ = reinterpret_cast<uint16_t *>(block + prefixBytes);
+  suffix_   = block + prefixBytes + paletteBytes;
+  stack_    = suffix_ + kGifMaxCodes;
+  line_     = stack_ + kGifMaxCodes;
+
+  if (globalPalette_ && !readPalette(palettes_, static_cast<uint16_t>(2U << (header[10] & 0x07)))) {
+    close();
+    return false;
+  }
+  firstFrame_ = src_.offset();
+  bool restores = false;
+  if (!scan(restores) || !src_.seek(firstFrame_)) {
+    close();
+    return false;
+  }
 
-  auto flush = [&]() {
-    if (bufIdx > 0) {
-      sendRawBuffer(buf, bufIdx);
-      bufIdx = 0;
+  // "Restore to previous" needs what was under the frame, which the panel
+  // cannot give back
+  if (restores) {
+    const size_t canvasBytes = size_t(width_) * height_ * sizeof(uint16_t);
+    if (esp_spiram_is_initialized()) {
+      canvas_ = static_cast<uint16_t *>(heap_caps_malloc(canvasBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
     }
-  };
-
-  digitalWrite(kLcdDcPin, HIGH);
-  digitalWrite(kLcdCsPin, LOW);
-  for (int16_t row = 0; row < h; ++row) {
-    if (y + row < 0 || y + row >= static_cast<int16_t>(Height)) { continue; }
-    for (int16_t col = 0; col < w; ++col) {
-      if (x + col < 0 || x + col >= static_cast<int16_t>(Width)) { continue; }
-      const uint16_t px = bitmap[row * w + col];
-      buf[bufIdx++] = px >> 8;
-      buf[bufIdx++] = px & 0xFF;
-      if (bufIdx >= sizeof(buf)) {
-        spi_.writeBytes(buf, bufIdx);
-        bufIdx = 0;
-      }
+    if (canvas_ == nullptr) {
+      canvas_ = static_cast<uint16_t *>(heap_caps_malloc(canvasBytes, MALLOC_CAP_8BIT));
+    }
+    if (canvas_ == nullptr) {
+      close();
+      return false;
     }
   }
-  if (bufIdx > 0) {
-    spi_.writeBytes(buf, bufIdx);
-  }
-  digitalWrite(kLcdCsPin, HIGH);
-}
 
-void ESP32S3BoxLiteDisplay::drawProgressBar(int16_t x, int16_t y, int16_t w, int16_t h,
-                                              uint8_t percent, uint16_t fgColor, uint16_t bgColor) {
-  if (!initialized_ || w <= 0 || h <= 0) {
-    return;
-  }
-  const uint8_t clampedPct = percent > 100 ? 100 : percent;
-  // Background
-  fillRect(static_cast<uint16_t>(x), static_cast<uint16_t>(y),
-           static_cast<uint16_t>(w), static_cast<uint16_t>(h), bgColor);
-  // Foreground fill
-  const int16_t fillW = static_cast<int16_t>((static_cast<int32_t>(w) * clampedPct) / 100);
-  if (fillW > 0) {
-    fillRect(static_cast<uint16_t>(x), static_cast<uint16_t>(y),
-             static_cast<uint16_t>(fillW), static_cast<uint16_t>(h), fgColor);
-  }
+  disp_             = &disp;
+  x_                = x;
+  y_                = y;
+  loopsLeft_        = std::max<int32_t>(loops_, 0);
+  gceDisposal_      = 0;
+  gceTransparent_   = -1;
+  gceDelayMs_       = 0;
+  delayMs_          = 0;
+  previousDisposal_ = 0;
+  clearPending_     = true;
+  finished_         = false;
+  nextDue_          = millis();
+  return true;
 }
 
-void ESP32S3BoxLiteDisplay::printf(int16_t x, int16_t y, uint8_t scale, uint16_t fg, uint16_t bg, const char *fmt, ...) {
-  char buf[128];
-  va_list args;
-  va_start(args, fmt);
-  vsnprintf(buf, sizeof(buf), fmt, args);
-  va_end(args);
-  drawText(x, y, buf, scale, fg, bg);
+bool ESP32S3BoxLiteGifPlayer::scan(bool &restores) {
+  frameCount_ = 0;
+  loops_      = -1;
+  // A damaged or cut-off file still plays the frames before the damage
+  for (;;) {
+    const int b = src_.read();
+    if (b == 0x21) {
+      if (!readExtension()) { break; }
+      restores = restores || gceDisposal_ == 3;
+    } else if (b == 0x2C) {
+      uint8_t desc[9];
+      if (src_.read(desc, sizeof(desc)) != sizeof(desc)) { break; }
+      const uint32_t paletteBytes = (desc[8] & 0x80) != 0 ? 3U * (2U << (desc[8] & 0x07)) : 0;
+      if (!src_.skip(paletteBytes + 1) || !skipGifSubBlocks(src_)) { break; }
+      if (frameCount_ < UINT16_MAX) { ++frameCount_; }
+    } else {
+      break;  // the trailer, or the end of a file that lacks one
+    }
+  }
+  return frameCount_ > 0;
 }
 
-void ESP32S3BoxLiteDisplay::drawGlyph(int16_t x, int16_t y, char ch, uint8_t scale, uint16_t fg, uint16_t bg) {
-  const Glyph *glyph = findGlyph(ch);
-  for (uint8_t row = 0; row < 7; ++row) {
-    for (uint8_t col = 0; col < 5; ++col) {
-      const bool on = glyph->rows[row] & (1 << (4 - col));
-      fillRect(static_cast<uint16_t>(x + col * scale), static_cast<uint16_t>(y + row * scale),
-               scale, scale, on ? fg : bg);
+bool ESP32S3BoxLiteGifPlayer::readExtension() {
+  const int label = src_.read();
+  uint8_t   buf[11];
+  if (label == 0xF9) {
+    const int32_t n = readGifSubBlock(src_, buf, 4);
+    if (n < 0) { return false; }
+    if (n == 0) { return true; }
+    if (n >= 4) {
+      gceDisposal_    = (buf[0] >> 2) & 0x07;
+      gceTransparent_ = (buf[0] & 0x01) != 0 ? buf[3] : -1;
+      // Browsers show 0 and 10 ms delays as 100 ms
+      const uint32_t cs = readLe16(buf + 1);
+      gceDelayMs_ = cs <= 1 ? 100 : cs * 10;
     }
+  } else if (label == 0xFF) {
+    const int32_t n = readGifSubBlock(src_, buf, sizeof(buf));
+    if (n < 0) { return false; }
+    if (n == 0) { return true; }
+    if (n == 11 && (memcmp(buf, "NETSCAPE2.0", 11) == 0 || memcmp(buf, "ANIMEXTS1.0", 11) == 0)) {
+      const int32_t m = readGifSubBlock(src_, buf, 3);
+      if (m < 0) { return false; }
+      if (m == 0) { return true; }
+      if (m >= 3 && buf[0] == 1) { loops_ = readLe16(buf + 1); }
+    }
+  } else if (label < 0) {
+    return false;
   }
+  return skipGifSubBlocks(src_);
 }
 
-void ESP32S3BoxLiteDisplay::drawText(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg) {
-  if (scale == 0) { scale = 1; }
-  const int16_t charWidth = 6 * scale;
-  for (size_t i = 0; text[i] != '\0'; ++i) {
-    drawGlyph(x, y, text[i], scale, fg, bg);
-    x += charWidth;
+bool ESP32S3BoxLiteGifPlayer::readPalette(uint16_t *palette, uint16_t count) {
+  uint8_t rgb[3];
+  for (uint16_t i = 0; i < count; ++i) {
+    if (src_.read(rgb, sizeof(rgb)) != sizeof(rgb)) { return false; }
+    palette[i] = rgbTo565(rgb[0], rgb[1], rgb[2]);
   }
+  // Indices past a short table show black
+  for (uint16_t i = count; i < 256; ++i) { palette[i] = 0; }
+  return true;
 }
 
-void ESP32S3BoxLiteDisplay::drawTextCentered(int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg) {
-  if (scale == 0) { scale = 1; }
-  const size_t  len       = strlen(text);
-  const int16_t charWidth = 6 * scale;
-  const int16_t textWidth = static_cast<int16_t>(len) * charWidth - scale;
-  const int16_t x         = (Width - textWidth) / 2;
-  drawText(x, y, text, scale, fg, bg);
+bool ESP32S3BoxLiteGifPlayer::update() {
+  if (!isOpen() || finished_) { return false; }
+  const uint32_t now = millis();
+  if (static_cast<int32_t>(now - nextDue_) < 0) { return true; }
+  if (!drawNextFrame()) { return false; }
+  // Keeps the cadence, unless drawing fell more than a frame behind
+  nextDue_ += delayMs_;
+  if (static_cast<int32_t>(now - nextDue_) > 0) { nextDue_ = now + delayMs_; }
+  return true;
 }
 
-// Phase 7 - UI helpers
-
-void ESP32S3BoxLiteDisplay::showMessage(const char *text, uint16_t bgColor) {
-  if (!initialized_) { return; }
-  fillScreen(bgColor);
-
-  // Split text into lines at '\n' or auto-wrap at ~26 chars per line (scale=1)
-  // We'll use scale=2 for readability, wrap at 13 chars (Width/12 = ~26 pixels per char)
-  constexpr uint8_t kScale = 2;
-  constexpr int16_t kMaxCharsPerLine = (Width - 20) / (6 * kScale);
-  constexpr int16_t kLineHeight = 7 * kScale + 4;
-
-  char lineBuf[64];
-  size_t len = strlen(text);
-  int16_t curY = (Height - kLineHeight * ((int16_t)((len + kMaxCharsPerLine - 1) / kMaxCharsPerLine))) / 2;
-  if (curY < 4) { curY = 4; }
+uint32_t ESP32S3BoxLiteGifPlayer::nextFrameIn() const {
+  if (!isOpen() || finished_) { return 0; }
+  const int32_t wait = static_cast<int32_t>(nextDue_ - millis());
+  return wait > 0 ? static_cast<uint32_t>(wait) : 0;
+}
 
-  size_t pos = 0;
-  while (pos < len) {
-    size_t end = pos + kMaxCharsPerLine;
-    if (end > len) { end = len; }
-    // Try to break at space
-    if (end < len && text[end] != ' ') {
-      size_t breakAt = end;
-      while (breakAt > pos && text[breakAt] != ' ') { --breakAt; }
-      if (breakAt > pos) { end = breakAt; }
+bool ESP32S3BoxLiteGifPlayer::drawNextFrame() {
+  if (!isOpen() || finished_) { return false; }
+  bool rewound = false;
+  for (;;) {
+    const int b = src_.read();
+    if (b == 0x2C) {
+      if (drawFrame()) { return true; }
+      break;
     }
-    const size_t lineLen = end - pos;
-    memcpy(lineBuf, text + pos, lineLen);
-    lineBuf[lineLen] = '\0';
-    drawTextCentered(curY, lineBuf, kScale, ColorWhite, bgColor);
-    curY += kLineHeight;
-    pos = end;
-    if (pos < len && text[pos] == ' ') { ++pos; }
+    if (b == 0x21) {
+      if (!readExtension()) { break; }
+      continue;
+    }
+    // The trailer, or the end of a file that lacks one: start the next loop
+    if (rewound || (loops_ != 0 && loopsLeft_ == 0)) { break; }
+    if (loops_ > 0) { --loopsLeft_; }
+    if (!src_.seek(firstFrame_)) { break; }
+    gceDisposal_    = 0;
+    gceTransparent_ = -1;
+    gceDelayMs_     = 0;
+    clearPending_   = true;
+    rewound         = true;
   }
+  finished_ = true;
+  return false;
 }
 
-void ESP32S3BoxLiteDisplay::showError(const char *text) {
-  showMessage(text, ColorRed);
-}
-
-void ESP32S3BoxLiteDisplay::showBootScreen(const char *appName, const char *version) {
-  if (!initialized_) { return; }
-  fillScreen(ColorBlack);
-
-  // Title bar
-  fillRect(0, 0, Width, 50, ColorBlue);
-  drawTextCentered(16, appName, 2, ColorWhite, ColorBlue);
-
-  // Version
-  drawTextCentered(70, version, 1, ColorCyan, ColorBlack);
-
-  // Divider
-  fillRect(20, 90, Width - 40, 2, ColorGray);
+bool ESP32S3BoxLiteGifPlayer::drawFrame() {
+  uint8_t desc[9];
+  if (src_.read(desc, sizeof(desc)) != sizeof(desc)) { return false; }
+  const uint16_t fx = readLe16(desc), fy = readLe16(desc + 2);
+  const uint16_t fw = readLe16(desc + 4), fh = readLe16(desc + 6);
+  const uint8_t  flags = desc[8];
+
+  const uint16_t *palette = globalPalette_ ? palettes_ : nullptr;
+  if ((flags & 0x80) != 0) {
+    if (!readPalette(palettes_ + 256, static_cast<uint16_t>(2U << (flags & 0x07)))) { return false; }
+    palette = palettes_ + 256;
+  }
+  if (palette == nullptr) { return false; }
+
+  // Only the part inside the logical screen is kept
+  Rect frame;
+  frame.x = std::min(fx, width_);
+  frame.y = std::min(fy, height_);
+  frame.w = std::min<uint16_t>(fw, width_ - frame.x);
+  frame.h = std::min<uint16_t>(fh, height_ - frame.y);
+
+  // Disposal of the previous frame touches its own rectangle only
+  if (clearPending_) {
+    clearPending_ = false;
+    const bool covers = frame.w == width_ && frame.h == height_ && gceTransparent_ < 0;
+    if (!covers) {
+      restoreRect(Rect{0, 0, width_, height_}, false);
+    } else if (canvas_ != nullptr) {
+      for (size_t i = 0; i < size_t(width_) * height_; ++i) { canvas_[i] = background_; }
+    }
+  } else if (previousDisposal_ == 2) {
+    restoreRect(previous_, false);
+  } else if (previousDisposal_ == 3 && canvas_ != nullptr) {
+    restoreRect(previous_, true);
+  }
 
-  // Progress bar animation placeholder
-  drawProgressBar(20, 110, Width - 40, 16, 100, ColorGreen, ColorGray);
-  drawTextCentered(140, "Initializing...", 1, ColorWhite, ColorBlack);
+  GifFrame f;
+  f.codedW      = fw;
+  f.codedH      = fh;
+  f.x           = frame.x;
+  f.y           = frame.y;
+  f.w           = frame.w;
+  f.h           = frame.h;
+  f.interlaced  = (flags & 0x40) != 0;
+  f.transparent = gceTransparent_;
+  f.palette     = palette;
+  f.canvas      = canvas_;
+  f.canvasW     = width_;
+  f.keep        = canvas_ != nullptr && gceDisposal_ != 3;
+
+  DisplayImageSink sink(*disp_, x_ + frame.x, y_ + frame.y);
+  const bool visible = sink.begin(frame.w, frame.h);
+  GifFrameDecoder decoder(src_, sink, visible, f, prefix_, suffix_, stack_, line_);
+  const bool ok = decoder.run();
+  sink.end();
+
+  previous_         = frame;
+  previousDisposal_ = gceDisposal_;
+  delayMs_          = gceDelayMs_;
+  gceDisposal_      = 0;
+  gceTransparent_   = -1;
+  gceDelayMs_       = 0;
+  return ok;
 }
 
-void ESP32S3BoxLiteDisplay::drawStatusBar(const char *left, const char *right, uint16_t bgColor) {
-  if (!initialized_) { return; }
-  constexpr uint16_t kBarHeight = 16;
-  fillRect(0, 0, Width, kBarHeight, bgColor);
-  drawText(4, 4, left, 1, ColorWhite, bgColor);
-
-  // Right-align the right string
-  const size_t  rLen  = strlen(right);
-  const int16_t rX    = static_cast<int16_t>(Width) - static_cast<int16_t>(rLen) * 6 - 4;
-  drawText(rX, 4, right, 1, ColorWhite, bgColor);
+void ESP32S3BoxLiteGifPlayer::restoreRect(const Rect &rect, bool fromCanvas) {
+  if (!fromCanvas && canvas_ != nullptr) {
+    for (uint16_t row = 0; row < rect.h; ++row) {
+      uint16_t *dst = canvas_ + size_t(rect.y + row) * width_ + rect.x;
+      for (uint16_t i = 0; i < rect.w; ++i) { dst[i] = background_; }
+    }
+  }
+  DisplayImageSink sink(*disp_, x_ + rect.x, y_ + rect.y);
+  if (!sink.begin(rect.w, rect.h)) { return; }
+  uint16_t fill[kImageSpan];
+  for (int32_t i = 0; i < kImageSpan; ++i) { fill[i] = background_; }
+  for (int32_t row = sink.y0; row < sink.y1; ++row) {
+    const uint16_t *src = fromCanvas ? canvas_ + size_t(rect.y + row) * width_ + rect.x : nullptr;
+    for (int32_t x = sink.x0; x < sink.x1; x += kImageSpan) {
+      const int32_t n = std::min<int32_t>(kImageSpan, sink.x1 - x);
+      sink.span(x, row, src != nullptr ? src + x : fill, n);
+    }
+  }
+  sink.end();
 }
 
 // ===========================================================================
-// ESP32S3BoxLiteSprite implementation
+// ESP32S3BoxLiteCompositor implementation
 // ===========================================================================
 
-bool ESP32S3BoxLiteSprite::createSprite(int16_t w, int16_t h) {
-  deleteSprite();
-  if (w <= 0 || h <= 0) { return false; }
-  const size_t bytes = static_cast<size_t>(w) * static_cast<size_t>(h) * 2U;
+int8_t ESP32S3BoxLiteCompositor::addLayer(const ESP32S3BoxLiteSprite &sprite, int16_t x, int16_t y,
+                                          ESP32S3BoxLiteBlend mode, uint16_t key, uint8_t alpha) {
+  if (count_ >= MaxLayers) { return -1; }
+  Layer &l = layers_[count_];
+  l = Layer{};
+  l.sprite  = &sprite;
+  l.x       = x;
+  l.y       = y;
+  l.mode    = mode;
+  l.key     = key;
+  l.alpha   = alpha;
+  l.visible = true;
+  return static_cast<int8_t>(count_++);
+}
 
-  // Try PSRAM first, then regular heap
-  if (esp_spiram_is_initialized()) {
-    buffer_ = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
-  }
-  if (buffer_ == nullptr) {
-    buffer_ = static_cast<uint16_t *>(heap_caps_malloc(bytes, MALLOC_CAP_8BIT));
-  }
-  if (buffer_ == nullptr) { return false; }
+void ESP32S3BoxLiteCompositor::clearLayers() {
+  count_ = 0;
+}
 
-  w_ = w;
-  h_ = h;
-  memset(buffer_, 0, bytes);
-  return true;
+void ESP32S3BoxLiteCompositor::setPosition(uint8_t layer, int16_t x, int16_t y) {
+  if (layer >= count_) { return; }
+  layers_[layer].x = x;
+  layers_[layer].y = y;
 }
 
-void ESP32S3BoxLiteSprite::deleteSprite() {
-  if (buffer_ != nullptr) {
-    heap_caps_free(buffer_);
-    buffer_ = nullptr;
-  }
-  w_ = 0;
-  h_ = 0;
+void ESP32S3BoxLiteCompositor::setVisible(uint8_t layer, bool visible) {
+  if (layer >= count_) { return; }
+  layers_[layer].visible = visible;
 }
 
-void ESP32S3BoxLiteSprite::fillScreen(uint16_t color) {
-  if (buffer_ == nullptr) { return; }
-  const int32_t total = static_cast<int32_t>(w_) * h_;
-  for (int32_t i = 0; i < total; ++i) {
-    buffer_[i] = color;
-  }
+void ESP32S3BoxLiteCompositor::setAlpha(uint8_t layer, uint8_t alpha, const uint8_t *mask) {
+  if (layer >= count_) { return; }
+  layers_[layer].alpha = alpha;
+  layers_[layer].mask  = mask;
 }
 
-void ESP32S3BoxLiteSprite::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  if (buffer_ == nullptr || w <= 0 || h <= 0) { return; }
-  for (int16_t row = y; row < y + h; ++row) {
-    if (row < 0 || row >= h_) { continue; }
-    for (int16_t col = x; col < x + w; ++col) {
-      if (col < 0 || col >= w_) { continue; }
-      buffer_[row * w_ + col] = color;
+void ESP32S3BoxLiteCompositor::render(ESP32S3BoxLiteDisplay &disp) {
+  int32_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+  auto include = [&](int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (w <= 0 || h <= 0) { return; }
+    x0 = std::min(x0, x);
+    y0 = std::min(y0, y);
+    x1 = std::max(x1, x + w);
+    y1 = std::max(y1, y + h);
+  };
+
+  for (uint8_t i = 0; i < count_; ++i) {
+    Layer &l = layers_[i];
+    if (l.drawn) {
+      include(l.lastX, l.lastY, l.lastW, l.lastH);
+    }
+    l.drawn = l.visible && l.sprite->created();
+    if (l.drawn) {
+      l.lastX = l.x;
+      l.lastY = l.y;
+      l.lastW = l.sprite->width();
+      l.lastH = l.sprite->height();
+      include(l.lastX, l.lastY, l.lastW, l.lastH);
     }
   }
+  if (x0 >= x1) { return; }
+  render(disp, static_cast<int16_t>(std::max<int32_t>(x0, INT16_MIN)),
+         static_cast<int16_t>(std::max<int32_t>(y0, INT16_MIN)),
+         static_cast<int16_t>(std::min<int32_t>(x1 - x0, INT16_MAX)),
+         static_cast<int16_t>(std::min<int32_t>(y1 - y0, INT16_MAX)));
 }
 
-void ESP32S3BoxLiteSprite::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if (buffer_ == nullptr || x < 0 || y < 0 || x >= w_ || y >= h_) { return; }
-  buffer_[y * w_ + x] = color;
+void ESP32S3BoxLiteCompositor::render(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, int16_t w, int16_t h) {
+  const ESP32S3BoxLiteClipRect &clip = disp.clipBounds();
+  const int32_t cx0 = std::max<int32_t>(x, clip.x0);
+  const int32_t cy0 = std::max<int32_t>(y, clip.y0);
+  const int32_t cx1 = std::min<int32_t>(static_cast<int32_t>(x) + w, clip.x1);
+  const int32_t cy1 = std::min<int32_t>(static_cast<int32_t>(y) + h, clip.y1);
+  if (cx0 >= cx1 || cy0 >= cy1) { return; }
+  x = static_cast<int16_t>(cx0);
+  w = static_cast<int16_t>(cx1 - cx0);
+
+  disp.setAddressWindowPublic(static_cast<uint16_t>(cx0), static_cast<uint16_t>(cy0),
+                              static_cast<uint16_t>(cx1 - 1), static_cast<uint16_t>(cy1 - 1));
+
+  for (int16_t row = static_cast<int16_t>(cy0); row < cy1; ++row) {
+    // Start at the topmost opaque layer covering the whole row; nothing
+    // below it can show through
+    int start = 0;
+    for (int i = count_ - 1; i >= 0; --i) {
+      const Layer &l = layers_[i];
+      if (l.visible && l.mode == ESP32S3BoxLiteBlend::Opaque && l.sprite->created() &&
+          row >= l.y && row < l.y + l.sprite->height() && l.x <= x && l.x + l.sprite->width() >= x + w) {
+        start = i;
+        break;
+      }
+    }
+    if (start == 0) {
+      std::fill(line_, line_ + w, background_);
+    }
+    for (int i = start; i < count_; ++i) {
+      if (layers_[i].visible && layers_[i].sprite->created()) {
+        composeRow(layers_[i], row, x, w);
+      }
+    }
+
+    for (int16_t i = 0; i < w; ++i) {
+      line_[i] = swap565(line_[i]);
+    }
+    disp.pushPixels(reinterpret_cast<const uint8_t *>(line_), static_cast<size_t>(w) * 2U);
+  }
+  disp.endPixels();
 }
 
-void ESP32S3BoxLiteSprite::drawText(int16_t x, int16_t y, const char *text, uint8_t scale,
-                                     uint16_t fg, uint16_t bg) {
-  if (buffer_ == nullptr || text == nullptr) { return; }
-  if (scale == 0) { scale = 1; }
-  // Find glyphs and draw into buffer
-  const int16_t charWidth = 6 * scale;
-  int16_t cx = x;
-  for (size_t i = 0; text[i] != '\0'; ++i) {
-    const Glyph *glyph = findGlyph(text[i]);
-    for (uint8_t row = 0; row < 7; ++row) {
-      for (uint8_t col = 0; col < 5; ++col) {
-        const bool on    = glyph->rows[row] & (1 << (4 - col));
-        const uint16_t c = on ? fg : bg;
-        for (uint8_t sy = 0; sy < scale; ++sy) {
-          for (uint8_t sx = 0; sx < scale; ++sx) {
-            drawPixel(cx + col * scale + sx, y + row * scale + sy, c);
-          }
+void ESP32S3BoxLiteCompositor::composeRow(const Layer &layer, int16_t row, int16_t x, int16_t w) {
+  const ESP32S3BoxLiteSprite &sp = *layer.sprite;
+  const int32_t sy = static_cast<int32_t>(row) - layer.y;
+  if (sy < 0 || sy >= sp.height()) { return; }
+  const int32_t c0 = std::max<int32_t>(x, layer.x);
+  const int32_t c1 = std::min<int32_t>(static_cast<int32_t>(x) + w, static_cast<int32_t>(layer.x) + sp.width());
+  if (c0 >= c1) { return; }
+
+  const size_t  offset = static_cast<size_t>(sy) * sp.width() + static_cast<size_t>(c0 - layer.x);
+  uint16_t     *dst    = line_ + (c0 - x);
+  const int32_t n      = c1 - c0;
+  bool          wire   = sp.wireOrder();
+
+  // Indexed layers are looked up into native colours first
+  uint16_t        expanded[ESP32S3BoxLiteDisplay::Width];
+  const uint16_t *src = expanded;
+  if (sp.indices() != nullptr) {
+    expandIndexed<false>(sp.indices() + static_cast<size_t>(sy) * sp.rowBytes(), sp.bitsPerPixel(), c0 - layer.x, n,
+                         sp.palette(), expanded);
+    wire = false;
+  } else {
+    src = sp.buffer() + offset;
+  }
+
+  switch (layer.mode) {
+    case ESP32S3BoxLiteBlend::Opaque:
+      if (!wire) {
+        memcpy(dst, src, static_cast<size_t>(n) * 2U);
+      } else {
+        for (int32_t i = 0; i < n; ++i) { dst[i] = swap565(src[i]); }
+      }
+      break;
+
+    case ESP32S3BoxLiteBlend::ColorKey: {
+      // Compare in storage order so skipped pixels cost no conversion
+      const uint16_t key = wire ? swap565(layer.key) : layer.key;
+      for (int32_t i = 0; i < n; ++i) {
+        if (src[i] != key) { dst[i] = wire ? swap565(src[i]) : src[i]; }
+      }
+      break;
+    }
+
+    case ESP32S3BoxLiteBlend::Alpha: {
+      if (layer.mask == nullptr) {
+        const uint32_t a = (layer.alpha + 4U) >> 3;
+        if (a == 0) { break; }
+        for (int32_t i = 0; i < n; ++i) {
+          const uint16_t c = wire ? swap565(src[i]) : src[i];
+          dst[i] = a >= 32 ? c : blend565(c, dst[i], a);
         }
+        break;
+      }
+      const uint8_t *mask  = layer.mask + offset;
+      const uint32_t scale = layer.alpha + 1U;
+      for (int32_t i = 0; i < n; ++i) {
+        const uint32_t a = (((mask[i] * scale) >> 8) + 4U) >> 3;
+        if (a == 0) { continue; }
+        const uint16_t c = wire ? swap565(src[i]) : src[i];
+        dst[i] = a >= 32 ? c : blend565(c, dst[i], a);
       }
+      break;
     }
-    cx += charWidth;
   }
 }
 
-void ESP32S3BoxLiteSprite::pushSprite(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y) {
-  if (buffer_ == nullptr || w_ <= 0 || h_ <= 0) { return; }
-
-  // Clip to display bounds
-  const int16_t dispW = static_cast<int16_t>(ESP32S3BoxLiteDisplay::Width);
-  const int16_t dispH = static_cast<int16_t>(ESP32S3BoxLiteDisplay::Height);
-
-  int16_t srcX = 0, srcY = 0;
-  int16_t dstX = x, dstY = y;
-  int16_t copyW = w_, copyH = h_;
+// ===========================================================================
+// ESP32S3BoxLiteTileRenderer implementation
+// ===========================================================================
 
-  if (dstX < 0) { srcX -= dstX; copyW += dstX; dstX = 0; }
-  if (dstY < 0) { srcY -= dstY; copyH += dstY; dstY = 0; }
-  if (dstX + copyW > dispW) { copyW = dispW - dstX; }
-  if (dstY + copyH > dispH) { copyH = dispH - dstY; }
+bool ESP32S3BoxLiteTileRenderer::begin(RenderFn render, void *context) {
+  // Wire order: unchanged tiles are detected on the bytes that would be sent
+  if (!tile_.createSprite(TileSize, TileSize, ESP32S3BoxLiteSprite::WireOrder)) { return false; }
+  render_  = render;
+  context_ = context;
+  resetCache();
+  invalidateAll();
+  return true;
+}
 
-  if (copyW <= 0 || copyH <= 0) { return; }
+void ESP32S3BoxLiteTileRenderer::end() {
+  tile_.deleteSprite();
+  render_ = nullptr;
+}
 
-  disp.setAddressWindowPublic(
-      static_cast<uint16_t>(dstX), static_cast<uint16_t>(dstY),
-      static_cast<uint16_t>(dstX + copyW - 1), static_cast<uint16_t>(dstY + copyH - 1));
+void ESP32S3BoxLiteTileRenderer::invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0 || static_cast<int32_t>(x) + w <= 0 || static_cast<int32_t>(y) + h <= 0) { return; }
+  const int32_t c0 = std::max<int32_t>(x, 0) / TileSize;
+  const int32_t r0 = std::max<int32_t>(y, 0) / TileSize;
+  const int32_t c1 = std::min<int32_t>((static_cast<int32_t>(x) + w - 1) / TileSize, Columns - 1);
+  const int32_t r1 = std::min<int32_t>((static_cast<int32_t>(y) + h - 1) / TileSize, Rows - 1);
+  for (int32_t r = r0; r <= r1; ++r) {
+    for (int32_t c = c0; c <= c1; ++c) {
+      const uint32_t i = static_cast<uint32_t>(r * Columns + c);
+      dirty_[i >> 5] |= 1U << (i & 31);
+    }
+  }
+}
 
-  // Send row by row (convert from native uint16 to big-endian bytes)
-  constexpr size_t kBufPixels = 128;
-  uint8_t txBuf[kBufPixels * 2];
-  size_t  bufIdx = 0;
+void ESP32S3BoxLiteTileRenderer::invalidateAll() {
+  for (uint16_t i = 0; i < kTileCount; ++i) {
+    dirty_[i >> 5] |= 1U << (i & 31);
+  }
+}
 
-  // We need to send via the public raw buffer method
-  // Accumulate into txBuf and flush when full
-  auto sendBuf = [&](size_t count) {
-    disp.sendRawBuffer(txBuf, count);
-    bufIdx = 0;
-  };
+void ESP32S3BoxLiteTileRenderer::resetCache() {
+  memset(hashValid_, 0, sizeof(hashValid_));
+}
 
-  for (int16_t row = 0; row < copyH; ++row) {
-    for (int16_t col = 0; col < copyW; ++col) {
-      const uint16_t px = buffer_[(srcY + row) * w_ + (srcX + col)];
-      txBuf[bufIdx++] = px >> 8;
-      txBuf[bufIdx++] = px & 0xFF;
-      if (bufIdx >= sizeof(txBuf)) {
-        sendBuf(bufIdx);
-      }
+uint16_t ESP32S3BoxLiteTileRenderer::renderFrame(ESP32S3BoxLiteDisplay &disp) {
+  rendered_ = 0;
+  pushed_   = 0;
+  if (render_ == nullptr || tile_.buffer() == nullptr) { return 0; }
+
+  for (uint16_t i = 0; i < kTileCount; ++i) {
+    const uint32_t bit = 1U << (i & 31);
+    if ((dirty_[i >> 5] & bit) == 0) { continue; }
+
+    const int16_t ox = static_cast<int16_t>((i % Columns) * TileSize);
+    const int16_t oy = static_cast<int16_t>((i / Columns) * TileSize);
+    render_(tile_, ox, oy, context_);
+    ++rendered_;
+
+    // FNV-1a over the on-screen rows (the last tile row may be partial),
+    // a 32-bit word at a time
+    const int16_t   rows  = std::min<int16_t>(TileSize, static_cast<int16_t>(ESP32S3BoxLiteDisplay::Height - oy));
+    const uint32_t *words = reinterpret_cast<const uint32_t *>(tile_.buffer());
+    const size_t    count = static_cast<size_t>(rows) * TileSize / 2;
+    uint32_t hash = 2166136261u;
+    for (size_t w = 0; w < count; ++w) {
+      hash = (hash ^ words[w]) * 16777619u;
     }
+
+    if ((hashValid_[i >> 5] & bit) != 0 && hash_[i] == hash) { continue; }
+    hash_[i] = hash;
+    hashValid_[i >> 5] |= bit;
+    tile_.pushSprite(disp, ox, oy);
+    ++pushed_;
   }
-  if (bufIdx > 0) {
-    sendBuf(bufIdx);
-  }
+  memset(dirty_, 0, sizeof(dirty_));
+  return pushed_;
 }
 
 // ===========================================================================
@@ -1546,6 +7361,8 @@ void ESP32S3BoxLite::enterLightSleep(uint32_t wakeupGpioMask) {
     }
     esp_sleep_enable_gpio_wakeup();
   }
+  // Let queued LCD transfers finish before the clocks stop
+  display_.waitIdle();
   esp_light_sleep_start();
 }
 
@@ -1553,6 +7370,7 @@ void ESP32S3BoxLite::enterDeepSleep(uint64_t wakeupTimerUs) {
   if (wakeupTimerUs > 0) {
     esp_sleep_enable_timer_wakeup(wakeupTimerUs);
   }
+  display_.waitIdle();
   esp_deep_sleep_start();
 }
 
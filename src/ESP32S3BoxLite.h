@@ -1,7 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
-#include <SPI.h>
+#include <FS.h>
 
 #include <cstdarg>
 #include <cstddef>
@@ -41,30 +41,667 @@ enum class BeepPattern {
   Triple,
 };
 
+// ---------------------------------------------------------------------------
+// Display bus
+// ---------------------------------------------------------------------------
+
+struct ESP32S3BoxLiteBusStats {
+  uint32_t transactions = 0;  // SPI transactions (each is one CS assert/release)
+  uint32_t csToggles    = 0;
+  uint32_t commands     = 0;  // command bytes sent with D/C low
+  uint32_t windows      = 0;  // RAMWR commands, i.e. address windows opened
+  uint64_t bytes        = 0;  // every byte clocked out, commands included
+};
+
+// Transport between ESP32S3BoxLiteDisplay and the ST7789. The display only
+// talks to the panel through this interface.
+class ESP32S3BoxLiteBus {
+ public:
+  // Largest single transfer; longer data is split into chunks of this size
+  static constexpr size_t MaxTransferBytes = 4096;
+
+  virtual ~ESP32S3BoxLiteBus() = default;
+
+  virtual bool begin() = 0;
+  virtual void writeCommand(uint8_t command) = 0;
+  // Command parameters, sent as one transfer
+  virtual void writeData(const uint8_t *data, size_t len) = 0;
+  // Pixel data (wire order). Consecutive calls are coalesced until
+  // flushPixels() or the next command. The data is copied.
+  virtual void writePixels(const uint8_t *data, size_t len) = 0;
+  virtual void flushPixels() = 0;
+  // Like writePixels(), but the bus may read `data` directly until
+  // waitIdle() returns. Returns true when it does so.
+  virtual bool writePixelsInPlace(const uint8_t *data, size_t len);
+  // `count` pixels of one colour
+  virtual void writeColor(uint16_t color, uint32_t count) = 0;
+  virtual void waitIdle() {}
+  virtual void delayMs(uint32_t ms);
+
+  const ESP32S3BoxLiteBusStats &stats() const { return stats_; }
+  void resetStats() { stats_ = ESP32S3BoxLiteBusStats{}; }
+
+ protected:
+  ESP32S3BoxLiteBusStats stats_;
+};
+
+// Hardware backend: SPI2 with a queue of DMA transactions. CS is driven by
+// the SPI peripheral, D/C by a pre-transfer hook.
+class ESP32S3BoxLiteSpiBus : public ESP32S3BoxLiteBus {
+ public:
+  static constexpr uint32_t ClockHz = 10000000;
+
+  bool begin() override;
+  void writeCommand(uint8_t command) override;
+  void writeData(const uint8_t *data, size_t len) override;
+  void writePixels(const uint8_t *data, size_t len) override;
+  void flushPixels() override;
+  bool writePixelsInPlace(const uint8_t *data, size_t len) override;
+  void writeColor(uint16_t color, uint32_t count) override;
+  void waitIdle() override;
+
+ private:
+  // DMA transaction queue, defined in the .cpp (keeps ESP-IDF types private)
+  struct Queue;
+  Queue *queue_ = nullptr;
+};
+
+// Off-panel backend. Emulates the ST7789 address window and frame memory in
+// a 320x240 image (CASET/RASET/RAMWR only) and optionally logs the byte
+// stream so it can be replayed into another bus. Stats are counted the way
+// the SPI bus would split the same stream into transactions.
+class ESP32S3BoxLiteRecordingBus : public ESP32S3BoxLiteBus {
+ public:
+  static constexpr uint16_t Width  = 320;
+  static constexpr uint16_t Height = 240;
+
+  ~ESP32S3BoxLiteRecordingBus() override;
+
+  bool begin() override;
+  void writeCommand(uint8_t command) override;
+  void writeData(const uint8_t *data, size_t len) override;
+  void writePixels(const uint8_t *data, size_t len) override;
+  void flushPixels() override;
+  bool writePixelsInPlace(const uint8_t *data, size_t len) override;
+  void writeColor(uint16_t color, uint32_t count) override;
+  void delayMs(uint32_t) override {}
+
+  // Emulated frame memory in RGB565; 0 outside the image or before begin()
+  uint16_t pixel(int16_t x, int16_t y) const;
+  const uint16_t *image() const { return ram_; }
+  uint32_t imageHash() const;  // FNV-1a over the whole image
+
+  // Log buffer owned by the caller. Records are appended until it is full.
+  void setLogBuffer(uint8_t *buf, size_t capacity);
+  void clearLog();
+  size_t logSize() const { return logLen_; }
+  bool logOverflowed() const { return logOverflow_; }
+  void replay(ESP32S3BoxLiteBus &target) const;
+
+ private:
+  void log(uint8_t tag, const uint8_t *head, size_t headLen, const uint8_t *body, size_t bodyLen);
+  void countTransfer(size_t len);
+  void ramWrite(const uint8_t *data, size_t len);
+  void ramFill(uint16_t color, uint32_t count);
+
+  uint16_t *ram_ = nullptr;
+
+  // Controller state
+  uint8_t  command_ = 0;
+  uint8_t  param_[4] = {};
+  uint8_t  paramCount_ = 0;
+  uint16_t winX0_ = 0, winY0_ = 0, winX1_ = Width - 1, winY1_ = Height - 1;
+  uint16_t curX_ = 0, curY_ = 0;
+  bool     oddByteValid_ = false;
+  uint8_t  oddByte_ = 0;
+
+  size_t pendingPixelBytes_ = 0;  // coalesced, not yet counted as a transfer
+
+  uint8_t *log_ = nullptr;
+  size_t   logCap_ = 0;
+  size_t   logLen_ = 0;
+  bool     logOverflow_ = false;
+};
+
+// ---------------------------------------------------------------------------
+// Proportional fonts
+// ---------------------------------------------------------------------------
+
+// Font data is generated by tools/fontconvert.py (ready-made fonts are in
+// src/fonts/). Glyph bitmaps are cropped to their ink and packed row-major,
+// MSB first, at 1 or 4 bits per pixel; 4-bit values are coverage levels 0..15.
+struct ESP32S3BoxLiteGlyph {
+  uint32_t offset;   // first byte in the font bitmap
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  advance;  // pen movement
+  int8_t   xOffset;  // ink left edge relative to the pen
+  int8_t   yOffset;  // ink top below the top of the line
+};
+
+struct ESP32S3BoxLiteKernPair {
+  uint16_t left;
+  uint16_t right;
+  int8_t   adjust;  // added to the advance of `left`
+};
+
+struct ESP32S3BoxLiteFont {
+  const uint8_t                *bitmap;
+  const ESP32S3BoxLiteGlyph    *glyphs;   // one per character, first..last
+  const ESP32S3BoxLiteKernPair *kerning;  // sorted by left, then right
+  uint16_t kernCount;
+  uint16_t first;
+  uint16_t last;
+  uint8_t  bpp;  // 1 or 4
+  uint8_t  lineHeight;
+  uint8_t  baseline;  // rows from the top of the line
+
+  // nullptr when the font has no glyph for ch
+  const ESP32S3BoxLiteGlyph *glyph(uint16_t ch) const;
+  int8_t kern(uint16_t left, uint16_t right) const;
+  // Pen advance of text in pixels, kerning included
+  int16_t measure(const char *text) const;
+  // Coverage levels (0..15) of pixels [x, x + count) on row `row` of the line
+  // box, for text whose pen starts at x = 0
+  void renderRow(const char *text, int16_t row, int16_t x, int16_t count, uint8_t *levels) const;
+};
+
+struct ESP32S3BoxLiteGlyphCacheStats {
+  uint32_t hits      = 0;
+  uint32_t misses    = 0;  // glyphs read from flash
+  uint32_t evictions = 0;
+};
+
+// Large fonts such as kana plus JIS level-1 kanji, kept in a flash file
+// written by tools/fontconvert.py --asset. Only the code point of every 32nd
+// glyph stays in RAM; glyphs are read on first use into a fixed number of
+// cache slots, replacing the least recently used. Text is UTF-8; the asset
+// has no kerning.
+class ESP32S3BoxLiteFontFile {
+ public:
+  static constexpr uint8_t MaxRun = 64;  // glyphs laid out at once
+
+  ~ESP32S3BoxLiteFontFile() { end(); }
+
+  // Opens an asset on SPIFFS with RAM for cacheGlyphs glyphs
+  bool begin(const char *path, uint16_t cacheGlyphs = 64);
+  void end();
+  bool ready() const { return slots_ != nullptr; }
+
+  uint8_t lineHeight() const { return lineHeight_; }
+  uint8_t baseline() const { return baseline_; }
+  int16_t measure(const char *text);
+
+  // Lays out the next glyphs of text that fit in the cache together (at
+  // most MaxRun), advances text past them and returns their width.
+  // renderRow() then rasterises that run like ESP32S3BoxLiteFont::renderRow.
+  int16_t layoutRun(const char *&text);
+  void renderRow(int16_t row, int16_t x, int16_t count, uint8_t *levels) const;
+
+  const ESP32S3BoxLiteGlyphCacheStats &cacheStats() const { return stats_; }
+  void resetCacheStats() { stats_ = ESP32S3BoxLiteGlyphCacheStats{}; }
+
+ private:
+  static constexpr uint16_t NoSlot = 0xFFFF;
+
+  struct Slot {
+    uint32_t            cp;
+    ESP32S3BoxLiteGlyph glyph;  // bitmap is in the slot's part of bits_
+    bool                present;
+    uint16_t            older, newer;  // LRU list
+    uint16_t            chain;         // next slot in the hash bucket
+    uint32_t            run;           // run that pinned the slot
+  };
+  struct Placed {
+    uint16_t slot;
+    int16_t  pen;
+  };
+
+  // Slot holding cp, read from flash on a miss; NoSlot when every slot is
+  // pinned by the current run
+  uint16_t lookup(uint32_t cp);
+  bool     loadGlyph(uint32_t cp, ESP32S3BoxLiteGlyph &glyph, uint8_t *bits);
+  void     touch(uint16_t slot);
+  uint16_t bucketOf(uint32_t cp) const;
+
+  fs::File file_;
+  uint8_t  bpp_ = 0;
+  uint8_t  lineHeight_ = 0;
+  uint8_t  baseline_ = 0;
+  uint16_t glyphCount_ = 0;
+  uint16_t maxGlyphBytes_ = 0;
+  uint32_t indexOffset_ = 0;
+
+  void     *block_ = nullptr;  // one allocation for everything below
+  uint32_t *pageFirst_ = nullptr;
+  Slot     *slots_ = nullptr;
+  uint8_t  *bits_ = nullptr;
+  uint16_t *buckets_ = nullptr;
+  uint16_t  slotCount_ = 0;
+  uint8_t   bucketBits_ = 0;
+  uint16_t  oldest_ = NoSlot, newest_ = NoSlot;
+  uint32_t  run_ = 0;
+
+  Placed  placed_[MaxRun];
+  uint8_t placedCount_ = 0;
+
+  ESP32S3BoxLiteGlyphCacheStats stats_;
+};
+
+// ---------------------------------------------------------------------------
+// Streaming images
+// ---------------------------------------------------------------------------
+
+// Byte stream read by the image decoders: a block in memory (flash or RAM) or
+// an open file, read ChunkBytes at a time.
+class ESP32S3BoxLiteImageSource {
+ public:
+  static constexpr size_t ChunkBytes = 256;
+
+  ESP32S3BoxLiteImageSource() = default;  // empty until setMemory() or setFile()
+  ESP32S3BoxLiteImageSource(const uint8_t *data, size_t size) { setMemory(data, size); }
+  explicit ESP32S3BoxLiteImageSource(fs::File &file) { setFile(file); }
+  ESP32S3BoxLiteImageSource(const ESP32S3BoxLiteImageSource &) = delete;
+  ESP32S3BoxLiteImageSource &operator=(const ESP32S3BoxLiteImageSource &) = delete;
+
+  void setMemory(const uint8_t *data, size_t size);
+  // Reads on from the file's current position
+  void setFile(fs::File &file);
+
+  // Next byte, or -1 at the end of the data
+  int read() {
+    if (pos_ == end_ && !refill()) { return -1; }
+    return data_[pos_++];
+  }
+  // Copies up to len bytes; returns how many there were
+  size_t read(uint8_t *dst, size_t len);
+  bool skip(uint32_t len);
+  // Offsets count from where the source started
+  bool seek(uint32_t offset);
+  uint32_t offset() const { return base_ + static_cast<uint32_t>(pos_); }
+
+ private:
+  bool refill();
+
+  fs::File      *file_ = nullptr;
+  const uint8_t *data_ = chunk_;
+  size_t         pos_ = 0;
+  size_t         end_ = 0;
+  uint32_t       base_ = 0;       // stream offset of data_[0]
+  uint32_t       fileStart_ = 0;  // file position of offset 0
+  uint8_t        chunk_[ChunkBytes];
+};
+
+// ---------------------------------------------------------------------------
+// Pixel conversion
+// ---------------------------------------------------------------------------
+
+// 8-bit-per-channel source layouts
+enum class ESP32S3BoxLitePixelFormat : uint8_t {
+  RGB888,    // bytes r, g, b
+  BGR888,    // bytes b, g, r
+  ARGB8888,  // uint32_t 0xAARRGGBB, little-endian (bytes b, g, r, a); alpha is ignored
+  Gray8,
+};
+
+enum class ESP32S3BoxLiteDither : uint8_t {
+  None,       // channels truncated to 5/6/5 bits
+  Ordered,    // 4x4 Bayer threshold; stateless, stable on moving images
+  Diffusion,  // Floyd-Steinberg; smoothest gradients, carries error between rows
+};
+
+// Converts rows of 8-bit pixels into big-endian RGB565, the wire order that
+// pushPixels(), sendRawBuffer() and the framebuffer hold. Each format and
+// dither mode has its own branch-free loop. Error diffusion keeps one row of
+// error per channel, allocated by begin().
+class ESP32S3BoxLitePixelConverter {
+ public:
+  ESP32S3BoxLitePixelConverter() = default;
+  ~ESP32S3BoxLitePixelConverter() { end(); }
+  ESP32S3BoxLitePixelConverter(const ESP32S3BoxLitePixelConverter &) = delete;
+  ESP32S3BoxLitePixelConverter &operator=(const ESP32S3BoxLitePixelConverter &) = delete;
+
+  // Rows are at most `width` pixels. Fails only when the error row cannot
+  // be allocated.
+  bool begin(ESP32S3BoxLitePixelFormat format, uint16_t width,
+             ESP32S3BoxLiteDither dither = ESP32S3BoxLiteDither::None);
+  void end();
+  // Back to row 0 with no carried error, e.g. at the start of each frame
+  void reset();
+
+  // Converts `count` pixels of the current row, starting at column x, into
+  // 2 * count bytes at `wire`. Spans of a row go left to right; error is not
+  // carried across a gap between them.
+  void convert(const uint8_t *src, uint8_t *wire, uint16_t x, uint16_t count);
+  void nextRow();
+
+  static uint8_t bytesPerPixel(ESP32S3BoxLitePixelFormat format);
+
+ private:
+  // Writes the error held for the row below, ending the current span
+  void closeSpan();
+
+  ESP32S3BoxLitePixelFormat format_ = ESP32S3BoxLitePixelFormat::RGB888;
+  ESP32S3BoxLiteDither dither_ = ESP32S3BoxLiteDither::None;
+  uint16_t width_ = 0;
+  uint16_t row_ = 0;
+  uint16_t col_ = 0;  // column after the last converted pixel
+  bool spanOpen_ = false;
+  // Diffusion state in 1/16 units: per channel, incoming error for the row
+  // (width + 2 entries), error carried right, and the unfinished error of
+  // the two pixels below the last one
+  int16_t *error_ = nullptr;
+  int16_t carry_[3] = {};
+  int16_t below_[3][2] = {};
+};
+
+// ---------------------------------------------------------------------------
+// Clipping
+// ---------------------------------------------------------------------------
+
+// Half-open rectangle [x0, x1) x [y0, y1)
+struct ESP32S3BoxLiteClipRect {
+  int16_t x0, y0, x1, y1;
+
+  bool empty() const { return x0 >= x1 || y0 >= y1; }
+  bool contains(int16_t x, int16_t y) const { return x >= x0 && x < x1 && y >= y0 && y < y1; }
+};
+
+// Clip rectangles of a display or sprite. Each push is intersected with the
+// rectangle below it, so nested regions only shrink; the bottom entry is the
+// whole surface.
+class ESP32S3BoxLiteClipStack {
+ public:
+  static constexpr uint8_t MaxDepth = 8;
+
+  ESP32S3BoxLiteClipStack(int16_t w = 0, int16_t h = 0) { reset(w, h); }
+
+  // Whole w x h surface, nothing pushed
+  void reset(int16_t w, int16_t h);
+  // False when MaxDepth rectangles are already pushed; nothing is pushed
+  // then, so the matching pop() must be skipped
+  bool push(int16_t x, int16_t y, int16_t w, int16_t h);
+  void pop();
+  const ESP32S3BoxLiteClipRect &current() const { return rects_[depth_]; }
+  uint8_t depth() const { return depth_; }
+
+ private:
+  ESP32S3BoxLiteClipRect rects_[MaxDepth + 1] = {};
+  uint8_t depth_ = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Display list
+// ---------------------------------------------------------------------------
+
+// One frame of display drawing, recorded by
+// ESP32S3BoxLiteDisplay::beginRecording() instead of being sent. Whatever a
+// drawing call sends is an opaque rectangle of one colour or of pixels, so
+// the list holds just those rectangles; pixel data is copied into a pool.
+// optimize() rewrites the list without changing the picture, and
+// ESP32S3BoxLiteDisplay::drawList() sends it.
+class ESP32S3BoxLiteDisplayList {
+ public:
+  ESP32S3BoxLiteDisplayList() = default;
+  ~ESP32S3BoxLiteDisplayList() { end(); }
+  ESP32S3BoxLiteDisplayList(const ESP32S3BoxLiteDisplayList &) = delete;
+  ESP32S3BoxLiteDisplayList &operator=(const ESP32S3BoxLiteDisplayList &) = delete;
+
+  // Room for maxOps rectangles (32 bytes each, half of it for optimize(),
+  // plus 2 KB of working space) and pixelBytes of pixel data, in PSRAM if
+  // available. The pool must hold at least one screen row.
+  bool begin(uint16_t maxOps = 256, size_t pixelBytes = 32768);
+  void end();
+  // Forgets the rectangles but keeps the memory
+  void clear();
+
+  // Drops rectangles that later ones paint over, trims the rest to the part
+  // still visible, joins same-colour fills that form a rectangle, and orders
+  // the rectangles top to bottom where they do not overlap. Never raises
+  // wireBytes().
+  void optimize();
+
+  uint16_t size() const { return count_; }
+  size_t pixelBytes() const { return poolUsed_; }
+  // Bytes drawList() sends for the list, address windows included (10 fewer
+  // when the first window is already set on the panel)
+  uint32_t wireBytes() const;
+
+ private:
+  friend class ESP32S3BoxLiteDisplay;
+
+  // Inclusive rectangle. Fills have stride 0; pixel rectangles hold
+  // wire-order rows `stride` pixels apart at pool_ + offset.
+  struct Op {
+    int16_t x0, y0, x1, y1;
+    uint32_t offset;
+    uint16_t color;
+    uint16_t stride;
+  };
+
+  // Recording, called by the display: the address window, then pixels
+  // written through it. Each record call takes as many pixels as fit and
+  // returns how many; 0 means the list is full.
+  void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  uint32_t recordFill(uint16_t color, uint32_t count);
+  uint32_t recordPixels(const uint8_t *wire, uint32_t count);
+  // Pixels from the write position to the end of the current run: the rest
+  // of the row, or whole rows when it starts a row
+  uint32_t nextRun(uint32_t count, Op &op) const;
+  void advance(uint32_t count);
+  void append(const Op &op);
+  void removeDropped();
+
+  Op *ops_ = nullptr;
+  uint16_t capacity_ = 0;
+  uint16_t count_ = 0;
+  uint8_t *pool_ = nullptr;
+  size_t poolSize_ = 0;
+  size_t poolUsed_ = 0;
+
+  // Emulated controller window and write position while recording
+  uint16_t winX0_ = 0, winY0_ = 0, winX1_ = 0, winY1_ = 0;
+  uint16_t curX_ = 0, curY_ = 0;
+};
+
 // ---------------------------------------------------------------------------
 // Sprite (Phase 2)
 // ---------------------------------------------------------------------------
 
 class ESP32S3BoxLiteDisplay;  // forward declaration
 
+enum class ESP32S3BoxLiteBlend : uint8_t {
+  Opaque,
+  ColorKey,  // pixels equal to the key colour are transparent
+  Alpha,     // layer alpha, optionally times a per-pixel 8-bit mask
+};
+
+// Sampling of rotated and scaled sprites
+enum class ESP32S3BoxLiteFilter : uint8_t {
+  Nearest,
+  Bilinear,  // blends the four closest pixels
+};
+
 class ESP32S3BoxLiteSprite {
  public:
-  bool createSprite(int16_t w, int16_t h);
+  // createSprite() flags
+  static constexpr uint8_t WireOrder   = 0x01;  // store big-endian RGB565, pushed without conversion
+  static constexpr uint8_t InternalRam = 0x02;  // DMA-capable internal RAM, pushed without copying
+  // Palette-indexed pixels, expanded through the palette as they are pushed.
+  // Drawing calls take palette indices instead of colours. 4 bpp packs two
+  // pixels per byte, the left one in the high nibble.
+  static constexpr uint8_t Indexed8 = 0x04;  // 256 colours, 1 byte per pixel
+  static constexpr uint8_t Indexed4 = 0x08;  // 16 colours, 2 pixels per byte
+
+  bool createSprite(int16_t w, int16_t h, uint8_t flags = 0);
   void deleteSprite();
+  bool created() const { return buffer_ != nullptr || indices_ != nullptr; }
   void pushSprite(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y);
+  // The w x h rectangle at (sx, sy) of the sprite, drawn at (x, y); clipped
+  // to both the sprite and the panel
+  void pushSubRect(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, int16_t sx, int16_t sy, int16_t w, int16_t h);
+
+  // --- Sprite to sprite ---
+  // Clipped to both sprites. Rows of the same format are copied with
+  // memmove; others are converted pixel by pixel, indexed destinations
+  // taking the nearest palette entry. Indexed sprites of the same depth copy
+  // indices, assuming a shared palette. Copies within one sprite may
+  // overlap. mode is Opaque or ColorKey (key compared as a colour); Alpha
+  // copies as Opaque.
+  void pushSprite(ESP32S3BoxLiteSprite &dst, int16_t x, int16_t y,
+                  ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0);
+  void pushSubRect(ESP32S3BoxLiteSprite &dst, int16_t x, int16_t y, int16_t sx, int16_t sy, int16_t w, int16_t h,
+                   ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0);
+
+  // --- Rotation and scaling ---
+  // Point of the sprite that pushRotateZoom() places at (x, y) and turns
+  // about; the centre after createSprite()
+  void setPivot(int16_t x, int16_t y);
+  int16_t pivotX() const { return pivotX_; }
+  int16_t pivotY() const { return pivotY_; }
+  // Draws the sprite turned angle degrees clockwise and scaled by zoomX,
+  // zoomY (negative mirrors) about its pivot, which lands on (x, y). mode is
+  // Opaque or ColorKey; Alpha draws as Opaque. With a key, bilinear filtering
+  // never blends the key colour into the edges.
+  void pushRotateZoom(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, float angle, float zoomX = 1.0f,
+                      float zoomY = 1.0f, ESP32S3BoxLiteFilter filter = ESP32S3BoxLiteFilter::Nearest,
+                      ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0);
+  // Into another sprite (not this one). Indexed destinations take the
+  // nearest palette entry of each pixel.
+  void pushRotateZoom(ESP32S3BoxLiteSprite &dst, int16_t x, int16_t y, float angle, float zoomX = 1.0f,
+                      float zoomY = 1.0f, ESP32S3BoxLiteFilter filter = ESP32S3BoxLiteFilter::Nearest,
+                      ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0);
+
+  // --- Palette (indexed sprites) ---
+  // Native RGB565 entries, looked up at push time: changing one recolours
+  // every pixel that uses it without redrawing. Indexed8 starts as RGB332
+  // (index rrrgggbb), Indexed4 as a 16-step grey ramp.
+  void setPaletteColor(uint8_t index, uint16_t color);
+  void setPalette(const uint16_t *colors, uint16_t count, uint8_t first = 0);
+  uint16_t paletteColor(uint8_t index) const;
+  // Rotates entries [first, first + count) step places up (the last ones
+  // wrap to first), or down when step is negative; for palette cycling
+  void cyclePalette(uint8_t first, uint16_t count, int8_t step = 1);
+  // Entry closest to color (squared RGB distance)
+  uint8_t nearestIndex(uint16_t color) const;
+
+  // --- Clipping ---
+  // Drawing into the sprite (including blits and pushRotateZoom() into it)
+  // is limited to the clip rectangle; see ESP32S3BoxLiteDisplay. Reset by
+  // createSprite().
+  bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) { return clip_.push(x, y, w, h); }
+  void popClipRect() { clip_.pop(); }
+  const ESP32S3BoxLiteClipRect &clipBounds() const { return clip_.current(); }
 
+  // fillScreen() fills the clip rectangle
   void fillScreen(uint16_t color);
   void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
   void drawPixel(int16_t x, int16_t y, uint16_t color);
   void drawText(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  // Colour of a pixel (the palette colour on indexed sprites); 0 outside
+  uint16_t readPixel(int16_t x, int16_t y) const;
+
+  // Same shapes and conventions as ESP32S3BoxLiteDisplay
+  void fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+  void fillPolygon(const int16_t *points, uint8_t count, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint16_t color);
+  void fillArc(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, int16_t startDeg, int16_t endDeg,
+               uint16_t color);
+
+  // Anti-aliased; edges blend with the pixels already in the sprite. Indexed
+  // sprites cannot blend, so their edges are cut at half coverage.
+  void drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+  void fillCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+  // Glyphs only; the cell background is left as it is
+  void drawTextAA(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t color);
+  // Blended over the sprite; returns the pen x after the text
+  int16_t drawString(const ESP32S3BoxLiteFont &font, int16_t x, int16_t y, const char *text, uint16_t color);
+  int16_t drawString(ESP32S3BoxLiteFontFile &font, int16_t x, int16_t y, const char *text, uint16_t color);
+  // Same formats as ESP32S3BoxLiteDisplay::drawImage(). On indexed sprites
+  // each pixel takes the nearest palette entry.
+  bool drawImage(ESP32S3BoxLiteImageSource &src, int16_t x, int16_t y, uint8_t shrink = 1);
 
   int16_t width() const { return w_; }
   int16_t height() const { return h_; }
+  bool wireOrder() const { return wireOrder_; }
+  uint8_t bitsPerPixel() const { return bpp_; }  // 16, 8 or 4
+  // RGB565 pixels; nullptr for indexed sprites
+  const uint16_t *buffer() const { return buffer_; }
+  // Indexed pixels, rowBytes() per row; nullptr for RGB565 sprites
+  const uint8_t *indices() const { return indices_; }
+  size_t rowBytes() const { return bpp_ == 4 ? (static_cast<size_t>(w_) + 1) / 2 : static_cast<size_t>(w_) * bpp_ / 8; }
+  const uint16_t *palette() const { return palette_; }
 
  private:
+  // Colour as stored in buffer_
+  uint16_t stored(uint16_t color) const {
+    return wireOrder_ ? static_cast<uint16_t>((color << 8) | (color >> 8)) : color;
+  }
+  // Waits for a push that is still reading buffer_; call before writing it
+  void sync();
+  // n pixels of color (an index on indexed sprites) from (x, y), inside the sprite
+  void writeSpan(int32_t x, int32_t y, int32_t n, uint16_t color);
+  // Index at (x, y) of an indexed sprite, inside the sprite
+  uint8_t indexAt(int32_t x, int32_t y) const;
+  // Blends color into a block at 16-level coverage (row-major, unclipped)
+  void blendBlock(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels, uint16_t color);
+
   uint16_t *buffer_ = nullptr;
+  uint16_t *palette_ = nullptr;  // indexed: one block, palette then indices_
+  uint8_t *indices_ = nullptr;
   int16_t w_ = 0;
   int16_t h_ = 0;
+  int16_t pivotX_ = 0;
+  int16_t pivotY_ = 0;
+  uint8_t bpp_ = 16;
+  bool wireOrder_ = false;
+  ESP32S3BoxLiteDisplay *inFlight_ = nullptr;
+  ESP32S3BoxLiteClipStack clip_;
+};
+
+// ---------------------------------------------------------------------------
+// Sprite sheet
+// ---------------------------------------------------------------------------
+
+// A named rectangle of an atlas sprite
+struct ESP32S3BoxLiteSpriteFrame {
+  const char *name;
+  int16_t x, y, w, h;
+};
+
+// Many images kept in one atlas sprite: a single allocation, usually in
+// PSRAM, instead of one per icon. Frames are drawn with pushSubRect(). The
+// atlas and the frame table are referenced, not copied.
+class ESP32S3BoxLiteSpriteSheet {
+ public:
+  void begin(ESP32S3BoxLiteSprite &atlas, const ESP32S3BoxLiteSpriteFrame *frames, uint16_t count);
+  // Unnamed frames of a uniform grid, numbered row by row
+  void beginGrid(ESP32S3BoxLiteSprite &atlas, int16_t cellW, int16_t cellH);
+
+  uint16_t frameCount() const;
+  // Index of the named frame, or -1. The search is linear, so look names
+  // up once outside hot loops.
+  int16_t find(const char *name) const;
+  bool frame(uint16_t index, ESP32S3BoxLiteSpriteFrame &out) const;
+
+  // False when the frame does not exist
+  bool drawFrame(ESP32S3BoxLiteDisplay &disp, uint16_t index, int16_t x, int16_t y) const;
+  bool drawFrame(ESP32S3BoxLiteSprite &dst, uint16_t index, int16_t x, int16_t y,
+                 ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0) const;
+  bool draw(ESP32S3BoxLiteDisplay &disp, const char *name, int16_t x, int16_t y) const;
+  bool draw(ESP32S3BoxLiteSprite &dst, const char *name, int16_t x, int16_t y,
+            ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0) const;
+
+ private:
+  ESP32S3BoxLiteSprite *atlas_ = nullptr;
+  const ESP32S3BoxLiteSpriteFrame *frames_ = nullptr;
+  uint16_t count_ = 0;
+  int16_t cellW_ = 0;  // grid sheets only
+  int16_t cellH_ = 0;
 };
 
 // ---------------------------------------------------------------------------
@@ -87,9 +724,39 @@ class ESP32S3BoxLiteDisplay {
   static constexpr uint16_t Width  = 320;
   static constexpr uint16_t Height = 240;
 
+  // Transport to the panel. Defaults to the built-in SPI bus; must be set
+  // before begin(). Passing nullptr restores the default.
+  void setBus(ESP32S3BoxLiteBus *bus);
+  ESP32S3BoxLiteBus &bus() { return *bus_; }
+
   bool begin();
 
+  // --- Clipping ---
+  // Every drawing call below, sprite pushes included, only touches pixels
+  // inside the clip rectangle: the intersection of the rectangles pushed
+  // and the screen. Primitives are cut to it per span or block, so one that
+  // lies entirely outside sends nothing. Raw pixel pushes (sprite support
+  // below) and flush() are not clipped.
+  bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) { return clip_.push(x, y, w, h); }
+  void popClipRect() { clip_.pop(); }
+  const ESP32S3BoxLiteClipRect &clipBounds() const { return clip_.current(); }
+
+  // --- Display list ---
+  // Between beginRecording() and endRecording(), drawing calls land in `list`
+  // instead of on the panel; send them with drawList(), usually after
+  // list.optimize(). A full list is optimized and sent on the spot, so
+  // nothing is lost. Direct mode only: false while the framebuffer is
+  // enabled or when the list has no memory. Hardware scroll commands are not
+  // recorded.
+  bool beginRecording(ESP32S3BoxLiteDisplayList &list);
+  void endRecording();
+  bool recording() const { return recording_ != nullptr; }
+  // Sends the rectangles as they are in the list, without clipping them
+  // again. While another list is being recorded, they are recorded into it.
+  void drawList(const ESP32S3BoxLiteDisplayList &list);
+
   // --- Existing drawing ---
+  // fillScreen() fills the clip rectangle
   void fillScreen(uint16_t color);
   void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
   void drawText(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg);
@@ -104,9 +771,63 @@ class ESP32S3BoxLiteDisplay {
   void fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
   void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgColor, uint16_t bgColor);
   void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h);
+  // 8-bit-per-channel pixels (rows `stride` bytes apart, 0 when packed),
+  // converted on the way to the panel, or straight into the framebuffer in
+  // buffered mode. Returns false only when diffusion memory is short.
+  bool drawRGBBitmap(int16_t x, int16_t y, const uint8_t *pixels, int16_t w, int16_t h,
+                     ESP32S3BoxLitePixelFormat format, ESP32S3BoxLiteDither dither = ESP32S3BoxLiteDither::None,
+                     size_t stride = 0);
   void drawProgressBar(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t percent, uint16_t fgColor, uint16_t bgColor);
   void printf(int16_t x, int16_t y, uint8_t scale, uint16_t fg, uint16_t bg, const char *fmt, ...);
 
+  // --- Spans ---
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+  // --- Filled shapes ---
+  // Scan-converted: every covered scanline is sent once, as one span.
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+  // `points` holds `count` x,y pairs (at most 96 points). Pixel centres inside
+  // the outline are filled (even-odd rule), so corners (0,0) and (10,10)
+  // cover 10x10 pixels.
+  void fillPolygon(const int16_t *points, uint8_t count, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void drawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint16_t color);
+  // Ring segment; angles in degrees clockwise from 3 o'clock. innerR 0 gives
+  // a pie slice.
+  void fillArc(int16_t cx, int16_t cy, int16_t outerR, int16_t innerR, int16_t startDeg, int16_t endDeg,
+               uint16_t color);
+
+  // --- Anti-aliased drawing ---
+  // Edges are blended toward `bg` in 16 coverage steps, since the panel cannot
+  // be read back. In buffered mode they blend with the framebuffer instead.
+  void drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg);
+  void drawCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color, uint16_t bg);
+  void fillCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t color, uint16_t bg);
+  // Same layout as drawText(), with smoothed glyph edges
+  void drawTextAA(int16_t x, int16_t y, const char *text, uint8_t scale, uint16_t fg, uint16_t bg);
+
+  // --- Proportional fonts ---
+  // y is the top of the line box, which is filled with bg (font.lineHeight
+  // rows, as wide as the text) and sent as one window. Returns the pen x
+  // after the text.
+  int16_t drawString(const ESP32S3BoxLiteFont &font, int16_t x, int16_t y, const char *text, uint16_t fg,
+                     uint16_t bg);
+  // Glyphs come through the font's cache; long or varied text is sent as one
+  // window per run of glyphs that fit in the cache together.
+  int16_t drawString(ESP32S3BoxLiteFontFile &font, int16_t x, int16_t y, const char *text, uint16_t fg,
+                     uint16_t bg);
+
+  // --- Images ---
+  // Decodes a BMP (uncompressed, 1 to 32 bpp), QOI, RLE565 (see
+  // tools/imageconvert.py) or baseline JPEG image with its top-left at (x, y),
+  // streaming it into the visible window without a frame buffer. JPEGs can be
+  // decoded at 1/shrink size (2, 4 or 8), which also makes them faster. Alpha
+  // is ignored. Returns false for unknown or damaged data; rows decoded before
+  // the damage stay drawn.
+  bool drawImage(ESP32S3BoxLiteImageSource &src, int16_t x, int16_t y, uint8_t shrink = 1);
+  bool drawImageFromSPIFFS(const char *path, int16_t x, int16_t y, uint8_t shrink = 1);
+
   // --- Phase 7 UI helpers ---
   void showMessage(const char *text, uint16_t bgColor);
   void showError(const char *text);
@@ -116,18 +837,531 @@ class ESP32S3BoxLiteDisplay {
   // --- Sprite support (called by ESP32S3BoxLiteSprite) ---
   void setAddressWindowPublic(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
   void sendRawBuffer(const uint8_t *buf, size_t len);
+  // Wire-order pixels, coalesced until endPixels()
+  void pushPixels(const uint8_t *wire, size_t len);
+  void endPixels();
+  // See ESP32S3BoxLiteBus::writePixelsInPlace()
+  bool pushPixelsInPlace(const uint8_t *wire, size_t len);
+
+  // --- Buffered mode ---
+  // When enabled, all drawing goes to a 320x240 RGB565 framebuffer (PSRAM if
+  // available) and only the damaged rectangles are sent to the panel by flush().
+  bool enableFramebuffer(bool enable = true);
+  bool framebufferEnabled() const { return framebuffer_ != nullptr; }
+  void flush();
+
+  // --- Asynchronous SPI ---
+  // Drawing calls queue DMA transactions and return immediately. waitIdle()
+  // blocks until everything queued so far has been clocked out.
+  void waitIdle();
+
+  // --- Hardware scroll ---
+  // The controller scrolls along its 320 gate lines, which run along X in
+  // this orientation, so the picture moves horizontally. Columns [0, left)
+  // and [Width - right, Width) stay fixed; in between, frame memory is shown
+  // shifted left by scrollTo() pixels, wrapping around.
+  void setScrollArea(uint16_t left, uint16_t right);
+  void scrollTo(uint16_t offset);
+  void resetScroll();
+  uint16_t scrollOffset() const { return scrollOffset_; }
+  // Frame-memory column currently shown at screen column x
+  int16_t scrollMemoryX(int16_t x) const;
+
+  // Counters for everything sent to the panel since the last reset
+  ESP32S3BoxLiteBusStats busStats() const;
+  void resetBusStats();
+  static uint32_t spiClockHz();
 
  private:
+  // The Ui keeps its invalid areas in the same DirtyRect lists
+  friend class ESP32S3BoxLiteUi;
+
+  // Inclusive screen-space rectangle
+  struct DirtyRect {
+    int16_t x0, y0, x1, y1;
+  };
+  static constexpr uint8_t kMaxDirtyRects = 16;
+
   void writeCommand(uint8_t command);
   void writeData(const uint8_t *data, size_t length);
   void writeCommandWithData(uint8_t command, const uint8_t *data, size_t length);
   void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  void writeAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
   void sendColor(uint16_t color, uint32_t count);
-  void drawGlyph(int16_t x, int16_t y, char ch, uint8_t scale, uint16_t fg, uint16_t bg);
+  bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+  // Sends a block of coverage levels (row-major, unclipped) as colours from
+  // ramp, or blended over the framebuffer in buffered mode
+  void pushCoverage(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t *levels, uint16_t color,
+                    const uint16_t *ramp);
+
+  // Framebuffer helpers (buffered mode)
+  void fbWrite(const uint8_t *bytes, uint16_t color, uint32_t count);
+  void markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
 
-  SPIClass spi_{FSPI};
+  // Sends and empties the list being recorded once it is full
+  void spillRecording();
+
+  ESP32S3BoxLiteSpiBus spiBus_;
+  ESP32S3BoxLiteBus *bus_ = &spiBus_;
   bool initialized_ = false;
   bool backlightPwmSetup_ = false;
+  ESP32S3BoxLiteClipStack clip_{Width, Height};
+  ESP32S3BoxLiteDisplayList *recording_ = nullptr;
+
+  // Hardware scroll state, in screen columns
+  uint16_t scrollLeft_ = 0;
+  uint16_t scrollWidth_ = Width;
+  uint16_t scrollOffset_ = 0;
+
+  // Last CASET/RASET sent to the panel; repeated windows skip the command
+  bool windowValid_ = false;
+  uint16_t winX0_ = 0, winY0_ = 0, winX1_ = 0, winY1_ = 0;
+
+  // Buffered mode state. Pixels are stored in wire order (big-endian RGB565)
+  // so dirty rows can be sent without conversion.
+  uint16_t *framebuffer_ = nullptr;
+  uint16_t fbWinX0_ = 0, fbWinY0_ = 0, fbWinX1_ = 0, fbWinY1_ = 0;
+  uint16_t fbCurX_ = 0, fbCurY_ = 0;
+  DirtyRect dirty_[kMaxDirtyRects] = {};
+  uint8_t dirtyCount_ = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Animated GIF
+// ---------------------------------------------------------------------------
+
+// Plays a GIF from flash or SPIFFS, decoding each frame's LZW data as it is
+// read. Only the frame's own rectangle is sent, and disposal is applied to the
+// previous frame's rectangle alone. RAM is the LZW tables, palettes and one
+// line (about 17 KB); a copy of the logical screen (PSRAM if available) is
+// kept only for files that use "restore to previous" disposal. Without it the
+// panel holds the picture, so nothing else may draw over the animation.
+class ESP32S3BoxLiteGifPlayer {
+ public:
+  ESP32S3BoxLiteGifPlayer() = default;
+  ~ESP32S3BoxLiteGifPlayer() { close(); }
+  ESP32S3BoxLiteGifPlayer(const ESP32S3BoxLiteGifPlayer &) = delete;
+  ESP32S3BoxLiteGifPlayer &operator=(const ESP32S3BoxLiteGifPlayer &) = delete;
+
+  // The logical screen's top-left goes at (x, y). Memory data must stay valid
+  // until close(). Nothing is drawn until the first update().
+  bool open(ESP32S3BoxLiteDisplay &disp, const uint8_t *data, size_t size, int16_t x, int16_t y);
+  bool openFromSPIFFS(ESP32S3BoxLiteDisplay &disp, const char *path, int16_t x, int16_t y);
+  void close();
+  bool isOpen() const { return disp_ != nullptr; }
+
+  // Fills "restore to background" areas and what the first frame leaves
+  // uncovered (default black; the file's own background index is ignored, as
+  // browsers do)
+  void setBackground(uint16_t color) { background_ = color; }
+
+  // Draws the next frame once the current one's delay has passed, and returns
+  // at once otherwise; call it from loop(). Returns false when the animation
+  // has ended (loop count reached) or the data is damaged.
+  bool update();
+  // Draws the next frame now, whatever its delay
+  bool drawNextFrame();
+  // Milliseconds until update() draws the next frame
+  uint32_t nextFrameIn() const;
+
+  uint16_t width() const { return width_; }
+  uint16_t height() const { return height_; }
+  uint16_t frameCount() const { return frameCount_; }
+  // Delays of 10 ms or less are shown for 100 ms, as browsers do
+  uint32_t frameDelay() const { return delayMs_; }
+
+ private:
+  // Frame rectangle in logical-screen pixels
+  struct Rect {
+    uint16_t x, y, w, h;
+  };
+
+  bool begin(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y);
+  // Counts the frames and finds the loop count and whether any frame
+  // restores to previous
+  bool scan(bool &restores);
+  bool readExtension();
+  bool readPalette(uint16_t *palette, uint16_t count);
+  bool drawFrame();
+  // Sends rect from the canvas, or fills it with the background
+  void restoreRect(const Rect &rect, bool fromCanvas);
+
+  ESP32S3BoxLiteDisplay    *disp_ = nullptr;
+  fs::File                  file_;
+  ESP32S3BoxLiteImageSource src_;
+  int16_t  x_ = 0, y_ = 0;
+  uint16_t width_ = 0, height_ = 0;
+  uint16_t frameCount_ = 0;
+  uint16_t background_ = 0;
+  uint32_t firstFrame_ = 0;  // source offset of the first block after the header
+  int32_t  loops_ = -1;      // NETSCAPE2.0 repeat count; -1 plays once, 0 forever
+  int32_t  loopsLeft_ = 0;
+  bool     globalPalette_ = false;
+
+  void     *block_ = nullptr;  // one allocation for everything below
+  uint16_t *prefix_ = nullptr;
+  uint16_t *palettes_ = nullptr;  // global, then local, native RGB565
+  uint8_t  *suffix_ = nullptr;
+  uint8_t  *stack_ = nullptr;
+  uint8_t  *line_ = nullptr;
+  uint16_t *canvas_ = nullptr;  // logical screen, native RGB565
+
+  // Graphic Control Extension for the next frame
+  uint8_t  gceDisposal_ = 0;
+  int16_t  gceTransparent_ = -1;
+  uint32_t gceDelayMs_ = 0;
+
+  uint32_t delayMs_ = 0;  // of the frame on screen
+  Rect     previous_ = {};
+  uint8_t  previousDisposal_ = 0;
+  bool     clearPending_ = true;  // the first frame of a loop clears the screen
+  bool     finished_ = false;
+  uint32_t nextDue_ = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Compositor
+// ---------------------------------------------------------------------------
+
+// Z-ordered sprite layers composed one scanline at a time. Every output row
+// is blended in a line buffer and sent once, so overlapping layers never
+// flicker. Layers reference their sprites; they are not copied.
+class ESP32S3BoxLiteCompositor {
+ public:
+  static constexpr uint8_t MaxLayers = 8;
+
+  // Layers are stacked in the order added, the last one on top. Returns the
+  // layer index, or -1 when full.
+  int8_t addLayer(const ESP32S3BoxLiteSprite &sprite, int16_t x, int16_t y,
+                  ESP32S3BoxLiteBlend mode = ESP32S3BoxLiteBlend::Opaque, uint16_t key = 0, uint8_t alpha = 255);
+  void clearLayers();
+
+  void setPosition(uint8_t layer, int16_t x, int16_t y);
+  void setVisible(uint8_t layer, bool visible);
+  // `mask` is sprite-sized (width * height), owned by the caller
+  void setAlpha(uint8_t layer, uint8_t alpha, const uint8_t *mask = nullptr);
+  void setBackground(uint16_t color) { background_ = color; }
+
+  // Redraws everything the layers cover now or covered at the last call
+  void render(ESP32S3BoxLiteDisplay &disp);
+  // Redraws one screen rectangle
+  void render(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, int16_t w, int16_t h);
+
+ private:
+  struct Layer {
+    const ESP32S3BoxLiteSprite *sprite;
+    int16_t x, y;
+    ESP32S3BoxLiteBlend mode;
+    uint16_t key;
+    uint8_t alpha;
+    const uint8_t *mask;
+    bool visible;
+    bool drawn;  // last rect below is valid
+    int16_t lastX, lastY, lastW, lastH;
+  };
+
+  void composeRow(const Layer &layer, int16_t row, int16_t x, int16_t w);
+
+  Layer layers_[MaxLayers] = {};
+  uint8_t count_ = 0;
+  uint16_t background_ = 0;
+  uint16_t line_[ESP32S3BoxLiteDisplay::Width] = {};
+};
+
+// ---------------------------------------------------------------------------
+// Tile renderer
+// ---------------------------------------------------------------------------
+
+// The screen as a grid of 32x32 tiles. Drawing code marks areas dirty with
+// invalidate(); renderFrame() redraws each dirty tile into a tile sprite
+// through the render callback and pushes it only if its content hash
+// changed. Per-frame work and memory are bounded by the tile grid.
+class ESP32S3BoxLiteTileRenderer {
+ public:
+  static constexpr int16_t TileSize = 32;
+  static constexpr int16_t Columns  = (ESP32S3BoxLiteDisplay::Width + TileSize - 1) / TileSize;
+  static constexpr int16_t Rows     = (ESP32S3BoxLiteDisplay::Height + TileSize - 1) / TileSize;
+
+  // Must paint the whole tile. Screen point (x, y) is tile pixel
+  // (x - originX, y - originY).
+  using RenderFn = void (*)(ESP32S3BoxLiteSprite &tile, int16_t originX, int16_t originY, void *context);
+
+  bool begin(RenderFn render, void *context = nullptr);
+  void end();
+
+  void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+  void invalidateAll();
+  // Forgets the hashes, e.g. after something else drew on the screen
+  void resetCache();
+
+  // Returns the number of tiles pushed
+  uint16_t renderFrame(ESP32S3BoxLiteDisplay &disp);
+  uint16_t lastRendered() const { return rendered_; }
+  uint16_t lastPushed() const { return pushed_; }
+
+ private:
+  static constexpr uint16_t kTileCount = Columns * Rows;
+  static constexpr uint16_t kMaskWords = (kTileCount + 31) / 32;
+
+  ESP32S3BoxLiteSprite tile_;
+  RenderFn render_ = nullptr;
+  void *context_ = nullptr;
+  uint32_t dirty_[kMaskWords] = {};
+  uint32_t hashValid_[kMaskWords] = {};
+  uint32_t hash_[kTileCount] = {};
+  uint16_t rendered_ = 0;
+  uint16_t pushed_ = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Console (hardware scroll)
+// ---------------------------------------------------------------------------
+
+// One line of 5x7 text that enters at the right edge and scrolls left.
+// Each character costs one cell of SPI traffic; the controller moves the
+// rest. The console owns the scroll area: anything else drawn between the
+// fixed columns moves with it.
+class ESP32S3BoxLiteConsole {
+ public:
+  bool begin(ESP32S3BoxLiteDisplay &disp, int16_t y, uint8_t scale, uint16_t fg, uint16_t bg,
+             uint16_t left = 0, uint16_t right = 0);
+  void end();
+  void clear();
+
+  void print(const char *text);
+  void println(const char *text);
+  void printf(const char *fmt, ...);
+
+ private:
+  void putChar(char ch);
+
+  ESP32S3BoxLiteDisplay *disp_ = nullptr;
+  int16_t  y_ = 0;
+  uint8_t  scale_ = 1;
+  uint16_t fg_ = 0;
+  uint16_t bg_ = 0;
+  uint16_t left_ = 0;
+  uint16_t width_ = 0;   // scroll area, a whole number of cells
+  uint16_t cursor_ = 0;  // next cell, relative to left_
+  uint16_t offset_ = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Label
+// ---------------------------------------------------------------------------
+
+// One line of 5x7 text, laid out as drawText() does, that remembers what is
+// on screen. set() compares the new string with the shown one and sends only
+// the runs of character cells that differ, then clears the cells the text
+// no longer reaches: a counter going from 1023 to 1024 costs one glyph.
+class ESP32S3BoxLiteLabel {
+ public:
+  static constexpr uint8_t MaxChars = 63;
+
+  void begin(ESP32S3BoxLiteDisplay &disp, int16_t x, int16_t y, uint8_t scale, uint16_t fg, uint16_t bg);
+
+  // Text past MaxChars is dropped
+  void set(const char *text);
+  void printf(const char *fmt, ...);
+
+  // Moving or rescaling clears the shown text at once; the next set() draws
+  // it in full. New colours repaint every cell on the next set().
+  void setPosition(int16_t x, int16_t y);
+  void setScale(uint8_t scale);
+  void setColors(uint16_t fg, uint16_t bg);
+  // Forgets the shown text, e.g. after fillScreen(); the next set() draws
+  // every cell and clears nothing
+  void invalidate() { shown_ = 0; }
+
+  const char *text() const { return text_; }
+  // Cells drawn by the last set(), not counting cleared ones
+  uint8_t cellsDrawn() const { return cellsDrawn_; }
+
+ private:
+  // Fills columns [x0, x1) of the text rows with bg
+  void fillBg(int32_t x0, int32_t x1);
+
+  ESP32S3BoxLiteDisplay *disp_ = nullptr;
+  int16_t  x_ = 0, y_ = 0;
+  uint8_t  scale_ = 1;
+  uint16_t fg_ = 0, bg_ = 0;
+  uint8_t  shown_ = 0;  // leading characters of text_ that are on screen
+  bool     repaint_ = false;
+  uint8_t  cellsDrawn_ = 0;
+  char     text_[MaxChars + 1] = {};
+};
+
+// ---------------------------------------------------------------------------
+// Retained widgets
+// ---------------------------------------------------------------------------
+
+class ESP32S3BoxLiteUi;
+
+// An opaque screen rectangle that keeps its own state. Setters invalidate
+// only the pixels that change; ESP32S3BoxLiteUi::render() repaints them.
+// A widget belongs to at most one ESP32S3BoxLiteUi and leaves it when destroyed.
+class ESP32S3BoxLiteWidget {
+ public:
+  virtual ~ESP32S3BoxLiteWidget();
+
+  void setBounds(int16_t x, int16_t y, int16_t w, int16_t h);
+  void setVisible(bool visible);
+  int16_t x() const { return x_; }
+  int16_t y() const { return y_; }
+  int16_t width() const { return w_; }
+  int16_t height() const { return h_; }
+  bool visible() const { return visible_; }
+
+ protected:
+  ESP32S3BoxLiteWidget(int16_t x, int16_t y, int16_t w, int16_t h) : x_(x), y_(y), w_(w), h_(h) {}
+
+  // Paints every pixel of the widget into canvas, whose pixel (0, 0) is
+  // screen point (originX, originY). The canvas clips.
+  virtual void paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const = 0;
+  // Area relative to the widget's top-left
+  void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+  void invalidate() { invalidate(0, 0, w_, h_); }
+  // Invalidates the character cells of a row of 5x7 text at (x, y) that
+  // differ between two strings. Right-aligned text is compared from its end.
+  void invalidateText(int16_t x, int16_t y, uint8_t scale, const char *before, const char *after,
+                      bool alignRight = false);
+
+  int16_t x_, y_, w_, h_;
+  bool visible_ = true;
+
+ private:
+  friend class ESP32S3BoxLiteUi;
+  ESP32S3BoxLiteUi *ui_ = nullptr;
+};
+
+// drawProgressBar() as a widget: a value change repaints only the band
+// between the old and the new fill edge
+class ESP32S3BoxLiteProgressWidget : public ESP32S3BoxLiteWidget {
+ public:
+  ESP32S3BoxLiteProgressWidget(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t fg, uint16_t bg)
+      : ESP32S3BoxLiteWidget(x, y, w, h), fg_(fg), bg_(bg) {}
+
+  void setValue(uint8_t percent);
+  uint8_t value() const { return percent_; }
+  void setColors(uint16_t fg, uint16_t bg);
+
+ protected:
+  void paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const override;
+
+ private:
+  int16_t fillWidth(uint8_t percent) const;
+
+  uint16_t fg_, bg_;
+  uint8_t percent_ = 0;
+};
+
+// drawStatusBar() as a widget: the 16-pixel strip at the top of the screen.
+// Text changes repaint only the character cells that differ.
+class ESP32S3BoxLiteStatusBarWidget : public ESP32S3BoxLiteWidget {
+ public:
+  static constexpr uint8_t MaxChars = 52;  // per side
+
+  explicit ESP32S3BoxLiteStatusBarWidget(uint16_t bg)
+      : ESP32S3BoxLiteWidget(0, 0, ESP32S3BoxLiteDisplay::Width, 16), bg_(bg) {}
+
+  void setLeft(const char *text);
+  void setRight(const char *text);
+  void setColor(uint16_t bg);
+
+ protected:
+  void paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const override;
+
+ private:
+  uint16_t bg_;
+  char left_[MaxChars + 1] = {};
+  char right_[MaxChars + 1] = {};
+};
+
+// A line of 5x7 text in a box of maxChars cells, like ESP32S3BoxLiteLabel
+class ESP32S3BoxLiteLabelWidget : public ESP32S3BoxLiteWidget {
+ public:
+  static constexpr uint8_t MaxChars = 63;
+
+  ESP32S3BoxLiteLabelWidget(int16_t x, int16_t y, uint8_t maxChars, uint8_t scale, uint16_t fg, uint16_t bg);
+
+  void setText(const char *text);
+  void printf(const char *fmt, ...);
+  const char *text() const { return text_; }
+  void setColors(uint16_t fg, uint16_t bg);
+
+ protected:
+  void paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const override;
+
+ private:
+  uint8_t  maxChars_, scale_;
+  uint16_t fg_, bg_;
+  char     text_[MaxChars + 1] = {};
+};
+
+// showMessage() in a box: white scale-2 text, wrapped at spaces and centred.
+// Starts hidden; show() and hide() repaint only the box.
+class ESP32S3BoxLiteMessageWidget : public ESP32S3BoxLiteWidget {
+ public:
+  static constexpr uint8_t MaxChars = 127;
+
+  ESP32S3BoxLiteMessageWidget(int16_t x, int16_t y, int16_t w, int16_t h)
+      : ESP32S3BoxLiteWidget(x, y, w, h) {
+    visible_ = false;
+  }
+
+  void show(const char *text, uint16_t bg);
+  void hide() { setVisible(false); }
+
+ protected:
+  void paint(ESP32S3BoxLiteSprite &canvas, int16_t originX, int16_t originY) const override;
+
+ private:
+  uint16_t bg_ = 0;
+  char text_[MaxChars + 1] = {};
+};
+
+// Widgets stacked in the order added, the last one on top, over a plain
+// background. Invalid areas are kept as merged rectangles; render() paints
+// each one in bands through a 320x16 canvas, starting from the topmost
+// widget that covers the band, and sends every pixel once.
+class ESP32S3BoxLiteUi {
+ public:
+  static constexpr uint8_t MaxWidgets = 16;
+  static constexpr int16_t BandRows   = 16;
+
+  ESP32S3BoxLiteUi() = default;
+  ~ESP32S3BoxLiteUi() { end(); }
+  ESP32S3BoxLiteUi(const ESP32S3BoxLiteUi &) = delete;
+  ESP32S3BoxLiteUi &operator=(const ESP32S3BoxLiteUi &) = delete;
+
+  // Allocates the canvas (10 KB) and invalidates the whole screen
+  bool begin(ESP32S3BoxLiteDisplay &disp, uint16_t background = 0);
+  // Frees the canvas and detaches every widget
+  void end();
+
+  // False when full or the widget already belongs to a Ui
+  bool add(ESP32S3BoxLiteWidget &widget);
+  void remove(ESP32S3BoxLiteWidget &widget);
+  void setBackground(uint16_t color);
+
+  void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+  void invalidateAll() { invalidate(0, 0, ESP32S3BoxLiteDisplay::Width, ESP32S3BoxLiteDisplay::Height); }
+  // Repaints the invalid areas; returns the number of pixels sent
+  uint32_t render();
+
+ private:
+  using DirtyRect = ESP32S3BoxLiteDisplay::DirtyRect;
+  static constexpr uint8_t kMaxDirtyRects = ESP32S3BoxLiteDisplay::kMaxDirtyRects;
+
+  void renderBand(int16_t x0, int16_t y0, int16_t w, int16_t h);
+
+  ESP32S3BoxLiteDisplay *disp_ = nullptr;
+  ESP32S3BoxLiteSprite canvas_;
+  ESP32S3BoxLiteWidget *widgets_[MaxWidgets] = {};
+  uint8_t count_ = 0;
+  uint16_t background_ = 0;
+  DirtyRect dirty_[kMaxDirtyRects] = {};
+  uint8_t dirtyCount_ = 0;
 };
 
 // ---------------------------------------------------------------------------
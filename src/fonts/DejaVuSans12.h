@@ -0,0 +1,377 @@
+// Generated by tools/fontconvert.py from DejaVuSans.ttf at 12 px, 4 bpp. Do not edit.
+#pragma once
+
+#include "../ESP32S3BoxLite.h"
+
+constexpr uint8_t kFontDejaVuSans12Bitmap[] = {
+    0x3F, 0x3F, 0x3F, 0x3F, 0x2F, 0x1E, 0x00, 0x3F, 0x3F, 0xD2, 0x95, 0xD2, 0x95, 0xD2, 0x95, 0x00,
+    0x00, 0xD1, 0x3B, 0x00, 0x00, 0x02, 0xC0, 0x77, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x0A,
+    0x50, 0xE0, 0x00, 0x00, 0x0D, 0x13, 0xB0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x68, 0x0B,
+    0x30, 0x00, 0x00, 0xA4, 0x1D, 0x00, 0x00, 0x00, 0x81, 0x00, 0x3C, 0xFD, 0x60, 0xD7, 0x83, 0x92,
+    0xE2, 0x81, 0x00, 0x7C, 0xB4, 0x00, 0x02, 0xAA, 0xD2, 0x00, 0x81, 0x89, 0xA3, 0x83, 0xB7, 0x4C,
+    0xFE, 0x90, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00, 0x08, 0xEB, 0x10, 0x05, 0x90, 0x02, 0xD1, 0x88,
+    0x01, 0xC1, 0x00, 0x59, 0x04, 0xA0, 0x86, 0x00, 0x03, 0xD1, 0x88, 0x3B, 0x00, 0x00, 0x08, 0xEC,
+    0x1B, 0x37, 0xEC, 0x10, 0x00, 0x06, 0x82, 0xD1, 0x88, 0x00, 0x01, 0xC1, 0x4A, 0x04, 0xB0, 0x00,
+    0x95, 0x02, 0xD1, 0x88, 0x00, 0x3B, 0x00, 0x07, 0xEC, 0x20, 0x00, 0x6E, 0xE7, 0x00, 0x00, 0x2F,
+    0x31, 0x91, 0x00, 0x02, 0xE1, 0x00, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x0A, 0x79, 0xB0, 0x09,
+    0x72, 0xF0, 0x09, 0xB1, 0xD3, 0x3F, 0x10, 0x0A, 0xDA, 0x00, 0xDA, 0x21, 0x7F, 0xB0, 0x02, 0xAE,
+    0xEA, 0x3C, 0x80, 0xD2, 0xD2, 0xD2, 0x07, 0x71, 0xE1, 0x6A, 0x0B, 0x60, 0xD4, 0x0E, 0x30, 0xD4,
+    0x0B, 0x60, 0x6A, 0x01, 0xD1, 0x07, 0x70, 0xC3, 0x05, 0xA0, 0x0E, 0x20, 0xB6, 0x08, 0x90, 0x8A,
+    0x08, 0x90, 0xB6, 0x0E, 0x25, 0xA0, 0xC3, 0x00, 0x00, 0x55, 0x00, 0x67, 0x55, 0x76, 0x06, 0xCC,
+    0x60, 0x06, 0xCC, 0x60, 0x67, 0x55, 0x76, 0x00, 0x55, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x07, 0x80, 0x00, 0x9A, 0xB6, 0xD0, 0x6F, 0xFB, 0xB8, 0xB8, 0x00, 0x2D, 0x00,
+    0x69, 0x00, 0xB4, 0x01, 0xE0, 0x05, 0xA0, 0x0A, 0x60, 0x0E, 0x10, 0x4B, 0x00, 0x87, 0x00, 0xD2,
+    0x00, 0x01, 0xAE, 0xD6, 0x00, 0x9B, 0x14, 0xE4, 0x0E, 0x40, 0x09, 0x92, 0xF1, 0x00, 0x6C, 0x3F,
+    0x00, 0x05, 0xC2, 0xF1, 0x00, 0x6C, 0x0E, 0x40, 0x09, 0x90, 0x9B, 0x14, 0xE4, 0x01, 0xAE, 0xE6,
+    0x00, 0xAF, 0xF9, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+    0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x8F, 0xFF, 0xF8, 0x05, 0xCE, 0xC5, 0x01,
+    0xA3, 0x16, 0xF2, 0x00, 0x00, 0x0D, 0x50, 0x00, 0x01, 0xF3, 0x00, 0x00, 0xB9, 0x00, 0x00, 0xAB,
+    0x00, 0x00, 0xAB, 0x00, 0x00, 0xAB, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0x70, 0x03, 0xBE, 0xD6, 0x00,
+    0x94, 0x14, 0xE4, 0x00, 0x00, 0x0B, 0x60, 0x00, 0x04, 0xE3, 0x00, 0x9F, 0xF7, 0x00, 0x00, 0x03,
+    0xD6, 0x00, 0x00, 0x08, 0x91, 0x92, 0x03, 0xD6, 0x05, 0xCE, 0xD7, 0x00, 0x00, 0x02, 0xEB, 0x00,
+    0x00, 0xBB, 0xB0, 0x00, 0x5A, 0x7B, 0x00, 0x1D, 0x27, 0xB0, 0x09, 0x70, 0x7B, 0x03, 0xC0, 0x07,
+    0xB0, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xB0, 0x00, 0x00, 0x7B, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
+    0xB6, 0x00, 0x00, 0x0B, 0x60, 0x00, 0x00, 0xBE, 0xEC, 0x50, 0x00, 0x01, 0x6F, 0x30, 0x00, 0x00,
+    0xA8, 0x00, 0x00, 0x0A, 0x81, 0x92, 0x16, 0xF3, 0x06, 0xDE, 0xC5, 0x00, 0x00, 0x6D, 0xE9, 0x10,
+    0x4D, 0x41, 0x64, 0x0C, 0x60, 0x00, 0x00, 0xF7, 0xEE, 0x90, 0x2F, 0xB2, 0x2C, 0x81, 0xF5, 0x00,
+    0x6C, 0x0E, 0x50, 0x06, 0xC0, 0x8C, 0x22, 0xC7, 0x00, 0x9E, 0xE8, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
+    0x01, 0xE4, 0x00, 0x06, 0xD0, 0x00, 0x0B, 0x70, 0x00, 0x2F, 0x20, 0x00, 0x7B, 0x00, 0x00, 0xD6,
+    0x00, 0x04, 0xE1, 0x00, 0x09, 0x90, 0x00, 0x02, 0xBE, 0xE8, 0x00, 0xC9, 0x12, 0xD6, 0x0E, 0x40,
+    0x09, 0x80, 0xA9, 0x12, 0xD4, 0x02, 0xDF, 0xF9, 0x00, 0xD7, 0x12, 0xC7, 0x2F, 0x10, 0x06, 0xC0,
+    0xE7, 0x12, 0xC9, 0x04, 0xCE, 0xE9, 0x10, 0x02, 0xBE, 0xD5, 0x00, 0xD8, 0x14, 0xE3, 0x3F, 0x10,
+    0x0A, 0x83, 0xF1, 0x00, 0xAB, 0x0D, 0x81, 0x4E, 0xC0, 0x3C, 0xEC, 0x9A, 0x00, 0x00, 0x0B, 0x70,
+    0x73, 0x17, 0xE1, 0x03, 0xCE, 0xB2, 0x00, 0x9A, 0x9A, 0x00, 0x00, 0x9A, 0x9A, 0x9A, 0x9A, 0x00,
+    0x00, 0x9A, 0xB6, 0xD0, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x38, 0xDB, 0x62, 0x6D, 0xB6, 0x10, 0x00,
+    0x6D, 0xB6, 0x10, 0x00, 0x00, 0x38, 0xDB, 0x61, 0x00, 0x00, 0x03, 0x9A, 0xBF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xA9, 0x40, 0x00, 0x00, 0x16, 0xBD, 0x83, 0x00,
+    0x00, 0x01, 0x6B, 0xD7, 0x00, 0x01, 0x6B, 0xD7, 0x16, 0xBD, 0x93, 0x00, 0xA9, 0x40, 0x00, 0x00,
+    0x06, 0xDE, 0xA0, 0x29, 0x12, 0xD6, 0x00, 0x00, 0xC6, 0x00, 0x09, 0xB0, 0x00, 0x7B, 0x00, 0x00,
+    0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x04, 0xBE, 0xEC, 0x60,
+    0x00, 0x00, 0x8C, 0x52, 0x13, 0xAB, 0x10, 0x05, 0xB1, 0x00, 0x00, 0x08, 0x80, 0x0C, 0x20, 0x8E,
+    0xD8, 0x80, 0xD0, 0x1B, 0x04, 0xC2, 0x2C, 0x80, 0xB2, 0x3A, 0x06, 0x80, 0x07, 0x80, 0xC0, 0x2B,
+    0x04, 0xC2, 0x1C, 0x87, 0x90, 0x0C, 0x20, 0x8E, 0xC8, 0xD8, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8C, 0x41, 0x14, 0xB3, 0x00, 0x00, 0x05, 0xBE, 0xEC, 0x71, 0x00, 0x00, 0x0B, 0xE0,
+    0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x7A, 0x7B, 0x00, 0x00, 0xD5, 0x2F, 0x10, 0x04, 0xE1, 0x0C,
+    0x70, 0x09, 0xA0, 0x07, 0xC0, 0x1E, 0xFF, 0xFF, 0xF3, 0x5E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00,
+    0x5E, 0xCF, 0xFE, 0xB3, 0x0C, 0x50, 0x19, 0xC0, 0xC5, 0x00, 0x3F, 0x0C, 0x50, 0x19, 0xB0, 0xCF,
+    0xFF, 0xE3, 0x0C, 0x50, 0x05, 0xE2, 0xC5, 0x00, 0x0E, 0x5C, 0x50, 0x05, 0xF3, 0xCF, 0xFF, 0xD6,
+    0x00, 0x00, 0x5C, 0xEE, 0xA2, 0x06, 0xE6, 0x11, 0x59, 0x1E, 0x60, 0x00, 0x00, 0x4F, 0x10, 0x00,
+    0x00, 0x5E, 0x00, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0x1E, 0x60, 0x00, 0x00, 0x06, 0xE6, 0x11,
+    0x59, 0x00, 0x5C, 0xEE, 0xA2, 0xCF, 0xFE, 0xC6, 0x00, 0xC5, 0x01, 0x5D, 0xA0, 0xC5, 0x00, 0x03,
+    0xF3, 0xC5, 0x00, 0x00, 0xD7, 0xC5, 0x00, 0x00, 0xB8, 0xC5, 0x00, 0x00, 0xD7, 0xC5, 0x00, 0x03,
+    0xF3, 0xC5, 0x01, 0x5D, 0xA0, 0xCF, 0xFE, 0xC6, 0x00, 0xCF, 0xFF, 0xFB, 0xC5, 0x00, 0x00, 0xC5,
+    0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF, 0xFF, 0xF8, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00,
+    0x00, 0xCF, 0xFF, 0xFC, 0xCF, 0xFF, 0xF3, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00,
+    0xCF, 0xFF, 0xC0, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00,
+    0x5C, 0xEE, 0xB5, 0x00, 0x6E, 0x62, 0x14, 0xA1, 0x1E, 0x60, 0x00, 0x00, 0x04, 0xF1, 0x00, 0x00,
+    0x00, 0x5E, 0x00, 0x0C, 0xFF, 0x54, 0xF1, 0x00, 0x00, 0xD5, 0x1E, 0x60, 0x00, 0x0D, 0x50, 0x6E,
+    0x61, 0x13, 0xE5, 0x00, 0x5C, 0xEE, 0xC6, 0x00, 0xC5, 0x00, 0x05, 0xDC, 0x50, 0x00, 0x5D, 0xC5,
+    0x00, 0x05, 0xDC, 0x50, 0x00, 0x5D, 0xCF, 0xFF, 0xFF, 0xDC, 0x50, 0x00, 0x5D, 0xC5, 0x00, 0x05,
+    0xDC, 0x50, 0x00, 0x5D, 0xC5, 0x00, 0x05, 0xD0, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+    0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00, 0xC5, 0x00,
+    0xC5, 0x00, 0xD5, 0x04, 0xF2, 0x9D, 0x70, 0xC5, 0x00, 0x4E, 0x5C, 0x50, 0x4E, 0x40, 0xC5, 0x5E,
+    0x40, 0x0C, 0xAE, 0x40, 0x00, 0xCE, 0xC0, 0x00, 0x0C, 0x6C, 0xB0, 0x00, 0xC5, 0x1C, 0xA0, 0x0C,
+    0x50, 0x1C, 0xA0, 0xC5, 0x00, 0x1D, 0x90, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00,
+    0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xCF,
+    0xFF, 0xF9, 0xCF, 0x20, 0x00, 0xCF, 0x3C, 0xD8, 0x00, 0x2D, 0xF3, 0xC7, 0xD0, 0x08, 0x7F, 0x3C,
+    0x5B, 0x40, 0xD2, 0xF3, 0xC5, 0x6A, 0x4B, 0x0F, 0x3C, 0x51, 0xEB, 0x50, 0xF3, 0xC5, 0x09, 0xE0,
+    0x0F, 0x3C, 0x50, 0x00, 0x00, 0xF3, 0xC5, 0x00, 0x00, 0x0F, 0x30, 0xCE, 0x10, 0x05, 0xCC, 0xE8,
+    0x00, 0x5C, 0xC7, 0xE1, 0x05, 0xCC, 0x59, 0x90, 0x5C, 0xC5, 0x2E, 0x25, 0xCC, 0x50, 0x99, 0x5C,
+    0xC5, 0x02, 0xE7, 0xCC, 0x50, 0x09, 0xEC, 0xC5, 0x00, 0x1E, 0xC0, 0x00, 0x5C, 0xFE, 0x91, 0x00,
+    0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00, 0x9A, 0x5E, 0x00, 0x00,
+    0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E, 0x51, 0x2B, 0xC0, 0x00,
+    0x6C, 0xFE, 0x91, 0x00, 0xCF, 0xFE, 0xA1, 0xC5, 0x02, 0xC9, 0xC5, 0x00, 0x7C, 0xC5, 0x02, 0xC9,
+    0xCF, 0xFE, 0xA1, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00,
+    0x5C, 0xFE, 0x91, 0x00, 0x6E, 0x51, 0x2B, 0xC0, 0x1E, 0x60, 0x00, 0x1E, 0x64, 0xF1, 0x00, 0x00,
+    0x9A, 0x5E, 0x00, 0x00, 0x08, 0xB4, 0xF1, 0x00, 0x00, 0x9A, 0x1E, 0x60, 0x00, 0x1E, 0x60, 0x6E,
+    0x51, 0x2B, 0xC0, 0x00, 0x5C, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, 0xC9,
+    0x00, 0xCF, 0xFE, 0xA1, 0x0C, 0x50, 0x2C, 0x90, 0xC5, 0x00, 0x7C, 0x0C, 0x50, 0x2C, 0x90, 0xCF,
+    0xFF, 0xB1, 0x0C, 0x50, 0x3E, 0x40, 0xC5, 0x00, 0x7C, 0x0C, 0x50, 0x01, 0xE5, 0xC5, 0x00, 0x08,
+    0xC0, 0x03, 0xBE, 0xD8, 0x10, 0xE7, 0x12, 0x76, 0x2F, 0x00, 0x00, 0x01, 0xE8, 0x20, 0x00, 0x02,
+    0xAE, 0xE9, 0x10, 0x00, 0x02, 0xBA, 0x00, 0x00, 0x05, 0xE2, 0xA3, 0x12, 0xBB, 0x05, 0xCE, 0xEA,
+    0x10, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40,
+    0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40,
+    0x00, 0x00, 0x0E, 0x40, 0x00, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE,
+    0x40, 0x00, 0x7B, 0xE4, 0x00, 0x07, 0xBE, 0x40, 0x00, 0x7B, 0xC6, 0x00, 0x09, 0x97, 0xD3, 0x14,
+    0xE4, 0x07, 0xDE, 0xC5, 0x00, 0xB8, 0x00, 0x00, 0x5E, 0x5D, 0x00, 0x00, 0xA8, 0x1E, 0x40, 0x01,
+    0xF3, 0x09, 0x90, 0x06, 0xC0, 0x04, 0xE1, 0x0C, 0x70, 0x00, 0xD5, 0x2F, 0x10, 0x00, 0x7B, 0x7B,
+    0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x7B, 0x00, 0x0D, 0xB0, 0x00, 0xD5, 0x3E,
+    0x00, 0x1D, 0xE0, 0x01, 0xF2, 0x0E, 0x30, 0x59, 0xB3, 0x05, 0xD0, 0x0B, 0x70, 0x96, 0x87, 0x09,
+    0x90, 0x08, 0xA0, 0xC2, 0x4A, 0x0C, 0x60, 0x04, 0xE1, 0xE0, 0x1E, 0x1F, 0x20, 0x01, 0xF7, 0xA0,
+    0x0C, 0x7D, 0x00, 0x00, 0xCE, 0x60, 0x09, 0xEA, 0x00, 0x00, 0x8F, 0x30, 0x05, 0xF6, 0x00, 0x1D,
+    0x50, 0x01, 0xD5, 0x04, 0xE1, 0x09, 0xA0, 0x00, 0xAA, 0x4E, 0x10, 0x00, 0x1E, 0xE5, 0x00, 0x00,
+    0x0A, 0xE1, 0x00, 0x00, 0x5E, 0xB9, 0x00, 0x01, 0xE5, 0x1E, 0x40, 0x0A, 0xA0, 0x06, 0xD0, 0x5E,
+    0x10, 0x00, 0xB8, 0xB9, 0x00, 0x04, 0xE1, 0x2E, 0x40, 0x1D, 0x60, 0x06, 0xD0, 0x8B, 0x00, 0x00,
+    0xBA, 0xE2, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00,
+    0x0E, 0x40, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x5F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0xE2, 0x00,
+    0x00, 0x2E, 0x50, 0x00, 0x01, 0xD8, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x7D, 0x10, 0x00, 0x04,
+    0xE3, 0x00, 0x00, 0x2E, 0x60, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0x8F, 0x20, 0xF2, 0x0F,
+    0x20, 0xF2, 0x0F, 0x20, 0xF2, 0x0F, 0x20, 0xF2, 0x0F, 0x20, 0xFF, 0x80, 0xD2, 0x00, 0x87, 0x00,
+    0x4B, 0x00, 0x0E, 0x10, 0x0A, 0x60, 0x05, 0xA0, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x69, 0x00, 0x2D,
+    0xCF, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0xCF,
+    0xA0, 0x00, 0x3D, 0xE3, 0x00, 0x03, 0xD5, 0x4D, 0x40, 0x4C, 0x30, 0x02, 0xC4, 0x2F, 0xFF, 0xFF,
+    0xF2, 0x88, 0x00, 0x96, 0x0C, 0xFF, 0xC3, 0x00, 0x00, 0x16, 0xD0, 0x00, 0x00, 0x0D, 0x20, 0x6D,
+    0xFF, 0xF4, 0x2E, 0x30, 0x0D, 0x43, 0xE2, 0x17, 0xF4, 0x08, 0xEE, 0x9C, 0x40, 0xE3, 0x00, 0x00,
+    0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE7, 0xDE, 0x90, 0xEC, 0x22, 0xC7, 0xE5, 0x00, 0x5D, 0xE3,
+    0x00, 0x3E, 0xE5, 0x00, 0x5D, 0xEC, 0x22, 0xC7, 0xE7, 0xDE, 0x90, 0x02, 0xAE, 0xD4, 0x0C, 0x91,
+    0x28, 0x3E, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0C, 0x91, 0x28, 0x02, 0xAE, 0xD4,
+    0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x88, 0x00, 0x00, 0x08, 0x80, 0x2C, 0xEB, 0xA8, 0x0D, 0x81,
+    0x5F, 0x83, 0xE0, 0x00, 0xB8, 0x5C, 0x00, 0x09, 0x83, 0xE0, 0x00, 0xB8, 0x0D, 0x81, 0x5F, 0x80,
+    0x3C, 0xEB, 0xA8, 0x01, 0xAE, 0xD7, 0x00, 0xC9, 0x12, 0xD4, 0x3E, 0x00, 0x06, 0x95, 0xFF, 0xFF,
+    0xFB, 0x3D, 0x00, 0x00, 0x00, 0xC8, 0x11, 0x66, 0x01, 0xAE, 0xE9, 0x10, 0x02, 0xCF, 0x70, 0x89,
+    0x00, 0x0A, 0x60, 0x0B, 0xFF, 0xF3, 0x0A, 0x60, 0x00, 0xA6, 0x00, 0x0A, 0x60, 0x00, 0xA6, 0x00,
+    0x0A, 0x60, 0x00, 0xA6, 0x00, 0x03, 0xCE, 0xBA, 0x80, 0xD7, 0x15, 0xF8, 0x3E, 0x00, 0x0A, 0x85,
+    0xC0, 0x00, 0x98, 0x3E, 0x00, 0x0A, 0x80, 0xD7, 0x15, 0xF8, 0x03, 0xCE, 0xBA, 0x80, 0x00, 0x00,
+    0xB6, 0x06, 0x41, 0x6E, 0x20, 0x2B, 0xEC, 0x40, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE3, 0x00,
+    0x00, 0xE7, 0xDE, 0xA0, 0xEB, 0x22, 0xD6, 0xE4, 0x00, 0x88, 0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79,
+    0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79, 0xD3, 0x00, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x00,
+    0xD3, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+    0xD3, 0x00, 0xD3, 0x02, 0xE1, 0x3E, 0x80, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00,
+    0xE3, 0x03, 0xD4, 0xE3, 0x4D, 0x30, 0xE7, 0xD3, 0x00, 0xEE, 0x90, 0x00, 0xE4, 0xD7, 0x00, 0xE3,
+    0x1D, 0x70, 0xE3, 0x02, 0xD7, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xE8,
+    0xDE, 0x93, 0xCE, 0xB1, 0xEB, 0x12, 0xED, 0x31, 0xB7, 0xE4, 0x00, 0xA7, 0x00, 0x7A, 0xE3, 0x00,
+    0xA6, 0x00, 0x6A, 0xE3, 0x00, 0xA6, 0x00, 0x6A, 0xE3, 0x00, 0xA6, 0x00, 0x6A, 0xE3, 0x00, 0xA6,
+    0x00, 0x6A, 0xE7, 0xDE, 0xA0, 0xEB, 0x22, 0xD6, 0xE4, 0x00, 0x88, 0xE3, 0x00, 0x79, 0xE3, 0x00,
+    0x79, 0xE3, 0x00, 0x79, 0xE3, 0x00, 0x79, 0x02, 0xBE, 0xD5, 0x00, 0xD8, 0x14, 0xE3, 0x3E, 0x00,
+    0x09, 0x85, 0xC0, 0x00, 0x7A, 0x3E, 0x00, 0x09, 0x80, 0xD8, 0x14, 0xE3, 0x02, 0xBE, 0xD5, 0x00,
+    0xE7, 0xDE, 0x90, 0xEC, 0x22, 0xC7, 0xE5, 0x00, 0x5D, 0xE3, 0x00, 0x3E, 0xE5, 0x00, 0x5D, 0xEC,
+    0x22, 0xC7, 0xE7, 0xDE, 0x90, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x02, 0xCE,
+    0xBA, 0x80, 0xD8, 0x15, 0xF8, 0x3E, 0x00, 0x0B, 0x85, 0xC0, 0x00, 0x98, 0x3E, 0x00, 0x0B, 0x80,
+    0xD8, 0x15, 0xF8, 0x03, 0xCE, 0xBA, 0x80, 0x00, 0x00, 0x88, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+    0x88, 0xE7, 0xCE, 0xEC, 0x20, 0xE4, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0xE3, 0x00, 0x08,
+    0xEE, 0x91, 0x3E, 0x21, 0x64, 0x3D, 0x10, 0x00, 0x06, 0xBC, 0x71, 0x00, 0x01, 0xA8, 0x57, 0x21,
+    0xA9, 0x18, 0xDE, 0xA1, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0xAF, 0xFF, 0x60, 0xD3, 0x00, 0x0D, 0x30,
+    0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xC6, 0x00, 0x05, 0xDF, 0x60, 0xF1, 0x00, 0x88, 0xF1, 0x00,
+    0x88, 0xF1, 0x00, 0x88, 0xF1, 0x00, 0x88, 0xE2, 0x00, 0xA8, 0xC8, 0x14, 0xE8, 0x3C, 0xEA, 0xA8,
+    0x7A, 0x00, 0x09, 0x92, 0xE1, 0x00, 0xE3, 0x0C, 0x60, 0x4D, 0x00, 0x6B, 0x09, 0x80, 0x01, 0xF2,
+    0xE2, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x6B, 0x00, 0xDA, 0x00, 0xD3, 0x2E, 0x01,
+    0xDD, 0x02, 0xE0, 0x0D, 0x35, 0x9C, 0x26, 0xA0, 0x0A, 0x79, 0x58, 0x69, 0x70, 0x06, 0xAC, 0x24,
+    0xAD, 0x30, 0x02, 0xED, 0x01, 0xEE, 0x00, 0x00, 0xE9, 0x00, 0xCB, 0x00, 0x2E, 0x30, 0x1E, 0x40,
+    0x6D, 0x1B, 0x80, 0x00, 0xAC, 0xC0, 0x00, 0x05, 0xF6, 0x00, 0x01, 0xD9, 0xD1, 0x00, 0x9A, 0x09,
+    0xA0, 0x5D, 0x10, 0x1D, 0x50, 0x7A, 0x00, 0x09, 0x81, 0xE1, 0x00, 0xE3, 0x0A, 0x70, 0x5D, 0x00,
+    0x5C, 0x0B, 0x70, 0x00, 0xE4, 0xF2, 0x00, 0x08, 0xEB, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x03, 0xE1,
+    0x00, 0x00, 0x99, 0x00, 0x01, 0xFD, 0x20, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0xC6, 0x00, 0x0A,
+    0x90, 0x00, 0x7B, 0x00, 0x04, 0xD1, 0x00, 0x2E, 0x30, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3C, 0xF2,
+    0x00, 0x99, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x02, 0xD4, 0x00, 0x8F, 0xB0, 0x00, 0x02,
+    0xD4, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x99, 0x00, 0x00, 0x3D, 0xF2, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7E, 0xA0, 0x00, 0x01, 0xD3, 0x00,
+    0x00, 0xC5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x3E, 0xF2, 0x00, 0xA9, 0x10, 0x00,
+    0xB5, 0x00, 0x00, 0xC5, 0x00, 0x01, 0xD3, 0x00, 0x7E, 0xA0, 0x00, 0x3B, 0xEB, 0x51, 0x39, 0x73,
+    0x15, 0xBE, 0xC3,
+};
+
+constexpr ESP32S3BoxLiteGlyph kFontDejaVuSans12Glyphs[] = {
+    {    0,   0,   0,   4,   0,   0},  // ' '
+    {    0,   2,   9,   5,   1,   3},  // !
+    {    9,   4,   3,   6,   1,   3},  // "
+    {   15,  10,   8,  10,   0,   4},  // #
+    {   55,   6,  11,   8,   1,   3},  // $
+    {   88,  11,   9,  11,   0,   3},  // %
+    {  138,   9,   9,   9,   0,   3},  // &
+    {  179,   2,   3,   3,   1,   3},  // '
+    {  182,   3,  11,   5,   1,   2},  // (
+    {  199,   3,  11,   5,   1,   2},  // )
+    {  216,   6,   6,   6,   0,   3},  // *
+    {  234,   8,   7,  10,   1,   5},  // +
+    {  262,   2,   3,   4,   1,  10},  // ,
+    {  265,   4,   1,   4,   0,   8},  // -
+    {  267,   2,   2,   4,   1,  10},  // .
+    {  269,   4,  10,   4,   0,   3},  // /
+    {  289,   7,   9,   8,   0,   3},  // 0
+    {  321,   6,   9,   8,   1,   3},  // 1
+    {  348,   7,   9,   8,   0,   3},  // 2
+    {  380,   7,   9,   8,   0,   3},  // 3
+    {  412,   7,   9,   8,   0,   3},  // 4
+    {  444,   7,   9,   8,   0,   3},  // 5
+    {  476,   7,   9,   8,   0,   3},  // 6
+    {  508,   6,   9,   8,   1,   3},  // 7
+    {  535,   7,   9,   8,   0,   3},  // 8
+    {  567,   7,   9,   8,   0,   3},  // 9
+    {  599,   2,   6,   4,   1,   6},  // :
+    {  605,   2,   7,   4,   1,   6},  // ;
+    {  612,   8,   6,  10,   1,   5},  // <
+    {  636,   8,   3,  10,   1,   7},  // =
+    {  648,   8,   6,  10,   1,   5},  // >
+    {  672,   6,   9,   6,   0,   3},  // ?
+    {  699,  12,  11,  12,   0,   4},  // @
+    {  765,   8,   9,   8,   0,   3},  // A
+    {  801,   7,   9,   8,   1,   3},  // B
+    {  833,   8,   9,   8,   0,   3},  // C
+    {  869,   8,   9,   9,   1,   3},  // D
+    {  905,   6,   9,   8,   1,   3},  // E
+    {  932,   6,   9,   7,   1,   3},  // F
+    {  959,   9,   9,   9,   0,   3},  // G
+    { 1000,   7,   9,   9,   1,   3},  // H
+    { 1032,   2,   9,   4,   1,   3},  // I
+    { 1041,   4,  11,   4,  -1,   3},  // J
+    { 1063,   7,   9,   8,   1,   3},  // K
+    { 1095,   6,   9,   7,   1,   3},  // L
+    { 1122,   9,   9,  10,   1,   3},  // M
+    { 1163,   7,   9,   9,   1,   3},  // N
+    { 1195,   9,   9,   9,   0,   3},  // O
+    { 1236,   6,   9,   7,   1,   3},  // P
+    { 1263,   9,  11,   9,   0,   3},  // Q
+    { 1313,   7,   9,   8,   1,   3},  // R
+    { 1345,   7,   9,   8,   0,   3},  // S
+    { 1377,   8,   9,   7,   0,   3},  // T
+    { 1413,   7,   9,   9,   1,   3},  // U
+    { 1445,   8,   9,   8,   0,   3},  // V
+    { 1481,  12,   9,  12,   0,   3},  // W
+    { 1535,   8,   9,   8,   0,   3},  // X
+    { 1571,   8,   9,   7,   0,   3},  // Y
+    { 1607,   8,   9,   8,   0,   3},  // Z
+    { 1643,   3,  11,   5,   1,   3},  // [
+    { 1660,   4,  10,   4,   0,   3},  // backslash
+    { 1680,   3,  11,   5,   1,   3},  // ]
+    { 1697,   8,   3,  10,   1,   3},  // ^
+    { 1709,   8,   1,   6,  -1,  14},  // _
+    { 1713,   3,   2,   6,   1,   2},  // `
+    { 1716,   7,   7,   7,   0,   5},  // a
+    { 1741,   6,  10,   8,   1,   2},  // b
+    { 1771,   6,   7,   7,   0,   5},  // c
+    { 1792,   7,  10,   8,   0,   2},  // d
+    { 1827,   7,   7,   7,   0,   5},  // e
+    { 1852,   5,  10,   4,   0,   2},  // f
+    { 1877,   7,  10,   8,   0,   5},  // g
+    { 1912,   6,  10,   8,   1,   2},  // h
+    { 1942,   2,   9,   3,   1,   3},  // i
+    { 1951,   4,  12,   3,  -1,   3},  // j
+    { 1975,   6,  10,   7,   1,   2},  // k
+    { 2005,   2,  10,   3,   1,   2},  // l
+    { 2015,  10,   7,  12,   1,   5},  // m
+    { 2050,   6,   7,   8,   1,   5},  // n
+    { 2071,   7,   7,   7,   0,   5},  // o
+    { 2096,   6,  10,   8,   1,   5},  // p
+    { 2126,   7,  10,   8,   0,   5},  // q
+    { 2161,   4,   7,   5,   1,   5},  // r
+    { 2175,   6,   7,   6,   0,   5},  // s
+    { 2196,   5,   9,   5,   0,   3},  // t
+    { 2219,   6,   7,   8,   1,   5},  // u
+    { 2240,   7,   7,   7,   0,   5},  // v
+    { 2265,  10,   7,  10,   0,   5},  // w
+    { 2300,   7,   7,   7,   0,   5},  // x
+    { 2325,   7,  10,   7,   0,   5},  // y
+    { 2360,   6,   7,   6,   0,   5},  // z
+    { 2381,   6,  11,   8,   1,   3},  // {
+    { 2414,   2,  12,   4,   1,   3},  // |
+    { 2426,   6,  11,   8,   1,   3},  // }
+    { 2459,   8,   2,  10,   1,   7},  // ~
+};
+
+constexpr ESP32S3BoxLiteKernPair kFontDejaVuSans12Kerning[] = {
+    {0x2D, 0x4A, 1},
+    {0x2D, 0x54, -1},
+    {0x2D, 0x56, -1},
+    {0x2D, 0x58, -1},
+    {0x2D, 0x59, -1},
+    {0x41, 0x54, -1},
+    {0x41, 0x56, -1},
+    {0x41, 0x57, -1},
+    {0x41, 0x59, -1},
+    {0x41, 0x76, -1},
+    {0x41, 0x79, -1},
+    {0x42, 0x59, -1},
+    {0x44, 0x59, -1},
+    {0x46, 0x2E, -2},
+    {0x46, 0x3A, -1},
+    {0x46, 0x41, -1},
+    {0x46, 0x61, -1},
+    {0x46, 0x65, -1},
+    {0x46, 0x69, -1},
+    {0x46, 0x72, -1},
+    {0x46, 0x75, -1},
+    {0x46, 0x79, -1},
+    {0x47, 0x59, -1},
+    {0x4B, 0x2D, -1},
+    {0x4B, 0x43, -1},
+    {0x4B, 0x4F, -1},
+    {0x4B, 0x54, -1},
+    {0x4B, 0x65, -1},
+    {0x4B, 0x6F, -1},
+    {0x4B, 0x75, -1},
+    {0x4B, 0x79, -1},
+    {0x4C, 0x54, -2},
+    {0x4C, 0x55, -1},
+    {0x4C, 0x56, -1},
+    {0x4C, 0x57, -1},
+    {0x4C, 0x59, -2},
+    {0x4C, 0x79, -1},
+    {0x4F, 0x58, -1},
+    {0x4F, 0x59, -1},
+    {0x50, 0x2E, -2},
+    {0x50, 0x41, -1},
+    {0x50, 0x61, -1},
+    {0x52, 0x43, -1},
+    {0x52, 0x54, -1},
+    {0x52, 0x56, -1},
+    {0x52, 0x59, -1},
+    {0x52, 0x65, -1},
+    {0x52, 0x6F, -1},
+    {0x52, 0x75, -1},
+    {0x52, 0x79, -1},
+    {0x54, 0x2D, -1},
+    {0x54, 0x2E, -1},
+    {0x54, 0x3A, -1},
+    {0x54, 0x41, -1},
+    {0x54, 0x43, -1},
+    {0x54, 0x61, -2},
+    {0x54, 0x63, -2},
+    {0x54, 0x65, -2},
+    {0x54, 0x6F, -2},
+    {0x54, 0x72, -2},
+    {0x54, 0x73, -2},
+    {0x54, 0x75, -2},
+    {0x54, 0x77, -2},
+    {0x54, 0x79, -2},
+    {0x56, 0x2D, -1},
+    {0x56, 0x2E, -2},
+    {0x56, 0x3A, -1},
+    {0x56, 0x41, -1},
+    {0x56, 0x61, -1},
+    {0x56, 0x65, -1},
+    {0x56, 0x6F, -1},
+    {0x56, 0x75, -1},
+    {0x57, 0x2E, -1},
+    {0x57, 0x3A, -1},
+    {0x57, 0x41, -1},
+    {0x57, 0x61, -1},
+    {0x57, 0x65, -1},
+    {0x57, 0x6F, -1},
+    {0x57, 0x72, -1},
+    {0x58, 0x2D, -1},
+    {0x58, 0x43, -1},
+    {0x58, 0x4F, -1},
+    {0x58, 0x65, -1},
+    {0x59, 0x2D, -1},
+    {0x59, 0x2E, -2},
+    {0x59, 0x3A, -2},
+    {0x59, 0x41, -1},
+    {0x59, 0x43, -1},
+    {0x59, 0x4F, -1},
+    {0x59, 0x61, -2},
+    {0x59, 0x65, -2},
+    {0x59, 0x6F, -2},
+    {0x59, 0x75, -1},
+    {0x66, 0x2D, -1},
+    {0x66, 0x2E, -1},
+    {0x72, 0x2D, -1},
+    {0x72, 0x2E, -1},
+    {0x76, 0x2E, -1},
+    {0x76, 0x3A, -1},
+    {0x77, 0x2E, -1},
+    {0x77, 0x3A, -1},
+    {0x79, 0x2E, -2},
+    {0x79, 0x3A, -1},
+};
+
+constexpr ESP32S3BoxLiteFont FontDejaVuSans12 = {
+    kFontDejaVuSans12Bitmap,
+    kFontDejaVuSans12Glyphs,
+    kFontDejaVuSans12Kerning,
+    103,  // kerning pairs
+    0x20, 0x7E,  // first, last
+    4,  // bpp
+    15,  // line height
+    12,  // baseline
+};
@@ -0,0 +1,513 @@
+// Generated by tools/fontconvert.py from DejaVuSans.ttf at 16 px, 4 bpp. Do not edit.
+#pragma once
+
+#include "../ESP32S3BoxLite.h"
+
+constexpr uint8_t kFontDejaVuSans16Bitmap[] = {
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x8F, 0x8E, 0x7D, 0x00, 0x00, 0x9F, 0x9F, 0x7D, 0x08, 0xC7, 0xD0,
+    0x8C, 0x7D, 0x08, 0xC7, 0xD0, 0x8C, 0x00, 0x00, 0x6D, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xA9, 0x02,
+    0xF2, 0x00, 0x00, 0x00, 0xE5, 0x06, 0xD0, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x07,
+    0xC0, 0x0E, 0x50, 0x00, 0x00, 0x0A, 0x90, 0x2F, 0x20, 0x00, 0x00, 0x0E, 0x50, 0x5E, 0x00, 0x00,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0xD5, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xF1,
+    0x00, 0x00, 0x00, 0xE4, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x06, 0x60, 0x00,
+    0x05, 0xCE, 0xFC, 0x50, 0x4F, 0x66, 0x74, 0xA2, 0x9C, 0x06, 0x60, 0x00, 0x8E, 0x26, 0x60, 0x00,
+    0x1D, 0xED, 0xA4, 0x00, 0x00, 0x5A, 0xEF, 0xD2, 0x00, 0x06, 0x62, 0xDB, 0x00, 0x06, 0x60, 0xAC,
+    0x87, 0x26, 0x75, 0xE7, 0x28, 0xCF, 0xEC, 0x60, 0x00, 0x06, 0x60, 0x00, 0x00, 0x06, 0x60, 0x00,
+    0x02, 0xBE, 0xC3, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xC9, 0x17, 0xD1, 0x00, 0x4E, 0x10, 0x00, 0x1F,
+    0x30, 0x1F, 0x30, 0x0D, 0x50, 0x00, 0x01, 0xF3, 0x01, 0xF3, 0x08, 0xB0, 0x00, 0x00, 0x0C, 0x91,
+    0x7E, 0x12, 0xE2, 0x00, 0x00, 0x00, 0x2B, 0xEC, 0x30, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5D, 0x12, 0xBE, 0xC4, 0x00, 0x00, 0x00, 0x1D, 0x50, 0xBA, 0x17, 0xE1, 0x00, 0x00, 0x08, 0xB0,
+    0x0F, 0x40, 0x0F, 0x40, 0x00, 0x03, 0xE2, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0xB7, 0x00, 0x0B,
+    0xA1, 0x7E, 0x10, 0x00, 0x6D, 0x00, 0x00, 0x2B, 0xEC, 0x40, 0x00, 0x5C, 0xEC, 0x50, 0x00, 0x00,
+    0x4F, 0x71, 0x3A, 0x20, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x00,
+    0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x5F, 0x69, 0xF7, 0x00, 0x2F,
+    0x5C, 0xB0, 0x08, 0xF7, 0x05, 0xF1, 0xE8, 0x00, 0x08, 0xF7, 0xCA, 0x0C, 0xC0, 0x00, 0x08, 0xFE,
+    0x20, 0x4F, 0xA2, 0x13, 0xAF, 0xF7, 0x00, 0x3A, 0xEF, 0xD9, 0x27, 0xF7, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x00, 0x9B, 0x02, 0xF3, 0x09, 0xC0, 0x1E, 0x60, 0x4F, 0x30, 0x7F, 0x00, 0x9E, 0x00, 0x9E, 0x00,
+    0x7F, 0x00, 0x4F, 0x30, 0x1E, 0x70, 0x09, 0xC0, 0x02, 0xF3, 0x00, 0x9B, 0x7C, 0x00, 0x1E, 0x60,
+    0x08, 0xD0, 0x03, 0xF4, 0x00, 0xE8, 0x00, 0xCB, 0x00, 0xAC, 0x00, 0xAC, 0x00, 0xCB, 0x00, 0xE8,
+    0x03, 0xF4, 0x08, 0xD0, 0x1E, 0x60, 0x7C, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x07, 0x70, 0x00,
+    0x4A, 0x37, 0x73, 0xA4, 0x02, 0x9D, 0xD9, 0x20, 0x02, 0x9D, 0xD9, 0x20, 0x4A, 0x37, 0x73, 0xA4,
+    0x00, 0x07, 0x70, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xE5, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x2F, 0x83, 0xF7, 0x6E, 0x1A, 0x70,
+    0x3F, 0xFF, 0xF0, 0x4F, 0x54, 0xF5, 0x00, 0x01, 0xF3, 0x00, 0x06, 0xE0, 0x00, 0x0B, 0x90, 0x00,
+    0x1F, 0x40, 0x00, 0x5E, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xE5, 0x00, 0x04, 0xF1, 0x00, 0x09, 0xB0,
+    0x00, 0x0E, 0x60, 0x00, 0x3F, 0x20, 0x00, 0x8C, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x01, 0xAE, 0xEB,
+    0x30, 0x00, 0xCC, 0x21, 0xAE, 0x10, 0x6F, 0x20, 0x01, 0xE8, 0x0A, 0xD0, 0x00, 0x0A, 0xD0, 0xDB,
+    0x00, 0x00, 0x8F, 0x1E, 0xA0, 0x00, 0x07, 0xF1, 0xEA, 0x00, 0x00, 0x7F, 0x1D, 0xB0, 0x00, 0x08,
+    0xF1, 0xAD, 0x00, 0x00, 0xAD, 0x06, 0xF2, 0x00, 0x1E, 0x80, 0x0C, 0xC2, 0x1A, 0xE2, 0x00, 0x1A,
+    0xEE, 0xB3, 0x00, 0x04, 0x9E, 0xF2, 0x00, 0x3B, 0x67, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00,
+    0x07, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00,
+    0x07, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFB, 0x28, 0xCE, 0xD9, 0x10, 0xBD, 0x41, 0x3C, 0xD1, 0x71, 0x00, 0x04, 0xF6, 0x00,
+    0x00, 0x02, 0xF7, 0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x1D, 0xD1, 0x00, 0x00, 0xBF, 0x40, 0x00,
+    0x0A, 0xF5, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0xCF,
+    0xFF, 0xFF, 0xF9, 0x16, 0xCE, 0xEB, 0x30, 0x68, 0x31, 0x2A, 0xF3, 0x00, 0x00, 0x01, 0xF9, 0x00,
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x2A, 0xE2, 0x00, 0xCF, 0xFE, 0x30, 0x00, 0x00, 0x2A, 0xE4, 0x00,
+    0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xDB, 0x95, 0x21, 0x3A, 0xF3, 0x29,
+    0xDF, 0xDA, 0x20, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x5E, 0xF9, 0x00, 0x00, 0x01, 0xE6,
+    0xE9, 0x00, 0x00, 0x0A, 0xC0, 0xE9, 0x00, 0x00, 0x4F, 0x30, 0xE9, 0x00, 0x01, 0xD9, 0x00, 0xE9,
+    0x00, 0x09, 0xE1, 0x00, 0xE9, 0x00, 0x2F, 0x50, 0x00, 0xE9, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x4F,
+    0xFF, 0xFF, 0xE0, 0x4F, 0x30, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x4F,
+    0xEF, 0xE9, 0x20, 0x48, 0x21, 0x4D, 0xD1, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xDB, 0x00,
+    0x00, 0x00, 0xDB, 0x00, 0x00, 0x03, 0xF8, 0x95, 0x21, 0x4D, 0xD1, 0x29, 0xDF, 0xD9, 0x20, 0x00,
+    0x4B, 0xED, 0x81, 0x00, 0x6E, 0x51, 0x17, 0x60, 0x2F, 0x50, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00,
+    0x00, 0xBC, 0x7D, 0xFD, 0x60, 0x0D, 0xFD, 0x31, 0x7F, 0x70, 0xDF, 0x40, 0x00, 0xBE, 0x0C, 0xF1,
+    0x00, 0x07, 0xF2, 0x9F, 0x10, 0x00, 0x7F, 0x24, 0xF4, 0x00, 0x0A, 0xE0, 0x0B, 0xD3, 0x16, 0xF6,
+    0x00, 0x19, 0xEF, 0xC6, 0x00, 0xAF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x09,
+    0xF2, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 0xBE, 0x10, 0x00, 0x01, 0xFA,
+    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x8F, 0x20,
+    0x00, 0x00, 0xDB, 0x00, 0x00, 0x04, 0xBE, 0xEC, 0x50, 0x03, 0xF9, 0x11, 0x7F, 0x60, 0x8F, 0x10,
+    0x00, 0xDB, 0x08, 0xF1, 0x00, 0x0D, 0xB0, 0x2E, 0x91, 0x17, 0xE4, 0x00, 0x3D, 0xFF, 0xE5, 0x00,
+    0x3E, 0x92, 0x17, 0xF6, 0x0B, 0xD0, 0x00, 0x0A, 0xE0, 0xDB, 0x00, 0x00, 0x8F, 0x1C, 0xD0, 0x00,
+    0x0A, 0xE0, 0x5F, 0x91, 0x17, 0xF8, 0x00, 0x4B, 0xEE, 0xC6, 0x00, 0x04, 0xBE, 0xEA, 0x20, 0x04,
+    0xF9, 0x12, 0xBD, 0x10, 0xBD, 0x00, 0x02, 0xF7, 0x0E, 0xA0, 0x00, 0x0D, 0xC0, 0xEA, 0x00, 0x00,
+    0xDE, 0x0B, 0xD0, 0x00, 0x2F, 0xF1, 0x4F, 0x91, 0x2B, 0xFF, 0x00, 0x5C, 0xFE, 0x89, 0xE0, 0x00,
+    0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x38, 0x20, 0x4D, 0x90, 0x00, 0x7D, 0xFC, 0x60,
+    0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x83, 0xF7, 0x6E, 0x1A, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x90, 0x00, 0x00, 0x16, 0xCF, 0xE7, 0x00, 0x04, 0x9E, 0xFB, 0x50, 0x01, 0x7D, 0xFC, 0x71,
+    0x00, 0x00, 0x4F, 0xE6, 0x00, 0x00, 0x00, 0x01, 0x7D, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x04, 0xAE,
+    0xFA, 0x50, 0x00, 0x00, 0x00, 0x16, 0xCF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x28, 0x90, 0x4F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x4A, 0x50, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xE8, 0x30, 0x00, 0x00, 0x00,
+    0x38, 0xEF, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xB0,
+    0x00, 0x00, 0x4A, 0xEF, 0xA4, 0x00, 0x28, 0xDF, 0xC6, 0x10, 0x02, 0xCF, 0xE8, 0x30, 0x00, 0x00,
+    0x4B, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xDE, 0xB3, 0x0A, 0x51, 0x2B, 0xE1, 0x00, 0x00, 0x4F,
+    0x50, 0x00, 0x08, 0xF3, 0x00, 0x05, 0xF9, 0x00, 0x03, 0xFA, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0D,
+    0x90, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x0E, 0xA0, 0x00,
+    0x00, 0x01, 0x7C, 0xEE, 0xD9, 0x30, 0x00, 0x00, 0x4E, 0x94, 0x10, 0x27, 0xE7, 0x00, 0x04, 0xE4,
+    0x00, 0x00, 0x00, 0x2D, 0x70, 0x1E, 0x50, 0x1A, 0xFE, 0x8C, 0x52, 0xF3, 0x7B, 0x00, 0xAC, 0x22,
+    0xBF, 0x50, 0x99, 0xB5, 0x01, 0xF3, 0x00, 0x3F, 0x50, 0x6C, 0xD3, 0x03, 0xF0, 0x00, 0x0E, 0x50,
+    0x4D, 0xD3, 0x04, 0xF0, 0x00, 0x0E, 0x50, 0x6B, 0xC5, 0x01, 0xF3, 0x00, 0x2F, 0x50, 0xB7, 0x7A,
+    0x00, 0xAC, 0x22, 0xBF, 0x68, 0xC0, 0x1E, 0x40, 0x1A, 0xED, 0x8B, 0xC7, 0x00, 0x05, 0xE3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x93, 0x11, 0x36, 0xC4, 0x00, 0x00, 0x01, 0x8C, 0xEE, 0xDB,
+    0x61, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0x00, 0x00, 0x00, 0x05, 0xF7,
+    0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0E, 0xA0, 0x00, 0x00, 0x2F, 0x80, 0x9F, 0x10, 0x00, 0x07, 0xF3,
+    0x03, 0xF6, 0x00, 0x00, 0xDD, 0x00, 0x0D, 0xC0, 0x00, 0x3F, 0x70, 0x00, 0x8F, 0x20, 0x09, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0xEA, 0x00, 0x00, 0x0B, 0xD0, 0x5F, 0x50, 0x00, 0x00, 0x5F, 0x4A, 0xE0,
+    0x00, 0x00, 0x01, 0xE9, 0x6F, 0xFF, 0xFD, 0xA2, 0x06, 0xF2, 0x00, 0x3C, 0xD1, 0x6F, 0x20, 0x00,
+    0x5F, 0x46, 0xF2, 0x00, 0x05, 0xF4, 0x6F, 0x20, 0x03, 0xCD, 0x06, 0xFF, 0xFF, 0xFD, 0x30, 0x6F,
+    0x20, 0x02, 0x9E, 0x36, 0xF2, 0x00, 0x00, 0xEA, 0x6F, 0x20, 0x00, 0x0D, 0xC6, 0xF2, 0x00, 0x00,
+    0xEB, 0x6F, 0x20, 0x02, 0x9F, 0x46, 0xFF, 0xFF, 0xEB, 0x40, 0x00, 0x03, 0xAD, 0xFD, 0xB5, 0x00,
+    0x06, 0xF9, 0x20, 0x27, 0xF5, 0x03, 0xF8, 0x00, 0x00, 0x03, 0x40, 0xAE, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00,
+    0x34, 0x00, 0x6F, 0x92, 0x02, 0x7F, 0x50, 0x00, 0x3A, 0xEF, 0xDB, 0x50, 0x6F, 0xFF, 0xED, 0xA5,
+    0x00, 0x06, 0xF2, 0x00, 0x27, 0xEB, 0x00, 0x6F, 0x20, 0x00, 0x03, 0xF9, 0x06, 0xF2, 0x00, 0x00,
+    0x0A, 0xF1, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x46, 0xF2, 0x00, 0x00, 0x05, 0xF5, 0x6F, 0x20, 0x00,
+    0x00, 0x5F, 0x56, 0xF2, 0x00, 0x00, 0x06, 0xF4, 0x6F, 0x20, 0x00, 0x00, 0xAF, 0x16, 0xF2, 0x00,
+    0x00, 0x3F, 0x90, 0x6F, 0x20, 0x02, 0x7E, 0xB0, 0x06, 0xFF, 0xFE, 0xDA, 0x50, 0x00, 0x6F, 0xFF,
+    0xFF, 0xFE, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xB0, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00,
+    0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06,
+    0xFF, 0xFF, 0xFF, 0xF1, 0x6F, 0xFF, 0xFF, 0xF4, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x6F, 0x20, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x00, 0x03, 0xAD, 0xFE, 0xC8, 0x20, 0x00, 0x6F, 0x93, 0x01, 0x5D, 0xC0,
+    0x03, 0xF7, 0x00, 0x00, 0x00, 0x70, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x1F, 0xFF, 0xF1, 0x0E, 0xA0,
+    0x00, 0x00, 0x07, 0xF1, 0x0A, 0xE0, 0x00, 0x00, 0x07, 0xF1, 0x03, 0xF7, 0x00, 0x00, 0x07, 0xF1,
+    0x00, 0x6F, 0x93, 0x01, 0x4B, 0xF1, 0x00, 0x03, 0xAD, 0xFE, 0xC9, 0x30, 0x6F, 0x20, 0x00, 0x02,
+    0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7,
+    0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F, 0xFF, 0xFF, 0xFF, 0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F,
+    0x20, 0x00, 0x02, 0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F, 0x20,
+    0x00, 0x02, 0xF7, 0x6F, 0x20, 0x00, 0x02, 0xF7, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+    0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x00, 0x6F, 0x20, 0x06, 0xF2, 0x00,
+    0x6F, 0x20, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x06, 0xF2, 0x00, 0x6F,
+    0x20, 0x06, 0xF2, 0x00, 0x6F, 0x20, 0x07, 0xF2, 0x00, 0x8F, 0x10, 0x3E, 0xB0, 0xCD, 0x91, 0x00,
+    0x6F, 0x20, 0x00, 0x3E, 0xC1, 0x6F, 0x20, 0x03, 0xEC, 0x10, 0x6F, 0x20, 0x4E, 0xC1, 0x00, 0x6F,
+    0x24, 0xEB, 0x10, 0x00, 0x6F, 0x7F, 0xB1, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xBF,
+    0x80, 0x00, 0x00, 0x6F, 0x29, 0xF7, 0x00, 0x00, 0x6F, 0x20, 0x9F, 0x70, 0x00, 0x6F, 0x20, 0x0A,
+    0xF6, 0x00, 0x6F, 0x20, 0x00, 0xAF, 0x60, 0x6F, 0x20, 0x00, 0x0B, 0xF5, 0x6F, 0x20, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00,
+    0x6F, 0x20, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFC, 0x6F, 0xF2, 0x00, 0x00,
+    0x4F, 0xF4, 0x6F, 0xE7, 0x00, 0x00, 0xAE, 0xF4, 0x6F, 0xAC, 0x00, 0x01, 0xEA, 0xF4, 0x6F, 0x5F,
+    0x20, 0x05, 0xE5, 0xF4, 0x6F, 0x2D, 0x80, 0x0B, 0xA4, 0xF4, 0x6F, 0x27, 0xD0, 0x1F, 0x44, 0xF4,
+    0x6F, 0x22, 0xF3, 0x6E, 0x04, 0xF4, 0x6F, 0x20, 0xC9, 0xC9, 0x04, 0xF4, 0x6F, 0x20, 0x6E, 0xF3,
+    0x04, 0xF4, 0x6F, 0x20, 0x1F, 0xD0, 0x04, 0xF4, 0x6F, 0x20, 0x00, 0x00, 0x04, 0xF4, 0x6F, 0x20,
+    0x00, 0x00, 0x04, 0xF4, 0x6F, 0xE1, 0x00, 0x02, 0xF6, 0x6F, 0xF7, 0x00, 0x02, 0xF6, 0x6F, 0xBE,
+    0x10, 0x02, 0xF6, 0x6F, 0x4F, 0x80, 0x02, 0xF6, 0x6F, 0x29, 0xE1, 0x02, 0xF6, 0x6F, 0x22, 0xF8,
+    0x02, 0xF6, 0x6F, 0x20, 0x8E, 0x12, 0xF6, 0x6F, 0x20, 0x1E, 0x92, 0xF6, 0x6F, 0x20, 0x08, 0xF4,
+    0xF6, 0x6F, 0x20, 0x01, 0xEB, 0xF6, 0x6F, 0x20, 0x00, 0x7F, 0xF6, 0x6F, 0x20, 0x00, 0x1E, 0xF6,
+    0x00, 0x04, 0xBE, 0xFD, 0x81, 0x00, 0x00, 0x7F, 0x82, 0x03, 0xCD, 0x20, 0x03, 0xF8, 0x00, 0x00,
+    0x1D, 0xC0, 0x0A, 0xE1, 0x00, 0x00, 0x06, 0xF4, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0x90,
+    0x00, 0x00, 0x00, 0xFA, 0x1F, 0x90, 0x00, 0x00, 0x00, 0xFA, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8,
+    0x0A, 0xE0, 0x00, 0x00, 0x06, 0xF4, 0x04, 0xF8, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0x7F, 0x82, 0x03,
+    0xCE, 0x20, 0x00, 0x04, 0xBE, 0xFD, 0x91, 0x00, 0x6F, 0xFF, 0xEC, 0x70, 0x06, 0xF2, 0x01, 0x7F,
+    0x80, 0x6F, 0x20, 0x00, 0xBE, 0x06, 0xF2, 0x00, 0x09, 0xF1, 0x6F, 0x20, 0x00, 0xBE, 0x06, 0xF2,
+    0x01, 0x7F, 0x80, 0x6F, 0xFF, 0xEC, 0x70, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00,
+    0x06, 0xF2, 0x00, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x00, 0x06, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xBE, 0xFD, 0x81, 0x00, 0x00, 0x7F, 0x82, 0x03, 0xCD, 0x20, 0x03, 0xF8, 0x00, 0x00, 0x1D, 0xC0,
+    0x0A, 0xE1, 0x00, 0x00, 0x06, 0xF4, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0x90, 0x00, 0x00,
+    0x00, 0xFA, 0x1F, 0x90, 0x00, 0x00, 0x00, 0xFA, 0x0E, 0xB0, 0x00, 0x00, 0x02, 0xF8, 0x0A, 0xE0,
+    0x00, 0x00, 0x06, 0xF4, 0x04, 0xF8, 0x00, 0x00, 0x1D, 0xD0, 0x00, 0x7F, 0x82, 0x03, 0xCE, 0x20,
+    0x00, 0x04, 0xBE, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBE, 0x30, 0x6F, 0xFF, 0xFD, 0x70, 0x00, 0x6F, 0x20, 0x16, 0xF8, 0x00, 0x6F, 0x20, 0x00, 0xBE,
+    0x00, 0x6F, 0x20, 0x00, 0x9F, 0x10, 0x6F, 0x20, 0x00, 0xBE, 0x00, 0x6F, 0x20, 0x16, 0xF8, 0x00,
+    0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x6F, 0x20, 0x19, 0xF4, 0x00, 0x6F, 0x20, 0x00, 0xCD, 0x00, 0x6F,
+    0x20, 0x00, 0x4F, 0x60, 0x6F, 0x20, 0x00, 0x0C, 0xD0, 0x6F, 0x20, 0x00, 0x04, 0xF6, 0x04, 0xBE,
+    0xEC, 0x71, 0x06, 0xF8, 0x21, 0x5D, 0x80, 0xCC, 0x00, 0x00, 0x16, 0x0D, 0xA0, 0x00, 0x00, 0x00,
+    0xAE, 0x40, 0x00, 0x00, 0x02, 0xCF, 0xD9, 0x61, 0x00, 0x00, 0x37, 0xAE, 0xE5, 0x00, 0x00, 0x00,
+    0x1C, 0xE1, 0x00, 0x00, 0x00, 0x6F, 0x38, 0x00, 0x00, 0x08, 0xF2, 0xDC, 0x41, 0x16, 0xEB, 0x02,
+    0x8C, 0xEE, 0xC8, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x04, 0xF5, 0x9F, 0x00, 0x00, 0x04, 0xF5,
+    0x9F, 0x00, 0x00, 0x04, 0xF5, 0x9F, 0x00, 0x00, 0x04, 0xF5, 0x9F, 0x00, 0x00, 0x04, 0xF5, 0x9F,
+    0x00, 0x00, 0x04, 0xF5, 0x9F, 0x00, 0x00, 0x04, 0xF5, 0x9F, 0x00, 0x00, 0x04, 0xF5, 0x8F, 0x10,
+    0x00, 0x05, 0xF4, 0x4F, 0x50, 0x00, 0x09, 0xE1, 0x0B, 0xD4, 0x12, 0x7F, 0x70, 0x01, 0x8D, 0xFE,
+    0xC5, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x1E, 0x95, 0xF5, 0x00, 0x00, 0x06, 0xF4, 0x0E, 0xA0, 0x00,
+    0x00, 0xBD, 0x00, 0x9F, 0x10, 0x00, 0x2F, 0x80, 0x03, 0xF6, 0x00, 0x07, 0xF2, 0x00, 0x0D, 0xC0,
+    0x00, 0xDC, 0x00, 0x00, 0x7F, 0x20, 0x3F, 0x60, 0x00, 0x02, 0xF8, 0x09, 0xF1, 0x00, 0x00, 0x0B,
+    0xD0, 0xEA, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x40, 0x00, 0x00, 0x01, 0xEF, 0xE0, 0x00, 0x00, 0x00,
+    0x09, 0xF8, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x06, 0xF3, 0x2F, 0x70, 0x00, 0x5E,
+    0xF2, 0x00, 0x0A, 0xE0, 0x0D, 0xB0, 0x00, 0x9B, 0xD6, 0x00, 0x0E, 0xA0, 0x09, 0xE0, 0x00, 0xC7,
+    0x9A, 0x00, 0x2F, 0x70, 0x06, 0xF3, 0x01, 0xF3, 0x6D, 0x00, 0x6F, 0x30, 0x02, 0xF7, 0x05, 0xE0,
+    0x2F, 0x20, 0x9E, 0x00, 0x00, 0xDA, 0x08, 0xB0, 0x0E, 0x60, 0xDB, 0x00, 0x00, 0xAE, 0x0C, 0x80,
+    0x0A, 0x92, 0xF7, 0x00, 0x00, 0x6F, 0x3F, 0x40, 0x07, 0xD5, 0xF3, 0x00, 0x00, 0x2F, 0xAF, 0x10,
+    0x03, 0xFA, 0xE0, 0x00, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0x00, 0x0A, 0xF8, 0x00,
+    0x00, 0xBF, 0x70, 0x00, 0x0A, 0xE2, 0x00, 0x00, 0xCD, 0x10, 0x1E, 0xA0, 0x00, 0x7F, 0x30, 0x00,
+    0x6F, 0x50, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x1C, 0xD0, 0x00, 0x00, 0x02, 0xED, 0xF3, 0x00, 0x00,
+    0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xD1, 0x00, 0x00, 0x00, 0x8F, 0x6F, 0x80, 0x00,
+    0x00, 0x3F, 0x80, 0x7F, 0x30, 0x00, 0x0C, 0xD0, 0x00, 0xCC, 0x00, 0x08, 0xF3, 0x00, 0x03, 0xF7,
+    0x03, 0xF8, 0x00, 0x00, 0x08, 0xF3, 0xBE, 0x10, 0x00, 0x03, 0xF7, 0x2E, 0xA0, 0x00, 0x0C, 0xC0,
+    0x06, 0xF5, 0x00, 0x8F, 0x30, 0x00, 0xBE, 0x13, 0xF8, 0x00, 0x00, 0x2E, 0x9C, 0xC0, 0x00, 0x00,
+    0x06, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00,
+    0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00,
+    0x2E, 0xE3, 0x00, 0x00, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x05,
+    0xFC, 0x10, 0x00, 0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0xE2, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x9F, 0xFA, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00,
+    0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9F, 0xFA,
+    0xD7, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x0E, 0x60, 0x00, 0x09, 0xB0, 0x00, 0x04,
+    0xF1, 0x00, 0x00, 0xE5, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B,
+    0x90, 0x00, 0x06, 0xE0, 0x00, 0x02, 0xF3, 0x7F, 0xFD, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00,
+    0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00,
+    0x9D, 0x7F, 0xFD, 0x00, 0x00, 0x9F, 0xD2, 0x00, 0x00, 0x00, 0x9E, 0x6C, 0xE3, 0x00, 0x00, 0xAD,
+    0x30, 0x0A, 0xE3, 0x01, 0xBC, 0x10, 0x00, 0x07, 0xE4, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 0x4F, 0x40,
+    0x06, 0xD1, 0x00, 0x8B, 0x6F, 0xFF, 0xDA, 0x20, 0x00, 0x00, 0x3B, 0xC0, 0x00, 0x00, 0x02, 0xF3,
+    0x07, 0xDE, 0xFF, 0xF5, 0x9E, 0x41, 0x02, 0xF5, 0xE8, 0x00, 0x03, 0xF5, 0xE7, 0x00, 0x09, 0xF5,
+    0xAD, 0x31, 0x6A, 0xF5, 0x1A, 0xEE, 0x92, 0xF5, 0x8E, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00,
+    0x00, 0x8E, 0x00, 0x00, 0x00, 0x08, 0xE2, 0xBE, 0xD7, 0x00, 0x8E, 0xA4, 0x16, 0xF6, 0x08, 0xF5,
+    0x00, 0x09, 0xD0, 0x8F, 0x00, 0x00, 0x5F, 0x28, 0xE0, 0x00, 0x03, 0xF4, 0x8F, 0x00, 0x00, 0x5F,
+    0x28, 0xF5, 0x00, 0x09, 0xE0, 0x8E, 0xA3, 0x16, 0xF6, 0x08, 0xE2, 0xBE, 0xD7, 0x00, 0x00, 0x3A,
+    0xEE, 0xB3, 0x03, 0xEA, 0x21, 0x49, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x70,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xEA, 0x21, 0x49, 0x00, 0x3A,
+    0xEE, 0xB3, 0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x0B, 0xB0,
+    0x05, 0xDF, 0xC3, 0xBB, 0x04, 0xF8, 0x13, 0xBC, 0xB0, 0xBC, 0x00, 0x02, 0xFB, 0x0F, 0x70, 0x00,
+    0x0D, 0xB1, 0xF6, 0x00, 0x00, 0xBB, 0x0F, 0x70, 0x00, 0x0D, 0xB0, 0xBB, 0x00, 0x02, 0xFB, 0x04,
+    0xF8, 0x12, 0xAC, 0xB0, 0x05, 0xDF, 0xC3, 0xBB, 0x00, 0x3A, 0xEF, 0xC4, 0x00, 0x3E, 0xA2, 0x17,
+    0xF3, 0x0B, 0xD0, 0x00, 0x0B, 0xA0, 0xF8, 0x00, 0x00, 0x8E, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF7,
+    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0xA2, 0x12, 0x78, 0x00, 0x2A, 0xEF, 0xD8,
+    0x20, 0x00, 0x6D, 0xFE, 0x01, 0xF7, 0x00, 0x04, 0xF3, 0x00, 0x9F, 0xFF, 0xF8, 0x04, 0xF3, 0x00,
+    0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04, 0xF3, 0x00, 0x04,
+    0xF3, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x5D, 0xFC, 0x3B, 0xB0, 0x4F, 0x81, 0x2A, 0xCB, 0x0B, 0xB0,
+    0x00, 0x2F, 0xB0, 0xF7, 0x00, 0x00, 0xDB, 0x1F, 0x60, 0x00, 0x0B, 0xB0, 0xF7, 0x00, 0x00, 0xDB,
+    0x0B, 0xB0, 0x00, 0x2F, 0xB0, 0x4F, 0x71, 0x2A, 0xCB, 0x00, 0x5D, 0xFC, 0x3C, 0xA0, 0x00, 0x00,
+    0x01, 0xE8, 0x01, 0x93, 0x12, 0xAE, 0x20, 0x06, 0xCE, 0xEB, 0x30, 0x8E, 0x00, 0x00, 0x00, 0x8E,
+    0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x1A, 0xED, 0x60, 0x8E, 0xA4, 0x17, 0xF3, 0x8F,
+    0x40, 0x00, 0xD9, 0x8F, 0x00, 0x00, 0xBB, 0x8E, 0x00, 0x00, 0xAC, 0x8E, 0x00, 0x00, 0xAC, 0x8E,
+    0x00, 0x00, 0xAC, 0x8E, 0x00, 0x00, 0xAC, 0x8E, 0x00, 0x00, 0xAC, 0x7E, 0x7E, 0x00, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00,
+    0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00,
+    0x8D, 0x01, 0xCA, 0x4E, 0xB2, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00,
+    0x00, 0x8E, 0x00, 0x06, 0xF7, 0x8E, 0x00, 0x7F, 0x60, 0x8E, 0x08, 0xE5, 0x00, 0x8E, 0xAE, 0x40,
+    0x00, 0x8F, 0xEB, 0x00, 0x00, 0x8E, 0x4E, 0xA0, 0x00, 0x8E, 0x04, 0xEA, 0x00, 0x8E, 0x00, 0x3E,
+    0xA0, 0x8E, 0x00, 0x03, 0xEA, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x8E, 0x1B, 0xED, 0x40, 0x4C, 0xFB, 0x20, 0x8E, 0xA3, 0x19, 0xE4, 0x92, 0x2D, 0xA0, 0x8F,
+    0x40, 0x01, 0xFD, 0x00, 0x06, 0xF1, 0x8F, 0x00, 0x00, 0xEA, 0x00, 0x04, 0xF3, 0x8E, 0x00, 0x00,
+    0xD9, 0x00, 0x03, 0xF4, 0x8E, 0x00, 0x00, 0xD8, 0x00, 0x03, 0xF4, 0x8E, 0x00, 0x00, 0xD8, 0x00,
+    0x03, 0xF4, 0x8E, 0x00, 0x00, 0xD8, 0x00, 0x03, 0xF4, 0x8E, 0x00, 0x00, 0xD8, 0x00, 0x03, 0xF4,
+    0x8E, 0x1A, 0xED, 0x60, 0x8E, 0xA4, 0x17, 0xF3, 0x8F, 0x40, 0x00, 0xD9, 0x8F, 0x00, 0x00, 0xBB,
+    0x8E, 0x00, 0x00, 0xAC, 0x8E, 0x00, 0x00, 0xAC, 0x8E, 0x00, 0x00, 0xAC, 0x8E, 0x00, 0x00, 0xAC,
+    0x8E, 0x00, 0x00, 0xAC, 0x00, 0x4C, 0xEE, 0xA2, 0x00, 0x4F, 0x91, 0x2B, 0xE2, 0x0C, 0xC0, 0x00,
+    0x1E, 0x90, 0xF8, 0x00, 0x00, 0xBC, 0x1F, 0x70, 0x00, 0x0A, 0xE0, 0xF8, 0x00, 0x00, 0xBC, 0x0C,
+    0xC0, 0x00, 0x1E, 0x90, 0x4F, 0x81, 0x2B, 0xE2, 0x00, 0x4C, 0xFE, 0xB2, 0x00, 0x8E, 0x2B, 0xED,
+    0x70, 0x08, 0xEA, 0x41, 0x6F, 0x60, 0x8F, 0x50, 0x00, 0x9D, 0x08, 0xF0, 0x00, 0x05, 0xF2, 0x8E,
+    0x00, 0x00, 0x3F, 0x48, 0xF0, 0x00, 0x05, 0xF2, 0x8F, 0x50, 0x00, 0x9E, 0x08, 0xEA, 0x31, 0x6F,
+    0x60, 0x8E, 0x2B, 0xED, 0x70, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x08, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x5D, 0xFC, 0x3B, 0xB0, 0x4F, 0x81, 0x3B, 0xCB, 0x0B, 0xC0, 0x00, 0x2F,
+    0xB0, 0xF7, 0x00, 0x00, 0xDB, 0x1F, 0x60, 0x00, 0x0B, 0xB0, 0xF7, 0x00, 0x00, 0xDB, 0x0B, 0xB0,
+    0x00, 0x2F, 0xB0, 0x4F, 0x81, 0x2A, 0xCB, 0x00, 0x5D, 0xFC, 0x3B, 0xB0, 0x00, 0x00, 0x00, 0xBB,
+    0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0x00, 0xBB, 0x8E, 0x1A, 0xE9, 0x8E, 0xA4, 0x00, 0x8F,
+    0x50, 0x00, 0x8F, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x8E, 0x00,
+    0x00, 0x8E, 0x00, 0x00, 0x02, 0xAE, 0xEC, 0x50, 0x0C, 0xB2, 0x13, 0xA1, 0x0F, 0x60, 0x00, 0x00,
+    0x0D, 0xD5, 0x10, 0x00, 0x02, 0xBF, 0xFC, 0x50, 0x00, 0x01, 0x4A, 0xF4, 0x00, 0x00, 0x00, 0xF8,
+    0x2A, 0x41, 0x16, 0xF4, 0x04, 0xBE, 0xEC, 0x50, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x8F, 0xFF,
+    0xFD, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00,
+    0x07, 0xE0, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x9E, 0xFD, 0xAC, 0x00, 0x00, 0xBA, 0xAC, 0x00, 0x00,
+    0xBA, 0xAC, 0x00, 0x00, 0xBA, 0xAC, 0x00, 0x00, 0xBA, 0xAC, 0x00, 0x00, 0xBA, 0x9D, 0x00, 0x00,
+    0xDA, 0x7E, 0x10, 0x02, 0xFA, 0x2F, 0x91, 0x3A, 0xCA, 0x05, 0xDF, 0xB2, 0xBA, 0x5F, 0x30, 0x00,
+    0x0B, 0xC0, 0xE8, 0x00, 0x01, 0xF7, 0x09, 0xD0, 0x00, 0x7F, 0x10, 0x4F, 0x40, 0x0C, 0xB0, 0x00,
+    0xD9, 0x02, 0xF5, 0x00, 0x08, 0xE1, 0x8E, 0x10, 0x00, 0x2F, 0x5D, 0x90, 0x00, 0x00, 0xCD, 0xF4,
+    0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x06, 0xF8, 0x00, 0x2F, 0x40, 0xE7, 0x00, 0xAE,
+    0xC0, 0x06, 0xF1, 0x0A, 0xB0, 0x0E, 0x8F, 0x10, 0xAC, 0x00, 0x7F, 0x03, 0xF1, 0xE4, 0x0E, 0x80,
+    0x03, 0xF4, 0x7C, 0x0B, 0x83, 0xF4, 0x00, 0x0E, 0x8B, 0x80, 0x7C, 0x6F, 0x10, 0x00, 0xAC, 0xE4,
+    0x03, 0xFB, 0xB0, 0x00, 0x06, 0xFF, 0x10, 0x0E, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xAF, 0x40,
+    0x00, 0x1D, 0xC0, 0x00, 0x4F, 0x60, 0x3F, 0x80, 0x1E, 0xA0, 0x00, 0x7F, 0x4B, 0xD1, 0x00, 0x00,
+    0xBF, 0xF4, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x01, 0xEC, 0xF7, 0x00, 0x00, 0xBD, 0x18, 0xF3,
+    0x00, 0x7F, 0x40, 0x0C, 0xD1, 0x3F, 0x80, 0x00, 0x2E, 0x90, 0x5F, 0x30, 0x00, 0x0B, 0xC0, 0xE9,
+    0x00, 0x02, 0xF6, 0x08, 0xE0, 0x00, 0x8E, 0x10, 0x2F, 0x50, 0x0D, 0x90, 0x00, 0xBB, 0x04, 0xF3,
+    0x00, 0x05, 0xF2, 0xAC, 0x00, 0x00, 0x0D, 0x9F, 0x60, 0x00, 0x00, 0x8F, 0xE1, 0x00, 0x00, 0x02,
+    0xF9, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x1C, 0xB0, 0x00, 0x00, 0xBF, 0xC2, 0x00, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x3E, 0xC0, 0x00, 0x01, 0xDD, 0x10,
+    0x00, 0x0B, 0xE3, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00,
+    0x5F, 0xFF, 0xFF, 0xFB, 0x00, 0x19, 0xEF, 0x30, 0x06, 0xF4, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x08,
+    0xD0, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x03, 0xE9, 0x00, 0x0F, 0xFC, 0x10, 0x00,
+    0x03, 0xE9, 0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x8E,
+    0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x1A, 0xEF, 0x30, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xFE, 0xB2, 0x00, 0x00, 0x2E, 0x90, 0x00,
+    0x00, 0xBB, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x6F,
+    0x50, 0x00, 0x00, 0xAF, 0xF3, 0x00, 0x6F, 0x40, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0xAB, 0x00, 0x00,
+    0x0A, 0xB0, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x2E, 0x90, 0x00, 0xFE, 0xB2, 0x00, 0x00, 0x07, 0xCE,
+    0xD9, 0x41, 0x16, 0xA4, 0xA3, 0x03, 0x7C, 0xED, 0xA2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr ESP32S3BoxLiteGlyph kFontDejaVuSans16Glyphs[] = {
+    {    0,   0,   0,   5,   0,   0},  // ' '
+    {    0,   2,  12,   6,   2,   3},  // !
+    {   12,   5,   4,   7,   1,   3},  // "
+    {   22,  12,  11,  13,   1,   4},  // #
+    {   88,   8,  14,  10,   1,   3},  // $
+    {  144,  15,  12,  15,   0,   3},  // %
+    {  234,  11,  12,  12,   1,   3},  // &
+    {  300,   2,   4,   4,   1,   3},  // '
+    {  304,   4,  14,   6,   1,   3},  // (
+    {  332,   4,  14,   6,   1,   3},  // )
+    {  360,   8,   8,   8,   0,   3},  // *
+    {  392,  11,   9,  13,   1,   6},  // +
+    {  442,   3,   4,   5,   1,  13},  // ,
+    {  448,   5,   1,   6,   0,  10},  // -
+    {  451,   3,   2,   5,   1,  13},  // .
+    {  454,   6,  13,   5,   0,   3},  // /
+    {  493,   9,  12,  10,   1,   3},  // 0
+    {  547,   8,  12,  10,   1,   3},  // 1
+    {  595,   8,  12,  10,   1,   3},  // 2
+    {  643,   8,  12,  10,   1,   3},  // 3
+    {  691,  10,  12,  10,   0,   3},  // 4
+    {  751,   8,  12,  10,   1,   3},  // 5
+    {  799,   9,  12,  10,   1,   3},  // 6
+    {  853,   8,  12,  10,   1,   3},  // 7
+    {  901,   9,  12,  10,   1,   3},  // 8
+    {  955,   9,  12,  10,   1,   3},  // 9
+    { 1009,   3,   8,   5,   1,   7},  // :
+    { 1021,   3,  10,   5,   1,   7},  // ;
+    { 1036,  11,   9,  13,   1,   6},  // <
+    { 1086,  11,   4,  13,   1,   8},  // =
+    { 1108,  11,   9,  13,   1,   6},  // >
+    { 1158,   7,  12,   9,   1,   3},  // ?
+    { 1200,  14,  14,  16,   1,   4},  // @
+    { 1298,  11,  12,  11,   0,   3},  // A
+    { 1364,   9,  12,  11,   1,   3},  // B
+    { 1418,  11,  12,  11,   0,   3},  // C
+    { 1484,  11,  12,  12,   1,   3},  // D
+    { 1550,   9,  12,  10,   1,   3},  // E
+    { 1604,   8,  12,   9,   1,   3},  // F
+    { 1652,  12,  12,  12,   0,   3},  // G
+    { 1724,  10,  12,  12,   1,   3},  // H
+    { 1784,   3,  12,   5,   1,   3},  // I
+    { 1802,   5,  15,   5,  -1,   3},  // J
+    { 1840,  10,  12,  11,   1,   3},  // K
+    { 1900,   8,  12,   9,   1,   3},  // L
+    { 1948,  12,  12,  14,   1,   3},  // M
+    { 2020,  10,  12,  12,   1,   3},  // N
+    { 2080,  12,  12,  13,   0,   3},  // O
+    { 2152,   9,  12,  10,   1,   3},  // P
+    { 2206,  12,  14,  13,   0,   3},  // Q
+    { 2290,  10,  12,  11,   1,   3},  // R
+    { 2350,   9,  12,  10,   1,   3},  // S
+    { 2404,  11,  12,  10,  -1,   3},  // T
+    { 2470,  10,  12,  12,   1,   3},  // U
+    { 2530,  11,  12,  11,   0,   3},  // V
+    { 2596,  16,  12,  16,   0,   3},  // W
+    { 2692,  11,  12,  11,   0,   3},  // X
+    { 2758,  10,  12,  10,   0,   3},  // Y
+    { 2818,  11,  12,  11,   0,   3},  // Z
+    { 2884,   4,  14,   6,   1,   3},  // [
+    { 2912,   6,  13,   5,   0,   3},  // backslash
+    { 2951,   4,  14,   6,   1,   3},  // ]
+    { 2979,  11,   4,  13,   1,   3},  // ^
+    { 3001,  10,   1,   8,  -1,  18},  // _
+    { 3006,   4,   3,   8,   1,   2},  // `
+    { 3012,   8,   9,  10,   1,   6},  // a
+    { 3048,   9,  12,  10,   1,   3},  // b
+    { 3102,   8,   9,   9,   0,   6},  // c
+    { 3138,   9,  12,  10,   0,   3},  // d
+    { 3192,   9,   9,  10,   0,   6},  // e
+    { 3233,   6,  12,   6,   0,   3},  // f
+    { 3269,   9,  12,  10,   0,   6},  // g
+    { 3323,   8,  12,  10,   1,   3},  // h
+    { 3371,   2,  12,   4,   1,   3},  // i
+    { 3383,   4,  15,   4,  -1,   3},  // j
+    { 3413,   8,  12,   9,   1,   3},  // k
+    { 3461,   2,  12,   4,   1,   3},  // l
+    { 3473,  14,   9,  16,   1,   6},  // m
+    { 3536,   8,   9,  10,   1,   6},  // n
+    { 3572,   9,   9,  10,   0,   6},  // o
+    { 3613,   9,  12,  10,   1,   6},  // p
+    { 3667,   9,  12,  10,   0,   6},  // q
+    { 3721,   6,   9,   7,   1,   6},  // r
+    { 3748,   8,   9,   8,   0,   6},  // s
+    { 3784,   6,  11,   6,   0,   4},  // t
+    { 3817,   8,   9,  10,   1,   6},  // u
+    { 3853,   9,   9,   9,   0,   6},  // v
+    { 3894,  13,   9,  13,   0,   6},  // w
+    { 3953,   9,   9,   9,   0,   6},  // x
+    { 3994,   9,  12,   9,   0,   6},  // y
+    { 4048,   8,   9,   8,   0,   6},  // z
+    { 4084,   7,  15,  10,   2,   3},  // {
+    { 4137,   2,  16,   5,   2,   3},  // |
+    { 4153,   7,  15,  10,   2,   3},  // }
+    { 4206,  11,   3,  13,   1,   9},  // ~
+};
+
+constexpr ESP32S3BoxLiteKernPair kFontDejaVuSans16Kerning[] = {
+    {0x2D, 0x42, -1},
+    {0x2D, 0x47, 1},
+    {0x2D, 0x4A, 1},
+    {0x2D, 0x51, 1},
+    {0x2D, 0x54, -1},
+    {0x2D, 0x56, -1},
+    {0x2D, 0x57, -1},
+    {0x2D, 0x58, -1},
+    {0x2D, 0x59, -2},
+    {0x41, 0x54, -1},
+    {0x41, 0x56, -1},
+    {0x41, 0x57, -1},
+    {0x41, 0x59, -1},
+    {0x41, 0x66, -1},
+    {0x41, 0x76, -1},
+    {0x41, 0x77, -1},
+    {0x41, 0x79, -1},
+    {0x42, 0x57, -1},
+    {0x42, 0x59, -1},
+    {0x44, 0x59, -1},
+    {0x46, 0x2E, -3},
+    {0x46, 0x3A, -1},
+    {0x46, 0x41, -1},
+    {0x46, 0x61, -1},
+    {0x46, 0x65, -1},
+    {0x46, 0x69, -1},
+    {0x46, 0x6F, -1},
+    {0x46, 0x72, -1},
+    {0x46, 0x75, -1},
+    {0x46, 0x79, -1},
+    {0x47, 0x54, -1},
+    {0x47, 0x59, -1},
+    {0x4A, 0x2D, -1},
+    {0x4B, 0x2D, -2},
+    {0x4B, 0x43, -1},
+    {0x4B, 0x4F, -1},
+    {0x4B, 0x54, -1},
+    {0x4B, 0x57, -1},
+    {0x4B, 0x59, -1},
+    {0x4B, 0x65, -1},
+    {0x4B, 0x6F, -1},
+    {0x4B, 0x75, -1},
+    {0x4B, 0x79, -1},
+    {0x4C, 0x4F, -1},
+    {0x4C, 0x54, -2},
+    {0x4C, 0x55, -1},
+    {0x4C, 0x56, -2},
+    {0x4C, 0x57, -1},
+    {0x4C, 0x59, -2},
+    {0x4C, 0x79, -1},
+    {0x4F, 0x2E, -1},
+    {0x4F, 0x58, -1},
+    {0x4F, 0x59, -1},
+    {0x50, 0x2E, -2},
+    {0x50, 0x41, -1},
+    {0x50, 0x61, -1},
+    {0x50, 0x65, -1},
+    {0x50, 0x6F, -1},
+    {0x52, 0x2D, -1},
+    {0x52, 0x2E, -1},
+    {0x52, 0x41, -1},
+    {0x52, 0x43, -1},
+    {0x52, 0x54, -1},
+    {0x52, 0x56, -1},
+    {0x52, 0x57, -1},
+    {0x52, 0x59, -1},
+    {0x52, 0x65, -1},
+    {0x52, 0x6F, -1},
+    {0x52, 0x75, -1},
+    {0x52, 0x79, -1},
+    {0x54, 0x2D, -1},
+    {0x54, 0x2E, -2},
+    {0x54, 0x3A, -2},
+    {0x54, 0x41, -1},
+    {0x54, 0x43, -1},
+    {0x54, 0x61, -3},
+    {0x54, 0x63, -3},
+    {0x54, 0x65, -3},
+    {0x54, 0x6F, -3},
+    {0x54, 0x72, -2},
+    {0x54, 0x73, -3},
+    {0x54, 0x75, -2},
+    {0x54, 0x77, -3},
+    {0x54, 0x79, -2},
+    {0x56, 0x2D, -1},
+    {0x56, 0x2E, -2},
+    {0x56, 0x3A, -1},
+    {0x56, 0x41, -1},
+    {0x56, 0x61, -1},
+    {0x56, 0x65, -1},
+    {0x56, 0x6F, -1},
+    {0x56, 0x75, -1},
+    {0x57, 0x2D, -1},
+    {0x57, 0x2E, -2},
+    {0x57, 0x3A, -1},
+    {0x57, 0x41, -1},
+    {0x57, 0x61, -1},
+    {0x57, 0x65, -1},
+    {0x57, 0x6F, -1},
+    {0x57, 0x72, -1},
+    {0x57, 0x75, -1},
+    {0x58, 0x2D, -1},
+    {0x58, 0x43, -1},
+    {0x58, 0x4F, -1},
+    {0x58, 0x65, -1},
+    {0x59, 0x2D, -2},
+    {0x59, 0x2E, -3},
+    {0x59, 0x3A, -2},
+    {0x59, 0x41, -1},
+    {0x59, 0x43, -1},
+    {0x59, 0x4F, -1},
+    {0x59, 0x61, -2},
+    {0x59, 0x65, -2},
+    {0x59, 0x69, -1},
+    {0x59, 0x6F, -2},
+    {0x59, 0x75, -2},
+    {0x66, 0x2D, -1},
+    {0x66, 0x2E, -1},
+    {0x66, 0x3A, -1},
+    {0x6B, 0x65, -1},
+    {0x6B, 0x6F, -1},
+    {0x6B, 0x79, -1},
+    {0x72, 0x2D, -1},
+    {0x72, 0x2E, -1},
+    {0x76, 0x2E, -1},
+    {0x76, 0x3A, -1},
+    {0x77, 0x2E, -1},
+    {0x77, 0x3A, -1},
+    {0x79, 0x2E, -2},
+    {0x79, 0x3A, -1},
+};
+
+constexpr ESP32S3BoxLiteFont FontDejaVuSans16 = {
+    kFontDejaVuSans16Bitmap,
+    kFontDejaVuSans16Glyphs,
+    kFontDejaVuSans16Kerning,
+    130,  // kerning pairs
+    0x20, 0x7E,  // first, last
+    4,  // bpp
+    19,  // line height
+    15,  // baseline
+};
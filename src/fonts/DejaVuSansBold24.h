@@ -0,0 +1,901 @@
+// Generated by tools/fontconvert.py from DejaVuSans-Bold.ttf at 24 px, 4 bpp. Do not edit.
+#pragma once
+
+#include "../ESP32S3BoxLite.h"
+
+constexpr uint8_t kFontDejaVuSansBold24Bitmap[] = {
+    0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0xAF,
+    0xFF, 0x99, 0xFF, 0xF8, 0x7F, 0xFF, 0x65, 0xFF, 0xF4, 0x3F, 0xFF, 0x21, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0xBF, 0xF1, 0x08,
+    0xFF, 0x3B, 0xFF, 0x10, 0x8F, 0xF3, 0xBF, 0xF1, 0x08, 0xFF, 0x3B, 0xFF, 0x10, 0x8F, 0xF3, 0xBF,
+    0xF1, 0x08, 0xFF, 0x3B, 0xFF, 0x10, 0x8F, 0xF3, 0xBF, 0xF1, 0x08, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x1F, 0xF8, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x8F, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xF2, 0x00, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xA0, 0x04, 0xFF, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x0D, 0xFC, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0xF7, 0x00, 0x6F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF3, 0x00, 0xAF, 0xE0, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x20, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x04, 0xFF, 0x60, 0x08,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x0C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFC,
+    0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x6F, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xDF, 0xFE, 0xCA, 0x62, 0x00, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0xFF, 0xE4, 0x9F,
+    0x52, 0x48, 0xD0, 0x01, 0xFF, 0xFA, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE3, 0x9F, 0x50,
+    0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFB, 0x62, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x40, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x48, 0xDF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x09, 0xF6, 0x6E, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0xAF, 0xFF, 0x11,
+    0xD8, 0x42, 0x19, 0xF5, 0x3E, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x02, 0x6A, 0xCE, 0xFF, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xD9,
+    0x10, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x0B,
+    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x71, 0x8F, 0xF9, 0x00, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0x00,
+    0x1F, 0xFD, 0x00, 0x1E, 0xFE, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x0D,
+    0xFF, 0x10, 0x08, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x0D, 0xFF, 0x10, 0x2F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x1E, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0x71, 0x8F, 0xF9, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF,
+    0xD1, 0x1E, 0xF9, 0x01, 0x9D, 0xFE, 0xA2, 0x00, 0x00, 0x29, 0xEF, 0xD9, 0x10, 0x9F, 0xE1, 0x1D,
+    0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x9F, 0xF9, 0x16, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0x00, 0xEF, 0xF1, 0x00, 0xDF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xF3, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x01, 0xFF,
+    0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xFE, 0x10, 0x00, 0xEF, 0xF1, 0x00, 0xDF, 0xF2,
+    0x00, 0x00, 0x00, 0x3F, 0xF6, 0x00, 0x00, 0x9F, 0xF9, 0x16, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xCF,
+    0xC0, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x06, 0xFF, 0x30, 0x00, 0x00, 0x01,
+    0x9D, 0xFE, 0xA2, 0x00, 0x00, 0x00, 0x05, 0xBE, 0xFD, 0xC8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xA1, 0x13, 0x6B, 0x20, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x9F, 0xFF, 0x10, 0x8F, 0xFF, 0xEE, 0xFF, 0xFE, 0x20,
+    0x0B, 0xFF, 0xD0, 0x2F, 0xFF, 0xE2, 0x2E, 0xFF, 0xFD, 0x22, 0xFF, 0xF9, 0x06, 0xFF, 0xF9, 0x00,
+    0x2D, 0xFF, 0xFD, 0xBF, 0xFF, 0x30, 0x8F, 0xFF, 0x90, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xA0, 0x07,
+    0xFF, 0xFE, 0x10, 0x00, 0x2D, 0xFF, 0xFF, 0xD1, 0x00, 0x2F, 0xFF, 0xFD, 0x41, 0x15, 0xCF, 0xFF,
+    0xFD, 0x10, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x39, 0xCE, 0xFE, 0xC8, 0x30, 0x7F, 0xFF, 0xF7, 0xBF,
+    0xF1, 0xBF, 0xF1, 0xBF, 0xF1, 0xBF, 0xF1, 0xBF, 0xF1, 0xBF, 0xF1, 0xBF, 0xF1, 0x00, 0x0B, 0xFF,
+    0xC0, 0x04, 0xFF, 0xF5, 0x00, 0xCF, 0xFD, 0x00, 0x4F, 0xFF, 0x70, 0x0B, 0xFF, 0xF2, 0x01, 0xFF,
+    0xFC, 0x00, 0x5F, 0xFF, 0x80, 0x09, 0xFF, 0xF5, 0x00, 0xCF, 0xFF, 0x30, 0x0D, 0xFF, 0xF2, 0x00,
+    0xEF, 0xFF, 0x10, 0x0D, 0xFF, 0xF2, 0x00, 0xCF, 0xFF, 0x30, 0x09, 0xFF, 0xF5, 0x00, 0x6F, 0xFF,
+    0x80, 0x02, 0xFF, 0xFB, 0x00, 0x0B, 0xFF, 0xF1, 0x00, 0x5F, 0xFF, 0x70, 0x00, 0xDF, 0xFC, 0x00,
+    0x04, 0xFF, 0xF5, 0x00, 0x0B, 0xFF, 0xC0, 0xCF, 0xFA, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x0D, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xFA, 0x00, 0x0C, 0xFF, 0xF1, 0x00, 0x9F, 0xFF, 0x50,
+    0x05, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xB0, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x02, 0xFF,
+    0xFC, 0x00, 0x3F, 0xFF, 0xB0, 0x05, 0xFF, 0xF9, 0x00, 0x9F, 0xFF, 0x50, 0x0C, 0xFF, 0xF1, 0x02,
+    0xFF, 0xFA, 0x00, 0x7F, 0xFF, 0x40, 0x0D, 0xFF, 0xC0, 0x05, 0xFF, 0xF4, 0x00, 0xCF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0C, 0x60, 0x0B,
+    0xF4, 0x02, 0xA7, 0x4F, 0xFD, 0x6B, 0xF6, 0x9F, 0xFC, 0x01, 0x8E, 0xFF, 0xFF, 0xFD, 0x50, 0x00,
+    0x03, 0xEF, 0xFF, 0xA0, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFD, 0x50, 0x4F, 0xFD, 0x5B, 0xF6, 0x9F,
+    0xFC, 0x0C, 0x60, 0x0B, 0xF4, 0x02, 0xA7, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x08, 0xFF,
+    0xFA, 0x08, 0xFF, 0xFA, 0x09, 0xFF, 0xF9, 0x0C, 0xFF, 0xE2, 0x1F, 0xFF, 0x60, 0x5F, 0xFB, 0x00,
+    0x9F, 0xE2, 0x00, 0xBF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFA, 0x8F,
+    0xFF, 0xA8, 0xFF, 0xFA, 0x8F, 0xFF, 0xA8, 0xFF, 0xFA, 0x8F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xEF,
+    0x90, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x09, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xA0, 0x00, 0x00,
+    0x3F, 0xF6, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x00, 0xDF, 0xB0, 0x00, 0x00, 0x2F, 0xF7, 0x00,
+    0x00, 0x07, 0xFF, 0x20, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x06, 0xFF,
+    0x30, 0x00, 0x00, 0xAF, 0xE0, 0x00, 0x00, 0x1E, 0xF9, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00,
+    0x9F, 0xE0, 0x00, 0x00, 0x0E, 0xFA, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 0x8F, 0xF1, 0x00,
+    0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xEF, 0xDA, 0x50, 0x00, 0x00, 0x03, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0xAF, 0xFF, 0xD3,
+    0x05, 0xFF, 0xFF, 0x60, 0x2F, 0xFF, 0xF4, 0x00, 0x08, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x00,
+    0x4F, 0xFF, 0xF2, 0xAF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x5B, 0xFF, 0xFB, 0x00, 0x00, 0x0F,
+    0xFF, 0xF7, 0xCF, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x8C, 0xFF, 0xFA, 0x00, 0x00, 0x0F, 0xFF,
+    0xF8, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0x7A, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF5,
+    0x7F, 0xFF, 0xE0, 0x00, 0x04, 0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0x40, 0x00, 0x8F, 0xFF, 0xC0, 0x0A,
+    0xFF, 0xFD, 0x30, 0x5F, 0xFF, 0xF6, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x3D,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x17, 0xCE, 0xFE, 0xA5, 0x00, 0x00, 0x03, 0x7A, 0xEF,
+    0xFF, 0xF1, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x4C, 0x85, 0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xF1, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF1, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x02, 0x69, 0xCE, 0xFE, 0xDA,
+    0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x1F, 0xE9, 0x41, 0x16, 0xEF, 0xFF, 0xF3, 0x1A, 0x10, 0x00, 0x00, 0x6F, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x10, 0x00, 0x00,
+    0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x01, 0x59, 0xCD, 0xFE, 0xDB, 0x71, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x09, 0x94,
+    0x21, 0x14, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x15, 0xDF, 0xFF, 0xA0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE8,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x25, 0xCF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFB, 0x6B, 0x73, 0x20, 0x15, 0xCF,
+    0xFF, 0xF7, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x20,
+    0x04, 0x8B, 0xDE, 0xFE, 0xC9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x6F, 0xFD,
+    0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x2E, 0xFF, 0x52, 0xFF, 0xFF, 0x20, 0x00, 0x0B, 0xFF, 0xA0, 0x2F,
+    0xFF, 0xF2, 0x00, 0x05, 0xFF, 0xE2, 0x02, 0xFF, 0xFF, 0x20, 0x01, 0xEF, 0xF7, 0x00, 0x2F, 0xFF,
+    0xF2, 0x00, 0x9F, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x0E, 0xFF, 0x30, 0x00, 0x2F, 0xFF, 0xF2,
+    0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF2, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xEF, 0xEB, 0x61, 0x00, 0x07,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x06, 0xA5, 0x31,
+    0x14, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFD,
+    0x2C, 0x84, 0x21, 0x14, 0xCF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x2F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x03, 0x6A, 0xCE, 0xFE, 0xDA, 0x50, 0x00, 0x00, 0x00, 0x17, 0xBD,
+    0xFE, 0xC9, 0x40, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x5F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0x2E, 0xFF, 0xFC, 0x41, 0x12, 0x5A, 0x40, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0xAE, 0xFE, 0xA4, 0x00,
+    0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x07,
+    0xFF, 0xFF, 0xE5, 0x13, 0xCF, 0xFF, 0xE1, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x45, 0xFF,
+    0xFF, 0x60, 0x00, 0x0F, 0xFF, 0xF6, 0x2F, 0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0xDF, 0xFF,
+    0x80, 0x00, 0x3F, 0xFF, 0xF3, 0x06, 0xFF, 0xFE, 0x51, 0x2C, 0xFF, 0xFC, 0x00, 0x0C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x05, 0xBE, 0xFE,
+    0xC8, 0x10, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xAD, 0xEF, 0xEC, 0x93, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x01, 0xFF, 0xFF, 0xB2, 0x14, 0xEF, 0xFF, 0xB0, 0x2F,
+    0xFF, 0xF3, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x8F, 0xFF, 0xA0, 0x09, 0xFF,
+    0xFB, 0x21, 0x4E, 0xFF, 0xF4, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0D, 0xFF, 0xFA, 0x21,
+    0x3D, 0xFF, 0xF8, 0x05, 0xFF, 0xFE, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x00, 0x01,
+    0xFF, 0xFF, 0x37, 0xFF, 0xFE, 0x00, 0x00, 0x4F, 0xFF, 0xF2, 0x4F, 0xFF, 0xFA, 0x21, 0x3D, 0xFF,
+    0xFE, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x6A, 0xDE, 0xFE, 0xC9, 0x40, 0x00, 0x00, 0x03, 0x9D, 0xEE, 0xD9, 0x30, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x03, 0xFF,
+    0xFF, 0x81, 0x19, 0xFF, 0xFE, 0x10, 0x8F, 0xFF, 0xD0, 0x00, 0x0D, 0xFF, 0xF7, 0x0A, 0xFF, 0xFA,
+    0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFF, 0xA0, 0x00, 0x0B, 0xFF, 0xFF, 0x09, 0xFF, 0xFD, 0x00,
+    0x00, 0xDF, 0xFF, 0xF1, 0x5F, 0xFF, 0xF8, 0x11, 0x9F, 0xFF, 0xFF, 0x20, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF2, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x01, 0x7C, 0xEF, 0xD8, 0x5F,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF,
+    0x40, 0x08, 0x94, 0x20, 0x26, 0xEF, 0xFF, 0xB0, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x16, 0xAD, 0xEE, 0xDA, 0x50, 0x00, 0x00, 0x5F,
+    0xFF, 0xE5, 0xFF, 0xFE, 0x5F, 0xFF, 0xE5, 0xFF, 0xFE, 0x5F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE5, 0xFF, 0xFE, 0x5F, 0xFF, 0xE5, 0xFF, 0xFE, 0x5F, 0xFF, 0xE0,
+    0x05, 0xFF, 0xFE, 0x05, 0xFF, 0xFE, 0x05, 0xFF, 0xFE, 0x05, 0xFF, 0xFE, 0x05, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x05, 0xFF, 0xFE, 0x05, 0xFF,
+    0xFE, 0x05, 0xFF, 0xFD, 0x08, 0xFF, 0xF5, 0x0C, 0xFF, 0xA0, 0x1F, 0xFE, 0x10, 0x5F, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xF8,
+    0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xFF, 0xFB, 0x61,
+    0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xC7, 0x20, 0x00, 0x3C, 0xFF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD8, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xC7, 0x10, 0x00,
+    0x00, 0x00, 0x04, 0xAE, 0xFF, 0xFF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x98,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC6, 0x10, 0x00, 0x00, 0x00,
+    0x15, 0xBF, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFE, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xFF, 0xC4,
+    0x00, 0x01, 0x6B, 0xFF, 0xFF, 0xFE, 0x83, 0x00, 0x15, 0xBF, 0xFF, 0xFF, 0xFA, 0x50, 0x00, 0x00,
+    0x7F, 0xFF, 0xFF, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xEC, 0x82, 0x00, 0x5F, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x40, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x5B, 0x63, 0x11, 0x7F, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0x00, 0x00, 0x02, 0xDF,
+    0xFF, 0xC0, 0x00, 0x00, 0x2D, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0xCF, 0xFF, 0xE3, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF5,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0E,
+    0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0xEF, 0xEB, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFD, 0x73, 0x10,
+    0x25, 0xAF, 0xFE, 0x30, 0x00, 0x00, 0x0B, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xE3, 0x00,
+    0x00, 0x8F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD, 0x00, 0x02, 0xFF, 0x60, 0x00, 0x7D,
+    0xFD, 0x77, 0xFF, 0x01, 0xEF, 0x70, 0x09, 0xFC, 0x00, 0x09, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x7F,
+    0xD0, 0x0E, 0xF5, 0x00, 0x4F, 0xFB, 0x22, 0xBF, 0xFF, 0x00, 0x2F, 0xF1, 0x3F, 0xF1, 0x00, 0xAF,
+    0xF2, 0x00, 0x1F, 0xFF, 0x00, 0x0E, 0xF4, 0x5F, 0xD0, 0x00, 0xDF, 0xD0, 0x00, 0x0C, 0xFF, 0x00,
+    0x0E, 0xF4, 0x6F, 0xC0, 0x00, 0xEF, 0xB0, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xF3, 0x5F, 0xD0, 0x00,
+    0xDF, 0xD0, 0x00, 0x0C, 0xFF, 0x00, 0x4F, 0xE0, 0x3F, 0xF1, 0x00, 0xAF, 0xF2, 0x00, 0x2F, 0xFF,
+    0x00, 0xBF, 0xA0, 0x0E, 0xF5, 0x00, 0x4F, 0xFB, 0x22, 0xBF, 0xFF, 0x3A, 0xFE, 0x20, 0x0A, 0xFB,
+    0x00, 0x09, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xD3, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x7D, 0xFD, 0x77,
+    0xFE, 0xB6, 0x10, 0x00, 0x00, 0x9F, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x03, 0xB1, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFC, 0x73, 0x10,
+    0x26, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0xAD, 0xEF, 0xDB, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x6F,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA1, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x2F,
+    0xFF, 0xF5, 0x0B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x10, 0x6F, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xA0, 0x02, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x0C,
+    0xFF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x10, 0x00, 0x7F, 0xFF, 0xF2, 0x00, 0x00, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x01,
+    0xEF, 0xFF, 0x80, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0xCF, 0xFF, 0xFF, 0xFF, 0xEC, 0x94, 0x00, 0x0C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x0C, 0xFF, 0xFB, 0x00,
+    0x15, 0xFF, 0xFF, 0xB0, 0xCF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFD, 0x0C, 0xFF, 0xFB, 0x00, 0x00,
+    0xBF, 0xFF, 0xC0, 0xCF, 0xFF, 0xB0, 0x01, 0x5F, 0xFF, 0xF8, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x10, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x60, 0xCF, 0xFF, 0xB0, 0x00, 0x3B, 0xFF, 0xFF, 0x1C, 0xFF, 0xFB, 0x00, 0x00, 0x2F, 0xFF, 0xF6,
+    0xCF, 0xFF, 0xB0, 0x00, 0x00, 0xEF, 0xFF, 0x8C, 0xFF, 0xFB, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0xCF,
+    0xFF, 0xB0, 0x00, 0x3B, 0xFF, 0xFF, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x0C, 0xFF, 0xFF, 0xFF, 0xFE, 0xDB, 0x61, 0x00, 0x00, 0x00, 0x04,
+    0x9C, 0xEF, 0xED, 0xA6, 0x10, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x5E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0xEF, 0xFF, 0xF9, 0x31, 0x13, 0x7E, 0xF1, 0x0B, 0xFF, 0xFF,
+    0x60, 0x00, 0x00, 0x01, 0x91, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x01, 0x91, 0x03, 0xEF, 0xFF,
+    0xF9, 0x31, 0x13, 0x7E, 0xF1, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x03, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x04, 0x9C, 0xEF, 0xED, 0xA6, 0x10, 0xCF, 0xFF, 0xFF,
+    0xFE, 0xDB, 0x72, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x0C, 0xFF, 0xFB, 0x00, 0x15, 0xBF, 0xFF, 0xFE, 0x20, 0xCF,
+    0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFA, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF2,
+    0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x6C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+    0xF8, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAC, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF9, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x8C, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x5F, 0xFF, 0xF6, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x2C, 0xFF, 0xFB, 0x00, 0x00,
+    0x08, 0xFF, 0xFF, 0xA0, 0xCF, 0xFF, 0xB0, 0x01, 0x5B, 0xFF, 0xFF, 0xE2, 0x0C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x0C, 0xFF, 0xFF,
+    0xFF, 0xED, 0xB8, 0x20, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF6, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x8C, 0xDF, 0xFE, 0xCA, 0x61, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF4, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3E, 0xFF, 0xFF, 0xA4, 0x10, 0x14,
+    0x9E, 0xF4, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x18, 0x43, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFD, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
+    0x30, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE0, 0xBF,
+    0xFF, 0xF6, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x03, 0xEF, 0xFF, 0xFA, 0x41, 0x02, 0x8F, 0xFF, 0xE0,
+    0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x49, 0xCE, 0xFE, 0xEC, 0x95, 0x10, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0xCF, 0xFF, 0xBC, 0xFF, 0xFB, 0xCF, 0xFF,
+    0xBC, 0xFF, 0xFB, 0xCF, 0xFF, 0xBC, 0xFF, 0xFB, 0xCF, 0xFF, 0xBC, 0xFF, 0xFB, 0xCF, 0xFF, 0xBC,
+    0xFF, 0xFB, 0xCF, 0xFF, 0xBC, 0xFF, 0xFB, 0xCF, 0xFF, 0xBC, 0xFF, 0xFB, 0xCF, 0xFF, 0xBC, 0xFF,
+    0xFB, 0xCF, 0xFF, 0xBC, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00,
+    0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF,
+    0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x0C, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF,
+    0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00,
+    0xCF, 0xFF, 0xB0, 0x00, 0x0E, 0xFF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xCF, 0xFF, 0xF3,
+    0x5F, 0xFF, 0xFF, 0xFB, 0x05, 0xFF, 0xFF, 0xFB, 0x10, 0x5F, 0xED, 0xA4, 0x00, 0x00, 0xCF, 0xFF,
+    0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x20, 0xCF, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0xD2, 0x00,
+    0xCF, 0xFF, 0xB0, 0x00, 0x4F, 0xFF, 0xFD, 0x20, 0x00, 0xCF, 0xFF, 0xB0, 0x04, 0xFF, 0xFF, 0xD2,
+    0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x4E, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0xCF, 0xFF, 0xB4, 0xEF, 0xFF,
+    0xD2, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xDE, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xBA, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0xAF, 0xFF, 0xFD,
+    0x10, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x0B, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0xBF, 0xFF, 0xFC, 0x10, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xC1, 0x00, 0xCF, 0xFF,
+    0xB0, 0x00, 0x01, 0xBF, 0xFF, 0xFC, 0x10, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xC1,
+    0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFA, 0xCF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFA, 0xCF, 0xFF, 0xCF, 0xFF, 0x20, 0x04, 0xFF, 0xFC, 0xFF,
+    0xFA, 0xCF, 0xFF, 0x7D, 0xFF, 0x80, 0x0A, 0xFF, 0xC9, 0xFF, 0xFA, 0xCF, 0xFF, 0x78, 0xFF, 0xE0,
+    0x1F, 0xFF, 0x69, 0xFF, 0xFA, 0xCF, 0xFF, 0x72, 0xFF, 0xF5, 0x7F, 0xFE, 0x19, 0xFF, 0xFA, 0xCF,
+    0xFF, 0x70, 0xBF, 0xFC, 0xDF, 0xF9, 0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0x70, 0x4F, 0xFF, 0xFF, 0xF3,
+    0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0x70, 0x0D, 0xFF, 0xFF, 0xC0, 0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0x70,
+    0x07, 0xFF, 0xFF, 0x60, 0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0x70, 0x02, 0xFF, 0xFE, 0x10, 0x09, 0xFF,
+    0xFA, 0xCF, 0xFF, 0x70, 0x00, 0xAF, 0xF9, 0x00, 0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFA, 0xCF,
+    0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFA, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xFE, 0x10, 0x00, 0x06, 0xFF, 0xFD, 0xCF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xFF, 0xE1, 0x00, 0x06, 0xFF, 0xFD, 0xCF, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0xFF,
+    0xFD, 0xCF, 0xFF, 0xFF, 0xFF, 0x20, 0x06, 0xFF, 0xFD, 0xCF, 0xFF, 0x9F, 0xFF, 0x90, 0x06, 0xFF,
+    0xFD, 0xCF, 0xFF, 0x79, 0xFF, 0xF2, 0x06, 0xFF, 0xFD, 0xCF, 0xFF, 0x71, 0xEF, 0xF9, 0x06, 0xFF,
+    0xFD, 0xCF, 0xFF, 0x70, 0x8F, 0xFF, 0x26, 0xFF, 0xFD, 0xCF, 0xFF, 0x70, 0x1E, 0xFF, 0xA6, 0xFF,
+    0xFD, 0xCF, 0xFF, 0x70, 0x08, 0xFF, 0xF9, 0xFF, 0xFD, 0xCF, 0xFF, 0x70, 0x01, 0xEF, 0xFF, 0xFF,
+    0xFD, 0xCF, 0xFF, 0x70, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0xCF, 0xFF, 0x70, 0x00, 0x1E, 0xFF, 0xFF,
+    0xFD, 0xCF, 0xFF, 0x70, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0xCF, 0xFF, 0x70, 0x00, 0x00, 0xDF, 0xFF,
+    0xFD, 0xCF, 0xFF, 0x70, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xAD, 0xEF, 0xEC, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x4F, 0xFF, 0xFE, 0x61, 0x13, 0xBF, 0xFF, 0xFA, 0x00, 0x0D,
+    0xFF, 0xFE, 0x20, 0x00, 0x00, 0xAF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0xA0, 0x8F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xF1, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x2B, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xAF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0x18, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x4F, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0xFA, 0x00, 0xDF, 0xFF, 0xE2, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x04, 0xFF,
+    0xFF, 0xE5, 0x10, 0x3B, 0xFF, 0xFF, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
+    0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xDE, 0xFE,
+    0xC8, 0x20, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xED, 0xA5, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFB, 0x10, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x0C, 0xFF, 0xFB, 0x00, 0x14, 0xDF,
+    0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0x8C, 0xFF, 0xFB, 0x00, 0x00, 0x1F, 0xFF,
+    0xF9, 0xCF, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0x8C, 0xFF, 0xFB, 0x00, 0x14, 0xDF, 0xFF, 0xF4,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xED, 0xA5, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAD, 0xEF,
+    0xEC, 0x82, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x4F, 0xFF, 0xFE, 0x61, 0x13, 0xBF, 0xFF, 0xFA,
+    0x00, 0x0C, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0xAF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xA0, 0x8F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF1, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0x2B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0xAF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0xFF, 0x18, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x4F, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00, 0xDF, 0xFF, 0xE2, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40,
+    0x05, 0xFF, 0xFF, 0xD5, 0x10, 0x3B, 0xFF, 0xFF, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC1, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x6A,
+    0xDE, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF7, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xEC, 0x93, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF4, 0x00, 0xCF, 0xFF, 0xB0, 0x02, 0x9F, 0xFF, 0xF9, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x0D, 0xFF, 0xFB, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x0D, 0xFF, 0xF8, 0x00, 0xCF, 0xFF, 0xB0, 0x02, 0x9F, 0xFF, 0xF2, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x40, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x20, 0x00, 0xCF, 0xFF, 0xB0, 0x16, 0xFF, 0xFF, 0xC0, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x7F, 0xFF, 0xF6, 0x00, 0xCF, 0xFF, 0xB0, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x06, 0xFF, 0xFF, 0x50, 0xCF, 0xFF, 0xB0, 0x00, 0x01, 0xEF, 0xFF, 0xC0, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x7F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x1E, 0xFF, 0xFC, 0x00, 0x04, 0x9D, 0xEF,
+    0xED, 0xB8, 0x61, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x00, 0xEF, 0xFF, 0xA3, 0x11, 0x38, 0xEF, 0x60, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x75, 0x04, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xFF, 0xFF, 0xC9, 0x62, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00,
+    0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x48, 0xBE, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x04, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x82, 0xA2, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0xF7, 0x2F, 0xFB, 0x63, 0x11, 0x3A, 0xFF, 0xFF, 0x32, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x15, 0x8B, 0xDE, 0xFE,
+    0xDA, 0x50, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xCF, 0xFF, 0xB0, 0x00,
+    0x00, 0x3F, 0xFF, 0xF4, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0xAF, 0xFF, 0xD0, 0x00,
+    0x00, 0x5F, 0xFF, 0xF2, 0x7F, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x41,
+    0x28, 0xFF, 0xFF, 0x90, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x03, 0x8C, 0xEF, 0xED, 0xA6, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE0, 0x0E,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF8, 0x00, 0x9F, 0xFF, 0xD0, 0x00, 0x00, 0x04, 0xFF,
+    0xFF, 0x30, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x0D, 0xFF, 0xF9, 0x00,
+    0x00, 0x1E, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFF, 0xE0, 0x00, 0x05, 0xFF, 0xFF, 0x20, 0x00, 0x03,
+    0xFF, 0xFF, 0x40, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x00, 0x0C, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x06, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x50,
+    0xBF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+    0x00, 0x0A, 0xFF, 0xF9, 0x0E, 0xFF, 0xF6, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x0E, 0xFF,
+    0xF6, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x8F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF2, 0x07, 0xFF,
+    0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0x00, 0x6F, 0xFF, 0xE0, 0x04, 0xFF, 0xFF, 0x10, 0x00,
+    0xEF, 0xFD, 0xFF, 0x70, 0x00, 0x9F, 0xFF, 0xA0, 0x01, 0xFF, 0xFF, 0x50, 0x03, 0xFF, 0xE8, 0xFF,
+    0xA0, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0xCF, 0xFF, 0x80, 0x06, 0xFF, 0xB4, 0xFF, 0xD0, 0x01, 0xFF,
+    0xFF, 0x30, 0x00, 0x8F, 0xFF, 0xC0, 0x0A, 0xFF, 0x71, 0xFF, 0xF2, 0x05, 0xFF, 0xFF, 0x00, 0x00,
+    0x5F, 0xFF, 0xF0, 0x0D, 0xFF, 0x40, 0xCF, 0xF5, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
+    0x2F, 0xFF, 0x10, 0x9F, 0xF9, 0x0C, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x5F, 0xFC, 0x00,
+    0x5F, 0xFC, 0x0F, 0xFF, 0xF5, 0x00, 0x00, 0x09, 0xFF, 0xFA, 0x9F, 0xF9, 0x00, 0x2F, 0xFF, 0x4F,
+    0xFF, 0xF1, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0xCF, 0xF5, 0x00, 0x0D, 0xFF, 0xBF, 0xFF, 0xD0, 0x00,
+    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xEF,
+    0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0xEF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00,
+    0x00, 0x1E, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x01,
+    0xDF, 0xFF, 0xC0, 0x00, 0xAF, 0xFF, 0xE2, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x00, 0x1E, 0xFF, 0xFB,
+    0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x61, 0xDF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xEA, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xDF,
+    0xFF, 0xC5, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0xAF, 0xFF, 0xE2, 0x00, 0x00,
+    0x4F, 0xFF, 0xF7, 0x00, 0x1E, 0xFF, 0xFB, 0x00, 0x01, 0xDF, 0xFF, 0xC0, 0x00, 0x05, 0xFF, 0xFF,
+    0x60, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xAF, 0xFF, 0xE2, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x1E, 0xFF, 0xFA, 0x1D, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xFA,
+    0x00, 0x00, 0x04, 0xFF, 0xFF, 0xA0, 0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0xDF, 0xFF, 0xE1, 0x00,
+    0x01, 0xEF, 0xFF, 0xD0, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x2B, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x2E, 0xFF,
+    0xFD, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x01, 0xDF,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF,
+    0xFF, 0xF5, 0xEF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF,
+    0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF,
+    0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF,
+    0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF,
+    0x10, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0xEF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF,
+    0xFF, 0xF5, 0xDF, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00,
+    0xEF, 0xA0, 0x00, 0x00, 0x09, 0xFE, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0x01, 0xEF, 0x90,
+    0x00, 0x00, 0x0A, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xF3, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x0D, 0xFB,
+    0x00, 0x00, 0x00, 0x8F, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x00, 0x00, 0x0E, 0xFA, 0x00, 0x00,
+    0x00, 0x9F, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x0E, 0xF9, 0x6F, 0xFF, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xFF, 0xFE, 0x6F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE,
+    0x00, 0x01, 0xFF, 0xFE, 0x6F, 0xFF, 0xFF, 0xFE, 0x6F, 0xFF, 0xFF, 0xFE, 0x6F, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x01, 0xCF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC1, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x9F, 0xFF, 0x90, 0x00,
+    0x00, 0x6F, 0xFF, 0x70, 0x05, 0xEF, 0xF7, 0x00, 0x04, 0xFF, 0xE4, 0x00, 0x00, 0x3D, 0xFF, 0x50,
+    0x3E, 0xFC, 0x20, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFC, 0x10, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x4E, 0xF7, 0x00, 0x00,
+    0x3E, 0xF5, 0x01, 0x59, 0xCE, 0xFE, 0xDA, 0x50, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x84, 0x21, 0x13, 0x9F, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x01, 0x6B, 0xDE, 0xFF, 0xFF, 0xFF, 0xF4, 0x2D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF5, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xEF, 0xFF, 0x92, 0x00, 0x0F, 0xFF,
+    0xF5, 0xEF, 0xFF, 0x91, 0x03, 0xBF, 0xFF, 0xF5, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x2E,
+    0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0xF5, 0x02, 0x9D, 0xFE, 0xB5, 0x0E, 0xFF, 0xF5, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x29, 0xDF, 0xD9, 0x20, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE,
+    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0xFF, 0xFF, 0xF7, 0x11, 0x7F, 0xFF, 0xF8,
+    0x0F, 0xFF, 0xFA, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0xFF, 0xFF, 0x50, 0x00, 0x05, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xF1, 0xFF, 0xFF, 0x50, 0x00, 0x05, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFA, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF7, 0x11, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xF3, 0x29,
+    0xDF, 0xE9, 0x20, 0x00, 0x00, 0x03, 0x8C, 0xEF, 0xDB, 0x61, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x5F, 0xFF, 0xFD, 0x51, 0x13, 0x78, 0xAF, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0xDF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFD, 0x51, 0x13, 0x78,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0x9C, 0xEF,
+    0xDB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x01, 0x8D, 0xFE, 0xA3, 0x1F, 0xFF, 0xF3, 0x02,
+    0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x30, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x5F, 0xFF,
+    0xF9, 0x21, 0x6E, 0xFF, 0xFF, 0x3A, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0xDF, 0xFF, 0x80,
+    0x00, 0x03, 0xFF, 0xFF, 0x3E, 0xFF, 0xF7, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0xDF, 0xFF, 0x80, 0x00,
+    0x03, 0xFF, 0xFF, 0x3A, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF3, 0x5F, 0xFF, 0xF9, 0x21, 0x5E,
+    0xFF, 0xFF, 0x30, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x02, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF,
+    0xFF, 0x30, 0x01, 0x8D, 0xFE, 0xA3, 0x1F, 0xFF, 0xF3, 0x00, 0x03, 0x9D, 0xEF, 0xEB, 0x50, 0x00,
+    0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x05,
+    0xFF, 0xFF, 0x71, 0x14, 0xDF, 0xFF, 0x70, 0xAF, 0xFF, 0x80, 0x00, 0x05, 0xFF, 0xFC, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xAF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x72,
+    0x11, 0x24, 0x7B, 0x70, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x03, 0x9C, 0xEF, 0xED, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x6C, 0xEF, 0xFF,
+    0xA0, 0x00, 0xAF, 0xFF, 0xFF, 0xFA, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xA0, 0x06, 0xFF, 0xFE, 0x20,
+    0x00, 0x00, 0x7F, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xB0, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x18,
+    0xDF, 0xEA, 0x31, 0xFF, 0xFF, 0x30, 0x2D, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF3, 0x0C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xFF, 0xFF, 0xA2, 0x16, 0xEF, 0xFF, 0xF3, 0xAF, 0xFF, 0xD0, 0x00,
+    0x07, 0xFF, 0xFF, 0x3D, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0xEF, 0xFF, 0x70, 0x00, 0x01,
+    0xFF, 0xFF, 0x3D, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0xAF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
+    0xFF, 0x35, 0xFF, 0xFF, 0x92, 0x16, 0xEF, 0xFF, 0xF3, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x30, 0x2D, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF3, 0x00, 0x18, 0xDF, 0xEA, 0x32, 0xFF, 0xFF, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x04, 0xB6, 0x31, 0x02, 0x7F, 0xFF, 0xF9, 0x00, 0x5F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x04, 0x9C,
+    0xEF, 0xED, 0xA5, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x32, 0x9D, 0xFE, 0xA2, 0x00, 0xFF,
+    0xFF, 0x7E, 0xFF, 0xFF, 0xFE, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xF8,
+    0x22, 0xAF, 0xFF, 0xF1, 0xFF, 0xFF, 0xB0, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFF, 0x60, 0x00, 0x0F,
+    0xFF, 0xF3, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3,
+    0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF,
+    0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00,
+    0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0x00, 0x00, 0x0F,
+    0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF,
+    0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3,
+    0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3,
+    0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3,
+    0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3,
+    0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x1F, 0xFF, 0xF2, 0x01, 0x8F, 0xFF, 0xE0,
+    0xCF, 0xFF, 0xFF, 0x90, 0xCF, 0xFF, 0xFD, 0x10, 0xCF, 0xFD, 0x91, 0x00, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x07, 0xFF, 0xFF, 0x60, 0xFF, 0xFF, 0x30, 0x07, 0xFF, 0xFF, 0x50,
+    0x0F, 0xFF, 0xF3, 0x07, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0x37, 0xFF, 0xFE, 0x30, 0x00, 0x0F,
+    0xFF, 0xFB, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xD2, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
+    0xDF, 0xFF, 0xD2, 0x00, 0x00, 0xFF, 0xFF, 0x32, 0xDF, 0xFF, 0xD2, 0x00, 0x0F, 0xFF, 0xF3, 0x02,
+    0xDF, 0xFF, 0xD2, 0x00, 0xFF, 0xFF, 0x30, 0x02, 0xEF, 0xFF, 0xD1, 0x0F, 0xFF, 0xF3, 0x00, 0x03,
+    0xEF, 0xFF, 0xD1, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F,
+    0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF,
+    0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3,
+    0xFF, 0xFF, 0x33, 0xAE, 0xEC, 0x60, 0x01, 0x9D, 0xFD, 0x92, 0x00, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xF9, 0x3E, 0xFF, 0xFF, 0xFE, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+    0x90, 0xFF, 0xFF, 0xF7, 0x13, 0xEF, 0xFF, 0xFC, 0x21, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xA0, 0x00,
+    0xAF, 0xFF, 0xF2, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x50, 0x00, 0x9F, 0xFF, 0xC0, 0x00, 0x1F,
+    0xFF, 0xF2, 0xFF, 0xFF, 0x40, 0x00, 0x8F, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x30,
+    0x00, 0x8F, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x30, 0x00, 0x8F, 0xFF, 0xA0, 0x00,
+    0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x30, 0x00, 0x8F, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF,
+    0x30, 0x00, 0x8F, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x30, 0x00, 0x8F, 0xFF, 0xA0,
+    0x00, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x30, 0x00, 0x8F, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xF2, 0xFF,
+    0xFF, 0x32, 0x9D, 0xFE, 0xA2, 0x00, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xFE, 0x30, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xF8, 0x22, 0xAF, 0xFF, 0xF1, 0xFF, 0xFF, 0xB0, 0x00, 0x2F,
+    0xFF, 0xF3, 0xFF, 0xFF, 0x60, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF3,
+    0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF,
+    0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00,
+    0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x04, 0x9D, 0xEF, 0xEB, 0x71,
+    0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+    0x05, 0xFF, 0xFF, 0xA2, 0x15, 0xEF, 0xFF, 0xC0, 0xAF, 0xFF, 0xD0, 0x00, 0x05, 0xFF, 0xFF, 0x3D,
+    0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0xEF, 0xFF, 0x6D, 0xFF,
+    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0xAF, 0xFF, 0xC0, 0x00, 0x05, 0xFF, 0xFF, 0x35, 0xFF, 0xFF,
+    0x92, 0x15, 0xEF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x1A, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x04, 0x9D, 0xEF, 0xEB, 0x71, 0x00, 0x00, 0xFF, 0xFF, 0x32, 0x9D,
+    0xFD, 0x92, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x0F, 0xFF, 0xFF, 0x71, 0x17, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF,
+    0xFD, 0x0F, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0xF1, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0xF1, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF, 0xFD, 0x0F,
+    0xFF, 0xFF, 0x71, 0x17, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x0F, 0xFF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0x32, 0x9D, 0xFE, 0x92, 0x00, 0x0F, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA, 0x31, 0xFF, 0xFF, 0x30, 0x2D, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xFF, 0xF3, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xFF, 0xFF, 0x92, 0x16, 0xEF, 0xFF,
+    0xF3, 0xAF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x3D, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF3,
+    0xEF, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xFF, 0x3D, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0xAF,
+    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x35, 0xFF, 0xFF, 0x92, 0x15, 0xEF, 0xFF, 0xF3, 0x0C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x2D, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF3, 0x00, 0x18, 0xDF,
+    0xEA, 0x31, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0xFF, 0xFF, 0x33, 0xAD, 0xFB, 0xFF,
+    0xFF, 0x8F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0x31, 0x38, 0xFF, 0xFF,
+    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0x30,
+    0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x01, 0x7B, 0xEF, 0xED, 0xB8,
+    0x30, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
+    0xF5, 0x10, 0x24, 0x7C, 0x40, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFD, 0xB8,
+    0x40, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x02, 0x69, 0xBD, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x02, 0xEF, 0xFF, 0x18, 0xA6, 0x32, 0x01, 0x5F, 0xFF, 0xF2, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x14, 0x8B, 0xDE, 0xFE, 0xC8, 0x20, 0x00,
+    0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00,
+    0x00, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90,
+    0x00, 0x00, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x09, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x08, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x5F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0xDF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0x9D, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
+    0xF1, 0x00, 0x02, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x10, 0x00, 0x2F, 0xFF, 0xF1, 0x2F, 0xFF, 0xF1,
+    0x00, 0x02, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x10, 0x00, 0x2F, 0xFF, 0xF1, 0x2F, 0xFF, 0xF1, 0x00,
+    0x02, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x10, 0x00, 0x2F, 0xFF, 0xF1, 0x2F, 0xFF, 0xF1, 0x00, 0x02,
+    0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x20, 0x00, 0x4F, 0xFF, 0xF1, 0x1F, 0xFF, 0xF3, 0x00, 0x09, 0xFF,
+    0xFF, 0x10, 0xEF, 0xFF, 0xB2, 0x17, 0xFF, 0xFF, 0xF1, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x10, 0x2E, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF1, 0x00, 0x29, 0xEF, 0xE9, 0x22, 0xFF, 0xFF, 0x10,
+    0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x1F, 0xFF, 0xF2, 0x1F, 0xFF, 0xF2, 0x00, 0x00, 0x7F, 0xFF, 0xB0,
+    0x0A, 0xFF, 0xF7, 0x00, 0x00, 0xCF, 0xFF, 0x50, 0x04, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00,
+    0x00, 0xDF, 0xFF, 0x30, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0D, 0xFF, 0xF2, 0x00,
+    0x00, 0x1F, 0xFF, 0xE0, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x0A, 0xFF, 0xF4, 0xAF, 0xFF, 0x50, 0x00,
+    0x00, 0x04, 0xFF, 0xFA, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x0C, 0xFF, 0xE0, 0x00,
+    0x0D, 0xFF, 0xF3, 0x0B, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF3, 0x00, 0x2F, 0xFF, 0xE0, 0x07, 0xFF,
+    0xF8, 0x00, 0x4F, 0xFF, 0xF7, 0x00, 0x5F, 0xFF, 0xA0, 0x03, 0xFF, 0xFC, 0x00, 0x8F, 0xFF, 0xFB,
+    0x00, 0x9F, 0xFF, 0x60, 0x00, 0xEF, 0xFF, 0x10, 0xCF, 0xEC, 0xFE, 0x00, 0xDF, 0xFF, 0x20, 0x00,
+    0xBF, 0xFF, 0x41, 0xFF, 0xB8, 0xFF, 0x32, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x84, 0xFF, 0x75,
+    0xFF, 0x75, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xB8, 0xFF, 0x41, 0xFF, 0xB9, 0xFF, 0xF5, 0x00,
+    0x00, 0x0E, 0xFF, 0xFC, 0xFF, 0x00, 0xCF, 0xED, 0xFF, 0xF1, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFB,
+    0x00, 0x9F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x5F, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+    0xF1, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x2E, 0xFF, 0xF6, 0x00, 0x01, 0xDF, 0xFF, 0x80, 0x4F,
+    0xFF, 0xE2, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xB0, 0x5F, 0xFF, 0xE2, 0x00, 0x00, 0xCF,
+    0xFF, 0x8E, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+    0xFE, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0x5C, 0xFF,
+    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x2E, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x6F, 0xFF,
+    0xE1, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x7F, 0xFF, 0xA0, 0x00, 0x00, 0x2F, 0xFF,
+    0xE1, 0x1F, 0xFF, 0xF1, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x09, 0xFF, 0xF7, 0x00, 0x00, 0xDF, 0xFF,
+    0x30, 0x03, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x08, 0xFF, 0xF6,
+    0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x0D, 0xFF, 0xE1, 0x00, 0x00, 0x0D, 0xFF, 0xF1, 0x3F, 0xFF, 0x90,
+    0x00, 0x00, 0x06, 0xFF, 0xF7, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x01, 0xEF, 0xFD, 0xDF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xFE, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00, 0x06, 0xFF,
+    0xFF, 0x50, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x5F,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0xBE, 0xFF, 0xF1, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x04, 0xFF, 0xFF, 0x51, 0x00, 0x00,
+    0x05, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x5E, 0xFF,
+    0xF6, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x01, 0x5E, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x06, 0xBE, 0xFF, 0xF1, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE,
+    0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB,
+    0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xFF,
+    0xFE, 0xC6, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+    0x00, 0x01, 0x4E, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+    0xF1, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF1, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xF1, 0x00, 0x05, 0xFF,
+    0xFF, 0x51, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xF5, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFE, 0xC6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4B, 0xEE, 0xB5, 0x00,
+    0x00, 0x00, 0x58, 0x1A, 0xFF, 0xFF, 0xFF, 0xD7, 0x21, 0x3A, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x7F, 0x93, 0x12, 0x6C, 0xFF, 0xFF, 0xFF, 0xB1, 0x53, 0x00, 0x00, 0x00, 0x4A,
+    0xEE, 0xC6, 0x00,
+};
+
+constexpr ESP32S3BoxLiteGlyph kFontDejaVuSansBold24Glyphs[] = {
+    {    0,   0,   0,   8,   0,   0},  // ' '
+    {    0,   5,  18,  11,   3,   5},  // !
+    {   45,   9,   7,  13,   2,   5},  // "
+    {   77,  18,  18,  20,   1,   5},  // #
+    {  239,  15,  23,  17,   1,   4},  // $
+    {  412,  24,  18,  24,   0,   5},  // %
+    {  628,  19,  18,  21,   1,   5},  // &
+    {  799,   4,   7,   7,   2,   5},  // '
+    {  813,   7,  21,  11,   2,   5},  // (
+    {  887,   7,  21,  11,   2,   5},  // )
+    {  961,  12,  11,  13,   0,   5},  // *
+    { 1027,  16,  15,  20,   2,   8},  // +
+    { 1147,   6,   8,   9,   1,  18},  // ,
+    { 1171,   8,   3,  10,   1,  14},  // -
+    { 1183,   5,   5,   9,   2,  18},  // .
+    { 1196,   9,  20,   9,   0,   5},  // /
+    { 1286,  15,  18,  17,   1,   5},  // 0
+    { 1421,  14,  18,  17,   2,   5},  // 1
+    { 1547,  14,  18,  17,   1,   5},  // 2
+    { 1673,  14,  18,  17,   1,   5},  // 3
+    { 1799,  15,  18,  17,   1,   5},  // 4
+    { 1934,  14,  18,  17,   1,   5},  // 5
+    { 2060,  15,  18,  17,   1,   5},  // 6
+    { 2195,  14,  18,  17,   1,   5},  // 7
+    { 2321,  15,  18,  17,   1,   5},  // 8
+    { 2456,  15,  18,  17,   1,   5},  // 9
+    { 2591,   5,  13,  10,   2,  10},  // :
+    { 2624,   6,  16,  10,   1,  10},  // ;
+    { 2672,  16,  14,  20,   2,   9},  // <
+    { 2784,  16,   9,  20,   2,  11},  // =
+    { 2856,  16,  14,  20,   2,   9},  // >
+    { 2968,  12,  18,  14,   1,   5},  // ?
+    { 3076,  22,  21,  24,   1,   5},  // @
+    { 3307,  19,  18,  19,   0,   5},  // A
+    { 3478,  15,  18,  18,   2,   5},  // B
+    { 3613,  16,  18,  18,   1,   5},  // C
+    { 3757,  17,  18,  20,   2,   5},  // D
+    { 3910,  13,  18,  16,   2,   5},  // E
+    { 4027,  13,  18,  16,   2,   5},  // F
+    { 4144,  17,  18,  20,   1,   5},  // G
+    { 4297,  16,  18,  20,   2,   5},  // H
+    { 4441,   5,  18,   9,   2,   5},  // I
+    { 4486,   9,  23,   9,  -2,   5},  // J
+    { 4590,  18,  18,  19,   2,   5},  // K
+    { 4752,  13,  18,  15,   2,   5},  // L
+    { 4869,  20,  18,  24,   2,   5},  // M
+    { 5049,  16,  18,  20,   2,   5},  // N
+    { 5193,  19,  18,  20,   1,   5},  // O
+    { 5364,  15,  18,  18,   2,   5},  // P
+    { 5499,  19,  22,  20,   1,   5},  // Q
+    { 5708,  16,  18,  18,   2,   5},  // R
+    { 5852,  15,  18,  17,   1,   5},  // S
+    { 5987,  17,  18,  16,   0,   5},  // T
+    { 6140,  16,  18,  19,   2,   5},  // U
+    { 6284,  19,  18,  19,   0,   5},  // V
+    { 6455,  26,  18,  26,   0,   5},  // W
+    { 6689,  18,  18,  19,   0,   5},  // X
+    { 6851,  19,  18,  17,  -1,   5},  // Y
+    { 7022,  16,  18,  17,   1,   5},  // Z
+    { 7166,   8,  21,  11,   2,   5},  // [
+    { 7250,   9,  20,   9,   0,   5},  // backslash
+    { 7340,   8,  21,  11,   1,   5},  // ]
+    { 7424,  16,   7,  20,   2,   5},  // ^
+    { 7480,  12,   2,  12,   0,  27},  // _
+    { 7492,   7,   4,  12,   1,   4},  // `
+    { 7506,  14,  13,  16,   1,  10},  // a
+    { 7597,  15,  18,  17,   2,   5},  // b
+    { 7732,  12,  13,  14,   1,  10},  // c
+    { 7810,  15,  18,  17,   1,   5},  // d
+    { 7945,  15,  13,  16,   1,  10},  // e
+    { 8043,  11,  18,  10,   0,   5},  // f
+    { 8142,  15,  18,  17,   1,  10},  // g
+    { 8277,  14,  18,  17,   2,   5},  // h
+    { 8403,   5,  18,   8,   2,   5},  // i
+    { 8448,   8,  23,   8,  -1,   5},  // j
+    { 8540,  15,  18,  16,   2,   5},  // k
+    { 8675,   5,  18,   8,   2,   5},  // l
+    { 8720,  22,  13,  25,   2,  10},  // m
+    { 8863,  14,  13,  17,   2,  10},  // n
+    { 8954,  15,  13,  16,   1,  10},  // o
+    { 9052,  15,  18,  17,   2,  10},  // p
+    { 9187,  15,  18,  17,   1,  10},  // q
+    { 9322,  10,  13,  12,   2,  10},  // r
+    { 9387,  13,  13,  14,   1,  10},  // s
+    { 9472,  11,  17,  11,   0,   6},  // t
+    { 9566,  15,  13,  17,   1,  10},  // u
+    { 9664,  16,  13,  16,   0,  10},  // v
+    { 9768,  22,  13,  22,   0,  10},  // w
+    { 9911,  15,  13,  15,   0,  10},  // x
+    {10009,  16,  18,  16,   0,  10},  // y
+    {10153,  12,  13,  14,   1,  10},  // z
+    {10231,  12,  22,  17,   3,   5},  // {
+    {10363,   3,  24,   9,   3,   5},  // |
+    {10399,  12,  22,  17,   3,   5},  // }
+    {10531,  16,   6,  20,   2,  12},  // ~
+};
+
+constexpr ESP32S3BoxLiteKernPair kFontDejaVuSansBold24Kerning[] = {
+    {0x2D, 0x54, -4},
+    {0x2D, 0x56, -2},
+    {0x2D, 0x57, -1},
+    {0x2D, 0x58, -2},
+    {0x2D, 0x59, -4},
+    {0x41, 0x54, -2},
+    {0x41, 0x55, -1},
+    {0x41, 0x56, -2},
+    {0x41, 0x57, -1},
+    {0x41, 0x59, -2},
+    {0x41, 0x76, -1},
+    {0x41, 0x79, -1},
+    {0x42, 0x56, -1},
+    {0x42, 0x57, -1},
+    {0x42, 0x59, -1},
+    {0x43, 0x2D, 1},
+    {0x44, 0x59, -2},
+    {0x46, 0x2C, -4},
+    {0x46, 0x2D, -1},
+    {0x46, 0x2E, -4},
+    {0x46, 0x3A, -1},
+    {0x46, 0x3B, -1},
+    {0x46, 0x41, -3},
+    {0x46, 0x61, -1},
+    {0x46, 0x65, -1},
+    {0x46, 0x6F, -1},
+    {0x46, 0x72, -2},
+    {0x46, 0x75, -1},
+    {0x46, 0x79, -1},
+    {0x47, 0x59, -1},
+    {0x4B, 0x2D, -2},
+    {0x4B, 0x43, -1},
+    {0x4B, 0x4F, -1},
+    {0x4B, 0x79, -2},
+    {0x4C, 0x4F, -1},
+    {0x4C, 0x54, -4},
+    {0x4C, 0x55, -1},
+    {0x4C, 0x56, -3},
+    {0x4C, 0x57, -2},
+    {0x4C, 0x59, -4},
+    {0x4C, 0x79, -2},
+    {0x4F, 0x2C, -1},
+    {0x4F, 0x2E, -1},
+    {0x4F, 0x41, -1},
+    {0x4F, 0x56, -1},
+    {0x4F, 0x58, -1},
+    {0x4F, 0x59, -1},
+    {0x50, 0x2C, -4},
+    {0x50, 0x2E, -4},
+    {0x50, 0x41, -2},
+    {0x50, 0x61, -1},
+    {0x52, 0x54, -1},
+    {0x52, 0x59, -1},
+    {0x52, 0x79, -1},
+    {0x53, 0x53, -1},
+    {0x54, 0x2C, -3},
+    {0x54, 0x2D, -4},
+    {0x54, 0x2E, -4},
+    {0x54, 0x3A, -1},
+    {0x54, 0x3B, -1},
+    {0x54, 0x41, -2},
+    {0x54, 0x54, 1},
+    {0x54, 0x61, -3},
+    {0x54, 0x63, -3},
+    {0x54, 0x65, -3},
+    {0x54, 0x6F, -3},
+    {0x54, 0x72, -3},
+    {0x54, 0x73, -3},
+    {0x54, 0x75, -3},
+    {0x54, 0x77, -3},
+    {0x54, 0x79, -3},
+    {0x55, 0x41, -1},
+    {0x56, 0x2C, -3},
+    {0x56, 0x2D, -2},
+    {0x56, 0x2E, -3},
+    {0x56, 0x3A, -1},
+    {0x56, 0x3B, -1},
+    {0x56, 0x41, -2},
+    {0x56, 0x61, -1},
+    {0x56, 0x65, -1},
+    {0x56, 0x6F, -1},
+    {0x56, 0x75, -1},
+    {0x57, 0x2C, -2},
+    {0x57, 0x2D, -1},
+    {0x57, 0x2E, -2},
+    {0x57, 0x3A, -1},
+    {0x57, 0x3B, -1},
+    {0x57, 0x41, -1},
+    {0x57, 0x61, -1},
+    {0x57, 0x65, -1},
+    {0x57, 0x6F, -1},
+    {0x58, 0x2D, -2},
+    {0x58, 0x43, -1},
+    {0x58, 0x4F, -1},
+    {0x58, 0x65, -1},
+    {0x59, 0x2C, -4},
+    {0x59, 0x2D, -4},
+    {0x59, 0x2E, -4},
+    {0x59, 0x3A, -2},
+    {0x59, 0x3B, -2},
+    {0x59, 0x41, -2},
+    {0x59, 0x43, -1},
+    {0x59, 0x4F, -1},
+    {0x59, 0x61, -2},
+    {0x59, 0x65, -2},
+    {0x59, 0x6F, -2},
+    {0x59, 0x75, -2},
+    {0x61, 0x79, -1},
+    {0x66, 0x2C, -1},
+    {0x66, 0x2E, -1},
+    {0x6B, 0x65, -1},
+    {0x6B, 0x6F, -1},
+    {0x72, 0x2C, -4},
+    {0x72, 0x2E, -3},
+    {0x76, 0x2C, -2},
+    {0x76, 0x2E, -2},
+    {0x77, 0x2C, -2},
+    {0x77, 0x2E, -2},
+    {0x79, 0x2C, -2},
+    {0x79, 0x2E, -2},
+};
+
+constexpr ESP32S3BoxLiteFont FontDejaVuSansBold24 = {
+    kFontDejaVuSansBold24Bitmap,
+    kFontDejaVuSansBold24Glyphs,
+    kFontDejaVuSansBold24Kerning,
+    120,  // kerning pairs
+    0x20, 0x7E,  // first, last
+    4,  // bpp
+    29,  // line height
+    23,  // baseline
+};
@@ -0,0 +1,150 @@
+// Generated by tools/fontconvert.py from DejaVuSansMono.ttf at 12 px, 1 bpp. Do not edit.
+#pragma once
+
+#include "../ESP32S3BoxLite.h"
+
+constexpr uint8_t kFontDejaVuSansMono12Bitmap[] = {
+    0xFD, 0x80, 0xB6, 0x80, 0x14, 0x29, 0xF9, 0x42, 0x9F, 0xD2, 0x28, 0x23, 0xBB, 0x46, 0x1C, 0xB5,
+    0x79, 0x08, 0x61, 0x22, 0x43, 0x21, 0x09, 0x84, 0x89, 0x0C, 0x38, 0xC1, 0x81, 0x07, 0x0A, 0x62,
+    0xA2, 0x3A, 0xE0, 0x6A, 0xAA, 0xA4, 0x89, 0x22, 0x4A, 0x4A, 0x00, 0x25, 0x5C, 0xEA, 0x90, 0x20,
+    0x82, 0x3F, 0x20, 0x82, 0x00, 0xE0, 0xE0, 0xC0, 0x08, 0x44, 0x22, 0x11, 0x08, 0x84, 0x00, 0x76,
+    0x63, 0x1A, 0xC6, 0x39, 0x70, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x78, 0x74, 0xC2, 0x11, 0x11, 0x98,
+    0xF8, 0x74, 0x42, 0x37, 0x04, 0x31, 0x70, 0x10, 0xC3, 0x14, 0x92, 0x4F, 0xC4, 0x10, 0xFC, 0x21,
+    0xE1, 0x84, 0x33, 0x70, 0x76, 0x61, 0x6C, 0xC6, 0x39, 0x70, 0xF8, 0x46, 0x21, 0x10, 0x84, 0x40,
+    0x76, 0x63, 0x97, 0x46, 0x31, 0x70, 0x74, 0x63, 0x18, 0xBC, 0x23, 0x70, 0xCC, 0xCE, 0x0C, 0xEC,
+    0x30, 0x38, 0x30, 0xFC, 0x0F, 0xC0, 0x83, 0x06, 0x36, 0x40, 0xE1, 0x12, 0x44, 0x04, 0x40, 0x3C,
+    0xC9, 0x0C, 0xF9, 0x32, 0x67, 0xA0, 0x60, 0x38, 0x10, 0x70, 0xA1, 0x42, 0xC8, 0x9F, 0x23, 0xC2,
+    0xF2, 0x28, 0xA2, 0xF2, 0x28, 0xE2, 0xF8, 0x3A, 0x21, 0x08, 0x42, 0x08, 0x38, 0xF4, 0xE3, 0x18,
+    0xC6, 0x33, 0xF0, 0xFC, 0x21, 0x0F, 0xC2, 0x10, 0xF8, 0xFF, 0x0C, 0x30, 0xFB, 0x0C, 0x30, 0xC0,
+    0x7E, 0x21, 0x09, 0xC6, 0x39, 0x78, 0x8C, 0x63, 0x1F, 0xC6, 0x31, 0x88, 0xF9, 0x08, 0x42, 0x10,
+    0x84, 0xF8, 0x78, 0xC6, 0x31, 0x8C, 0x62, 0xF0, 0x8E, 0x6B, 0x38, 0xE2, 0x49, 0xA2, 0x8C, 0x82,
+    0x08, 0x20, 0x82, 0x08, 0x20, 0xFC, 0xC7, 0xCF, 0xBF, 0x5D, 0xBA, 0x70, 0xE1, 0xC2, 0xCE, 0x73,
+    0x5A, 0xCE, 0x73, 0x88, 0x73, 0x28, 0xA2, 0x8E, 0x28, 0xB2, 0x70, 0xFA, 0x28, 0xE2, 0xFA, 0x08,
+    0x20, 0x80, 0x73, 0x28, 0xA2, 0x8E, 0x28, 0xB2, 0x70, 0x60, 0x80, 0xF2, 0x28, 0xA2, 0xF2, 0x68,
+    0xA3, 0x84, 0x74, 0x61, 0x87, 0x04, 0x31, 0x70, 0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10,
+    0x8C, 0x63, 0x18, 0xC6, 0x31, 0x70, 0xC2, 0x89, 0x12, 0x22, 0x45, 0x0A, 0x1C, 0x10, 0x83, 0x06,
+    0x4A, 0xD4, 0xAD, 0x9B, 0x36, 0x64, 0x46, 0xC8, 0xA0, 0xC1, 0x87, 0x0B, 0x22, 0xC2, 0xC6, 0x88,
+    0xB1, 0xC1, 0x02, 0x04, 0x08, 0x10, 0xFC, 0x21, 0x84, 0x20, 0x84, 0x20, 0xFC, 0xEA, 0xAA, 0xAC,
+    0x84, 0x10, 0x82, 0x10, 0x42, 0x08, 0x40, 0xED, 0xB6, 0xDB, 0x6F, 0x80, 0x32, 0xA2, 0xFE, 0x90,
+    0xF0, 0x42, 0xF8, 0xC5, 0xA0, 0x84, 0x21, 0x6C, 0xC6, 0x31, 0xCF, 0x80, 0x3A, 0x21, 0x08, 0x20,
+    0xE0, 0x08, 0x42, 0xF9, 0xC6, 0x31, 0x9B, 0x40, 0x73, 0x28, 0xBF, 0x83, 0x27, 0x00, 0x19, 0x09,
+    0xF2, 0x10, 0x84, 0x21, 0x00, 0x7C, 0xE3, 0x18, 0xCD, 0xA1, 0x1B, 0x80, 0x84, 0x21, 0x6C, 0xC6,
+    0x31, 0x8C, 0x40, 0x20, 0x01, 0xC2, 0x10, 0x84, 0x27, 0xC0, 0x10, 0x07, 0x11, 0x11, 0x11, 0x32,
+    0xE0, 0xC3, 0x0C, 0x32, 0xD3, 0x8F, 0x34, 0xCB, 0x30, 0xE1, 0x08, 0x42, 0x10, 0x84, 0x21, 0xC0,
+    0xFA, 0x9A, 0x69, 0xA6, 0x9A, 0x40, 0xB6, 0x63, 0x18, 0xC6, 0x20, 0x76, 0x63, 0x18, 0xE5, 0xC0,
+    0xF6, 0x63, 0x18, 0xE7, 0xD0, 0x84, 0x00, 0x7E, 0xE3, 0x18, 0xED, 0xE1, 0x08, 0x40, 0xFE, 0x21,
+    0x08, 0x42, 0x00, 0x76, 0x70, 0xE0, 0xC5, 0xC0, 0x21, 0x3E, 0x42, 0x10, 0x84, 0x38, 0x8C, 0x63,
+    0x18, 0xE5, 0xA0, 0x8C, 0x72, 0xA5, 0x38, 0x80, 0x83, 0x05, 0x4A, 0xA6, 0xCD, 0x99, 0x00, 0x8A,
+    0x9C, 0x47, 0x26, 0x20, 0x8E, 0x2C, 0x96, 0x50, 0xC2, 0x08, 0x23, 0x00, 0xF8, 0x44, 0x44, 0x23,
+    0xE0, 0x19, 0x08, 0x42, 0x70, 0x84, 0x21, 0x06, 0xFF, 0xF0, 0xE1, 0x08, 0x42, 0x0C, 0x84, 0x21,
+    0x38, 0xE0, 0xC0,
+};
+
+constexpr ESP32S3BoxLiteGlyph kFontDejaVuSansMono12Glyphs[] = {
+    {    0,   0,   0,   7,   0,   0},  // ' '
+    {    0,   1,   9,   7,   3,   3},  // !
+    {    2,   3,   3,   7,   2,   3},  // "
+    {    4,   7,   8,   7,   0,   4},  // #
+    {   11,   5,  11,   7,   1,   3},  // $
+    {   18,   7,   9,   7,   0,   3},  // %
+    {   26,   7,   9,   7,   0,   3},  // &
+    {   34,   1,   3,   7,   3,   3},  // '
+    {   35,   2,  11,   7,   3,   2},  // (
+    {   38,   3,  11,   7,   2,   2},  // )
+    {   43,   5,   6,   7,   1,   3},  // *
+    {   47,   6,   7,   7,   1,   5},  // +
+    {   53,   1,   3,   7,   3,  10},  // ,
+    {   54,   3,   1,   7,   2,   8},  // -
+    {   55,   1,   2,   7,   3,  10},  // .
+    {   56,   5,  10,   7,   1,   3},  // /
+    {   63,   5,   9,   7,   1,   3},  // 0
+    {   69,   5,   9,   7,   1,   3},  // 1
+    {   75,   5,   9,   7,   1,   3},  // 2
+    {   81,   5,   9,   7,   1,   3},  // 3
+    {   87,   6,   9,   7,   1,   3},  // 4
+    {   94,   5,   9,   7,   1,   3},  // 5
+    {  100,   5,   9,   7,   1,   3},  // 6
+    {  106,   5,   9,   7,   1,   3},  // 7
+    {  112,   5,   9,   7,   1,   3},  // 8
+    {  118,   5,   9,   7,   1,   3},  // 9
+    {  124,   1,   6,   7,   3,   6},  // :
+    {  125,   1,   7,   7,   3,   6},  // ;
+    {  126,   6,   6,   7,   1,   5},  // <
+    {  131,   6,   3,   7,   1,   7},  // =
+    {  134,   5,   6,   7,   1,   5},  // >
+    {  138,   4,   9,   7,   2,   3},  // ?
+    {  143,   7,  10,   7,   0,   4},  // @
+    {  152,   7,   9,   7,   0,   3},  // A
+    {  160,   6,   9,   7,   1,   3},  // B
+    {  167,   5,   9,   7,   1,   3},  // C
+    {  173,   5,   9,   7,   1,   3},  // D
+    {  179,   5,   9,   7,   1,   3},  // E
+    {  185,   6,   9,   7,   1,   3},  // F
+    {  192,   5,   9,   7,   1,   3},  // G
+    {  198,   5,   9,   7,   1,   3},  // H
+    {  204,   5,   9,   7,   1,   3},  // I
+    {  210,   5,   9,   7,   1,   3},  // J
+    {  216,   6,   9,   7,   1,   3},  // K
+    {  223,   6,   9,   7,   1,   3},  // L
+    {  230,   7,   9,   7,   0,   3},  // M
+    {  238,   5,   9,   7,   1,   3},  // N
+    {  244,   6,   9,   7,   1,   3},  // O
+    {  251,   6,   9,   7,   1,   3},  // P
+    {  258,   6,  11,   7,   1,   3},  // Q
+    {  267,   6,   9,   7,   1,   3},  // R
+    {  274,   5,   9,   7,   1,   3},  // S
+    {  280,   7,   9,   7,   0,   3},  // T
+    {  288,   5,   9,   7,   1,   3},  // U
+    {  294,   7,   9,   7,   0,   3},  // V
+    {  302,   7,   9,   7,   0,   3},  // W
+    {  310,   7,   9,   7,   0,   3},  // X
+    {  318,   7,   9,   7,   0,   3},  // Y
+    {  326,   6,   9,   7,   1,   3},  // Z
+    {  333,   2,  11,   7,   3,   2},  // [
+    {  336,   5,  10,   7,   1,   3},  // backslash
+    {  343,   3,  11,   7,   2,   2},  // ]
+    {  348,   5,   3,   7,   1,   3},  // ^
+    {  350,   7,   1,   7,   0,  14},  // _
+    {  351,   2,   2,   7,   2,   2},  // `
+    {  352,   5,   7,   7,   1,   5},  // a
+    {  357,   5,  10,   7,   1,   2},  // b
+    {  364,   5,   7,   7,   1,   5},  // c
+    {  369,   5,  10,   7,   1,   2},  // d
+    {  376,   6,   7,   7,   1,   5},  // e
+    {  382,   5,  10,   7,   1,   2},  // f
+    {  389,   5,  10,   7,   1,   5},  // g
+    {  396,   5,  10,   7,   1,   2},  // h
+    {  403,   5,  10,   7,   1,   2},  // i
+    {  410,   4,  13,   7,   1,   2},  // j
+    {  417,   6,  10,   7,   1,   2},  // k
+    {  425,   5,  10,   7,   1,   2},  // l
+    {  432,   6,   7,   7,   1,   5},  // m
+    {  438,   5,   7,   7,   1,   5},  // n
+    {  443,   5,   7,   7,   1,   5},  // o
+    {  448,   5,  10,   7,   1,   5},  // p
+    {  455,   5,  10,   7,   1,   5},  // q
+    {  462,   5,   7,   7,   2,   5},  // r
+    {  467,   5,   7,   7,   1,   5},  // s
+    {  472,   5,   9,   7,   1,   3},  // t
+    {  478,   5,   7,   7,   1,   5},  // u
+    {  483,   5,   7,   7,   1,   5},  // v
+    {  488,   7,   7,   7,   0,   5},  // w
+    {  495,   5,   7,   7,   1,   5},  // x
+    {  500,   6,  10,   7,   1,   5},  // y
+    {  508,   5,   7,   7,   1,   5},  // z
+    {  513,   5,  11,   7,   1,   2},  // {
+    {  520,   1,  12,   7,   3,   2},  // |
+    {  522,   5,  11,   7,   1,   2},  // }
+    {  529,   5,   2,   7,   1,   7},  // ~
+};
+
+constexpr ESP32S3BoxLiteFont FontDejaVuSansMono12 = {
+    kFontDejaVuSansMono12Bitmap,
+    kFontDejaVuSansMono12Glyphs,
+    nullptr,
+    0,  // kerning pairs
+    0x20, 0x7E,  // first, last
+    1,  // bpp
+    15,  // line height
+    12,  // baseline
+};
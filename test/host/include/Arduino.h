@@ -0,0 +1,54 @@
+// Host stand-in for the Arduino core: only what ESP32S3BoxLite and the
+// examples use. See host_fakes.h for the knobs the tests turn.
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define ADC_11db 3
+#define IRAM_ATTR
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+int digitalRead(int pin);
+void delay(uint32_t ms);
+uint32_t millis();
+uint32_t micros();
+void analogReadResolution(int bits);
+void analogSetPinAttenuation(int pin, int attenuation);
+uint32_t analogReadMilliVolts(int pin);
+bool ledcSetup(int channel, int freq, int bits);
+void ledcAttachPin(int pin, int channel);
+void ledcWrite(int channel, int duty);
+uint32_t getCpuFrequencyMhz();
+
+class Print {
+ public:
+  size_t write(const uint8_t *data, size_t len);
+  size_t print(const char *text);
+  size_t println(const char *text = "");
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+};
+
+// Writes to stdout
+extern HardwareSerial Serial;
@@ -0,0 +1,30 @@
+// Host stand-in for the Arduino FS API. There is no file system: every open
+// fails.
+#pragma once
+
+#include <Arduino.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+
+namespace fs {
+
+enum SeekMode { SeekSet, SeekCur, SeekEnd };
+
+class File : public Stream {
+ public:
+  size_t write(const uint8_t *data, size_t len);
+  size_t read(uint8_t *buf, size_t len);
+  size_t size() const;
+  size_t position() const;
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  void close();
+  operator bool() const;
+};
+
+class FS {
+ public:
+  File open(const char *path, const char *mode = FILE_READ, bool create = false);
+};
+
+}  // namespace fs
@@ -0,0 +1,13 @@
+// Host stand-in for SPIFFS; begin() fails
+#pragma once
+
+#include <FS.h>
+
+using fs::File;
+
+class SPIFFSFS : public fs::FS {
+ public:
+  bool begin(bool formatOnFail = false);
+};
+
+extern SPIFFSFS SPIFFS;
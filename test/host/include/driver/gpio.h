@@ -0,0 +1,16 @@
+// Host stand-in for driver/gpio.h. Levels are remembered per pin, see
+// host::gpioLevel().
+#pragma once
+
+#include <cstdint>
+
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+#define GPIO_NUM_NC -1
+#define GPIO_PULLUP_ENABLE 1
+#define GPIO_INTR_LOW_LEVEL 4
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level);
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, int type);
@@ -0,0 +1,37 @@
+// Host stand-in for driver/i2c.h; there are no devices, so every command
+// fails
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "driver/gpio.h"
+#include "esp_err.h"
+
+typedef int i2c_port_t;
+typedef void *i2c_cmd_handle_t;
+
+#define I2C_NUM_0 0
+#define I2C_MODE_MASTER 1
+#define I2C_MASTER_LAST_NACK 2
+
+struct i2c_config_t {
+  int mode;
+  gpio_num_t sda_io_num;
+  gpio_num_t scl_io_num;
+  int sda_pullup_en;
+  int scl_pullup_en;
+  struct {
+    uint32_t clk_speed;
+  } master;
+};
+
+esp_err_t i2c_param_config(i2c_port_t port, const i2c_config_t *config);
+esp_err_t i2c_driver_install(i2c_port_t port, int mode, size_t rxBuf, size_t txBuf, int flags);
+i2c_cmd_handle_t i2c_cmd_link_create();
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ackCheck);
+esp_err_t i2c_master_read_byte(i2c_cmd_handle_t cmd, uint8_t *data, int ack);
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, int ticks);
@@ -0,0 +1,46 @@
+// Host stand-in for driver/i2s.h; the driver never installs
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "driver/gpio.h"
+#include "esp_err.h"
+
+typedef int i2s_port_t;
+typedef int i2s_mode_t;
+
+#define I2S_NUM_0 0
+#define I2S_MODE_MASTER 1
+#define I2S_MODE_TX 4
+#define I2S_MODE_RX 8
+#define I2S_BITS_PER_SAMPLE_16BIT 16
+#define I2S_CHANNEL_FMT_ONLY_LEFT 3
+#define I2S_COMM_FORMAT_STAND_I2S 1
+#define I2S_CHANNEL_MONO 1
+
+struct i2s_config_t {
+  i2s_mode_t mode;
+  uint32_t sample_rate;
+  int bits_per_sample;
+  int channel_format;
+  int communication_format;
+  int intr_alloc_flags;
+  int dma_buf_count;
+  int dma_buf_len;
+  bool use_apll;
+  bool tx_desc_auto_clear;
+  int fixed_mclk;
+};
+
+struct i2s_pin_config_t {
+  int mck_io_num, bck_io_num, ws_io_num, data_out_num, data_in_num;
+};
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_config_t *config, int queueSize, void *queue);
+esp_err_t i2s_driver_uninstall(i2s_port_t port);
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t *pins);
+esp_err_t i2s_zero_dma_buffer(i2s_port_t port);
+esp_err_t i2s_read(i2s_port_t port, void *dst, size_t size, size_t *bytesRead, uint32_t ticks);
+esp_err_t i2s_write(i2s_port_t port, const void *src, size_t size, size_t *bytesWritten, uint32_t ticks);
+esp_err_t i2s_set_sample_rates(i2s_port_t port, uint32_t rate);
@@ -0,0 +1,22 @@
+// Host stand-in for esp_system.h
+#pragma once
+
+#include "esp_err.h"
+
+typedef int esp_reset_reason_t;
+
+enum {
+  ESP_RST_UNKNOWN,
+  ESP_RST_POWERON,
+  ESP_RST_EXT,
+  ESP_RST_SW,
+  ESP_RST_PANIC,
+  ESP_RST_INT_WDT,
+  ESP_RST_TASK_WDT,
+  ESP_RST_WDT,
+  ESP_RST_DEEPSLEEP,
+  ESP_RST_BROWNOUT,
+  ESP_RST_SDIO,
+};
+
+esp_reset_reason_t esp_reset_reason();
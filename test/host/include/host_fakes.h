@@ -0,0 +1,35 @@
+// Inspection API for the host stand-ins. Tests call host::reset() in setUp()
+// and read back what the library did to the (fake) hardware.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace host {
+
+// One SPI transaction as it went out on the wire
+struct SpiTransaction {
+  bool dc;                     // D/C level the pre-transfer callback set
+  bool inlineData;             // SPI_TRANS_USE_TXDATA
+  const void *buffer;          // tx_buffer, nullptr when inline
+  std::vector<uint8_t> bytes;  // payload as queued
+};
+
+// Forgets all SPI traffic and pin levels; memory counts as DMA capable again
+void reset();
+
+// Transactions in the order they completed
+const std::vector<SpiTransaction> &spiWire();
+void clearSpiWire();
+// Queued but not yet collected by spi_device_get_trans_result()
+size_t spiInFlight();
+size_t spiMaxInFlight();
+// Times the driver saw a transaction queued twice, a full queue, or a
+// payload that changed between queueing and completion
+size_t spiViolations();
+
+int gpioLevel(int pin);
+void setDmaCapable(bool capable);
+
+}  // namespace host
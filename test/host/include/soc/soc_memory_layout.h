@@ -0,0 +1,6 @@
+// Host stand-in for soc/soc_memory_layout.h. Whether memory counts as DMA
+// capable is set by host::setDmaCapable().
+#pragma once
+
+bool esp_ptr_dma_capable(const void *ptr);
+bool esp_ptr_external_ram(const void *ptr);
@@ -0,0 +1,4 @@
+# Links the sanitizer runtimes requested in platformio.ini build_flags
+Import("env")
+
+env.Append(LINKFLAGS=["-fsanitize=address,undefined"])
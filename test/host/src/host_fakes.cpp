@@ -0,0 +1,234 @@
+// Host stand-ins for the Arduino core and the ESP-IDF drivers ESP32S3BoxLite
+// links against. Everything that talks to hardware reports failure except the
+// SPI master, which records traffic for the tests; see host_fakes.h.
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <driver/gpio.h>
+#include <driver/i2c.h>
+#include <driver/i2s.h>
+#include <driver/spi_master.h>
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include <nvs.h>
+#include <nvs_flash.h>
+#include <soc/soc_memory_layout.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <deque>
+#include <map>
+
+#include "host_fakes.h"
+
+namespace {
+
+struct Pending {
+  spi_transaction_t *trans;
+  std::vector<uint8_t> bytes;
+};
+
+struct SpiState {
+  spi_device_interface_config_t config = {};
+  bool added = false;
+  std::deque<Pending> queue;
+  std::vector<host::SpiTransaction> wire;
+  size_t maxInFlight = 0;
+  size_t violations = 0;
+};
+
+SpiState spi;
+std::map<int, int> levels;
+bool dmaCapable = true;
+
+const uint8_t *payload(const spi_transaction_t *t) {
+  return (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : static_cast<const uint8_t *>(t->tx_buffer);
+}
+
+std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+}  // namespace
+
+namespace host {
+
+void reset() {
+  spi.queue.clear();
+  spi.wire.clear();
+  spi.maxInFlight = 0;
+  spi.violations = 0;
+  levels.clear();
+  dmaCapable = true;
+}
+
+const std::vector<SpiTransaction> &spiWire() { return spi.wire; }
+void clearSpiWire() { spi.wire.clear(); }
+size_t spiInFlight() { return spi.queue.size(); }
+size_t spiMaxInFlight() { return spi.maxInFlight; }
+size_t spiViolations() { return spi.violations; }
+
+int gpioLevel(int pin) {
+  auto it = levels.find(pin);
+  return it == levels.end() ? -1 : it->second;
+}
+
+void setDmaCapable(bool capable) { dmaCapable = capable; }
+
+}  // namespace host
+
+// ---- SPI master ------------------------------------------------------------
+
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t *, int) { return ESP_OK; }
+
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle) {
+  spi.config = *config;
+  spi.added = true;
+  *handle = reinterpret_cast<spi_device_handle_t>(&spi);
+  return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t, spi_transaction_t *trans, uint32_t) {
+  for (const Pending &p : spi.queue) {
+    if (p.trans == trans) ++spi.violations;
+  }
+  if (spi.queue.size() >= static_cast<size_t>(spi.config.queue_size)) ++spi.violations;
+  const uint8_t *src = payload(trans);
+  size_t len = (trans->length + 7) / 8;
+  spi.queue.push_back({trans, std::vector<uint8_t>(src, src + len)});
+  if (spi.queue.size() > spi.maxInFlight) spi.maxInFlight = spi.queue.size();
+  return ESP_OK;
+}
+
+// Completes the oldest transaction: the pre-transfer callback runs and the
+// payload goes out now, so a buffer reused before this point is caught
+esp_err_t spi_device_get_trans_result(spi_device_handle_t, spi_transaction_t **trans, uint32_t) {
+  if (spi.queue.empty()) return ESP_ERR_TIMEOUT;
+  Pending p = std::move(spi.queue.front());
+  spi.queue.pop_front();
+  spi_transaction_t *t = p.trans;
+  if (spi.config.pre_cb) spi.config.pre_cb(t);
+  bool inlineData = t->flags & SPI_TRANS_USE_TXDATA;
+  if (memcmp(payload(t), p.bytes.data(), p.bytes.size()) != 0) ++spi.violations;
+  spi.wire.push_back({host::gpioLevel(4) == 1, inlineData, inlineData ? nullptr : t->tx_buffer,
+                      std::move(p.bytes)});
+  *trans = t;
+  return ESP_OK;
+}
+
+// ---- GPIO, memory ----------------------------------------------------------
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) {
+  levels[pin] = level ? 1 : 0;
+  return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t, int) { return ESP_OK; }
+
+bool esp_ptr_dma_capable(const void *) { return dmaCapable; }
+bool esp_ptr_external_ram(const void *) { return false; }
+
+void *heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+void heap_caps_free(void *ptr) { free(ptr); }
+size_t heap_caps_get_free_size(uint32_t) { return 256 * 1024; }
+bool esp_spiram_is_initialized() { return false; }
+
+// ---- Arduino core ----------------------------------------------------------
+
+HardwareSerial Serial;
+
+size_t Print::write(const uint8_t *data, size_t len) { return fwrite(data, 1, len, stdout); }
+size_t Print::print(const char *text) { return fputs(text, stdout) < 0 ? 0 : strlen(text); }
+size_t Print::println(const char *text) { return print(text) + print("\n"); }
+
+size_t Print::printf(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vprintf(fmt, args);
+  va_end(args);
+  return n < 0 ? 0 : n;
+}
+
+void pinMode(int, int) {}
+void digitalWrite(int pin, int level) { levels[pin] = level ? 1 : 0; }
+int digitalRead(int pin) { return host::gpioLevel(pin) == 0 ? LOW : HIGH; }
+void delay(uint32_t) {}
+
+uint32_t micros() {
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+uint32_t millis() { return micros() / 1000; }
+void analogReadResolution(int) {}
+void analogSetPinAttenuation(int, int) {}
+uint32_t analogReadMilliVolts(int) { return 0; }
+bool ledcSetup(int, int, int) { return true; }
+void ledcAttachPin(int, int) {}
+void ledcWrite(int, int) {}
+uint32_t getCpuFrequencyMhz() { return 240; }
+
+// ---- File system -----------------------------------------------------------
+
+SPIFFSFS SPIFFS;
+
+bool SPIFFSFS::begin(bool) { return false; }
+fs::File fs::FS::open(const char *, const char *, bool) { return File(); }
+size_t fs::File::write(const uint8_t *, size_t) { return 0; }
+size_t fs::File::read(uint8_t *, size_t) { return 0; }
+size_t fs::File::size() const { return 0; }
+size_t fs::File::position() const { return 0; }
+bool fs::File::seek(uint32_t, SeekMode) { return false; }
+void fs::File::close() {}
+fs::File::operator bool() const { return false; }
+
+// ---- I2C, I2S --------------------------------------------------------------
+
+esp_err_t i2c_param_config(i2c_port_t, const i2c_config_t *) { return ESP_OK; }
+esp_err_t i2c_driver_install(i2c_port_t, int, size_t, size_t, int) { return ESP_OK; }
+i2c_cmd_handle_t i2c_cmd_link_create() { return &spi; }
+void i2c_cmd_link_delete(i2c_cmd_handle_t) {}
+esp_err_t i2c_master_start(i2c_cmd_handle_t) { return ESP_OK; }
+esp_err_t i2c_master_stop(i2c_cmd_handle_t) { return ESP_OK; }
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t, uint8_t, bool) { return ESP_OK; }
+esp_err_t i2c_master_read_byte(i2c_cmd_handle_t, uint8_t *data, int) {
+  *data = 0;
+  return ESP_OK;
+}
+esp_err_t i2c_master_cmd_begin(i2c_port_t, i2c_cmd_handle_t, int) { return ESP_FAIL; }
+
+esp_err_t i2s_driver_install(i2s_port_t, const i2s_config_t *, int, void *) { return ESP_FAIL; }
+esp_err_t i2s_driver_uninstall(i2s_port_t) { return ESP_OK; }
+esp_err_t i2s_set_pin(i2s_port_t, const i2s_pin_config_t *) { return ESP_OK; }
+esp_err_t i2s_zero_dma_buffer(i2s_port_t) { return ESP_OK; }
+esp_err_t i2s_set_sample_rates(i2s_port_t, uint32_t) { return ESP_OK; }
+
+esp_err_t i2s_read(i2s_port_t, void *, size_t, size_t *bytesRead, uint32_t) {
+  *bytesRead = 0;
+  return ESP_FAIL;
+}
+
+esp_err_t i2s_write(i2s_port_t, const void *, size_t, size_t *bytesWritten, uint32_t) {
+  *bytesWritten = 0;
+  return ESP_FAIL;
+}
+
+// ---- NVS, sleep, reset -----------------------------------------------------
+
+esp_err_t nvs_flash_init() { return ESP_OK; }
+esp_err_t nvs_flash_erase() { return ESP_OK; }
+esp_err_t nvs_open(const char *, int, nvs_handle_t *handle) {
+  *handle = 1;
+  return ESP_OK;
+}
+void nvs_close(nvs_handle_t) {}
+esp_err_t nvs_commit(nvs_handle_t) { return ESP_OK; }
+esp_err_t nvs_set_i32(nvs_handle_t, const char *, int32_t) { return ESP_OK; }
+esp_err_t nvs_get_i32(nvs_handle_t, const char *, int32_t *) { return ESP_FAIL; }
+esp_err_t nvs_set_str(nvs_handle_t, const char *, const char *) { return ESP_OK; }
+esp_err_t nvs_get_str(nvs_handle_t, const char *, char *, size_t *) { return ESP_FAIL; }
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) { return ESP_OK; }
+esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+esp_err_t esp_light_sleep_start() { return ESP_OK; }
+void esp_deep_sleep_start() {}
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return ESP_SLEEP_WAKEUP_UNDEFINED; }
+esp_reset_reason_t esp_reset_reason() { return ESP_RST_POWERON; }
@@ -0,0 +1,101 @@
+// Runs the DisplayBenchmark workload table on ESP32S3BoxLiteRecordingBus and
+// prints bytes and transactions per workload. Times are not measured; the
+// counts are what the panel bus would see.
+#include <host_fakes.h>
+#include <unity.h>
+
+#include "../../examples/DisplayBenchmark/BenchWorkloads.h"
+
+namespace {
+
+ESP32S3BoxLiteRecordingBus recorder;
+
+struct Measured {
+  ESP32S3BoxLiteBusStats stats;
+  uint32_t imageHash;
+  bool ran;
+};
+
+Measured measured[kWorkloadCount];
+
+const Measured &result(const char *id) {
+  for (size_t i = 0; i < kWorkloadCount; ++i) {
+    if (strcmp(kWorkloads[i].id, id) == 0) { return measured[i]; }
+  }
+  TEST_FAIL_MESSAGE(id);
+  return measured[0];
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+// Same sequence as runSuite() in the sketch
+void test_run_workloads() {
+  auto &d = box.display();
+  printf("%-24s %7s %7s %6s %9s %9s\n", "workload", "tx", "cs", "win", "bytes", "image");
+  for (size_t i = 0; i < kWorkloadCount; ++i) {
+    const Workload &w = kWorkloads[i];
+    Measured &m = measured[i];
+    m.ran = w.needs == nullptr || w.needs->width() > 0;
+    TEST_ASSERT_TRUE_MESSAGE(m.ran, w.name);
+
+    d.fillScreen(kBlack);
+    if (w.prepare != nullptr) {
+      w.prepare();
+    }
+    d.waitIdle();
+    d.resetBusStats();
+    w.run();
+    d.waitIdle();
+    m.stats     = d.busStats();
+    m.imageHash = recorder.imageHash();
+    printf("%-24s %7lu %7lu %6lu %9lu  %08lx\n", w.name, (unsigned long)m.stats.transactions,
+           (unsigned long)m.stats.csToggles, (unsigned long)m.stats.windows, (unsigned long)m.stats.bytes,
+           (unsigned long)m.imageHash);
+  }
+}
+
+void test_cpu_only_workloads_send_nothing() {
+  for (const char *id : {"spdraw", "cvt888", "cvtbgr", "cvtargb", "cvtgray", "cvtord", "cvtfs"}) {
+    TEST_ASSERT_EQUAL_MESSAGE(0, result(id).stats.bytes, id);
+  }
+}
+
+void test_drawing_workloads_reach_the_panel() {
+  for (size_t i = 0; i < kWorkloadCount; ++i) {
+    const char *id = kWorkloads[i].id;
+    if (strcmp(id, "spdraw") == 0 || strncmp(id, "cvt", 3) == 0) { continue; }
+    TEST_ASSERT_TRUE_MESSAGE(measured[i].stats.bytes > 0, id);
+    TEST_ASSERT_TRUE_MESSAGE(measured[i].stats.transactions > 0, id);
+  }
+}
+
+// Each pair draws the same thing two ways; the second must send less
+void test_incremental_paths_send_fewer_bytes() {
+  TEST_ASSERT_LESS_THAN(result("boot").stats.bytes, result("bootdl").stats.bytes);
+  TEST_ASSERT_LESS_THAN(result("page").stats.bytes, result("pagedl").stats.bytes);
+  TEST_ASSERT_LESS_THAN(result("counter").stats.bytes, result("label").stats.bytes);
+  TEST_ASSERT_LESS_THAN(result("progbar").stats.bytes, result("uiprog").stats.bytes);
+  TEST_ASSERT_LESS_THAN(result("text4").stats.bytes, result("font24").stats.bytes);
+}
+
+void test_display_list_keeps_the_image() {
+  TEST_ASSERT_EQUAL_HEX32(result("boot").imageHash, result("bootdl").imageHash);
+  TEST_ASSERT_EQUAL_HEX32(result("page").imageHash, result("pagedl").imageHash);
+}
+
+int main() {
+  box.display().setBus(&recorder);
+  box.begin(true, true, false);
+  setupWorkloads();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_run_workloads);
+  RUN_TEST(test_cpu_only_workloads_send_nothing);
+  RUN_TEST(test_drawing_workloads_reach_the_panel);
+  RUN_TEST(test_incremental_paths_send_fewer_bytes);
+  RUN_TEST(test_display_list_keeps_the_image);
+  return UNITY_END();
+}
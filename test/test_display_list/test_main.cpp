@@ -0,0 +1,222 @@
+// ESP32S3BoxLiteDisplayList::optimize: a recorded frame, optimized and sent
+// with drawList(), must leave the same picture as drawing it directly, must
+// not cost more bytes than the list as recorded, and must drop what later
+// drawing paints over.
+#include <ESP32S3BoxLite.h>
+#include <host_fakes.h>
+#include <unity.h>
+
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+constexpr int16_t kWidth  = ESP32S3BoxLiteRecordingBus::Width;
+constexpr int16_t kHeight = ESP32S3BoxLiteRecordingBus::Height;
+constexpr uint16_t kBackground = 0x0000;
+// CASET or RASET with its four parameter bytes; a window takes both, then
+// one RAMWR byte before the pixels
+constexpr uint32_t kCommandBytes = 5;
+constexpr uint32_t kWindowBytes  = 2 * kCommandBytes;
+constexpr uint32_t kScreenBytes  = kWindowBytes + 1 + static_cast<uint32_t>(kWidth) * kHeight * 2;
+
+ESP32S3BoxLiteRecordingBus recorder;
+ESP32S3BoxLiteDisplay display;
+ESP32S3BoxLiteDisplayList list;
+// Sprites have no destructor; created once in main()
+ESP32S3BoxLiteSprite sprite;
+
+struct Replayed {
+  uint16_t opsRecorded;
+  uint16_t opsOptimized;
+  uint32_t wireRecorded;
+  uint32_t wireOptimized;
+};
+
+std::vector<uint16_t> snapshot() {
+  return std::vector<uint16_t>(recorder.image(), recorder.image() + kWidth * kHeight);
+}
+
+// Draws `frame` directly, then records it, optimizes the list and replays
+// it over the same background, checking the picture and the byte estimate
+Replayed replay(void (*frame)()) {
+  display.fillScreen(kBackground);
+  frame();
+  const std::vector<uint16_t> expected = snapshot();
+
+  display.fillScreen(kBackground);
+  list.clear();
+  TEST_ASSERT_TRUE(display.beginRecording(list));
+  frame();
+  display.endRecording();
+
+  Replayed r;
+  r.opsRecorded  = list.size();
+  r.wireRecorded = list.wireBytes();
+  list.optimize();
+  r.opsOptimized  = list.size();
+  r.wireOptimized = list.wireBytes();
+
+  display.resetBusStats();
+  display.drawList(list);
+  const uint64_t sent = display.busStats().bytes;
+  TEST_ASSERT_TRUE(sent <= r.wireOptimized);
+  TEST_ASSERT_TRUE(sent + kWindowBytes >= r.wireOptimized);
+  TEST_ASSERT_EQUAL_UINT16_ARRAY(expected.data(), recorder.image(), kWidth * kHeight);
+  return r;
+}
+
+void bootFrame() {
+  display.fillScreen(kBackground);
+  display.showBootScreen("ESP32-S3-BOX-Lite", "v1.0.0");
+  display.drawStatusBar("BOOT", "12:34", 0x001F);
+}
+
+void pageFrame() {
+  display.fillScreen(0x18E3);
+  display.drawStatusBar("MENU", "12:34", 0x001F);
+  for (int16_t i = 0; i < 5; ++i) {
+    const int16_t y = 24 + i * 40;
+    display.fillRoundRect(8, y, 304, 34, 6, i == 2 ? 0x04FF : 0x3186);
+    display.drawText(20, y + 10, "Menu item", 2, 0xFFFF, i == 2 ? 0x04FF : 0x3186);
+    display.drawProgressBar(200, y + 12, 100, 10, static_cast<uint8_t>(i * 25), 0x07E0, 0x0000);
+  }
+}
+
+void overdrawnFrame() {
+  display.fillRect(10, 10, 100, 60, 0xF800);
+  display.drawText(30, 100, "Hidden", 3, 0xFFFF, 0x0000);
+  sprite.pushSprite(display, 150, 120);
+  display.fillCircle(200, 60, 40, 0x07E0);
+  display.fillScreen(0x001F);
+}
+
+void coveredRectsFrame() {
+  display.fillRect(40, 40, 20, 20, 0xF800);
+  sprite.pushSprite(display, 60, 50);
+  display.fillRect(90, 30, 10, 10, 0x07E0);
+  display.fillRect(20, 20, 120, 80, 0x001F);
+}
+
+unsigned frameSeed = 0;
+
+int16_t pick(int16_t lo, int16_t hi) {
+  return static_cast<int16_t>(lo + rand() % (hi - lo + 1));
+}
+
+// Reseeds on every call, so the direct and the recorded pass draw the same
+void randomFrame() {
+  srand(frameSeed);
+  const int ops = pick(1, 24);
+  for (int i = 0; i < ops; ++i) {
+    const int16_t x = pick(-40, 340), y = pick(-40, 260);
+    const int16_t w = pick(1, 200), h = pick(1, 160);
+    const uint16_t color = static_cast<uint16_t>(rand());
+    switch (rand() % 8) {
+      case 0: display.fillRect(x, y, w, h, color); break;
+      case 1: display.drawLine(x, y, x + w, y - h, color); break;
+      case 2: display.fillCircle(x, y, h / 2, color); break;
+      case 3: display.drawText(x, y, "List 42", 1 + h % 3, color, static_cast<uint16_t>(~color)); break;
+      case 4: sprite.pushSprite(display, x, y); break;
+      case 5: display.drawProgressBar(x, y, w, h / 8 + 1, static_cast<uint8_t>(w % 101), color, 0x0000); break;
+      case 6: display.fillRoundRect(x, y, w, h, h / 5, color); break;
+      default:
+        if (rand() % 4 == 0) { display.fillScreen(color); }
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {
+  list.clear();
+}
+
+void test_boot_and_page_frames_replay_exactly() {
+  // Both start with a full-screen fill that the rest mostly covers
+  const Replayed boot = replay(bootFrame);
+  TEST_ASSERT_TRUE(boot.wireOptimized < boot.wireRecorded);
+
+  const Replayed page = replay(pageFrame);
+  TEST_ASSERT_TRUE(page.wireOptimized < page.wireRecorded);
+}
+
+void test_random_frames_replay_exactly() {
+  for (frameSeed = 1; frameSeed <= 400; ++frameSeed) {
+    const Replayed r = replay(randomFrame);
+    TEST_ASSERT_TRUE(r.wireOptimized <= r.wireRecorded);
+  }
+}
+
+void test_full_screen_fill_drops_earlier_ops() {
+  const Replayed r = replay(overdrawnFrame);
+  TEST_ASSERT_TRUE(r.opsRecorded > 1);
+  TEST_ASSERT_EQUAL_UINT16(1, r.opsOptimized);
+  TEST_ASSERT_EQUAL_UINT32(kScreenBytes, r.wireOptimized);
+}
+
+void test_covered_rects_are_dropped() {
+  const Replayed r = replay(coveredRectsFrame);
+  // The red fill, the green fill and every row of the sprite
+  TEST_ASSERT_TRUE(r.opsRecorded > 3);
+  TEST_ASSERT_EQUAL_UINT16(1, r.opsOptimized);
+  TEST_ASSERT_EQUAL_UINT32(kWindowBytes + 1 + 120 * 80 * 2, r.wireOptimized);
+}
+
+void test_partly_covered_rect_is_trimmed() {
+  const Replayed r = replay([] {
+    display.fillRect(0, 0, 100, 10, 0xF800);
+    display.fillRect(50, 0, 50, 10, 0x07E0);
+  });
+  TEST_ASSERT_EQUAL_UINT16(2, r.opsOptimized);
+  // Same rows, so the second RASET is skipped
+  TEST_ASSERT_EQUAL_UINT32(kWindowBytes + kCommandBytes + 2 + 100 * 10 * 2, r.wireOptimized);
+}
+
+void test_trim_never_costs_a_shared_window() {
+  // Trimming the covered column saves two pixels but breaks the CASET the
+  // middle fill shares with the first
+  const Replayed r = replay([] {
+    display.fillRect(0, 5, 3, 1, 0xF800);
+    display.fillRect(0, 0, 3, 1, 0x07E0);
+    display.fillRect(2, 0, 1, 1, 0x001F);
+  });
+  TEST_ASSERT_TRUE(r.wireOptimized <= r.wireRecorded);
+}
+
+void test_optimize_is_idempotent() {
+  for (void (*frame)() : {bootFrame, pageFrame}) {
+    replay(frame);
+    const uint16_t ops   = list.size();
+    const uint32_t bytes = list.wireBytes();
+    list.optimize();
+    TEST_ASSERT_EQUAL_UINT16(ops, list.size());
+    TEST_ASSERT_EQUAL_UINT32(bytes, list.wireBytes());
+  }
+}
+
+int main() {
+  display.setBus(&recorder);
+  display.begin();
+  list.begin();
+  sprite.createSprite(48, 32);
+  for (int16_t y = 0; y < 32; ++y) {
+    for (int16_t x = 0; x < 48; ++x) {
+      sprite.drawPixel(x, y, static_cast<uint16_t>(x * 1013 + y * 77));
+    }
+  }
+
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_and_page_frames_replay_exactly);
+  RUN_TEST(test_random_frames_replay_exactly);
+  RUN_TEST(test_full_screen_fill_drops_earlier_ops);
+  RUN_TEST(test_covered_rects_are_dropped);
+  RUN_TEST(test_partly_covered_rect_is_trimmed);
+  RUN_TEST(test_trim_never_costs_a_shared_window);
+  RUN_TEST(test_optimize_is_idempotent);
+  sprite.deleteSprite();
+  return UNITY_END();
+}
@@ -0,0 +1,198 @@
+// Baseline JPEG decoder against damaged input: a Huffman table with more
+// codes than its lengths hold must be refused, and coefficients at the
+// limits of the format must decode without overflow. The streams are built
+// here, so every case is a few hundred bytes; the native build runs them
+// under AddressSanitizer and UndefinedBehaviorSanitizer.
+#include <ESP32S3BoxLite.h>
+#include <host_fakes.h>
+#include <unity.h>
+
+#include <vector>
+
+namespace {
+
+constexpr uint16_t kBackground = 0x0000;
+// Grey 128 in RGB565
+constexpr uint16_t kMidGrey = 0x8410;
+
+ESP32S3BoxLiteRecordingBus recorder;
+ESP32S3BoxLiteDisplay display;
+
+// Entropy-coded bits, MSB first, with 0xFF stuffing and 1-padding
+class BitWriter {
+ public:
+  void put(uint32_t value, int bits) {
+    for (int i = bits - 1; i >= 0; --i) {
+      acc_ = static_cast<uint8_t>((acc_ << 1) | ((value >> i) & 1));
+      if (++count_ == 8) { flushByte(); }
+    }
+  }
+  std::vector<uint8_t> finish() {
+    while (count_ != 0) { put(1, 1); }
+    return bytes_;
+  }
+
+ private:
+  void flushByte() {
+    bytes_.push_back(acc_);
+    if (acc_ == 0xFF) { bytes_.push_back(0x00); }
+    acc_   = 0;
+    count_ = 0;
+  }
+
+  std::vector<uint8_t> bytes_;
+  uint8_t acc_ = 0;
+  int count_ = 0;
+};
+
+// Grey baseline JPEG, one component, built segment by segment
+class JpegWriter {
+ public:
+  JpegWriter() { bytes_ = {0xFF, 0xD8}; }
+
+  void quant(uint16_t value, bool wide) {
+    std::vector<uint8_t> body = {static_cast<uint8_t>(wide ? 0x10 : 0x00)};
+    for (int i = 0; i < 64; ++i) {
+      if (wide) { body.push_back(static_cast<uint8_t>(value >> 8)); }
+      body.push_back(static_cast<uint8_t>(value));
+    }
+    segment(0xDB, body);
+  }
+  void frame(uint16_t width, uint16_t height) {
+    segment(0xC0, {8, static_cast<uint8_t>(height >> 8), static_cast<uint8_t>(height), static_cast<uint8_t>(width >> 8),
+                   static_cast<uint8_t>(width), 1, 1, 0x11, 0});
+  }
+  // tc 0 = DC, 1 = AC; counts[i] codes of length i + 1
+  void huffman(uint8_t tc, const uint8_t (&counts)[16], const std::vector<uint8_t> &symbols) {
+    std::vector<uint8_t> body = {static_cast<uint8_t>(tc << 4)};
+    body.insert(body.end(), counts, counts + 16);
+    body.insert(body.end(), symbols.begin(), symbols.end());
+    segment(0xC4, body);
+  }
+  void scan(const std::vector<uint8_t> &data) {
+    segment(0xDA, {1, 1, 0x00, 0, 63, 0});
+    bytes_.insert(bytes_.end(), data.begin(), data.end());
+    bytes_.push_back(0xFF);
+    bytes_.push_back(0xD9);
+  }
+
+  bool draw() {
+    display.fillScreen(kBackground);
+    ESP32S3BoxLiteImageSource src(bytes_.data(), bytes_.size());
+    return display.drawImage(src, 0, 0);
+  }
+
+ private:
+  void segment(uint8_t marker, const std::vector<uint8_t> &body) {
+    const size_t len = body.size() + 2;
+    bytes_.insert(bytes_.end(), {0xFF, marker, static_cast<uint8_t>(len >> 8), static_cast<uint8_t>(len)});
+    bytes_.insert(bytes_.end(), body.begin(), body.end());
+  }
+
+  std::vector<uint8_t> bytes_;
+};
+
+// A single 1-bit code
+constexpr uint8_t kOneCode[16] = {1};
+
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_flat_block_decodes() {
+  // DC difference 0 and end of block: every sample is the level shift
+  JpegWriter jpeg;
+  jpeg.quant(1, false);
+  jpeg.frame(8, 8);
+  jpeg.huffman(0, kOneCode, {0x00});
+  jpeg.huffman(1, kOneCode, {0x00});
+  BitWriter bits;
+  bits.put(0, 2);
+  jpeg.scan(bits.finish());
+  TEST_ASSERT_TRUE(jpeg.draw());
+  for (int16_t y = 0; y < 8; ++y) {
+    for (int16_t x = 0; x < 8; ++x) { TEST_ASSERT_EQUAL_HEX16(kMidGrey, recorder.pixel(x, y)); }
+  }
+  TEST_ASSERT_EQUAL_HEX16(kBackground, recorder.pixel(8, 0));
+}
+
+void test_oversubscribed_huffman_table_is_refused() {
+  // Three 1-bit codes, and all 255 symbols as 1-bit codes: both used to
+  // fill the fast table past its end
+  for (uint8_t n : {3, 255}) {
+    uint8_t counts[16] = {n};
+    std::vector<uint8_t> symbols(n);
+    for (uint8_t i = 0; i < n; ++i) { symbols[i] = i; }
+    JpegWriter jpeg;
+    jpeg.quant(1, false);
+    jpeg.frame(8, 8);
+    jpeg.huffman(0, counts, symbols);
+    jpeg.huffman(1, kOneCode, {0x00});
+    jpeg.scan({0x3F});
+    TEST_ASSERT_FALSE(jpeg.draw());
+  }
+
+  // Codes fill length 2 exactly, then one more at length 3
+  const uint8_t counts[16] = {0, 4, 1};
+  JpegWriter jpeg;
+  jpeg.quant(1, false);
+  jpeg.frame(8, 8);
+  jpeg.huffman(0, counts, {0, 1, 2, 3, 4});
+  jpeg.huffman(1, kOneCode, {0x00});
+  jpeg.scan({0x3F});
+  TEST_ASSERT_FALSE(jpeg.draw());
+}
+
+void test_complete_huffman_table_is_accepted() {
+  // Two 1-bit codes use the whole code space, which is allowed
+  const uint8_t counts[16] = {2};
+  JpegWriter jpeg;
+  jpeg.quant(1, false);
+  jpeg.frame(8, 8);
+  jpeg.huffman(0, counts, {0x00, 0x01});
+  jpeg.huffman(1, kOneCode, {0x00});
+  BitWriter bits;
+  bits.put(0, 2);
+  jpeg.scan(bits.finish());
+  TEST_ASSERT_TRUE(jpeg.draw());
+  TEST_ASSERT_EQUAL_HEX16(kMidGrey, recorder.pixel(3, 3));
+}
+
+void test_extreme_coefficients_do_not_overflow() {
+  // 16-bit quantisers of 65535 and 15-bit values in every position, with
+  // signs from a fixed pattern; 16 blocks, so the DC predictor keeps
+  // growing. The decode itself is the test: an overflow aborts the run.
+  for (uint16_t q : {1, 255, 65535}) {
+    JpegWriter jpeg;
+    jpeg.quant(q, q > 255);
+    jpeg.frame(32, 32);
+    jpeg.huffman(0, kOneCode, {0x0F});
+    jpeg.huffman(1, kOneCode, {0x0F});
+    BitWriter bits;
+    uint32_t pattern = 0x9E3779B9;
+    for (int block = 0; block < 16; ++block) {
+      for (int k = 0; k < 64; ++k) {
+        pattern = pattern * 1664525 + 1013904223;
+        bits.put(0, 1);
+        // Top bit set: +16384..+32767; clear: -32767..-16384
+        bits.put(block < 8 ? 0x7FFF : (pattern >> 17), 15);
+      }
+    }
+    jpeg.scan(bits.finish());
+    TEST_ASSERT_TRUE(jpeg.draw());
+  }
+}
+
+int main() {
+  display.setBus(&recorder);
+  display.begin();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_flat_block_decodes);
+  RUN_TEST(test_oversubscribed_huffman_table_is_refused);
+  RUN_TEST(test_complete_huffman_table_is_accepted);
+  RUN_TEST(test_extreme_coefficients_do_not_overflow);
+  return UNITY_END();
+}
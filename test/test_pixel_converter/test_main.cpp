@@ -0,0 +1,224 @@
+// ESP32S3BoxLitePixelConverter: exact RGB565 from every source format
+// without dithering, the bounds of ordered dithering, and the error
+// bookkeeping of diffusion.
+#include <ESP32S3BoxLite.h>
+#include <host_fakes.h>
+#include <unity.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using Format = ESP32S3BoxLitePixelFormat;
+using Dither = ESP32S3BoxLiteDither;
+
+constexpr uint16_t kWidth = 320;
+
+struct Rgb {
+  uint8_t r, g, b;
+};
+
+struct Levels {
+  int r, g, b;  // 5, 6 and 5 bits
+};
+
+Rgb sample(uint32_t i) {
+  return {static_cast<uint8_t>(i), static_cast<uint8_t>(i * 7 + 3), static_cast<uint8_t>(255 - i * 13)};
+}
+
+// Source row in `format` holding `rgb`; alpha and the unused grey channels
+// are filled with noise that must not show up in the output
+std::vector<uint8_t> encode(Format format, const std::vector<Rgb> &rgb) {
+  std::vector<uint8_t> out;
+  for (size_t i = 0; i < rgb.size(); ++i) {
+    const Rgb &p = rgb[i];
+    switch (format) {
+      case Format::RGB888:   out.insert(out.end(), {p.r, p.g, p.b}); break;
+      case Format::BGR888:   out.insert(out.end(), {p.b, p.g, p.r}); break;
+      case Format::ARGB8888: out.insert(out.end(), {p.b, p.g, p.r, static_cast<uint8_t>(i * 31)}); break;
+      case Format::Gray8:    out.push_back(p.r); break;
+    }
+  }
+  return out;
+}
+
+Levels decode(const uint8_t *wire) {
+  const uint16_t v = static_cast<uint16_t>(wire[0] << 8 | wire[1]);
+  return {v >> 11, (v >> 5) & 0x3F, v & 0x1F};
+}
+
+// Level scaled back to 8 bits the way the converter measures its error
+double expand(int level, int bits) {
+  return (level << (8 - bits)) | (level >> (2 * bits - 8));
+}
+
+std::vector<uint8_t> convertRow(ESP32S3BoxLitePixelConverter &cvt, const std::vector<uint8_t> &src, uint16_t x,
+                                uint16_t count) {
+  std::vector<uint8_t> wire(count * 2U);
+  cvt.convert(src.data(), wire.data(), x, count);
+  return wire;
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_truncation_is_exact_for_every_format() {
+  std::vector<Rgb> rgb(256);
+  for (uint32_t i = 0; i < rgb.size(); ++i) { rgb[i] = sample(i); }
+  for (Format format : {Format::RGB888, Format::BGR888, Format::ARGB8888, Format::Gray8}) {
+    ESP32S3BoxLitePixelConverter cvt;
+    TEST_ASSERT_TRUE(cvt.begin(format, 256));
+    const std::vector<uint8_t> wire = convertRow(cvt, encode(format, rgb), 0, 256);
+    for (uint32_t i = 0; i < rgb.size(); ++i) {
+      const Rgb p = format == Format::Gray8 ? Rgb{rgb[i].r, rgb[i].r, rgb[i].r} : rgb[i];
+      const uint16_t want = static_cast<uint16_t>((p.r & 0xF8) << 8 | (p.g & 0xFC) << 3 | p.b >> 3);
+      TEST_ASSERT_EQUAL_HEX8(want >> 8, wire[i * 2]);
+      TEST_ASSERT_EQUAL_HEX8(want & 0xFF, wire[i * 2 + 1]);
+    }
+  }
+}
+
+void test_truncation_ignores_row_and_span() {
+  std::vector<Rgb> rgb(kWidth);
+  for (uint32_t i = 0; i < rgb.size(); ++i) { rgb[i] = sample(i * 5); }
+  const std::vector<uint8_t> src = encode(Format::RGB888, rgb);
+  ESP32S3BoxLitePixelConverter cvt;
+  TEST_ASSERT_TRUE(cvt.begin(Format::RGB888, kWidth));
+  const std::vector<uint8_t> whole = convertRow(cvt, src, 0, kWidth);
+  cvt.nextRow();
+  const std::vector<uint8_t> tail =
+      convertRow(cvt, std::vector<uint8_t>(src.begin() + 100 * 3, src.end()), 100, kWidth - 100);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(whole.data() + 200, tail.data(), tail.size());
+}
+
+// Each channel lands on the truncated level or one above it, and which one
+// depends on the position in a 4x4 cell
+void test_ordered_dither_is_bounded_and_position_dependent() {
+  for (Format format : {Format::RGB888, Format::BGR888, Format::ARGB8888, Format::Gray8}) {
+    ESP32S3BoxLitePixelConverter cvt;
+    TEST_ASSERT_TRUE(cvt.begin(format, kWidth, Dither::Ordered));
+    for (uint32_t y = 0; y < 8; ++y) {
+      std::vector<Rgb> rgb(kWidth);
+      for (uint32_t i = 0; i < rgb.size(); ++i) { rgb[i] = sample(i + y * 77); }
+      const std::vector<uint8_t> wire = convertRow(cvt, encode(format, rgb), 0, kWidth);
+      for (uint32_t i = 0; i < kWidth; ++i) {
+        const Rgb p = format == Format::Gray8 ? Rgb{rgb[i].r, rgb[i].r, rgb[i].r} : rgb[i];
+        const Levels l = decode(&wire[i * 2]);
+        TEST_ASSERT_TRUE(l.r == p.r >> 3 || l.r == (p.r >> 3) + 1);
+        TEST_ASSERT_TRUE(l.g == p.g >> 2 || l.g == (p.g >> 2) + 1);
+        TEST_ASSERT_TRUE(l.b == p.b >> 3 || l.b == (p.b >> 3) + 1);
+      }
+      cvt.nextRow();
+    }
+  }
+
+  // A flat tone between two levels: both appear in every 4x4 cell, and the
+  // pattern repeats every 4 pixels in both directions
+  ESP32S3BoxLitePixelConverter cvt;
+  TEST_ASSERT_TRUE(cvt.begin(Format::RGB888, kWidth, Dither::Ordered));
+  const std::vector<uint8_t> src = encode(Format::RGB888, std::vector<Rgb>(kWidth, Rgb{0x84, 0x82, 0x84}));
+  std::vector<std::vector<uint8_t>> rows;
+  for (int y = 0; y < 8; ++y) {
+    rows.push_back(convertRow(cvt, src, 0, kWidth));
+    cvt.nextRow();
+  }
+  int high = 0;
+  for (int y = 0; y < 4; ++y) {
+    for (int x = 0; x < 4; ++x) {
+      high += decode(&rows[y][x * 2]).r == 0x84 >> 3 ? 0 : 1;
+    }
+  }
+  TEST_ASSERT_TRUE(high > 0 && high < 16);
+  TEST_ASSERT_FALSE(rows[0] == rows[1]);
+  for (int y = 0; y < 4; ++y) {
+    for (int x = 0; x < kWidth - 4; ++x) {
+      TEST_ASSERT_EQUAL_HEX8(rows[y][x * 2], rows[y][(x + 4) * 2]);
+      TEST_ASSERT_EQUAL_HEX8(rows[y][x * 2 + 1], rows[y][(x + 4) * 2 + 1]);
+      TEST_ASSERT_EQUAL_HEX8(rows[y][x * 2], rows[y + 4][x * 2]);
+    }
+  }
+}
+
+// A flat tone between two levels. Floyd-Steinberg sends 7/16 of the error
+// right and the rest down, so one row's mean may sit off the tone by up to
+// half a level, rows alternating above and below it; over the rows after the
+// first the mean matches the tone. Truncation fails both.
+void test_diffusion_keeps_the_mean_of_a_flat_tone() {
+  const Rgb tone = {101, 90, 203};
+  ESP32S3BoxLitePixelConverter cvt;
+  TEST_ASSERT_TRUE(cvt.begin(Format::RGB888, kWidth, Dither::Diffusion));
+  const std::vector<uint8_t> src = encode(Format::RGB888, std::vector<Rgb>(kWidth, tone));
+  constexpr int kRows = 16;
+  double total[3] = {0, 0, 0};
+  for (int y = 0; y < kRows; ++y) {
+    const std::vector<uint8_t> wire = convertRow(cvt, src, 0, kWidth);
+    cvt.nextRow();
+    double mean[3] = {0, 0, 0};
+    for (uint32_t i = 0; i < kWidth; ++i) {
+      const Levels l = decode(&wire[i * 2]);
+      mean[0] += expand(l.r, 5) / kWidth;
+      mean[1] += expand(l.g, 6) / kWidth;
+      mean[2] += expand(l.b, 5) / kWidth;
+    }
+    TEST_ASSERT_TRUE(fabs(mean[0] - tone.r) <= 4.0);
+    TEST_ASSERT_TRUE(fabs(mean[1] - tone.g) <= 2.0);
+    TEST_ASSERT_TRUE(fabs(mean[2] - tone.b) <= 4.0);
+    if (y > 0) {
+      for (int c = 0; c < 3; ++c) { total[c] += mean[c] / (kRows - 1); }
+    }
+  }
+  TEST_ASSERT_TRUE(fabs(total[0] - tone.r) <= 0.25);
+  TEST_ASSERT_TRUE(fabs(total[1] - tone.g) <= 0.25);
+  TEST_ASSERT_TRUE(fabs(total[2] - tone.b) <= 0.25);
+}
+
+// reset() and begin() drop the carried error: the same frame converts the
+// same way twice, and a span after a gap starts with no error from its left
+void test_diffusion_error_is_reset_between_frames_and_spans() {
+  std::vector<Rgb> rgb(kWidth);
+  for (uint32_t i = 0; i < rgb.size(); ++i) { rgb[i] = sample(i * 3); }
+  const std::vector<uint8_t> src = encode(Format::RGB888, rgb);
+  ESP32S3BoxLitePixelConverter cvt;
+  TEST_ASSERT_TRUE(cvt.begin(Format::RGB888, kWidth, Dither::Diffusion));
+
+  std::vector<std::vector<uint8_t>> first;
+  for (int y = 0; y < 4; ++y) {
+    first.push_back(convertRow(cvt, src, 0, kWidth));
+    cvt.nextRow();
+  }
+  cvt.reset();
+  for (int y = 0; y < 4; ++y) {
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(first[y].data(), convertRow(cvt, src, 0, kWidth).data(), kWidth * 2);
+    cvt.nextRow();
+  }
+
+  // Contiguous spans continue the row
+  cvt.reset();
+  const std::vector<uint8_t> left = convertRow(cvt, src, 0, 150);
+  const std::vector<uint8_t> right =
+      convertRow(cvt, std::vector<uint8_t>(src.begin() + 150 * 3, src.end()), 150, kWidth - 150);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(first[0].data(), left.data(), left.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(first[0].data() + 300, right.data(), right.size());
+
+  // After a gap the span starts clean, like the first pixel of a row
+  ESP32S3BoxLitePixelConverter fresh;
+  TEST_ASSERT_TRUE(fresh.begin(Format::RGB888, kWidth, Dither::Diffusion));
+  const std::vector<uint8_t> tail(src.begin() + 200 * 3, src.end());
+  const std::vector<uint8_t> alone = convertRow(fresh, tail, 200, 40);
+  cvt.reset();
+  convertRow(cvt, src, 0, 100);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(alone.data(), convertRow(cvt, tail, 200, 40).data(), alone.size());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_truncation_is_exact_for_every_format);
+  RUN_TEST(test_truncation_ignores_row_and_span);
+  RUN_TEST(test_ordered_dither_is_bounded_and_position_dependent);
+  RUN_TEST(test_diffusion_keeps_the_mean_of_a_flat_tone);
+  RUN_TEST(test_diffusion_error_is_reset_between_frames_and_spans);
+  return UNITY_END();
+}
@@ -0,0 +1,230 @@
+// ESP32S3BoxLiteSprite::pushRotateZoom: exact quarter turns and mirrors,
+// clipping against the destination, and colour-keyed bilinear edges. Source
+// sprites are allocated at their exact size, so a read past the source
+// shows up under AddressSanitizer.
+#include <ESP32S3BoxLite.h>
+#include <host_fakes.h>
+#include <unity.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using Filter = ESP32S3BoxLiteFilter;
+using Blend  = ESP32S3BoxLiteBlend;
+
+constexpr int16_t kWidth  = ESP32S3BoxLiteRecordingBus::Width;
+constexpr int16_t kHeight = ESP32S3BoxLiteRecordingBus::Height;
+constexpr uint16_t kBackground = 0x0000;
+
+ESP32S3BoxLiteRecordingBus recorder;
+ESP32S3BoxLiteDisplay display;
+// Sprites have no destructor; createSprite() frees the previous buffer
+ESP32S3BoxLiteSprite sprite;
+ESP32S3BoxLiteSprite dst;
+
+// Distinct, never the background
+uint16_t texel(int16_t x, int16_t y) {
+  return static_cast<uint16_t>(((x * 131 + y * 7919) * 2654435761U) >> 16) | 1;
+}
+
+void paint(int16_t w, int16_t h) {
+  TEST_ASSERT_TRUE(sprite.createSprite(w, h));
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      sprite.drawPixel(x, y, texel(x, y));
+    }
+  }
+  sprite.setPivot(0, 0);
+}
+
+size_t countDrawn() {
+  size_t n = 0;
+  for (int32_t i = 0; i < kWidth * kHeight; ++i) {
+    n += recorder.image()[i] != kBackground;
+  }
+  return n;
+}
+
+// Source texel sampled at the centre of destination pixel (dx, dy), or -1
+// outside the source. `edge` is the distance to the nearest texel boundary,
+// where float rounding may pick either neighbour.
+int32_t reference(int16_t w, int16_t h, int16_t px, int16_t py, int16_t x, int16_t y, double angle, double zoomX,
+                  double zoomY, int16_t dx, int16_t dy, double &edge) {
+  const double r = angle * M_PI / 180.0;
+  const double c = cos(r), s = sin(r);
+  const double ox = dx + 0.5 - x, oy = dy + 0.5 - y;
+  const double u = px + (c * ox + s * oy) / zoomX;
+  const double v = py + (c * oy - s * ox) / zoomY;
+  edge = std::min(fabs(u - round(u)), fabs(v - round(v)));
+  if (u < 0 || v < 0 || u >= w || v >= h) { return -1; }
+  return texel(static_cast<int16_t>(floor(u)), static_cast<int16_t>(floor(v)));
+}
+
+}  // namespace
+
+void setUp() {
+  display.fillScreen(kBackground);
+}
+
+void tearDown() {}
+
+void test_zero_degrees_matches_push_sprite() {
+  paint(37, 23);
+  for (Filter filter : {Filter::Nearest, Filter::Bilinear}) {
+    display.fillScreen(kBackground);
+    sprite.pushSprite(display, 50, 40);
+    const std::vector<uint16_t> expected(recorder.image(), recorder.image() + kWidth * kHeight);
+    display.fillScreen(kBackground);
+    sprite.pushRotateZoom(display, 50, 40, 0.0f, 1.0f, 1.0f, filter);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(expected.data(), recorder.image(), kWidth * kHeight);
+  }
+}
+
+void test_quarter_turn_is_a_transpose() {
+  const int16_t w = 37, h = 23;
+  paint(w, h);
+  // Clockwise: source column x becomes destination row x
+  sprite.pushRotateZoom(display, 100, 100, 90.0f);
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      TEST_ASSERT_EQUAL_HEX16(texel(x, y), recorder.pixel(static_cast<int16_t>(99 - y), static_cast<int16_t>(100 + x)));
+    }
+  }
+  TEST_ASSERT_EQUAL(w * h, countDrawn());
+
+  display.fillScreen(kBackground);
+  sprite.pushRotateZoom(display, 100, 100, -90.0f);
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      TEST_ASSERT_EQUAL_HEX16(texel(x, y), recorder.pixel(static_cast<int16_t>(100 + y), static_cast<int16_t>(99 - x)));
+    }
+  }
+  TEST_ASSERT_EQUAL(w * h, countDrawn());
+}
+
+void test_half_turn_is_a_flip() {
+  const int16_t w = 37, h = 23;
+  paint(w, h);
+  sprite.pushRotateZoom(display, 100, 100, 180.0f);
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      TEST_ASSERT_EQUAL_HEX16(texel(x, y), recorder.pixel(static_cast<int16_t>(99 - x), static_cast<int16_t>(99 - y)));
+    }
+  }
+  TEST_ASSERT_EQUAL(w * h, countDrawn());
+}
+
+void test_negative_zoom_mirrors() {
+  const int16_t w = 37, h = 23;
+  paint(w, h);
+  sprite.pushRotateZoom(display, 100, 100, 0.0f, -1.0f, 1.0f);
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      TEST_ASSERT_EQUAL_HEX16(texel(x, y), recorder.pixel(static_cast<int16_t>(99 - x), static_cast<int16_t>(100 + y)));
+    }
+  }
+  TEST_ASSERT_EQUAL(w * h, countDrawn());
+
+  display.fillScreen(kBackground);
+  sprite.pushRotateZoom(display, 100, 100, 0.0f, 1.0f, -1.0f);
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      TEST_ASSERT_EQUAL_HEX16(texel(x, y), recorder.pixel(static_cast<int16_t>(100 + x), static_cast<int16_t>(99 - y)));
+    }
+  }
+
+  // Mirroring both axes is a half turn
+  const std::vector<uint16_t> mirrored = [&] {
+    display.fillScreen(kBackground);
+    sprite.pushRotateZoom(display, 100, 100, 0.0f, -1.0f, -1.0f);
+    return std::vector<uint16_t>(recorder.image(), recorder.image() + kWidth * kHeight);
+  }();
+  display.fillScreen(kBackground);
+  sprite.pushRotateZoom(display, 100, 100, 180.0f);
+  TEST_ASSERT_EQUAL_UINT16_ARRAY(mirrored.data(), recorder.image(), kWidth * kHeight);
+}
+
+// Rotated sources hanging over every edge of the screen: each row is clipped
+// on its own, and the pixels that are drawn sample the right texel
+void test_rows_are_clipped_against_the_destination() {
+  const int16_t w = 61, h = 45;
+  paint(w, h);
+  sprite.setPivot(30, 22);
+  const int16_t positions[][2] = {{-20, 120}, {335, 120}, {160, -25}, {160, 255}, {-10, -10}, {330, 250}};
+  for (const auto &pos : positions) {
+    for (float angle : {17.0f, 45.0f, 133.0f, 250.0f, 311.0f}) {
+      for (float zoom : {0.7f, 1.0f, -1.3f}) {
+        display.fillScreen(kBackground);
+        sprite.pushRotateZoom(display, pos[0], pos[1], angle, zoom, 1.2f);
+        for (int16_t dy = 0; dy < kHeight; ++dy) {
+          for (int16_t dx = 0; dx < kWidth; ++dx) {
+            double edge = 0;
+            const int32_t want = reference(w, h, 30, 22, pos[0], pos[1], angle, zoom, 1.2, dx, dy, edge);
+            if (edge < 0.01) { continue; }
+            TEST_ASSERT_EQUAL_HEX16(want < 0 ? kBackground : want, recorder.pixel(dx, dy));
+          }
+        }
+      }
+    }
+  }
+}
+
+void test_clip_rectangle_limits_the_output() {
+  const int16_t w = 61, h = 45;
+  paint(w, h);
+  sprite.setPivot(30, 22);
+
+  TEST_ASSERT_TRUE(dst.createSprite(48, 40));
+  for (Filter filter : {Filter::Nearest, Filter::Bilinear}) {
+    dst.fillScreen(kBackground);
+    TEST_ASSERT_TRUE(dst.pushClipRect(10, 8, 20, 16));
+    sprite.pushRotateZoom(dst, 24, 20, 30.0f, 1.5f, 1.5f, filter);
+    dst.popClipRect();
+    for (int16_t y = 0; y < 40; ++y) {
+      for (int16_t x = 0; x < 48; ++x) {
+        const bool inside = x >= 10 && x < 30 && y >= 8 && y < 24;
+        TEST_ASSERT_EQUAL(inside, dst.readPixel(x, y) != kBackground);
+      }
+    }
+  }
+}
+
+// A solid shape on a key-coloured ground: bilinear edges must blend only
+// the shape, so every drawn pixel is exactly the shape colour
+void test_color_key_never_bleeds_into_bilinear_edges() {
+  constexpr uint16_t kKey   = 0xF81F;
+  constexpr uint16_t kShape = 0x07E0;
+  TEST_ASSERT_TRUE(sprite.createSprite(40, 40));
+  sprite.fillScreen(kKey);
+  sprite.fillRect(8, 8, 24, 24, kShape);
+  for (float angle : {0.0f, 10.0f, 45.0f, 100.0f}) {
+    for (float zoom : {0.6f, 1.0f, 2.5f}) {
+      display.fillScreen(kBackground);
+      sprite.pushRotateZoom(display, 160, 120, angle, zoom, zoom, Filter::Bilinear, Blend::ColorKey, kKey);
+      size_t shape = 0;
+      for (int32_t i = 0; i < kWidth * kHeight; ++i) {
+        const uint16_t c = recorder.image()[i];
+        TEST_ASSERT_TRUE(c == kBackground || c == kShape);
+        shape += c == kShape;
+      }
+      TEST_ASSERT_TRUE(shape > 0);
+    }
+  }
+}
+
+int main() {
+  display.setBus(&recorder);
+  display.begin();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_zero_degrees_matches_push_sprite);
+  RUN_TEST(test_quarter_turn_is_a_transpose);
+  RUN_TEST(test_half_turn_is_a_flip);
+  RUN_TEST(test_negative_zoom_mirrors);
+  RUN_TEST(test_rows_are_clipped_against_the_destination);
+  RUN_TEST(test_clip_rectangle_limits_the_output);
+  RUN_TEST(test_color_key_never_bleeds_into_bilinear_edges);
+  return UNITY_END();
+}
@@ -0,0 +1,250 @@
+// ESP32S3BoxLiteSpiBus against a fake SPI master that completes transactions
+// only when the bus collects them, so reusing a buffer too early shows up as
+// a changed payload.
+#include <ESP32S3BoxLite.h>
+#include <host_fakes.h>
+#include <unity.h>
+
+#include <vector>
+
+namespace {
+
+constexpr size_t kLineBytes = ESP32S3BoxLiteBus::MaxTransferBytes;
+constexpr int kDcPin        = 4;
+
+ESP32S3BoxLiteSpiBus bus;
+
+std::vector<uint8_t> pattern(size_t len, uint8_t seed) {
+  std::vector<uint8_t> v(len);
+  for (size_t i = 0; i < len; ++i) {
+    v[i] = static_cast<uint8_t>(seed + i * 7 + (i >> 8));
+  }
+  return v;
+}
+
+// Concatenated payloads of the data transactions from `first` on
+std::vector<uint8_t> dataBytes(size_t first = 0) {
+  std::vector<uint8_t> out;
+  const auto &wire = host::spiWire();
+  for (size_t i = first; i < wire.size(); ++i) {
+    if (wire[i].dc) { out.insert(out.end(), wire[i].bytes.begin(), wire[i].bytes.end()); }
+  }
+  return out;
+}
+
+}  // namespace
+
+void setUp() {
+  bus.waitIdle();
+  host::reset();
+  bus.resetStats();
+}
+
+void tearDown() {
+  bus.waitIdle();
+}
+
+void test_begin_sets_up_the_device() {
+  TEST_ASSERT_TRUE(bus.begin());
+  TEST_ASSERT_EQUAL(0, host::spiWire().size());
+}
+
+void test_commands_and_data_keep_their_order_and_dc_level() {
+  const uint8_t caset[4] = {0x00, 0x10, 0x00, 0x1F};
+  const std::vector<uint8_t> pixels = pattern(64, 3);
+  bus.writeCommand(0x2A);
+  bus.writeData(caset, sizeof(caset));
+  bus.writeCommand(0x2C);
+  bus.writePixels(pixels.data(), pixels.size());
+  bus.writeCommand(0x00);
+  bus.waitIdle();
+
+  const auto &wire = host::spiWire();
+  TEST_ASSERT_EQUAL(5, wire.size());
+  TEST_ASSERT_FALSE(wire[0].dc);
+  TEST_ASSERT_TRUE(wire[1].dc);
+  TEST_ASSERT_FALSE(wire[2].dc);
+  TEST_ASSERT_TRUE(wire[3].dc);
+  TEST_ASSERT_FALSE(wire[4].dc);
+  TEST_ASSERT_EQUAL_HEX8(0x2A, wire[0].bytes[0]);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(caset, wire[1].bytes.data(), 4);
+  TEST_ASSERT_EQUAL_HEX8(0x2C, wire[2].bytes[0]);
+  TEST_ASSERT_EQUAL(pixels.size(), wire[3].bytes.size());
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(pixels.data(), wire[3].bytes.data(), pixels.size());
+  TEST_ASSERT_EQUAL(0, host::gpioLevel(kDcPin));
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+
+  const ESP32S3BoxLiteBusStats &s = bus.stats();
+  TEST_ASSERT_EQUAL(5, s.transactions);
+  TEST_ASSERT_EQUAL(5, s.csToggles);
+  TEST_ASSERT_EQUAL(3, s.commands);
+  TEST_ASSERT_EQUAL(1, s.windows);
+  TEST_ASSERT_EQUAL(3 + 4 + 64, s.bytes);
+}
+
+void test_payloads_up_to_four_bytes_go_inline() {
+  const std::vector<uint8_t> data = pattern(8, 40);
+  for (size_t len = 1; len <= 8; ++len) {
+    bus.writeData(data.data(), len);
+  }
+  bus.writeCommand(0x29);
+  bus.waitIdle();
+
+  const auto &wire = host::spiWire();
+  TEST_ASSERT_EQUAL(9, wire.size());
+  for (size_t len = 1; len <= 8; ++len) {
+    const host::SpiTransaction &t = wire[len - 1];
+    TEST_ASSERT_EQUAL(len <= 4, t.inlineData);
+    TEST_ASSERT_EQUAL(len, t.bytes.size());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data.data(), t.bytes.data(), len);
+  }
+  TEST_ASSERT_TRUE(wire[8].inlineData);
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+}
+
+void test_pixels_are_split_into_line_buffers() {
+  const size_t len = kLineBytes * 2 + 1808;
+  const std::vector<uint8_t> pixels = pattern(len, 9);
+  bus.writeCommand(0x2C);
+  bus.writePixels(pixels.data(), len);
+  bus.flushPixels();
+  bus.waitIdle();
+
+  const auto &wire = host::spiWire();
+  TEST_ASSERT_EQUAL(4, wire.size());
+  TEST_ASSERT_EQUAL(kLineBytes, wire[1].bytes.size());
+  TEST_ASSERT_EQUAL(kLineBytes, wire[2].bytes.size());
+  TEST_ASSERT_EQUAL(1808, wire[3].bytes.size());
+  // The two line buffers alternate
+  TEST_ASSERT_TRUE(wire[1].buffer != wire[2].buffer);
+  TEST_ASSERT_EQUAL_PTR(wire[1].buffer, wire[3].buffer);
+  TEST_ASSERT_TRUE(dataBytes() == pixels);
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+}
+
+void test_line_buffer_is_reused_only_after_completion() {
+  // Many small writes, each a different pattern, so every refill of a line
+  // buffer that was still in flight would change what goes out on the wire
+  std::vector<uint8_t> sent;
+  bus.writeCommand(0x2C);
+  for (uint8_t i = 0; i < 40; ++i) {
+    const std::vector<uint8_t> chunk = pattern(1000 + i * 13, i);
+    bus.writePixels(chunk.data(), chunk.size());
+    sent.insert(sent.end(), chunk.begin(), chunk.end());
+  }
+  bus.flushPixels();
+  TEST_ASSERT_TRUE(host::spiInFlight() > 0);
+  bus.waitIdle();
+
+  TEST_ASSERT_EQUAL(0, host::spiInFlight());
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+  TEST_ASSERT_TRUE(dataBytes() == sent);
+  TEST_ASSERT_EQUAL(1 + (sent.size() + kLineBytes - 1) / kLineBytes, host::spiWire().size());
+}
+
+void test_fill_reuses_one_buffer_per_chunk() {
+  const uint32_t count = 320 * 240;
+  const uint32_t chunk = kLineBytes / 2;
+  bus.writeCommand(0x2C);
+  bus.writeColor(0xF81F, count);
+  bus.waitIdle();
+
+  const auto &wire = host::spiWire();
+  const size_t expected = (count + chunk - 1) / chunk;
+  TEST_ASSERT_EQUAL(1 + expected, wire.size());
+  TEST_ASSERT_EQUAL(1 + expected, bus.stats().transactions);
+  uint32_t pixels = 0;
+  for (size_t i = 1; i < wire.size(); ++i) {
+    TEST_ASSERT_TRUE(wire[i].dc);
+    TEST_ASSERT_EQUAL_PTR(wire[1].buffer, wire[i].buffer);
+    for (size_t b = 0; b < wire[i].bytes.size(); b += 2) {
+      TEST_ASSERT_EQUAL_HEX8(0xF8, wire[i].bytes[b]);
+      TEST_ASSERT_EQUAL_HEX8(0x1F, wire[i].bytes[b + 1]);
+    }
+    pixels += wire[i].bytes.size() / 2;
+  }
+  TEST_ASSERT_EQUAL(count, pixels);
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+}
+
+void test_fill_after_pixels_waits_for_the_other_buffer() {
+  const std::vector<uint8_t> pixels = pattern(kLineBytes + 100, 77);
+  bus.writeCommand(0x2C);
+  bus.writePixels(pixels.data(), pixels.size());
+  bus.writeColor(0x1234, 5000);
+  bus.writePixels(pixels.data(), pixels.size());
+  bus.waitIdle();
+
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+  const std::vector<uint8_t> out = dataBytes();
+  TEST_ASSERT_EQUAL(pixels.size() * 2 + 10000, out.size());
+  TEST_ASSERT_TRUE(std::equal(pixels.begin(), pixels.end(), out.begin()));
+  TEST_ASSERT_TRUE(std::equal(pixels.begin(), pixels.end(), out.end() - pixels.size()));
+}
+
+void test_queue_never_exceeds_its_depth() {
+  bus.writeCommand(0x2C);
+  for (int i = 0; i < 8; ++i) {
+    bus.writeColor(static_cast<uint16_t>(i * 0x1111), 320 * 240);
+  }
+  bus.waitIdle();
+  TEST_ASSERT_TRUE(host::spiMaxInFlight() > 2);
+  TEST_ASSERT_TRUE(host::spiMaxInFlight() <= 16);
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+}
+
+void test_in_place_pixels_are_sent_from_the_caller_buffer() {
+  const size_t len = kLineBytes * 2 + 512;
+  std::vector<uint32_t> words(len / 4);
+  uint8_t *pixels = reinterpret_cast<uint8_t *>(words.data());
+  const std::vector<uint8_t> src = pattern(len, 21);
+  memcpy(pixels, src.data(), len);
+
+  bus.writeCommand(0x2C);
+  TEST_ASSERT_TRUE(bus.writePixelsInPlace(pixels, len));
+  bus.waitIdle();
+
+  const auto &wire = host::spiWire();
+  TEST_ASSERT_EQUAL(4, wire.size());
+  TEST_ASSERT_EQUAL_PTR(pixels, wire[1].buffer);
+  TEST_ASSERT_EQUAL_PTR(pixels + kLineBytes, wire[2].buffer);
+  TEST_ASSERT_EQUAL_PTR(pixels + kLineBytes * 2, wire[3].buffer);
+  TEST_ASSERT_TRUE(dataBytes() == src);
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+}
+
+void test_in_place_falls_back_to_line_buffers() {
+  const std::vector<uint8_t> src = pattern(kLineBytes + 64, 5);
+  std::vector<uint32_t> words(src.size() / 4 + 1);
+  uint8_t *unaligned = reinterpret_cast<uint8_t *>(words.data()) + 1;
+  memcpy(unaligned, src.data(), src.size());
+
+  bus.writeCommand(0x2C);
+  TEST_ASSERT_FALSE(bus.writePixelsInPlace(unaligned, src.size()));
+  host::setDmaCapable(false);
+  TEST_ASSERT_FALSE(bus.writePixelsInPlace(reinterpret_cast<uint8_t *>(words.data()), kLineBytes));
+  bus.flushPixels();
+  bus.waitIdle();
+
+  for (const host::SpiTransaction &t : host::spiWire()) {
+    TEST_ASSERT_TRUE(t.inlineData || (t.buffer != unaligned && t.buffer != words.data()));
+  }
+  TEST_ASSERT_EQUAL(src.size() + kLineBytes, dataBytes().size());
+  TEST_ASSERT_TRUE(std::equal(src.begin(), src.end(), dataBytes().begin()));
+  TEST_ASSERT_EQUAL(0, host::spiViolations());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_begin_sets_up_the_device);
+  RUN_TEST(test_commands_and_data_keep_their_order_and_dc_level);
+  RUN_TEST(test_payloads_up_to_four_bytes_go_inline);
+  RUN_TEST(test_pixels_are_split_into_line_buffers);
+  RUN_TEST(test_line_buffer_is_reused_only_after_completion);
+  RUN_TEST(test_fill_reuses_one_buffer_per_chunk);
+  RUN_TEST(test_fill_after_pixels_waits_for_the_other_buffer);
+  RUN_TEST(test_queue_never_exceeds_its_depth);
+  RUN_TEST(test_in_place_pixels_are_sent_from_the_caller_buffer);
+  RUN_TEST(test_in_place_falls_back_to_line_buffers);
+  return UNITY_END();
+}
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+"""Converts a TrueType font into an ESP32S3BoxLiteFont header or font asset.
+
+    python3 tools/fontconvert.py /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf 16 \
+        --bpp 4 --name FontDejaVuSans16 -o src/fonts/DejaVuSans16.h
+
+    python3 tools/fontconvert.py NotoSansJP-Regular.ttf 16 --charset jis1 \
+        --asset -o data/jp16.fnt
+
+Headers are compiled into the sketch. Assets (--asset) are binary files for
+SPIFFS, read glyph by glyph by ESP32S3BoxLiteFontFile; the layout is described
+in ESP32S3BoxLite.cpp next to kFontAssetMagic.
+
+Glyphs are rendered with Pillow at the requested pixel size, cropped to their
+ink and packed row-major without row padding (MSB first; 4 bpp puts the left
+pixel in the high nibble). Each glyph starts on a byte boundary. Kerning comes
+from the font's legacy 'kern' table, when it has one.
+
+Needs Pillow: pip install pillow
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+try:
+    from PIL import Image, ImageDraw, ImageFont
+except ImportError:
+    sys.exit("fontconvert.py needs Pillow: pip install pillow")
+
+
+def read_tables(data):
+    count = struct.unpack(">H", data[4:6])[0]
+    tables = {}
+    for i in range(count):
+        tag, _, offset, length = struct.unpack(">4sIII", data[12 + 16 * i:28 + 16 * i])
+        tables[tag.decode("latin-1")] = data[offset:offset + length]
+    return tables
+
+
+def read_cmap(cmap):
+    """Code point -> glyph id from the first format 4 Unicode subtable."""
+    count = struct.unpack(">H", cmap[2:4])[0]
+    for i in range(count):
+        platform, encoding, offset = struct.unpack(">HHI", cmap[4 + 8 * i:12 + 8 * i])
+        if (platform, encoding) not in ((3, 1), (0, 3), (0, 4)):
+            continue
+        if struct.unpack(">H", cmap[offset:offset + 2])[0] != 4:
+            continue
+        sub = cmap[offset:]
+        segs = struct.unpack(">H", sub[6:8])[0] // 2
+        ends = struct.unpack(">%dH" % segs, sub[14:14 + 2 * segs])
+        base = 16 + 2 * segs
+        starts = struct.unpack(">%dH" % segs, sub[base:base + 2 * segs])
+        deltas = struct.unpack(">%dh" % segs, sub[base + 2 * segs:base + 4 * segs])
+        range_base = base + 4 * segs
+        ranges = struct.unpack(">%dH" % segs, sub[range_base:range_base + 2 * segs])
+        mapping = {}
+        for s in range(segs):
+            for cp in range(starts[s], ends[s] + 1):
+                if cp == 0xFFFF:
+                    continue
+                if ranges[s] == 0:
+                    gid = (cp + deltas[s]) & 0xFFFF
+                else:
+                    at = range_base + 2 * s + ranges[s] + 2 * (cp - starts[s])
+                    gid = struct.unpack(">H", sub[at:at + 2])[0]
+                    if gid:
+                        gid = (gid + deltas[s]) & 0xFFFF
+                if gid:
+                    mapping[cp] = gid
+        return mapping
+    return {}
+
+
+def read_kern(kern):
+    """(left gid, right gid) -> value in font units, format 0 subtables only."""
+    pairs = {}
+    if not kern:
+        return pairs
+    version, count = struct.unpack(">HH", kern[0:4])
+    if version != 0:
+        return pairs
+    offset = 4
+    for _ in range(count):
+        length, coverage = struct.unpack(">HH", kern[offset + 2:offset + 6])
+        if (coverage >> 8) == 0 and (coverage & 0x1):  # format 0, horizontal
+            npairs = struct.unpack(">H", kern[offset + 6:offset + 8])[0]
+            at = offset + 14
+            for i in range(npairs):
+                left, right, value = struct.unpack(">HHh", kern[at + 6 * i:at + 6 * i + 6])
+                pairs[(left, right)] = value
+        offset += length
+    return pairs
+
+
+def quantise(value, bpp):
+    if bpp == 1:
+        return 1 if value >= 128 else 0
+    return (value * 15 + 127) // 255
+
+
+def render_glyph(font, ch, ascent, bpp):
+    """Returns (bits, width, height, xoffset, yoffset, advance)."""
+    advance = int(round(font.getlength(ch)))
+    left, top, right, bottom = font.getbbox(ch, anchor="ls")
+    if right <= left or bottom <= top:
+        return [], 0, 0, 0, 0, advance
+    pad = 4
+    canvas = Image.new("L", (right - left + 2 * pad, bottom - top + 2 * pad), 0)
+    ImageDraw.Draw(canvas).text((pad - left, pad - top), ch, font=font, fill=255, anchor="ls")
+    box = canvas.point(lambda v: 255 if quantise(v, bpp) else 0).getbbox()
+    if box is None:
+        return [], 0, 0, 0, 0, advance
+    x0, y0, x1, y1 = box
+    pixels = canvas.load()
+    bits = [quantise(pixels[x, y], bpp) for y in range(y0, y1) for x in range(x0, x1)]
+    # Pen origin sits at (pad - left, pad - top) on the baseline
+    xoffset = x0 - (pad - left)
+    yoffset = y0 - (pad - top) + ascent
+    return bits, x1 - x0, y1 - y0, xoffset, yoffset, advance
+
+
+def pack(values, bpp):
+    out = bytearray()
+    if bpp == 1:
+        for i in range(0, len(values), 8):
+            byte = 0
+            for j, v in enumerate(values[i:i + 8]):
+                byte |= v << (7 - j)
+            out.append(byte)
+    else:
+        for i in range(0, len(values), 2):
+            hi = values[i]
+            lo = values[i + 1] if i + 1 < len(values) else 0
+            out.append((hi << 4) | lo)
+    return out
+
+
+def jis_charset():
+    """ASCII, JIS X 0208 rows 1-8 (symbols, kana, Greek, Cyrillic) and the
+    level-1 kanji of rows 16-47."""
+    chars = set(chr(c) for c in range(0x20, 0x7F))
+    for row in list(range(1, 9)) + list(range(16, 48)):
+        for cell in range(1, 95):
+            try:
+                chars.add(bytes([0xA0 + row, 0xA0 + cell]).decode("euc_jp"))
+            except UnicodeDecodeError:
+                pass
+    return sorted(ord(c) for c in chars)
+
+
+def write_asset(path, glyphs, bitmap, bpp, line_height, baseline):
+    header_bytes, entry_bytes = 16, 16
+    index_offset = header_bytes
+    bitmap_offset = index_offset + entry_bytes * len(glyphs)
+    largest = 0
+    index = bytearray()
+    for i, (offset, width, height, advance, xoffset, yoffset, ch) in enumerate(glyphs):
+        end = glyphs[i + 1][0] if i + 1 < len(glyphs) else len(bitmap)
+        largest = max(largest, end - offset)
+        index += struct.pack("<IIBBBbb3x", ord(ch), bitmap_offset + offset, width, height, advance,
+                             xoffset, yoffset)
+    if len(glyphs) > 0xFFFF or largest > 0xFFFF:
+        sys.exit("too many or too large glyphs for an asset")
+    header = struct.pack("<4sHBBBxHI", b"BXF1", len(glyphs), bpp, line_height, baseline, largest,
+                         index_offset)
+    with open(path, "wb") as f:
+        f.write(header + index + bitmap)
+
+
+def check_range(value, lo, hi, what, ch):
+    if not lo <= value <= hi:
+        sys.exit("glyph %r: %s %d does not fit" % (ch, what, value))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("font", help="TrueType font file")
+    parser.add_argument("size", type=int, help="pixel size (em height)")
+    parser.add_argument("--bpp", type=int, choices=(1, 4), default=4)
+    parser.add_argument("--name", help="C++ identifier of the font object")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=0x20)
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=0x7E)
+    parser.add_argument("--charset", choices=("range", "jis1"), default="range",
+                        help="range: --first..--last; jis1: ASCII, kana and JIS level-1 kanji")
+    parser.add_argument("--asset", action="store_true", help="write a binary asset (needs -o)")
+    parser.add_argument("-o", "--output", help="header to write (default: stdout)")
+    args = parser.parse_args()
+
+    base = os.path.splitext(os.path.basename(args.font))[0].replace("-", "")
+    name = args.name or "Font%s%d" % (base, args.size)
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+
+    raw = open(args.font, "rb").read()
+    tables = read_tables(raw)
+    units_per_em = struct.unpack(">H", tables["head"][18:20])[0]
+    cmap = read_cmap(tables.get("cmap", b""))
+    kern_units = read_kern(tables.get("kern", b""))
+
+    codes = jis_charset() if args.charset == "jis1" else list(range(args.first, args.last + 1))
+    if args.asset:
+        if not args.output:
+            sys.exit("--asset needs -o")
+        # The asset is searched by code point, so only glyphs the font has
+        codes = [cp for cp in codes if cp in cmap or cp == 0x20]
+    elif args.charset != "range":
+        sys.exit("headers cover a contiguous --first..--last range")
+    bitmap = bytearray()
+    glyphs = []
+    for cp in codes:
+        ch = chr(cp)
+        bits, width, height, xoffset, yoffset, advance = render_glyph(font, ch, ascent, args.bpp)
+        check_range(width, 0, 255, "width", ch)
+        check_range(height, 0, 255, "height", ch)
+        check_range(advance, 0, 255, "advance", ch)
+        check_range(xoffset, -128, 127, "x offset", ch)
+        check_range(yoffset, -128, 127, "y offset", ch)
+        glyphs.append((len(bitmap), width, height, advance, xoffset, yoffset, ch))
+        bitmap += pack(bits, args.bpp)
+
+    if args.asset:
+        write_asset(args.output, glyphs, bitmap, args.bpp, ascent + descent, ascent)
+        return
+
+    kerning = []
+    scale = args.size / float(units_per_em)
+    for left in codes:
+        for right in codes:
+            gl, gr = cmap.get(left), cmap.get(right)
+            if gl is None or gr is None or (gl, gr) not in kern_units:
+                continue
+            value = int(round(kern_units[(gl, gr)] * scale))
+            if value != 0:
+                kerning.append((left, right, max(-128, min(127, value))))
+
+    out = []
+    out.append("// Generated by tools/fontconvert.py from %s at %d px, %d bpp. Do not edit."
+               % (os.path.basename(args.font), args.size, args.bpp))
+    out.append("#pragma once")
+    out.append("")
+    out.append('#include "../ESP32S3BoxLite.h"')
+    out.append("")
+    out.append("constexpr uint8_t k%sBitmap[] = {" % name)
+    for i in range(0, len(bitmap), 16):
+        out.append("    " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("constexpr ESP32S3BoxLiteGlyph k%sGlyphs[] = {" % name)
+    for offset, width, height, advance, xoffset, yoffset, ch in glyphs:
+        label = "' '" if ch == " " else ch.replace("\\", "backslash")
+        out.append("    {%5d, %3d, %3d, %3d, %3d, %3d},  // %s"
+                   % (offset, width, height, advance, xoffset, yoffset, label))
+    out.append("};")
+    out.append("")
+    if kerning:
+        out.append("constexpr ESP32S3BoxLiteKernPair k%sKerning[] = {" % name)
+        for left, right, value in kerning:
+            out.append("    {0x%02X, 0x%02X, %d}," % (left, right, value))
+        out.append("};")
+        out.append("")
+    out.append("constexpr ESP32S3BoxLiteFont %s = {" % name)
+    out.append("    k%sBitmap," % name)
+    out.append("    k%sGlyphs," % name)
+    out.append("    %s," % ("k%sKerning" % name if kerning else "nullptr"))
+    out.append("    %d,  // kerning pairs" % len(kerning))
+    out.append("    0x%02X, 0x%02X,  // first, last" % (args.first, args.last))
+    out.append("    %d,  // bpp" % args.bpp)
+    out.append("    %d,  // line height" % (ascent + descent))
+    out.append("    %d,  // baseline" % ascent)
+    out.append("};")
+    text = "\n".join(out) + "\n"
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
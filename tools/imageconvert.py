@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""Converts an image into a QOI, RLE565, BMP or JPEG file for drawImage(), or
+an animation into a GIF for ESP32S3BoxLiteGifPlayer.
+
+    python3 tools/imageconvert.py photo.png data/photo.jpg --size 320x240
+    python3 tools/imageconvert.py icons.png data/icons.rle
+    python3 tools/imageconvert.py logo.png logo.h --format rle --name kLogo
+    python3 tools/imageconvert.py clip.webp data/clip.gif --size 160x120
+
+The format follows the output extension (.qoi, .rle, .bmp, .jpg, .gif) unless
+--format is given. A .h output holds the file as a byte array, for drawing from flash
+with ESP32S3BoxLiteImageSource(data, size).
+
+JPEG is the smallest for photos; it is written as baseline with 4:2:0
+chroma, the only kind drawImage() decodes. QOI suits photos and gradients
+that must stay exact. RLE565 suits flat-colour artwork: it stores
+the RGB565 pixels the panel shows, so runs survive the colour reduction. The
+RLE565 layout is described in ESP32S3BoxLite.cpp next to decodeRle().
+GIF keeps every frame of an animated input (GIF, APNG, WebP); Pillow stores
+each frame as the rectangle that changed, which is all the player sends.
+
+Needs Pillow: pip install pillow
+"""
+
+import argparse
+import io
+import os
+import struct
+import sys
+
+try:
+    from PIL import Image, ImageSequence
+except ImportError:
+    sys.exit("imageconvert.py needs Pillow: pip install pillow")
+
+
+def to_565(rgb):
+    r, g, b = rgb
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def pixels_of(img, mode):
+    data = img.convert(mode).tobytes()
+    step = len(mode)
+    return [tuple(data[i:i + step]) for i in range(0, len(data), step)]
+
+
+def encode_rle(img):
+    pixels = [to_565(p) for p in pixels_of(img, "RGB")]
+    out = bytearray(b"R565" + struct.pack("<HH", img.width, img.height))
+    i, n = 0, len(pixels)
+    literal = []
+
+    def flush_literal():
+        for j in range(0, len(literal), 128):
+            chunk = literal[j:j + 128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(struct.pack("<H", p))
+        literal.clear()
+
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        # A run of two costs as much as two literals
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(struct.pack("<H", pixels[i]))
+        else:
+            literal.extend(pixels[i:i + run])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def encode_qoi(img):
+    """Reference QOI encoder (qoiformat.org), RGB or RGBA."""
+    channels = 4 if "A" in img.getbands() else 3
+    out = bytearray(b"qoif" + struct.pack(">IIBB", img.width, img.height, channels, 0))
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+    pixels = pixels_of(img, "RGBA")
+    for pos, px in enumerate(pixels):
+        if px == prev:
+            run += 1
+            if run == 62 or pos == len(pixels) - 1:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+        r, g, b, a = px
+        slot = (r * 3 + g * 5 + b * 7 + a * 11) % 64
+        if index[slot] == px:
+            out.append(slot)
+        else:
+            index[slot] = px
+            if a == prev[3]:
+                dr = (r - prev[0] + 128) % 256 - 128
+                dg = (g - prev[1] + 128) % 256 - 128
+                db = (b - prev[2] + 128) % 256 - 128
+                dr_dg, db_dg = dr - dg, db - dg
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                    out.append(0x80 | (dg + 32))
+                    out.append(((dr_dg + 8) << 4) | (db_dg + 8))
+                else:
+                    out += bytes((0xFE, r, g, b))
+            else:
+                out += bytes((0xFF, r, g, b, a))
+        prev = px
+    out += bytes(7) + b"\x01"
+    return bytes(out)
+
+
+def encode_bmp(img):
+    """24 bpp, bottom-up, as Pillow writes it."""
+    buf = io.BytesIO()
+    img.convert("RGB").save(buf, "BMP")
+    return buf.getvalue()
+
+
+def encode_jpg(img, quality=80):
+    buf = io.BytesIO()
+    img.convert("RGB").save(buf, "JPEG", quality=quality, subsampling=2, progressive=False, optimize=True)
+    return buf.getvalue()
+
+
+def encode_gif(img, size=None):
+    frames, durations = [], []
+    for frame in ImageSequence.Iterator(img):
+        rgb = frame.convert("RGB")
+        frames.append(rgb.resize(size, Image.LANCZOS) if size else rgb)
+        durations.append(frame.info.get("duration", 100))
+    buf = io.BytesIO()
+    frames[0].save(buf, "GIF", save_all=True, append_images=frames[1:], duration=durations,
+                   loop=img.info.get("loop", 0), optimize=True)
+    return buf.getvalue()
+
+
+ENCODERS = {"qoi": encode_qoi, "rle": encode_rle, "bmp": encode_bmp, "jpg": encode_jpg, "gif": encode_gif}
+
+
+def write_header(path, name, data, source, fmt):
+    out = ["// Generated by tools/imageconvert.py from %s (%s). Do not edit."
+           % (os.path.basename(source), fmt.upper()),
+           "#pragma once", "", "#include <Arduino.h>", "",
+           "constexpr uint8_t %s[] = {" % name]
+    for i in range(0, len(data), 16):
+        out.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("image", help="any image Pillow can read")
+    parser.add_argument("output", help=".qoi, .rle, .bmp, .jpg, .gif, or .h for a C array")
+    parser.add_argument("--format", choices=sorted(ENCODERS), help="default: from the extension")
+    parser.add_argument("--size", help="resize to WxH first")
+    parser.add_argument("--name", help="C++ identifier of the array (.h output)")
+    parser.add_argument("--quality", type=int, default=80, help="JPEG quality (default 80)")
+    args = parser.parse_args()
+
+    ext = os.path.splitext(args.output)[1].lstrip(".").lower()
+    fmt = args.format or {"jpeg": "jpg"}.get(ext, ext if ext in ENCODERS else None)
+    if fmt is None:
+        sys.exit("pick a --format for %s" % args.output)
+
+    img = Image.open(args.image)
+    size = tuple(int(v) for v in args.size.lower().split("x")) if args.size else None
+    if fmt == "gif":
+        # Frames are resized one by one
+        data = encode_gif(img, size)
+        if size:
+            img = img.resize(size)
+    else:
+        if size:
+            img = img.resize(size, Image.LANCZOS)
+        if img.width > 0x7FFF or img.height > 0x7FFF:
+            sys.exit("image too large")
+        data = encode_jpg(img, args.quality) if fmt == "jpg" else ENCODERS[fmt](img)
+
+    if ext == "h":
+        base = os.path.splitext(os.path.basename(args.output))[0]
+        name = args.name or "k" + "".join(part[:1].upper() + part[1:] for part in base.replace("-", "_").split("_"))
+        write_header(args.output, name, data, args.image, fmt)
+    else:
+        with open(args.output, "wb") as f:
+            f.write(data)
+    frames = getattr(img, "n_frames", 1) if fmt == "gif" else 1
+    print("%s: %dx%d%s, %d bytes (%.1fx smaller than raw RGB565)"
+          % (args.output, img.width, img.height, " x %d frames" % frames if frames > 1 else "", len(data),
+             img.width * img.height * 2.0 * frames / len(data)))
+
+
+if __name__ == "__main__":
+    main()